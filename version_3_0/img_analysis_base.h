@@ -70,6 +70,56 @@ void ImgEqualizeHist(vx_uint8 input1[IMG_PIXELS],    //
     EqualizeHist<IMG_PIXELS>(input1, input2, output);
 }
 
+/*********************************************************************************************************************/
+/** @brief  Equalizes the histogram of a grayscale video stream in a single pass.
+ * @details The lookup table built from the histogram of frame N-1 is applied to frame N, while the histogram of
+ *          frame N is accumulated. No frame buffer and no second read of the frame are needed. The first frame
+ *          is passed through unchanged. The lookup table can be damped over time to avoid flickering.
+ * @param IMG_PIXELS The amount of pixels for input and output image
+ * @param DAMPING    The weight of the previous lookup table in 1/256 (0 = no temporal damping)
+ * @param input      The grayscale input image in vx_uint8
+ * @param output     The grayscale output image in vx_uint8 with equalized brightness and contrast
+ */
+template <vx_uint32 IMG_PIXELS, vx_uint8 DAMPING>                           //
+void ImgEqualizeHistStream(vx_image_data<vx_uint8, 1> input[IMG_PIXELS],    //
+                           vx_image_data<vx_uint8, 1> output[IMG_PIXELS]) { //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, output);
+    EqualizeHistStream<IMG_PIXELS, DAMPING>(input, output);
+}
+template <vx_uint32 IMG_PIXELS, vx_uint8 DAMPING>                                     //
+void ImgEqualizeHistStream(vx_uint8 input[IMG_PIXELS], vx_uint8 output[IMG_PIXELS]) { //
+#pragma HLS INLINE
+    EqualizeHistStream<IMG_PIXELS, DAMPING>(input, output);
+}
+
+/*********************************************************************************************************************/
+/** @brief  Contrast limited adaptive histogram equalization (CLAHE) of a grayscale video stream.
+ * @details The image is divided into TILES_X * TILES_Y tiles. Their histograms are gathered in one streaming pass,
+ *          clipped at the clip limit and the clipped entries are redistributed. The tile lookup tables of frame N-1
+ *          are applied to frame N, bilinear interpolated between the nearest tile centers (as OpenCV CLAHE).
+ *          The first frame is passed through unchanged.
+ * @param IMG_COLS   The columns of the image (multiple of TILES_X)
+ * @param IMG_ROWS   The rows of the image (multiple of TILES_Y)
+ * @param TILES_X    The amount of tiles in x direction
+ * @param TILES_Y    The amount of tiles in y direction (TILES_X * TILES_Y <= 256)
+ * @param CLIP_LIMIT The clip limit relative to the average bin height in Q4 (e.g. 32 = 2.0, 0 = no clipping)
+ * @param input      The grayscale input image in vx_uint8
+ * @param output     The grayscale output image in vx_uint8
+ */
+template <vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS, vx_uint16 TILES_X, vx_uint16 TILES_Y, vx_uint16 CLIP_LIMIT> //
+void ImgClahe(vx_image_data<vx_uint8, 1> input[IMG_COLS * IMG_ROWS],                                           //
+              vx_image_data<vx_uint8, 1> output[IMG_COLS * IMG_ROWS]) {                                        //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, output);
+    Clahe<IMG_COLS, IMG_ROWS, TILES_X, TILES_Y, CLIP_LIMIT>(input, output);
+}
+template <vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS, vx_uint16 TILES_X, vx_uint16 TILES_Y, vx_uint16 CLIP_LIMIT> //
+void ImgClahe(vx_uint8 input[IMG_COLS * IMG_ROWS], vx_uint8 output[IMG_COLS * IMG_ROWS]) {                     //
+#pragma HLS INLINE
+    Clahe<IMG_COLS, IMG_ROWS, TILES_X, TILES_Y, CLIP_LIMIT>(input, output);
+}
+
 /*********************************************************************************************************************/
 /** @brief  Generates a distribution from an image.
  *  @details This kernel counts the number of occurrences of each pixel value
@@ -148,6 +198,69 @@ void ImgIntegral(vx_uint8 input[IMG_ROWS * IMG_COLS], vx_uint32 output[IMG_ROWS
     Integral<IMG_COLS, IMG_ROWS>(input, output);
 }
 
+/*********************************************************************************************************************/
+/** @brief  Computes the integral image of a vectorized input with a configurable output width.
+ *   @details Each output pixel is the sum of the corresponding input pixel and all other pixels
+ *            above and to the left of it. The overflow policy used is VX_CONVERT_POLICY_WRAP.
+ * @param SrcType     The data type of the input image (vx_uint8, vx_uint16)
+ * @param DstType     The data type of the output image (vx_uint32, vx_uint64)
+ * @param VEC_NUM     The amount of pixels computed in parallel (1 - 8)
+ * @param IMG_COLS    The columns of the image
+ * @param IMG_ROWS    The rows of the image
+ * @param input       The input image
+ * @param output      The output image
+ */
+template <typename SrcType, typename DstType, vx_uint8 VEC_NUM, vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS> //
+void ImgIntegral(vx_image_data<SrcType, VEC_NUM> input[(IMG_COLS * IMG_ROWS) / VEC_NUM],               //
+                 vx_image_data<DstType, VEC_NUM> output[(IMG_COLS * IMG_ROWS) / VEC_NUM]) {            //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, output);
+    IntegralVector<SrcType, DstType, DstType, VEC_NUM, IMG_COLS, IMG_ROWS, false>(input, output, NULL);
+}
+template <typename SrcType, typename DstType, vx_uint8 VEC_NUM, vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS> //
+void ImgIntegral(SrcType input[IMG_COLS * IMG_ROWS],                                                    //
+                 DstType output[IMG_COLS * IMG_ROWS]) {                                                 //
+#pragma HLS INLINE
+    IntegralVector<SrcType, DstType, DstType, VEC_NUM, IMG_COLS, IMG_ROWS, false>( //
+        (vx_image_data<SrcType, VEC_NUM> *)input,                                  //
+        (vx_image_data<DstType, VEC_NUM> *)output, NULL);                          //
+}
+
+/*********************************************************************************************************************/
+/** @brief  Computes the integral image and the integral of the squared pixels of a vectorized input in the same pass.
+ *   @details Box sums and box variances (sum_sqr / N - (sum / N)^2) of any window can then be computed with
+ *            4 reads per image. The overflow policy used is VX_CONVERT_POLICY_WRAP.
+ * @param SrcType     The data type of the input image (vx_uint8, vx_uint16)
+ * @param DstType     The data type of the integral image (vx_uint32, vx_uint64)
+ * @param SqrType     The data type of the squared integral image (vx_uint32, vx_uint64)
+ * @param VEC_NUM     The amount of pixels computed in parallel (1 - 8)
+ * @param IMG_COLS    The columns of the image
+ * @param IMG_ROWS    The rows of the image
+ * @param input       The input image
+ * @param output      The integral image
+ * @param output_sqr  The squared integral image
+ */
+template <typename SrcType, typename DstType, typename SqrType, vx_uint8 VEC_NUM, vx_uint32 IMG_COLS, //
+          vx_uint32 IMG_ROWS>                                                                        //
+void ImgIntegral(vx_image_data<SrcType, VEC_NUM> input[(IMG_COLS * IMG_ROWS) / VEC_NUM],             //
+                 vx_image_data<DstType, VEC_NUM> output[(IMG_COLS * IMG_ROWS) / VEC_NUM],            //
+                 vx_image_data<SqrType, VEC_NUM> output_sqr[(IMG_COLS * IMG_ROWS) / VEC_NUM]) {      //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, output, output_sqr);
+    IntegralVector<SrcType, DstType, SqrType, VEC_NUM, IMG_COLS, IMG_ROWS, true>(input, output, output_sqr);
+}
+template <typename SrcType, typename DstType, typename SqrType, vx_uint8 VEC_NUM, vx_uint32 IMG_COLS, //
+          vx_uint32 IMG_ROWS>                                                                        //
+void ImgIntegral(SrcType input[IMG_COLS * IMG_ROWS],                                                  //
+                 DstType output[IMG_COLS * IMG_ROWS],                                                 //
+                 SqrType output_sqr[IMG_COLS * IMG_ROWS]) {                                           //
+#pragma HLS INLINE
+    IntegralVector<SrcType, DstType, SqrType, VEC_NUM, IMG_COLS, IMG_ROWS, true>( //
+        (vx_image_data<SrcType, VEC_NUM> *)input,                                 //
+        (vx_image_data<DstType, VEC_NUM> *)output,                                //
+        (vx_image_data<SqrType, VEC_NUM> *)output_sqr);                           //
+}
+
 /*********************************************************************************************************************/
 /** @brief Computes the mean pixel value and the standard deviation of the pixels in the input image
  *         (which has a dimension width and height). Use with or without all parameters marked as optional.
@@ -202,6 +315,79 @@ void ImgMeanStdDev(DataType input1[IMG_ROWS * IMG_COLS],             //
     MeanStdDev<DataType, IMG_COLS, IMG_ROWS, vx_false_e>(input1, mean, NULL, NULL);
 }
 
+/*********************************************************************************************************************/
+/** @brief Computes the mean pixel value and the standard deviation of the pixels in the input image in a single pass
+ *         (numerically stable). The image is read only once and can be vectorized.
+ * @param DataType   The data type of the input, which can be 8-bit/16-bit signed/unsigned
+ * @param VEC_NUM    The amount of pixels computed in parallel (1 - 8)
+ * @param IMG_COLS   The amount of columns in the image
+ * @param IMG_ROWS   The amount of rows in the image
+ * @param input      The input image
+ * @param mean       The VX_TYPE_FLOAT32 average pixel value.
+ * @param stddev     The VX_TYPE_FLOAT32 standard deviation of the pixel values.
+ */
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS>     //
+void ImgMeanStdDev(vx_image_data<DataType, VEC_NUM> input[(IMG_ROWS * IMG_COLS) / VEC_NUM], //
+                   vx_image_data<vx_float32, 1> mean[1],                                   //
+                   vx_image_data<vx_float32, 1> stddev[1]) {                               //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, mean, stddev);
+    MeanStdDevSinglePass<DataType, VEC_NUM, IMG_COLS, IMG_ROWS, 1, 1, false>(input, mean, stddev, NULL, NULL);
+}
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS> //
+void ImgMeanStdDev(DataType input[IMG_ROWS * IMG_COLS],                                //
+                   vx_float32 mean[1],                                                 //
+                   vx_float32 stddev[1]) {                                             //
+#pragma HLS INLINE
+    MeanStdDevSinglePass<DataType, VEC_NUM, IMG_COLS, IMG_ROWS, 1, 1, false>( //
+        (vx_image_data<DataType, VEC_NUM> *)input,                            //
+        (vx_image_data<vx_float32, 1> *)mean,                                 //
+        (vx_image_data<vx_float32, 1> *)stddev, NULL, NULL);                  //
+}
+
+/*********************************************************************************************************************/
+/** @brief Computes the mean pixel value and the standard deviation of the pixels in the input image and of its tiles
+ *         in a single pass (numerically stable). Set TILES_X = 1 and TILE_ROWS = 1 to get the statistics per row.
+ * @param DataType    The data type of the input, which can be 8-bit/16-bit signed/unsigned
+ * @param VEC_NUM     The amount of pixels computed in parallel (1 - 8)
+ * @param IMG_COLS    The amount of columns in the image
+ * @param IMG_ROWS    The amount of rows in the image
+ * @param TILES_X     The amount of tiles in x direction
+ * @param TILE_ROWS   The amount of rows of a tile
+ * @param input       The input image
+ * @param mean        The VX_TYPE_FLOAT32 average pixel value.
+ * @param stddev      The VX_TYPE_FLOAT32 standard deviation of the pixel values.
+ * @param tile_mean   The VX_TYPE_FLOAT32 average pixel values of the tiles (row-major order of the tiles)
+ * @param tile_stddev The VX_TYPE_FLOAT32 standard deviations of the tiles (row-major order of the tiles)
+ */
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS,           //
+          vx_uint16 TILES_X, vx_uint16 TILE_ROWS>                                                //
+void ImgMeanStdDev(vx_image_data<DataType, VEC_NUM> input[(IMG_ROWS * IMG_COLS) / VEC_NUM],      //
+                   vx_image_data<vx_float32, 1> mean[1],                                         //
+                   vx_image_data<vx_float32, 1> stddev[1],                                       //
+                   vx_image_data<vx_float32, 1> tile_mean[TILES_X * (IMG_ROWS / TILE_ROWS)],     //
+                   vx_image_data<vx_float32, 1> tile_stddev[TILES_X * (IMG_ROWS / TILE_ROWS)]) { //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, mean, stddev, tile_mean, tile_stddev);
+    MeanStdDevSinglePass<DataType, VEC_NUM, IMG_COLS, IMG_ROWS, TILES_X, TILE_ROWS, true>( //
+        input, mean, stddev, tile_mean, tile_stddev);                                      //
+}
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS, //
+          vx_uint16 TILES_X, vx_uint16 TILE_ROWS>                                      //
+void ImgMeanStdDev(DataType input[IMG_ROWS * IMG_COLS],                                //
+                   vx_float32 mean[1],                                                 //
+                   vx_float32 stddev[1],                                               //
+                   vx_float32 tile_mean[TILES_X * (IMG_ROWS / TILE_ROWS)],             //
+                   vx_float32 tile_stddev[TILES_X * (IMG_ROWS / TILE_ROWS)]) {         //
+#pragma HLS INLINE
+    MeanStdDevSinglePass<DataType, VEC_NUM, IMG_COLS, IMG_ROWS, TILES_X, TILE_ROWS, true>( //
+        (vx_image_data<DataType, VEC_NUM> *)input,                                         //
+        (vx_image_data<vx_float32, 1> *)mean,                                              //
+        (vx_image_data<vx_float32, 1> *)stddev,                                            //
+        (vx_image_data<vx_float32, 1> *)tile_mean,                                         //
+        (vx_image_data<vx_float32, 1> *)tile_stddev);                                      //
+}
+
 /*********************************************************************************************************************/
 /** @brief Finds the minimum and maximum values in an image and a location for each. If the input
  *         image has several minimums/maximums, the kernel returns all of them. Use with or without
@@ -276,6 +462,169 @@ void ImgMinMaxLocation(DataType input[IMG_ROWS * IMG_COLS], //
         (input, min_val, max_val, NULL, NULL, NULL, NULL);                 //
 }
 
+/*********************************************************************************************************************/
+/** @brief Finds the minimum and maximum values in a vectorized image and a location for each. Each vector lane
+ *         tracks its own minimum/maximum and the lanes are merged by a tree reduction at the end of the image.
+ *         The locations are returned in raster order, like in the function without vectorization.
+ * @param DataType  The data type of the input, which can be 8-bit/16-bit signed/unsigned
+ * @param VEC_NUM   The amount of pixels computed in parallel (1 - 8)
+ * @param IMG_COLS  The amount of columns in the image
+ * @param IMG_ROWS  The amount of rows in the image
+ * @param CAPACITY  The capacity of the arrays that store the locations (min_loc, max_loc)
+ * @param input     The input image
+ * @param min_val   The minimum value in the image, which corresponds to the type of the input.
+ * @param max_val   The maximum value in the image, which corresponds to the type of the input.
+ * @param min_loc   The first minimum VX_TYPE_COORDINATES2D locations, up to the capacity of the array.
+ * @param max_loc   The first maximum VX_TYPE_COORDINATES2D locations, up to the capacity of the array.
+ * @param min_count The number of detected minimums (up to the capacity of the array).
+ * @param max_count The number of detected maximums (up to the capacity of the array).
+ */
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS, vx_uint16 CAPACITY> //
+void ImgMinMaxLocation(vx_image_data<DataType, VEC_NUM> input[(IMG_ROWS * IMG_COLS) / VEC_NUM],            //
+                       vx_image_data<DataType, 1> min_val[1],                                              //
+                       vx_image_data<DataType, 1> max_val[1],                                              //
+                       vx_image_data<vx_uint16, 2> min_loc[CAPACITY],                                      //
+                       vx_image_data<vx_uint16, 2> max_loc[CAPACITY],                                      //
+                       vx_image_data<vx_uint16, 1> min_count[1],                                           //
+                       vx_image_data<vx_uint16, 1> max_count[1]) {                                         //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, min_val, max_val, min_loc, max_loc, min_count, max_count);
+    MinMaxLocationVector<DataType, VEC_NUM, IMG_COLS, IMG_ROWS, CAPACITY, vx_true_e> //
+        (input, min_val, max_val, min_loc, max_loc, min_count, max_count);           //
+}
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS, vx_uint16 CAPACITY> //
+void ImgMinMaxLocation(DataType input[IMG_ROWS * IMG_COLS],                                                //
+                       DataType min_val[1],                                                                //
+                       DataType max_val[1],                                                                //
+                       vx_image_data<vx_uint16, 2> min_loc[CAPACITY],                                      //
+                       vx_image_data<vx_uint16, 2> max_loc[CAPACITY],                                      //
+                       vx_uint16 min_count[1],                                                             //
+                       vx_uint16 max_count[1]) {                                                           //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(min_loc, max_loc);
+    MinMaxLocationVector<DataType, VEC_NUM, IMG_COLS, IMG_ROWS, CAPACITY, vx_true_e>                        //
+        ((vx_image_data<DataType, VEC_NUM> *)input, (vx_image_data<DataType, 1> *)min_val,                  //
+         (vx_image_data<DataType, 1> *)max_val, min_loc, max_loc, (vx_image_data<vx_uint16, 1> *)min_count, //
+         (vx_image_data<vx_uint16, 1> *)max_count);                                                         //
+}
+
+/*********************************************************************************************************************/
+/** @brief Finds the minimum and maximum values in a vectorized image. Each vector lane tracks its own
+ *         minimum/maximum and the lanes are merged by a tree reduction at the end of the image.
+ * @param DataType  The data type of the input, which can be 8-bit/16-bit signed/unsigned
+ * @param VEC_NUM   The amount of pixels computed in parallel (1 - 8)
+ * @param IMG_COLS  The amount of columns in the image
+ * @param IMG_ROWS  The amount of rows in the image
+ * @param input     The input image
+ * @param min_val   The minimum value in the image, which corresponds to the type of the input.
+ * @param max_val   The maximum value in the image, which corresponds to the type of the input.
+ */
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS>          //
+void ImgMinMaxLocation(vx_image_data<DataType, VEC_NUM> input[(IMG_ROWS * IMG_COLS) / VEC_NUM], //
+                       vx_image_data<DataType, 1> min_val[1],                                   //
+                       vx_image_data<DataType, 1> max_val[1]) {                                 //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, min_val, max_val);
+    MinMaxLocationVector<DataType, VEC_NUM, IMG_COLS, IMG_ROWS, (vx_uint16)1, vx_false_e> //
+        (input, min_val, max_val, NULL, NULL, NULL, NULL);                                //
+}
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS>
+void ImgMinMaxLocation(DataType input[IMG_ROWS * IMG_COLS], //
+                       DataType min_val[1],                 //
+                       DataType max_val[1]) {               //
+#pragma HLS INLINE
+    MinMaxLocationVector<DataType, VEC_NUM, IMG_COLS, IMG_ROWS, (vx_uint16)1, vx_false_e>  //
+        ((vx_image_data<DataType, VEC_NUM> *)input, (vx_image_data<DataType, 1> *)min_val, //
+         (vx_image_data<DataType, 1> *)max_val, NULL, NULL, NULL, NULL);                   //
+}
+
+/*********************************************************************************************************************/
+/** @brief Single-pass connected component labeling of a binary image (e.g. after thresholding). Only one line of labels
+ *         and a union-find table are stored. Outputs the area, bounding box and centroid of every component.
+ * @param IMG_COLS     The amount of columns in the image
+ * @param IMG_ROWS     The amount of rows in the image
+ * @param MAX_LABELS   The size of the label table (MAX_LABELS - 1 labels)
+ * @param CONNECTIVITY The neighborhood of a pixel (4 or 8)
+ * @param input        The binary input image (pixels unequal to 0 are foreground)
+ * @param blobs        The records of the components in raster order of their first pixel (see BlobRecord)
+ * @param blob_count   The amount of components
+ */
+template <vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint16 MAX_LABELS, vx_uint8 CONNECTIVITY>          //
+void ImgConnectedComponents(vx_image_data<vx_uint8, 1> input[IMG_COLS * IMG_ROWS],                      //
+                            vx_image_data<vx_uint32, HIFLIPVX::BLOB_RECORD_SIZE> blobs[MAX_LABELS - 1], //
+                            vx_image_data<vx_uint16, 1> blob_count[1]) {                                //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, blobs, blob_count);
+    ConnectedComponents<IMG_COLS, IMG_ROWS, MAX_LABELS, CONNECTIVITY>(input, blobs, blob_count);
+}
+template <vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint16 MAX_LABELS, vx_uint8 CONNECTIVITY> //
+void ImgConnectedComponents(vx_uint8 input[IMG_COLS * IMG_ROWS],                               //
+                            vx_uint32 blobs[(MAX_LABELS - 1) * HIFLIPVX::BLOB_RECORD_SIZE],    //
+                            vx_uint16 blob_count[1]) {                                         //
+#pragma HLS INLINE
+    ConnectedComponents<IMG_COLS, IMG_ROWS, MAX_LABELS, CONNECTIVITY>( //
+        (vx_image_data<vx_uint8, 1> *)input,                           //
+        (vx_image_data<vx_uint32, HIFLIPVX::BLOB_RECORD_SIZE> *)blobs, //
+        (vx_image_data<vx_uint16, 1> *)blob_count);                    //
+}
+
+/*********************************************************************************************************************/
+/** @brief Computes the raw moments up to order 2 or 3 of a gray or mask image in a single pass (pixel value is the
+ *         weight). The centroid (m10 / m00, m01 / m00) and the orientation follow from the moments.
+ * @param SrcType   The data type of the input (vx_uint8)
+ * @param VEC_NUM   The amount of pixels computed in parallel (1 - 8)
+ * @param IMG_COLS  The amount of columns in the image
+ * @param IMG_ROWS  The amount of rows in the image
+ * @param ORDER     The maximum order of the moments (2 or 3)
+ * @param input     The input image
+ * @param moments   The moments in the order of ImageMoment (6 for order 2, 10 for order 3)
+ */
+template <typename SrcType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint8 ORDER> //
+void ImgMoments(vx_image_data<SrcType, VEC_NUM> input[(IMG_COLS * IMG_ROWS) / VEC_NUM],               //
+                vx_image_data<vx_uint64, 1> moments[((ORDER + 1) * (ORDER + 2)) / 2]) {               //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, moments);
+    MomentsIntensity<SrcType, VEC_NUM, IMG_COLS, IMG_ROWS, ORDER>(input, moments);
+}
+template <typename SrcType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint8 ORDER> //
+void ImgMoments(SrcType input[IMG_COLS * IMG_ROWS],                                                   //
+                vx_uint64 moments[((ORDER + 1) * (ORDER + 2)) / 2]) {                                 //
+#pragma HLS INLINE
+    MomentsIntensity<SrcType, VEC_NUM, IMG_COLS, IMG_ROWS, ORDER>( //
+        (vx_image_data<SrcType, VEC_NUM> *)input,                  //
+        (vx_image_data<vx_uint64, 1> *)moments);                   //
+}
+
+/*********************************************************************************************************************/
+/** @brief Computes the raw moments up to order 2 or 3 of every label of a label image in a single pass (e.g. the
+ *         components of a mask). Each pixel has the weight 1. Pixels with a label >= LABELS are ignored.
+ * @param SrcType   The data type of the labels (vx_uint8, vx_uint16)
+ * @param VEC_NUM   The amount of pixels computed in parallel (1 - 8)
+ * @param IMG_COLS  The amount of columns in the image
+ * @param IMG_ROWS  The amount of rows in the image
+ * @param ORDER     The maximum order of the moments (2 or 3)
+ * @param LABELS    The amount of labels
+ * @param input     The label image
+ * @param moments   The moments of each label in the order of ImageMoment (label-major)
+ */
+template <typename SrcType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint8 ORDER, //
+          vx_uint16 LABELS>                                                                           //
+void ImgMoments(vx_image_data<SrcType, VEC_NUM> input[(IMG_COLS * IMG_ROWS) / VEC_NUM],               //
+                vx_image_data<vx_uint64, 1> moments[LABELS * (((ORDER + 1) * (ORDER + 2)) / 2)]) {    //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, moments);
+    MomentsLabels<SrcType, VEC_NUM, IMG_COLS, IMG_ROWS, ORDER, LABELS>(input, moments);
+}
+template <typename SrcType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint8 ORDER, //
+          vx_uint16 LABELS>                                                                           //
+void ImgMoments(SrcType input[IMG_COLS * IMG_ROWS],                                                   //
+                vx_uint64 moments[LABELS * (((ORDER + 1) * (ORDER + 2)) / 2)]) {                      //
+#pragma HLS INLINE
+    MomentsLabels<SrcType, VEC_NUM, IMG_COLS, IMG_ROWS, ORDER, LABELS>( //
+        (vx_image_data<SrcType, VEC_NUM> *)input,                       //
+        (vx_image_data<vx_uint64, 1> *)moments);                        //
+}
+
 /*********************************************************************************************************************/
 /** @brief  Implements the Table Lookup Image Kernel. The output image dimensions should be the
  *          same as the dimensions of the input image.
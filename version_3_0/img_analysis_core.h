@@ -310,6 +310,108 @@ void EqualizeHist(vx_uint8 input1[IMG_PIXELS], vx_uint8 input2[IMG_PIXELS], vx_u
     }
 }
 
+/***************************************************************************************************************************************************/
+/** @brief Equalizes the histogram of a video stream in a single pass. The lookup table computed from the previous frame is applied to the
+ *         current frame while the histogram of the current frame is accumulated. The first frame is passed through unchanged. The state is
+ *         kept between the calls (one state per template instance).
+ * @param IMG_PIXELS The amount of pixels for input and output image
+ * @param DAMPING    The weight of the previous lookup table in 1/256 (0 = no temporal damping, 255 = slowest adaption)
+ * @param input      The grayscale input image in VX_DF_IMAGE_U8
+ * @param output     The grayscale output image in VX_DF_IMAGE_U8
+ */
+template <vx_uint32 IMG_PIXELS, vx_uint8 DAMPING>                        //
+void EqualizeHistStream(vx_image_data<vx_uint8, 1> input[IMG_PIXELS],    //
+                        vx_image_data<vx_uint8, 1> output[IMG_PIXELS]) { //
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint32 BINS = 256;
+    const vx_uint32 SHIFT = 24;
+    const vx_uint32 FRACTION = 8;
+    const vx_uint32 WEIGHT = 1 << FRACTION;
+
+    // Histogram of the current frame and lookup table of the previous frame (fixed-point with FRACTION bits for the damping)
+    static vx_uint32 LUTA[BINS], LUTB[BINS];
+    static vx_uint16 LUT[BINS];
+    static bool first_frame = true;
+
+    // Variables
+    vx_uint8 pre_bin = 0, cur_bin = 0;
+    vx_uint32 pre_val = 0, cur_val = 0;
+    vx_uint8 min_bin = std::numeric_limits<vx_uint8>::max();
+
+    // Identity lookup table for the first frame
+    if (first_frame) {
+        for (vx_uint32 i = 0; i < BINS; i++) {
+#pragma HLS PIPELINE II = 1
+            LUT[i] = static_cast<vx_uint16>(i << FRACTION);
+            LUTA[i] = 0;
+            LUTB[i] = 0;
+        }
+        first_frame = false;
+    }
+
+    // Apply the lookup table and compute the histogram
+    for (vx_uint32 i = 0; i < IMG_PIXELS + 1; i++) {
+#pragma HLS PIPELINE II = 1
+
+        // Get the input data and write the output data
+        if (i < IMG_PIXELS) {
+            vx_image_data<vx_uint8, 1> src = input[i];
+            vx_image_data<vx_uint8, 1> dst;
+            cur_bin = src.pixel[0];
+            GenerateDmaSignal<vx_uint8, 1>((i == 0), (i == IMG_PIXELS - 1), dst);
+            dst.pixel[0] = static_cast<vx_uint8>((LUT[cur_bin] + (WEIGHT >> 1)) >> FRACTION);
+            output[i] = dst;
+        }
+
+        // Compute minimum bin entry
+        min_bin = MIN(min_bin, cur_bin);
+
+        // Read current bin & write previous bin
+        if (i % 2 == 0) {
+            cur_val = LUTA[cur_bin];
+            LUTB[pre_bin] = pre_val;
+        } else {
+            cur_val = LUTB[cur_bin];
+            LUTA[pre_bin] = pre_val;
+        }
+
+        // Update to store in next iteration
+        cur_val++;
+        pre_bin = cur_bin;
+        pre_val = cur_val;
+    }
+
+    // Pre-compute parts of the cdf computation (a flat image keeps the identity mapping)
+    const vx_uint32 cdf_min = LUTA[min_bin] + LUTB[min_bin];
+    const vx_uint32 divisor = IMG_PIXELS - cdf_min;
+    const vx_uint64 multiplicant = (divisor > 0) ? (static_cast<vx_uint64>((255u << SHIFT) / divisor)) : (0);
+
+    // Update the lookup table for the next frame and reset the histogram
+    for (vx_uint32 i = 0, cdf_i = 0; i < BINS; i++) {
+#pragma HLS PIPELINE II = 1
+
+        // Cumulative distribution function
+        cdf_i += LUTA[i] + LUTB[i];
+        LUTA[i] = 0;
+        LUTB[i] = 0;
+
+        // Equalized histogram function
+        const vx_uint64 cdf = static_cast<vx_uint64>((cdf_i > cdf_min) ? (cdf_i - cdf_min) : (0));
+        const vx_uint32 eqhist = (divisor > 0) ? (static_cast<vx_uint32>((cdf * multiplicant) >> SHIFT)) : (i);
+
+        // Temporal damping with the lookup table of the previous frame
+        const vx_uint32 damped = static_cast<vx_uint32>(LUT[i]) * DAMPING + (eqhist << FRACTION) * (WEIGHT - DAMPING);
+        LUT[i] = static_cast<vx_uint16>((damped + (WEIGHT >> 1)) >> FRACTION);
+    }
+}
+template <vx_uint32 IMG_PIXELS, vx_uint8 DAMPING>                                  //
+void EqualizeHistStream(vx_uint8 input[IMG_PIXELS], vx_uint8 output[IMG_PIXELS]) { //
+#pragma HLS INLINE
+    EqualizeHistStream<IMG_PIXELS, DAMPING>((vx_image_data<vx_uint8, 1> *)input, (vx_image_data<vx_uint8, 1> *)output);
+}
+
 /***************************************************************************************************************************************************/
 // Compile time checks for histogram function
 template <typename SrcType, vx_uint32 IMG_ROWS, vx_uint32 IMG_COLS, vx_uint8 VEC_NUM, //
@@ -523,6 +625,202 @@ void Histogram(SrcType input[IMG_ROWS * IMG_COLS], vx_uint32 output[DIST_BINS])
     }
 }
 
+/***************************************************************************************************************************************************/
+/** @brief Contrast limited adaptive histogram equalization (CLAHE) of a video stream. The histograms of all tiles are gathered in one streaming
+ *         pass. After the frame, each histogram is clipped, the clipped entries are redistributed and the tile lookup tables are computed. They
+ *         are applied to the next frame, bilinear interpolated between the 4 nearest tile centers. The first frame is passed through unchanged.
+ *         The state is kept between the calls (one state per template instance).
+ * @param IMG_COLS   The columns of the image
+ * @param IMG_ROWS   The rows of the image
+ * @param TILES_X    The amount of tiles in x direction
+ * @param TILES_Y    The amount of tiles in y direction
+ * @param CLIP_LIMIT The clip limit relative to the average bin height in Q4 (e.g. 32 = 2.0, 0 = no clipping)
+ * @param input      The grayscale input image in VX_DF_IMAGE_U8
+ * @param output     The grayscale output image in VX_DF_IMAGE_U8
+ */
+template <vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS, vx_uint16 TILES_X, vx_uint16 TILES_Y, vx_uint16 CLIP_LIMIT> //
+void Clahe(vx_image_data<vx_uint8, 1> input[IMG_COLS * IMG_ROWS],                                              //
+           vx_image_data<vx_uint8, 1> output[IMG_COLS * IMG_ROWS]) {                                           //
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint32 BINS = 256;
+    const vx_uint32 IMG_PIXELS = IMG_COLS * IMG_ROWS;
+    const vx_uint32 TILE_COLS = IMG_COLS / TILES_X;
+    const vx_uint32 TILE_ROWS = IMG_ROWS / TILES_Y;
+    const vx_uint32 TILE_PIXELS = TILE_COLS * TILE_ROWS;
+    const vx_uint32 TILES = static_cast<vx_uint32>(TILES_X) * static_cast<vx_uint32>(TILES_Y);
+    const vx_uint32 HIST_BINS = TILES * BINS;
+    const vx_uint32 BANK_COLS = (TILES_X + 1) / 2;
+    const vx_uint32 BANK_BINS = BANK_COLS * ((TILES_Y + 1) / 2) * BINS;
+    const vx_uint32 CLIP_VALUE = (CLIP_LIMIT > 0) ? (MAX((CLIP_LIMIT * TILE_PIXELS) / (16 * BINS), 1)) : (TILE_PIXELS);
+    const vx_uint32 SHIFT = 24;
+    const vx_uint64 LUT_SCALE = (static_cast<vx_uint64>(255) << SHIFT) / TILE_PIXELS;
+    const vx_uint32 RECIP_X = (256 << 16) / (2 * TILE_COLS);
+    const vx_uint32 RECIP_Y = (256 << 16) / (2 * TILE_ROWS);
+
+    // Check function parameters/types
+    STATIC_ASSERT((IMG_COLS % TILES_X) == 0 && (IMG_ROWS % TILES_Y) == 0, image_size_must_be_multiple_of_tiles);
+    STATIC_ASSERT((TILES_X >= 1) && (TILES_Y >= 1) && (HIST_BINS <= 65536), tiles_must_be_between_1_and_256);
+    STATIC_ASSERT((TILE_COLS >= 2) && (TILE_ROWS >= 2), tiles_must_be_at_least_2x2_pixels);
+
+    // Histograms of the current frame (2 banks for the read-modify-write, see HistogramUpdateEntry)
+    static vx_uint32 LUTA[HIST_BINS], LUTB[HIST_BINS];
+
+    // Lookup tables of the previous frame (4 banks for the even/odd tile columns/rows of the bilinear interpolation)
+    static vx_uint8 LUT[4][BANK_BINS];
+#pragma HLS array_partition variable = LUT complete dim = 1
+    static bool first_frame = true;
+
+    // Identity lookup tables for the first frame
+    if (first_frame) {
+        for (vx_uint32 i = 0; i < BANK_BINS; i++) {
+#pragma HLS PIPELINE II = 1
+            for (vx_uint16 b = 0; b < 4; b++) {
+#pragma HLS unroll
+                LUT[b][i] = static_cast<vx_uint8>(i % BINS);
+            }
+        }
+        for (vx_uint32 i = 0; i < HIST_BINS; i++) {
+#pragma HLS PIPELINE II = 1
+            LUTA[i] = 0;
+            LUTB[i] = 0;
+        }
+        first_frame = false;
+    }
+
+    // Variables for the histogram
+    vx_uint16 pre_bin = 0;
+    vx_uint32 pre_val = 0;
+
+    // Tile of the histogram (tile_*) and upper left tile center of the interpolation (center_*) with its distance in half pixels (frac_*)
+    vx_uint16 tile_x = 0, tile_y = 0;
+    vx_uint32 tile_col = 0, tile_row = 0;
+    vx_int32 center_x = -1, center_y = -1;
+    vx_uint32 frac_x = TILE_COLS + 1, frac_y = TILE_ROWS + 1;
+
+    // Apply the lookup tables and compute the histograms of all tiles
+    for (vx_uint32 i = 0, x = 0; i < IMG_PIXELS + 1; i++) {
+#pragma HLS PIPELINE II = 1
+        vx_uint8 pixel = 0;
+
+        if (i < IMG_PIXELS) {
+            vx_image_data<vx_uint8, 1> src = input[i];
+            vx_image_data<vx_uint8, 1> dst;
+            pixel = src.pixel[0];
+
+            // Tiles of the 4 nearest tile centers (clamped at the borders)
+            const vx_uint32 x1 = static_cast<vx_uint32>(MAX(center_x, 0));
+            const vx_uint32 x2 = static_cast<vx_uint32>(MIN(center_x + 1, TILES_X - 1));
+            const vx_uint32 y1 = static_cast<vx_uint32>(MAX(center_y, 0));
+            const vx_uint32 y2 = static_cast<vx_uint32>(MIN(center_y + 1, TILES_Y - 1));
+
+            // Interpolation weights (Q8)
+            const vx_uint32 wx = (frac_x * RECIP_X) >> 16;
+            const vx_uint32 wy = (frac_y * RECIP_Y) >> 16;
+
+            // Read the 4 lookup tables (one per bank)
+            vx_uint32 value[4];
+            for (vx_uint16 b = 0; b < 4; b++) {
+#pragma HLS unroll
+                const vx_uint32 tx = ((x1 & 1) == (b & 1)) ? (x1) : (x2);
+                const vx_uint32 ty = ((y1 & 1) == (b >> 1)) ? (y1) : (y2);
+                value[b] = LUT[b][((ty >> 1) * BANK_COLS + (tx >> 1)) * BINS + pixel];
+            }
+
+            // Bilinear interpolation
+            const vx_uint32 top = value[(x1 & 1) | ((y1 & 1) << 1)] * (256 - wx) + value[(x2 & 1) | ((y1 & 1) << 1)] * wx;
+            const vx_uint32 bottom = value[(x1 & 1) | ((y2 & 1) << 1)] * (256 - wx) + value[(x2 & 1) | ((y2 & 1) << 1)] * wx;
+            const vx_uint32 result = (top * (256 - wy) + bottom * wy + (1 << 15)) >> 16;
+
+            // Write output
+            GenerateDmaSignal<vx_uint8, 1>((i == 0), (i == IMG_PIXELS - 1), dst);
+            dst.pixel[0] = static_cast<vx_uint8>(result);
+            output[i] = dst;
+        }
+
+        // Histogram of the tile
+        const vx_uint16 bin = static_cast<vx_uint16>((tile_y * TILES_X + tile_x) * BINS + pixel);
+        const vx_bool ignore = (i < IMG_PIXELS) ? (vx_false_e) : (vx_true_e);
+        HistogramUpdateEntry<vx_uint16, IMG_PIXELS, HIST_BINS, HIST_BINS, 0> //
+            (i, bin, LUTA, LUTB, pre_bin, pre_val, ignore);                  //
+
+        // Update the column counters
+        frac_x += 2;
+        if (frac_x >= 2 * TILE_COLS) {
+            frac_x -= 2 * TILE_COLS;
+            center_x++;
+        }
+        tile_col++;
+        if (tile_col == TILE_COLS) {
+            tile_col = 0;
+            tile_x++;
+        }
+
+        // Update the row counters at the end of a row
+        x++;
+        if (x == IMG_COLS) {
+            x = 0;
+            tile_x = 0;
+            center_x = -1;
+            frac_x = TILE_COLS + 1;
+            frac_y += 2;
+            if (frac_y >= 2 * TILE_ROWS) {
+                frac_y -= 2 * TILE_ROWS;
+                center_y++;
+            }
+            tile_row++;
+            if (tile_row == TILE_ROWS) {
+                tile_row = 0;
+                tile_y++;
+            }
+        }
+    }
+
+    // Compute the lookup tables of all tiles for the next frame
+    for (vx_uint32 t = 0; t < TILES; t++) {
+        vx_uint32 HIST[BINS];
+        vx_uint32 clipped = 0;
+
+        // Clip the histogram and reset it for the next frame
+        for (vx_uint32 i = 0; i < BINS; i++) {
+#pragma HLS PIPELINE II = 1
+            const vx_uint32 value = LUTA[t * BINS + i] + LUTB[t * BINS + i];
+            LUTA[t * BINS + i] = 0;
+            LUTB[t * BINS + i] = 0;
+            clipped += (value > CLIP_VALUE) ? (value - CLIP_VALUE) : (0);
+            HIST[i] = MIN(value, CLIP_VALUE);
+        }
+
+        // Redistribute the clipped entries equally, the residual to every residual_step-th bin
+        const vx_uint32 batch = clipped / BINS;
+        vx_uint32 residual = clipped - batch * BINS;
+        const vx_uint32 residual_step = (residual > 0) ? (MAX(BINS / residual, 1)) : (BINS);
+
+        // Cumulative distribution function and lookup table
+        const vx_uint32 tx = t % TILES_X, ty = t / TILES_X;
+        const vx_uint32 bank = (tx & 1) | ((ty & 1) << 1);
+        const vx_uint32 offset = ((ty >> 1) * BANK_COLS + (tx >> 1)) * BINS;
+        for (vx_uint32 i = 0, cdf = 0, step = 0; i < BINS; i++) {
+#pragma HLS PIPELINE II = 1
+            cdf += HIST[i] + batch;
+            if ((step == 0) && (residual > 0)) {
+                cdf++;
+                residual--;
+            }
+            step = (step + 1 == residual_step) ? (0) : (step + 1);
+            const vx_uint64 value = (static_cast<vx_uint64>(cdf) * LUT_SCALE + (1 << (SHIFT - 1))) >> SHIFT;
+            LUT[bank][offset + i] = static_cast<vx_uint8>(MIN(value, static_cast<vx_uint64>(255)));
+        }
+    }
+}
+template <vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS, vx_uint16 TILES_X, vx_uint16 TILES_Y, vx_uint16 CLIP_LIMIT> //
+void Clahe(vx_uint8 input[IMG_COLS * IMG_ROWS], vx_uint8 output[IMG_COLS * IMG_ROWS]) {                        //
+#pragma HLS INLINE
+    Clahe<IMG_COLS, IMG_ROWS, TILES_X, TILES_Y, CLIP_LIMIT>((vx_image_data<vx_uint8, 1> *)input,
+                                                            (vx_image_data<vx_uint8, 1> *)output);
+}
+
 /******************************************************************************/
 /* Calculate Contrast Factor k */
 /******************************************************************************/
@@ -806,6 +1104,88 @@ void Integral(vx_uint8 input[IMG_COLS * IMG_ROWS],            //
     }
 }
 
+/***************************************************************************************************************************************************/
+/** @brief Computes the integral image and optionally the integral of the squared pixels of a vectorized input image. The overflow policy is
+ *         VX_CONVERT_POLICY_WRAP, the output types define when it occurs.
+ * @param SrcType     The data type of the input image (vx_uint8, vx_uint16)
+ * @param DstType     The data type of the integral image (vx_uint32, vx_uint64)
+ * @param SqrType     The data type of the squared integral image (vx_uint32, vx_uint64)
+ * @param VEC_NUM     The amount of pixels computed in parallel (1 - 8)
+ * @param IMG_COLS    The columns of the image
+ * @param IMG_ROWS    The rows of the image
+ * @param SQUARED     Computes the squared integral image, if true
+ * @param input       The input image
+ * @param output      The integral image
+ * @param output_sqr  The squared integral image (only used if SQUARED)
+ */
+template <typename SrcType, typename DstType, typename SqrType, vx_uint8 VEC_NUM, vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS, bool SQUARED> //
+void IntegralVector(vx_image_data<SrcType, VEC_NUM> input[(IMG_COLS * IMG_ROWS) / VEC_NUM],                                                //
+                    vx_image_data<DstType, VEC_NUM> output[(IMG_COLS * IMG_ROWS) / VEC_NUM],                                               //
+                    vx_image_data<SqrType, VEC_NUM> output_sqr[(IMG_COLS * IMG_ROWS) / VEC_NUM]) {                                         //
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint32 VEC_COLS = IMG_COLS / VEC_NUM;
+
+    // Check function parameters/types
+    const bool allowed_src = std::is_same<SrcType, vx_uint8>::value || std::is_same<SrcType, vx_uint16>::value;
+    const bool allowed_dst = std::is_same<DstType, vx_uint32>::value || std::is_same<DstType, vx_uint64>::value;
+    const bool allowed_sqr = std::is_same<SqrType, vx_uint32>::value || std::is_same<SqrType, vx_uint64>::value;
+    STATIC_ASSERT(allowed_src, source_type_must_be_uint8_or_uint16);
+    STATIC_ASSERT(allowed_dst && allowed_sqr, destination_type_must_be_uint32_or_uint64);
+    STATIC_ASSERT((VEC_NUM >= 1) && (VEC_NUM <= 8), vec_num_must_be_between_1_and_8);
+    STATIC_ASSERT((IMG_COLS % VEC_NUM) == 0, columns_must_be_multiple_of_vec_num);
+
+    // Buffers 1 row of the integral images
+    DstType buffer[VEC_NUM][VEC_COLS];
+    SqrType buffer_sqr[VEC_NUM][VEC_COLS];
+#pragma HLS array_partition variable = buffer complete dim = 1
+#pragma HLS array_partition variable = buffer_sqr complete dim = 1
+
+    // Compute integral on image
+    for (vx_uint32 y = 0; y < IMG_ROWS; y++) {
+        DstType sum_row = 0;
+        SqrType sum_row_sqr = 0;
+        for (vx_uint32 x = 0; x < VEC_COLS; x++) {
+#pragma HLS PIPELINE II = 1
+            vx_image_data<DstType, VEC_NUM> dst;
+            vx_image_data<SqrType, VEC_NUM> dst_sqr;
+
+            // Read input
+            vx_image_data<SrcType, VEC_NUM> src = input[y * VEC_COLS + x];
+
+            // Prefix sums of the current row (adder chain over the vector)
+            for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+                const SrcType pixel = src.pixel[v];
+                sum_row += static_cast<DstType>(pixel);
+                sum_row_sqr += static_cast<SqrType>(pixel) * static_cast<SqrType>(pixel);
+
+                // Compute the integral pixels and buffer them for the next row
+                const DstType sum_area = (y > 0) ? (static_cast<DstType>(sum_row + buffer[v][x])) : (sum_row);
+                const SqrType sum_area_sqr = (y > 0) ? (static_cast<SqrType>(sum_row_sqr + buffer_sqr[v][x])) : (sum_row_sqr);
+                buffer[v][x] = sum_area;
+                dst.pixel[v] = sum_area;
+                if (SQUARED) {
+                    buffer_sqr[v][x] = sum_area_sqr;
+                    dst_sqr.pixel[v] = sum_area_sqr;
+                }
+            }
+
+            // Set user(SOF) & last(EOF)
+            const bool first = (x == 0 && y == 0);
+            const bool last = (x == (VEC_COLS - 1) && y == (IMG_ROWS - 1));
+            GenerateDmaSignal<DstType, VEC_NUM>(first, last, dst);
+            GenerateDmaSignal<SqrType, VEC_NUM>(first, last, dst_sqr);
+
+            // Write output
+            output[y * VEC_COLS + x] = dst;
+            if (SQUARED)
+                output_sqr[y * VEC_COLS + x] = dst_sqr;
+        }
+    }
+}
+
 /***************************************************************************************************************************************************/
 /** @brief Computes the mean pixel value of the pixels in the input image.
  * @param DataType    The data type of the input, which can be 8-bit/16-bit signed/unsigned
@@ -1041,6 +1421,168 @@ void MeanStdDev(DataType input1[IMG_ROWS * IMG_COLS], vx_float32 mean[1], DataTy
     }
 }
 
+/***************************************************************************************************************************************************/
+/** @brief Merges the statistics (amount, mean, sum of squared differences to the mean) of two sets (Chan et al.)
+ * @param n_a    The amount of values of set A (updated to the merged set)
+ * @param mean_a The mean of set A (updated to the merged set)
+ * @param m2_a   The sum of squared differences to the mean of set A (updated to the merged set)
+ * @param n_b    The amount of values of set B
+ * @param mean_b The mean of set B
+ * @param m2_b   The sum of squared differences to the mean of set B
+ */
+inline void MeanStdDevMerge(vx_uint32 &n_a, vx_float64 &mean_a, vx_float64 &m2_a, vx_uint32 n_b, vx_float64 mean_b, vx_float64 m2_b) {
+#pragma HLS INLINE
+    const vx_uint32 n = n_a + n_b;
+    const vx_float64 delta = mean_b - mean_a;
+    const vx_float64 weight = (n > 0) ? (static_cast<vx_float64>(n_b) / static_cast<vx_float64>(n)) : (0.0);
+    mean_a += delta * weight;
+    m2_a += m2_b + delta * delta * static_cast<vx_float64>(n_a) * weight;
+    n_a = n;
+}
+
+/***************************************************************************************************************************************************/
+/** @brief Computes the mean and the standard deviation of a vectorized image in a single pass. The exact integer sums of each row segment
+ *         (VEC_NUM pixels merged by an adder tree per clock cycle) are merged into the statistics of the tiles and the image (Chan et al.).
+ *         This is numerically stable, also for a large mean and a small standard deviation.
+ * @param DataType    The data type of the input, which can be 8-bit/16-bit signed/unsigned
+ * @param VEC_NUM     The amount of pixels computed in parallel (1 - 8)
+ * @param IMG_COLS    The amount of columns in the image
+ * @param IMG_ROWS    The amount of rows in the image
+ * @param TILES_X     The amount of tiles in x direction (1 for row statistics)
+ * @param TILE_ROWS   The amount of rows of a tile (1 for row statistics)
+ * @param TILE_STATS  Is true if the statistics of the tiles need to be computed (If [optional] is set)
+ * @param input       The input image
+ * @param mean        The VX_TYPE_FLOAT32 average pixel value
+ * @param stddev      The VX_TYPE_FLOAT32 standard deviation of the pixel values
+ * @param tile_mean   [optional] The average pixel values of the tiles (row-major order of the tiles)
+ * @param tile_stddev [optional] The standard deviations of the tiles (row-major order of the tiles)
+ */
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint32 IMG_COLS, vx_uint32 IMG_ROWS, vx_uint16 TILES_X, vx_uint16 TILE_ROWS, bool TILE_STATS> //
+void MeanStdDevSinglePass(vx_image_data<DataType, VEC_NUM> input[(IMG_COLS * IMG_ROWS) / VEC_NUM],                                              //
+                          vx_image_data<vx_float32, 1> mean[1], vx_image_data<vx_float32, 1> stddev[1],                                         //
+                          vx_image_data<vx_float32, 1> tile_mean[TILES_X * (IMG_ROWS / TILE_ROWS)],                                             //
+                          vx_image_data<vx_float32, 1> tile_stddev[TILES_X * (IMG_ROWS / TILE_ROWS)]) {                                         //
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint32 VEC_COLS = IMG_COLS / VEC_NUM;
+    const vx_uint32 TILE_COLS = IMG_COLS / TILES_X;
+    const vx_uint32 TILE_VEC_COLS = TILE_COLS / VEC_NUM;
+    const vx_uint32 TILES_Y = IMG_ROWS / TILE_ROWS;
+
+    // Check function parameters/types
+    const vx_type_e TYPE = GET_TYPE(DataType);
+    const bool allowed_type = (TYPE == VX_TYPE_UINT8) || (TYPE == VX_TYPE_UINT16) || (TYPE == VX_TYPE_INT8) || (TYPE == VX_TYPE_INT16);
+    STATIC_ASSERT(allowed_type, data_type_is_not_allowed_for_mean_stddev);
+    STATIC_ASSERT((VEC_NUM == 1) || (VEC_NUM == 2) || (VEC_NUM == 4) || (VEC_NUM == 8), vec_num_must_be_1_2_4_or_8);
+    STATIC_ASSERT((TILES_X >= 1) && ((IMG_COLS % TILES_X) == 0) && ((TILE_COLS % VEC_NUM) == 0), tile_columns_must_be_multiple_of_vec_num);
+    STATIC_ASSERT((TILE_ROWS >= 1) && ((IMG_ROWS % TILE_ROWS) == 0), image_rows_must_be_multiple_of_tile_rows);
+    STATIC_ASSERT(TILE_COLS <= 65536, tile_columns_must_be_smaller_or_equal_65536);
+
+    // Exact sums of the row segments of the current row
+    vx_int64 segment_sum[TILES_X];
+    vx_uint64 segment_sqr[TILES_X];
+
+    // Statistics of the tiles of the current tile row and of the image
+    vx_uint32 tile_n[TILES_X];
+    vx_float64 tile_mu[TILES_X], tile_m2[TILES_X];
+    vx_uint32 image_n = 0;
+    vx_float64 image_mu = 0.0, image_m2 = 0.0;
+
+    for (vx_uint32 y = 0; y < IMG_ROWS; y++) {
+
+        // Accumulate the exact sums of the row segments (one per tile)
+        vx_int64 sum = 0;
+        vx_uint64 sqr = 0;
+        for (vx_uint32 x = 0, tile = 0, tile_x = 0; x < VEC_COLS; x++) {
+#pragma HLS PIPELINE II = 1
+            vx_image_data<DataType, VEC_NUM> src = input[y * VEC_COLS + x];
+            vx_int64 sum_tree[VEC_NUM];
+            vx_uint64 sqr_tree[VEC_NUM];
+#pragma HLS array_partition variable = sum_tree complete dim = 0
+#pragma HLS array_partition variable = sqr_tree complete dim = 0
+
+            // Values of the vector and adder tree
+            for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+                const vx_int64 data = static_cast<vx_int64>(src.pixel[v]);
+                sum_tree[v] = data;
+                sqr_tree[v] = static_cast<vx_uint64>(data * data);
+            }
+            for (vx_uint16 step = 1; step < VEC_NUM; step *= 2) {
+#pragma HLS unroll
+                for (vx_uint16 v = 0; v + step < VEC_NUM; v += 2 * step) {
+#pragma HLS unroll
+                    sum_tree[v] += sum_tree[v + step];
+                    sqr_tree[v] += sqr_tree[v + step];
+                }
+            }
+            sum += sum_tree[0];
+            sqr += sqr_tree[0];
+
+            // Store the sums at the end of a row segment
+            tile_x++;
+            if (tile_x == TILE_VEC_COLS) {
+                segment_sum[tile] = sum;
+                segment_sqr[tile] = sqr;
+                sum = 0;
+                sqr = 0;
+                tile_x = 0;
+                tile++;
+            }
+        }
+
+        // Merge the row segments into the tiles: n * m2 = n * sum(x^2) - sum(x)^2 is exact in 64 bit
+        const bool first_row = ((y % TILE_ROWS) == 0);
+        const bool last_row = ((y % TILE_ROWS) == (TILE_ROWS - 1));
+        for (vx_uint32 tile = 0; tile < TILES_X; tile++) {
+#pragma HLS PIPELINE II = 1
+            const vx_uint64 n_m2 = static_cast<vx_uint64>(TILE_COLS) * segment_sqr[tile] -
+                                   static_cast<vx_uint64>(segment_sum[tile]) * static_cast<vx_uint64>(segment_sum[tile]);
+            const vx_float64 segment_mu = static_cast<vx_float64>(segment_sum[tile]) / TILE_COLS;
+            const vx_float64 segment_m2 = static_cast<vx_float64>(n_m2) / TILE_COLS;
+            if (first_row) {
+                tile_n[tile] = TILE_COLS;
+                tile_mu[tile] = segment_mu;
+                tile_m2[tile] = segment_m2;
+            } else {
+                MeanStdDevMerge(tile_n[tile], tile_mu[tile], tile_m2[tile], TILE_COLS, segment_mu, segment_m2);
+            }
+
+            // Write the tile statistics
+            if (last_row) {
+                const vx_uint32 ptr = (y / TILE_ROWS) * TILES_X + tile;
+                const bool first = (ptr == 0), last = (ptr == TILES_X * TILES_Y - 1);
+                if (TILE_STATS) {
+                    vx_image_data<vx_float32, 1> mean_v, stddev_v;
+                    GenerateDmaSignal<vx_float32, 1>(first, last, mean_v);
+                    GenerateDmaSignal<vx_float32, 1>(first, last, stddev_v);
+                    mean_v.pixel[0] = static_cast<vx_float32>(tile_mu[tile]);
+                    stddev_v.pixel[0] = static_cast<vx_float32>(sqrt(tile_m2[tile] / tile_n[tile]));
+                    tile_mean[ptr] = mean_v;
+                    tile_stddev[ptr] = stddev_v;
+                }
+            }
+        }
+
+        // Merge the tiles of a finished tile row into the image statistics. Every merge depends on the previous one (double precision
+        // division and multiply-add), so the loop is not pipelined. It takes TILES_X merge latencies (tens of cycles each) per tile row.
+        if (last_row) {
+            for (vx_uint32 tile = 0; tile < TILES_X; tile++)
+                MeanStdDevMerge(image_n, image_mu, image_m2, tile_n[tile], tile_mu[tile], tile_m2[tile]);
+        }
+    }
+
+    // Write the image statistics
+    vx_image_data<vx_float32, 1> mean_v, stddev_v;
+    GenerateDmaSignal<vx_float32, 1>(true, true, mean_v);
+    GenerateDmaSignal<vx_float32, 1>(true, true, stddev_v);
+    mean_v.pixel[0] = static_cast<vx_float32>(image_mu);
+    stddev_v.pixel[0] = static_cast<vx_float32>(sqrt(image_m2 / image_n));
+    mean[0] = mean_v;
+    stddev[0] = stddev_v;
+}
+
 /***************************************************************************************************************************************************/
 // Update Min/max location
 template <typename DataType, vx_uint16 CAPACITY, vx_bool COMPUTE_LOCATIONS>
@@ -1279,6 +1821,714 @@ void MinMaxLocation(DataType input[IMG_ROWS * IMG_COLS], DataType min_val[1], Da
     }
 }
 
+/***************************************************************************************************************************************************/
+/** @brief Finds the minimum and maximum values in a vectorized image and a location for each. Every vector lane tracks its own minimum/maximum
+ *         and the first locations of it (VEC_NUM * CAPACITY locations). After the image, the lanes are merged by a tree reduction. The locations
+ *         are merged in raster order, which keeps the first-location semantics of the scalar function.
+ * @param DataType          The data type of the input, which can be 8-bit/16-bit signed/unsigned
+ * @param VEC_NUM           The amount of pixels computed in parallel (1 - 8)
+ * @param IMG_COLS          The amount of columns in the image
+ * @param IMG_ROWS          The amount of rows in the image
+ * @param CAPACITY          The capacity of the arrays that store the locations (min_loc, max_loc)
+ * @param COMPUTE_LOCATIONS Is true if the locations and counters need to be computed (If [optional] is set)
+ * @param input             The input image
+ * @param min_val           The minimum value in the image, which corresponds to the type of the input.
+ * @param max_val           The maximum value in the image, which corresponds to the type of the input.
+ * @param min_loc           [optional] The first minimum x, y locations in raster order (up to the capacity of the array)
+ * @param max_loc           [optional] The first maximum x, y locations in raster order (up to the capacity of the array)
+ * @param min_count         [optional] The number of detected minimums (up to the capacity of the array)
+ * @param max_count         [optional] The number of detected maximums (up to the capacity of the array)
+ */
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint16 CAPACITY, vx_bool COMPUTE_LOCATIONS> //
+void MinMaxLocationVector(vx_image_data<DataType, VEC_NUM> input[(IMG_ROWS * IMG_COLS) / VEC_NUM],                                    //
+                          vx_image_data<DataType, 1> min_val[1], vx_image_data<DataType, 1> max_val[1],                               //
+                          vx_image_data<vx_uint16, 2> min_loc[CAPACITY], vx_image_data<vx_uint16, 2> max_loc[CAPACITY],               //
+                          vx_image_data<vx_uint16, 1> min_count[1], vx_image_data<vx_uint16, 1> max_count[1]) {                       //
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint16 VEC_COLS = IMG_COLS / VEC_NUM;
+    const vx_uint32 NO_LOCATION = 0xFFFFFFFF;
+
+    // Check input
+    const vx_type_e TYPE = GET_TYPE(DataType);
+    const bool allowed_type =
+        (TYPE == VX_TYPE_UINT8) || (TYPE == VX_TYPE_UINT16) || (TYPE == VX_TYPE_INT8) || (TYPE == VX_TYPE_INT16);
+    STATIC_ASSERT(allowed_type, data_type_is_not_allowed_for_min_max_location);
+    STATIC_ASSERT((VEC_NUM == 1) || (VEC_NUM == 2) || (VEC_NUM == 4) || (VEC_NUM == 8), vec_num_must_be_1_2_4_or_8);
+    STATIC_ASSERT((IMG_COLS % VEC_NUM) == 0, image_columns_must_be_multiple_of_vec_num);
+
+    // Minimum/maximum values, counters and locations of each vector lane
+    DataType min_lane[VEC_NUM], max_lane[VEC_NUM];
+    vx_uint16 min_counter[VEC_NUM], max_counter[VEC_NUM];
+    vx_uint16 min_loc_x_buffer[VEC_NUM][CAPACITY], min_loc_y_buffer[VEC_NUM][CAPACITY];
+    vx_uint16 max_loc_x_buffer[VEC_NUM][CAPACITY], max_loc_y_buffer[VEC_NUM][CAPACITY];
+#pragma HLS array_partition variable = min_lane complete dim = 0
+#pragma HLS array_partition variable = max_lane complete dim = 0
+#pragma HLS array_partition variable = min_counter complete dim = 0
+#pragma HLS array_partition variable = max_counter complete dim = 0
+#pragma HLS array_partition variable = min_loc_x_buffer complete dim = 1
+#pragma HLS array_partition variable = min_loc_y_buffer complete dim = 1
+#pragma HLS array_partition variable = max_loc_x_buffer complete dim = 1
+#pragma HLS array_partition variable = max_loc_y_buffer complete dim = 1
+    for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+        min_lane[v] = ComputeMax<DataType>();
+        max_lane[v] = ComputeMin<DataType>();
+        min_counter[v] = 0;
+        max_counter[v] = 0;
+    }
+
+    // Computes the minimum and maximum values, including their counters and locations of each lane (pipelined)
+    for (vx_uint16 y = 0; y < IMG_ROWS; y++) {
+        for (vx_uint16 x = 0; x < VEC_COLS; x++) {
+#pragma HLS PIPELINE II = 1
+
+            // Read Input
+            vx_image_data<DataType, VEC_NUM> src = input[y * VEC_COLS + x];
+
+            // Update Min/max location of each lane
+            for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+                MinMaxUpdateLocation<DataType, CAPACITY, COMPUTE_LOCATIONS>(                                                        //
+                    y, x * VEC_NUM + v, src.pixel[v], min_loc_x_buffer[v], min_loc_y_buffer[v], max_loc_x_buffer[v],               //
+                    max_loc_y_buffer[v], min_lane[v], max_lane[v], min_counter[v], max_counter[v]);                                //
+            }
+        }
+    }
+
+    // Merge the minimum/maximum values of the lanes (tree reduction)
+    DataType min_tree[VEC_NUM], max_tree[VEC_NUM];
+#pragma HLS array_partition variable = min_tree complete dim = 0
+#pragma HLS array_partition variable = max_tree complete dim = 0
+    for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+        min_tree[v] = min_lane[v];
+        max_tree[v] = max_lane[v];
+    }
+    for (vx_uint16 step = 1; step < VEC_NUM; step *= 2) {
+#pragma HLS unroll
+        for (vx_uint16 v = 0; v + step < VEC_NUM; v += 2 * step) {
+#pragma HLS unroll
+            min_tree[v] = MIN(min_tree[v], min_tree[v + step]);
+            max_tree[v] = MAX(max_tree[v], max_tree[v + step]);
+        }
+    }
+    const DataType min_value = min_tree[0];
+    const DataType max_value = max_tree[0];
+
+    {
+        // Write output
+        vx_image_data<DataType, 1> dst1, dst2;
+        GenerateDmaSignal<DataType, 1>(true, true, dst1);
+        GenerateDmaSignal<DataType, 1>(true, true, dst2);
+        dst1.pixel[0] = min_value;
+        dst2.pixel[0] = max_value;
+        *min_val = dst1;
+        *max_val = dst2;
+    }
+
+    // Write optional output
+    if (COMPUTE_LOCATIONS == vx_true_e) {
+
+        // Only the lanes that found the minimum/maximum value contribute locations
+        vx_uint32 min_total = 0, max_total = 0;
+        for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+            if (min_lane[v] != min_value)
+                min_counter[v] = 0;
+            if (max_lane[v] != max_value)
+                max_counter[v] = 0;
+            min_total += min_counter[v];
+            max_total += max_counter[v];
+        }
+        const vx_uint16 min_elements = static_cast<vx_uint16>(MIN(min_total, static_cast<vx_uint32>(CAPACITY)));
+        const vx_uint16 max_elements = static_cast<vx_uint16>(MIN(max_total, static_cast<vx_uint32>(CAPACITY)));
+        const vx_uint16 max_elements_both = MAX(min_elements, max_elements);
+
+        // Read pointers of the location buffers of the lanes
+        vx_uint16 min_ptr[VEC_NUM], max_ptr[VEC_NUM];
+#pragma HLS array_partition variable = min_ptr complete dim = 0
+#pragma HLS array_partition variable = max_ptr complete dim = 0
+        for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+            min_ptr[v] = 0;
+            max_ptr[v] = 0;
+        }
+
+        // Store location information: select the lane with the next location in raster order (tree reduction)
+        for (vx_uint16 i = 0; i < max_elements_both; i++) {
+#pragma HLS PIPELINE II = 1
+#pragma HLS loop_tripcount min = 1 max = CAPACITY
+            vx_image_data<vx_uint16, 1> dst1, dst2;
+            vx_image_data<vx_uint16, 2> dst3, dst4;
+            vx_uint32 min_key[VEC_NUM], max_key[VEC_NUM];
+            vx_uint16 min_sel[VEC_NUM], max_sel[VEC_NUM];
+#pragma HLS array_partition variable = min_key complete dim = 0
+#pragma HLS array_partition variable = max_key complete dim = 0
+#pragma HLS array_partition variable = min_sel complete dim = 0
+#pragma HLS array_partition variable = max_sel complete dim = 0
+
+            // Raster position (y, x) of the next location of each lane
+            for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+                const vx_uint16 min_p = MIN(min_ptr[v], static_cast<vx_uint16>(CAPACITY - 1));
+                const vx_uint16 max_p = MIN(max_ptr[v], static_cast<vx_uint16>(CAPACITY - 1));
+                min_key[v] = (min_ptr[v] < min_counter[v])
+                                 ? ((static_cast<vx_uint32>(min_loc_y_buffer[v][min_p]) << 16) | min_loc_x_buffer[v][min_p])
+                                 : (NO_LOCATION);
+                max_key[v] = (max_ptr[v] < max_counter[v])
+                                 ? ((static_cast<vx_uint32>(max_loc_y_buffer[v][max_p]) << 16) | max_loc_x_buffer[v][max_p])
+                                 : (NO_LOCATION);
+                min_sel[v] = v;
+                max_sel[v] = v;
+            }
+            for (vx_uint16 step = 1; step < VEC_NUM; step *= 2) {
+#pragma HLS unroll
+                for (vx_uint16 v = 0; v + step < VEC_NUM; v += 2 * step) {
+#pragma HLS unroll
+                    if (min_key[v + step] < min_key[v]) {
+                        min_key[v] = min_key[v + step];
+                        min_sel[v] = min_sel[v + step];
+                    }
+                    if (max_key[v + step] < max_key[v]) {
+                        max_key[v] = max_key[v + step];
+                        max_sel[v] = max_sel[v + step];
+                    }
+                }
+            }
+
+            if (i == 0) {
+                GenerateDmaSignal<vx_uint16, 1>(true, true, dst1);
+                GenerateDmaSignal<vx_uint16, 1>(true, true, dst2);
+                dst1.pixel[0] = min_elements;
+                dst2.pixel[0] = max_elements;
+                *min_count = dst1;
+                *max_count = dst2;
+            }
+            if (i < min_elements) {
+                dst3.pixel[0] = static_cast<vx_uint16>(min_key[0] & 0xFFFF);
+                dst3.pixel[1] = static_cast<vx_uint16>(min_key[0] >> 16);
+                GenerateDmaSignal<vx_uint16, 2>((i == 0), (i == min_elements - 1), dst3);
+                min_loc[i] = dst3;
+                min_ptr[min_sel[0]]++;
+            }
+            if (i < max_elements) {
+                dst4.pixel[0] = static_cast<vx_uint16>(max_key[0] & 0xFFFF);
+                dst4.pixel[1] = static_cast<vx_uint16>(max_key[0] >> 16);
+                GenerateDmaSignal<vx_uint16, 2>((i == 0), (i == max_elements - 1), dst4);
+                max_loc[i] = dst4;
+                max_ptr[max_sel[0]]++;
+            }
+        }
+    }
+}
+
+/***************************************************************************************************************************************************/
+// Adds the statistics of a run of pixels on line y to the statistics of a label
+template <vx_uint16 MAX_LABELS>
+void ConnectedComponentsAddRun(vx_uint16 label, vx_uint16 y, vx_uint16 run_min_x, vx_uint16 run_max_x, vx_uint32 run_area, vx_uint64 run_sum_x,
+                               vx_uint32 area[MAX_LABELS], vx_uint16 min_x[MAX_LABELS], vx_uint16 max_x[MAX_LABELS],
+                               vx_uint16 max_y[MAX_LABELS], vx_uint64 sum_x[MAX_LABELS], vx_uint64 sum_y[MAX_LABELS]) {
+#pragma HLS INLINE
+    area[label] += run_area;
+    min_x[label] = MIN(min_x[label], run_min_x);
+    max_x[label] = MAX(max_x[label], run_max_x);
+    max_y[label] = y;
+    sum_x[label] += run_sum_x;
+    sum_y[label] += static_cast<vx_uint64>(run_area) * y;
+}
+
+/***************************************************************************************************************************************************/
+/** @brief Single-pass connected component labeling (raster order) of a binary image, which outputs the statistics of every component. Only one
+ *         line of labels and a union-find table with the statistics of each label are stored. Two components are merged by linking the larger to
+ *         the smaller root label. The merges of a line are resolved at its end (latest first), so every label of the previous line points to its
+ *         root. A label of the previous line is then found with two reads: its root at the start of the line and the root it was merged into on
+ *         the current line (a copy of the union-find table). A root can't be merged twice on a line, before one of its later pixels of the
+ *         previous line is read, since a smaller root between them would be enclosed by the component. The statistics of a run of pixels are
+ *         added once at its end and the statistics of the merged labels are added to their roots at the end of the image.
+ * @param IMG_COLS     The amount of columns in the image
+ * @param IMG_ROWS     The amount of rows in the image
+ * @param MAX_LABELS   The size of the label table (MAX_LABELS - 1 labels). Pixels that would need further labels are not labeled.
+ * @param CONNECTIVITY The neighborhood of a pixel (4 or 8)
+ * @param input        The binary input image (pixels unequal to 0 are foreground)
+ * @param blobs        The records of the components (area, bounding box, centroid), see BlobRecord
+ * @param blob_count   The amount of components
+ */
+template <vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint16 MAX_LABELS, vx_uint8 CONNECTIVITY>       //
+void ConnectedComponents(vx_image_data<vx_uint8, 1> input[IMG_COLS * IMG_ROWS],                      //
+                         vx_image_data<vx_uint32, HIFLIPVX::BLOB_RECORD_SIZE> blobs[MAX_LABELS - 1], //
+                         vx_image_data<vx_uint16, 1> blob_count[1]) {                                //
+#pragma HLS INLINE
+
+    // Check function parameters/types
+    STATIC_ASSERT((CONNECTIVITY == 4) || (CONNECTIVITY == 8), connectivity_must_be_4_or_8);
+    STATIC_ASSERT(MAX_LABELS >= 2, max_labels_must_be_at_least_2);
+    STATIC_ASSERT((static_cast<vx_uint64>(IMG_COLS) * IMG_ROWS * MAX(IMG_COLS, IMG_ROWS)) < (1ULL << 48), image_is_too_large_for_centroids);
+
+    // A pixel merges at most one root, which starts a run of the previous line, so a line has at most (IMG_COLS + 1) / 2 merges
+    const vx_uint16 MAX_MERGES = (IMG_COLS + 1) / 2;
+
+    // Labels of the previous line (0 is background)
+    vx_uint16 line[IMG_COLS];
+
+    // Union-find table, its copy for the second read of a lookup and the merges of the current line (label and root it was merged into)
+    vx_uint16 parent[MAX_LABELS], parent_copy[MAX_LABELS];
+    vx_uint16 merged_label[MAX_MERGES], merged_root[MAX_MERGES];
+
+    // Statistics of the labels
+    vx_uint32 area[MAX_LABELS];
+    vx_uint16 min_x[MAX_LABELS], min_y[MAX_LABELS], max_x[MAX_LABELS], max_y[MAX_LABELS];
+    vx_uint64 sum_x[MAX_LABELS], sum_y[MAX_LABELS];
+    vx_uint16 next_label = 1, components = 0;
+    parent[0] = 0;
+    parent_copy[0] = 0;
+
+    for (vx_uint16 y = 0; y < IMG_ROWS; y++) {
+
+        // Root labels of the left, upper left, upper and upper right neighbor
+        vx_uint16 left = 0, up_left = 0;
+        vx_uint16 up = (y > 0) ? (parent_copy[parent[line[0]]]) : (0);
+        vx_uint16 merges = 0;
+
+        // Statistics of the current run of pixels
+        vx_uint16 run_min_x = 0;
+        vx_uint32 run_area = 0;
+        vx_uint64 run_sum_x = 0;
+
+        for (vx_uint16 x = 0; x < IMG_COLS; x++) {
+#pragma HLS PIPELINE II = 1
+            vx_uint16 up_right = 0;
+            if ((y > 0) && (x + 1 < IMG_COLS))
+                up_right = parent_copy[parent[line[x + 1]]];
+
+            // Read input
+            vx_image_data<vx_uint8, 1> src = input[y * IMG_COLS + x];
+            vx_uint16 label = 0;
+
+            if (src.pixel[0] != 0) {
+
+                // Neighbors of the pixel (4 or 8 connectivity)
+                vx_uint16 neighbor[4];
+#pragma HLS array_partition variable = neighbor complete dim = 0
+                neighbor[0] = left;
+                neighbor[1] = up;
+                neighbor[2] = (CONNECTIVITY == 8) ? (up_left) : (0);
+                neighbor[3] = (CONNECTIVITY == 8) ? (up_right) : (0);
+
+                // Take the smallest root label of the neighbors or create a new label. The neighbors have at most two different roots, since
+                // the left, upper left and upper neighbor have been merged at the previous pixel.
+                vx_uint16 other = 0;
+                for (vx_uint16 i = 0; i < 4; i++) {
+#pragma HLS unroll
+                    if ((neighbor[i] != 0) && ((label == 0) || (neighbor[i] < label)))
+                        label = neighbor[i];
+                    other = MAX(other, neighbor[i]);
+                }
+                if ((label == 0) && (next_label < MAX_LABELS)) {
+                    label = next_label;
+                    parent[label] = label;
+                    parent_copy[label] = label;
+                    area[label] = 0;
+                    min_x[label] = x;
+                    min_y[label] = y;
+                    max_x[label] = x;
+                    max_y[label] = y;
+                    sum_x[label] = 0;
+                    sum_y[label] = 0;
+                    next_label++;
+                    components++;
+                }
+
+                // Merge the component of the other root into the component of the label and replace it in the neighbor registers
+                if ((other != 0) && (other != label)) {
+                    parent[other] = label;
+                    parent_copy[other] = label;
+                    merged_label[merges] = other;
+                    merged_root[merges] = label;
+                    merges++;
+                    components--;
+                    if (up == other)
+                        up = label;
+                    if (up_right == other)
+                        up_right = label;
+                }
+
+                // Update the statistics of the run
+                if (label != 0) {
+                    run_min_x = (left == 0) ? (x) : (run_min_x);
+                    run_area = (left == 0) ? (1) : (run_area + 1);
+                    run_sum_x = (left == 0) ? (static_cast<vx_uint64>(x)) : (run_sum_x + x);
+                }
+            }
+
+            // Add the statistics of a run at its end
+            if ((label == 0) && (left != 0))
+                ConnectedComponentsAddRun<MAX_LABELS>(left, y, run_min_x, x - 1, run_area, run_sum_x, area, min_x, max_x, max_y, sum_x, sum_y);
+
+            // Store the label for the next line and shift the neighbors
+            line[x] = label;
+            left = label;
+            up_left = up;
+            up = up_right;
+        }
+
+        // Add the statistics of a run at the end of the line
+        if (left != 0)
+            ConnectedComponentsAddRun<MAX_LABELS>(left, y, run_min_x, IMG_COLS - 1, run_area, run_sum_x, area, min_x, max_x, max_y, sum_x, sum_y);
+
+        // Resolve the merges of the line (latest first). The root a label was merged into can only be merged later on the line.
+        for (vx_uint16 i = merges; i > 0; i--) {
+#pragma HLS PIPELINE II = 1
+#pragma HLS loop_tripcount min = 0 max = MAX_MERGES
+            const vx_uint16 label = merged_label[i - 1];
+            const vx_uint16 root = parent_copy[merged_root[i - 1]];
+            parent[label] = root;
+            parent_copy[label] = root;
+        }
+    }
+
+    // Add the statistics of the merged labels to their roots (a label is always merged into a smaller one)
+    for (vx_uint16 label = next_label - 1; label > 0; label--) {
+#pragma HLS PIPELINE II = 2
+#pragma HLS loop_tripcount min = 0 max = MAX_LABELS
+        const vx_uint16 root = parent[label];
+        if (root != label) {
+            area[root] += area[label];
+            min_x[root] = MIN(min_x[root], min_x[label]);
+            min_y[root] = MIN(min_y[root], min_y[label]);
+            max_x[root] = MAX(max_x[root], max_x[label]);
+            max_y[root] = MAX(max_y[root], max_y[label]);
+            sum_x[root] += sum_x[label];
+            sum_y[root] += sum_y[label];
+        }
+    }
+
+    // Write the amount of components
+    vx_image_data<vx_uint16, 1> count;
+    GenerateDmaSignal<vx_uint16, 1>(true, true, count);
+    count.pixel[0] = components;
+    blob_count[0] = count;
+
+    // Write the records of the root labels
+    for (vx_uint16 label = 1, ptr = 0; label < next_label; label++) {
+#pragma HLS PIPELINE II = 1
+#pragma HLS loop_tripcount min = 1 max = MAX_LABELS
+        if (parent[label] == label) {
+            vx_image_data<vx_uint32, HIFLIPVX::BLOB_RECORD_SIZE> dst;
+            GenerateDmaSignal<vx_uint32, HIFLIPVX::BLOB_RECORD_SIZE>((ptr == 0), (ptr == components - 1), dst);
+            dst.pixel[HIFLIPVX::BLOB_AREA] = area[label];
+            dst.pixel[HIFLIPVX::BLOB_MIN_X] = min_x[label];
+            dst.pixel[HIFLIPVX::BLOB_MIN_Y] = min_y[label];
+            dst.pixel[HIFLIPVX::BLOB_MAX_X] = max_x[label];
+            dst.pixel[HIFLIPVX::BLOB_MAX_Y] = max_y[label];
+            dst.pixel[HIFLIPVX::BLOB_CENTROID_X] = static_cast<vx_uint32>(((sum_x[label] << 16) + (area[label] / 2)) / area[label]);
+            dst.pixel[HIFLIPVX::BLOB_CENTROID_Y] = static_cast<vx_uint32>(((sum_y[label] << 16) + (area[label] / 2)) / area[label]);
+            blobs[ptr] = dst;
+            ptr++;
+        }
+    }
+}
+
+/***************************************************************************************************************************************************/
+/** @brief Checks the parameters of the moment functions. The largest moment (WEIGHT_MAX * pixels * max(cols, rows)^ORDER) must fit in 64 bit.
+ * @param SrcType    The data type of the input
+ * @param VEC_NUM    The amount of pixels computed in parallel (1 - 8)
+ * @param IMG_COLS   The amount of columns in the image
+ * @param IMG_ROWS   The amount of rows in the image
+ * @param ORDER      The maximum order of the moments (2 or 3)
+ * @param WEIGHT_MAX The maximum weight of a pixel
+ */
+template <typename SrcType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint8 ORDER, vx_uint64 WEIGHT_MAX> //
+void MomentsCompileTimeChecks() {                                                                                           //
+#pragma HLS INLINE
+    const vx_uint64 LENGTH_MAX = static_cast<vx_uint64>(MAX(IMG_COLS, IMG_ROWS));
+    const vx_uint64 POWER_MAX = (ORDER == 2) ? (LENGTH_MAX * LENGTH_MAX) : (LENGTH_MAX * LENGTH_MAX * LENGTH_MAX);
+    const vx_uint64 SUM_MAX = WEIGHT_MAX * static_cast<vx_uint64>(IMG_COLS) * static_cast<vx_uint64>(IMG_ROWS);
+    STATIC_ASSERT((ORDER == 2) || (ORDER == 3), moments_order_must_be_2_or_3);
+    STATIC_ASSERT((VEC_NUM == 1) || (VEC_NUM == 2) || (VEC_NUM == 4) || (VEC_NUM == 8), vec_num_must_be_1_2_4_or_8);
+    STATIC_ASSERT((IMG_COLS % VEC_NUM) == 0, image_columns_must_be_multiple_of_vec_num);
+    STATIC_ASSERT(POWER_MAX <= (0xFFFFFFFFFFFFFFFFULL / SUM_MAX), moments_exceed_64_bit_for_this_image_size);
+}
+
+/***************************************************************************************************************************************************/
+/** @brief Computes the powers value^0 .. value^ORDER
+ * @param ORDER  The highest power
+ * @param value  The base
+ * @param power  The powers
+ */
+template <vx_uint8 ORDER> //
+void MomentsPowers(vx_uint64 value, vx_uint64 power[ORDER + 1]) {
+#pragma HLS INLINE
+    power[0] = 1;
+    for (vx_uint8 p = 1; p <= ORDER; p++) {
+#pragma HLS unroll
+        power[p] = power[p - 1] * value;
+    }
+}
+
+/***************************************************************************************************************************************************/
+/** @brief Computes the raw moments up to order 2 or 3 of a vectorized gray or mask image (pixel value is the weight) in a single pass. The
+ *         moments are separable: the row sums S_p = sum(x^p * pixel) of the vector lanes are merged by an adder tree, and at the end of each
+ *         row m_pq += S_p * y^q is updated. Only ORDER + 1 row sums and the moments are stored.
+ * @param SrcType   The data type of the input (vx_uint8)
+ * @param VEC_NUM   The amount of pixels computed in parallel (1 - 8)
+ * @param IMG_COLS  The amount of columns in the image
+ * @param IMG_ROWS  The amount of rows in the image
+ * @param ORDER     The maximum order of the moments (2 or 3)
+ * @param input     The input image
+ * @param moments   The moments in the order of ImageMoment
+ */
+template <typename SrcType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint8 ORDER> //
+void MomentsIntensity(vx_image_data<SrcType, VEC_NUM> input[(IMG_COLS * IMG_ROWS) / VEC_NUM],         //
+                      vx_image_data<vx_uint64, 1> moments[((ORDER + 1) * (ORDER + 2)) / 2]) {         //
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint16 VEC_COLS = IMG_COLS / VEC_NUM;
+    const vx_uint8 MOMENT_NUM = ((ORDER + 1) * (ORDER + 2)) / 2;
+
+    // Check function parameters/types
+    const vx_type_e TYPE = GET_TYPE(SrcType);
+    STATIC_ASSERT(TYPE == VX_TYPE_UINT8, data_type_is_not_allowed_for_intensity_moments);
+    MomentsCompileTimeChecks<SrcType, VEC_NUM, IMG_COLS, IMG_ROWS, ORDER, 255>();
+
+    // Moments of the image
+    vx_uint64 moment[MOMENT_NUM];
+#pragma HLS array_partition variable = moment complete dim = 0
+    for (vx_uint8 m = 0; m < MOMENT_NUM; m++) {
+#pragma HLS unroll
+        moment[m] = 0;
+    }
+
+    for (vx_uint16 y = 0; y < IMG_ROWS; y++) {
+
+        // Row sums S_p = sum(x^p * pixel)
+        vx_uint64 row_sum[ORDER + 1];
+#pragma HLS array_partition variable = row_sum complete dim = 0
+        for (vx_uint8 p = 0; p <= ORDER; p++) {
+#pragma HLS unroll
+            row_sum[p] = 0;
+        }
+        for (vx_uint16 x = 0; x < VEC_COLS; x++) {
+#pragma HLS PIPELINE II = 1
+            vx_image_data<SrcType, VEC_NUM> src = input[y * VEC_COLS + x];
+            vx_uint64 sum_tree[ORDER + 1][VEC_NUM];
+#pragma HLS array_partition variable = sum_tree complete dim = 0
+
+            // Weighted powers of the vector and adder tree
+            for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+                vx_uint64 power[ORDER + 1];
+#pragma HLS array_partition variable = power complete dim = 0
+                MomentsPowers<ORDER>(static_cast<vx_uint64>(x * VEC_NUM + v), power);
+                for (vx_uint8 p = 0; p <= ORDER; p++) {
+#pragma HLS unroll
+                    sum_tree[p][v] = static_cast<vx_uint64>(src.pixel[v]) * power[p];
+                }
+            }
+            for (vx_uint16 step = 1; step < VEC_NUM; step *= 2) {
+#pragma HLS unroll
+                for (vx_uint16 v = 0; v + step < VEC_NUM; v += 2 * step) {
+#pragma HLS unroll
+                    for (vx_uint8 p = 0; p <= ORDER; p++) {
+#pragma HLS unroll
+                        sum_tree[p][v] += sum_tree[p][v + step];
+                    }
+                }
+            }
+            for (vx_uint8 p = 0; p <= ORDER; p++) {
+#pragma HLS unroll
+                row_sum[p] += sum_tree[p][0];
+            }
+        }
+
+        // Update the moments at the end of the row: m_pq += S_p * y^q
+        vx_uint64 power[ORDER + 1];
+#pragma HLS array_partition variable = power complete dim = 0
+        MomentsPowers<ORDER>(static_cast<vx_uint64>(y), power);
+        for (vx_uint8 n = 0, m = 0; n <= ORDER; n++) {
+#pragma HLS unroll
+            for (vx_uint8 q = 0; q <= n; q++, m++) {
+#pragma HLS unroll
+                moment[m] += row_sum[n - q] * power[q];
+            }
+        }
+    }
+
+    // Write the moments
+    for (vx_uint8 m = 0; m < MOMENT_NUM; m++) {
+#pragma HLS PIPELINE II = 1
+        vx_image_data<vx_uint64, 1> dst;
+        GenerateDmaSignal<vx_uint64, 1>((m == 0), (m == MOMENT_NUM - 1), dst);
+        dst.pixel[0] = moment[m];
+        moments[m] = dst;
+    }
+}
+
+/***************************************************************************************************************************************************/
+/** @brief Updates the moments of a label (reads the current and writes the previous entry into alternating tables, see HistogramUpdateEntry)
+ * @param MOMENT_NUM   The amount of moments
+ * @param LABELS       The amount of labels
+ * @param i            The pixel counter (selects the table)
+ * @param label        The label of the pixel
+ * @param valid        Is true if the label is smaller than LABELS
+ * @param contribution The values x^p * y^q of the pixel
+ * @param TABLE_A      The moments of the labels (even pixels)
+ * @param TABLE_B      The moments of the labels (odd pixels)
+ * @param pre_label    The label of the previous pixel (updated)
+ * @param pre_val      The moments of the previous pixel to be written (updated)
+ */
+template <vx_uint8 MOMENT_NUM, vx_uint16 LABELS>                                                            //
+void MomentsUpdateEntry(vx_uint32 i, vx_uint16 label, bool valid, const vx_uint64 contribution[MOMENT_NUM], //
+                        vx_uint64 TABLE_A[MOMENT_NUM][LABELS], vx_uint64 TABLE_B[MOMENT_NUM][LABELS],       //
+                        vx_uint16 &pre_label, vx_uint64 pre_val[MOMENT_NUM]) {                              //
+#pragma HLS INLINE
+
+    const vx_uint16 cur_label = (valid == true) ? (label) : (static_cast<vx_uint16>(0));
+    vx_uint64 cur_val[MOMENT_NUM];
+#pragma HLS array_partition variable = cur_val complete dim = 0
+
+    // Read current moments & write previous moments
+    for (vx_uint8 m = 0; m < MOMENT_NUM; m++) {
+#pragma HLS unroll
+        if (i % 2 == 0) {
+            cur_val[m] = TABLE_A[m][cur_label];
+            TABLE_B[m][pre_label] = pre_val[m];
+        } else {
+            cur_val[m] = TABLE_B[m][cur_label];
+            TABLE_A[m][pre_label] = pre_val[m];
+        }
+    }
+
+    // Accumulate and store in next iteration
+    for (vx_uint8 m = 0; m < MOMENT_NUM; m++) {
+#pragma HLS unroll
+        pre_val[m] = (valid == true) ? (cur_val[m] + contribution[m]) : (cur_val[m]);
+    }
+    pre_label = cur_label;
+}
+
+/***************************************************************************************************************************************************/
+/** @brief Computes the raw moments up to order 2 or 3 of every label of a vectorized label image (each pixel has the weight 1) in a single pass.
+ *         Every vector lane accumulates into two own tables (alternating pixels), which are merged when the moments are written. Pixels with a
+ *         label larger or equal to LABELS are ignored.
+ * @param SrcType   The data type of the labels (vx_uint8, vx_uint16)
+ * @param VEC_NUM   The amount of pixels computed in parallel (1 - 8)
+ * @param IMG_COLS  The amount of columns in the image
+ * @param IMG_ROWS  The amount of rows in the image
+ * @param ORDER     The maximum order of the moments (2 or 3)
+ * @param LABELS    The amount of labels
+ * @param input     The label image
+ * @param moments   The moments of the labels (label-major, in the order of ImageMoment)
+ */
+template <typename SrcType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint8 ORDER, vx_uint16 LABELS> //
+void MomentsLabels(vx_image_data<SrcType, VEC_NUM> input[(IMG_COLS * IMG_ROWS) / VEC_NUM],                              //
+                   vx_image_data<vx_uint64, 1> moments[LABELS * (((ORDER + 1) * (ORDER + 2)) / 2)]) {                   //
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint16 VEC_COLS = IMG_COLS / VEC_NUM;
+    const vx_uint32 VEC_PIXELS = static_cast<vx_uint32>(VEC_COLS) * static_cast<vx_uint32>(IMG_ROWS);
+    const vx_uint8 MOMENT_NUM = ((ORDER + 1) * (ORDER + 2)) / 2;
+
+    // Check function parameters/types
+    const vx_type_e TYPE = GET_TYPE(SrcType);
+    STATIC_ASSERT((TYPE == VX_TYPE_UINT8) || (TYPE == VX_TYPE_UINT16), data_type_is_not_allowed_for_label_moments);
+    STATIC_ASSERT(LABELS >= 1, amount_of_labels_must_be_positive);
+    MomentsCompileTimeChecks<SrcType, VEC_NUM, IMG_COLS, IMG_ROWS, ORDER, 1>();
+
+    // Moments of the labels (2 tables per vector lane)
+    vx_uint64 TABLES[2 * VEC_NUM][MOMENT_NUM][LABELS];
+#pragma HLS array_partition variable = TABLES complete dim = 1
+#pragma HLS array_partition variable = TABLES complete dim = 2
+    vx_uint16 pre_label[VEC_NUM];
+#pragma HLS array_partition variable = pre_label complete dim = 0
+    vx_uint64 pre_val[VEC_NUM][MOMENT_NUM];
+#pragma HLS array_partition variable = pre_val complete dim = 0
+
+    // Reset the tables
+    for (vx_uint16 l = 0; l < LABELS; l++) {
+#pragma HLS PIPELINE II = 1
+        for (vx_uint16 t = 0; t < 2 * VEC_NUM; t++) {
+#pragma HLS unroll
+            for (vx_uint8 m = 0; m < MOMENT_NUM; m++) {
+#pragma HLS unroll
+                TABLES[t][m][l] = 0;
+            }
+        }
+    }
+    for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+        pre_label[v] = 0;
+        for (vx_uint8 m = 0; m < MOMENT_NUM; m++) {
+#pragma HLS unroll
+            pre_val[v][m] = 0;
+        }
+    }
+
+    // Accumulate the moments of the labels
+    for (vx_uint16 y = 0; y < IMG_ROWS; y++) {
+        vx_uint64 power_y[ORDER + 1];
+#pragma HLS array_partition variable = power_y complete dim = 0
+        MomentsPowers<ORDER>(static_cast<vx_uint64>(y), power_y);
+
+        for (vx_uint16 x = 0; x < VEC_COLS; x++) {
+#pragma HLS PIPELINE II = 1
+            const vx_uint32 ptr = static_cast<vx_uint32>(y) * VEC_COLS + x;
+            vx_image_data<SrcType, VEC_NUM> src = input[ptr];
+
+            for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+                const vx_uint16 label = static_cast<vx_uint16>(src.pixel[v]);
+                const bool valid = (label < LABELS);
+
+                // Contributions x^p * y^q of the pixel
+                vx_uint64 power_x[ORDER + 1], contribution[MOMENT_NUM];
+#pragma HLS array_partition variable = power_x complete dim = 0
+#pragma HLS array_partition variable = contribution complete dim = 0
+                MomentsPowers<ORDER>(static_cast<vx_uint64>(x * VEC_NUM + v), power_x);
+                for (vx_uint8 n = 0, m = 0; n <= ORDER; n++) {
+#pragma HLS unroll
+                    for (vx_uint8 q = 0; q <= n; q++, m++) {
+#pragma HLS unroll
+                        contribution[m] = power_x[n - q] * power_y[q];
+                    }
+                }
+
+                MomentsUpdateEntry<MOMENT_NUM, LABELS>                                                             //
+                    (ptr, label, valid, contribution, TABLES[2 * v], TABLES[2 * v + 1], pre_label[v], pre_val[v]); //
+            }
+        }
+    }
+
+    // Write the moments of the last pixels into the table they were read from
+    for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+        const vx_uint16 t = 2 * v + ((VEC_PIXELS - 1) % 2);
+        for (vx_uint8 m = 0; m < MOMENT_NUM; m++) {
+#pragma HLS unroll
+            TABLES[t][m][pre_label[v]] = pre_val[v][m];
+        }
+    }
+
+    // Merge the tables and write the moments
+    for (vx_uint16 l = 0; l < LABELS; l++) {
+        for (vx_uint8 m = 0; m < MOMENT_NUM; m++) {
+#pragma HLS PIPELINE II = 1
+            vx_image_data<vx_uint64, 1> dst;
+            GenerateDmaSignal<vx_uint64, 1>((l == 0) && (m == 0), (l == LABELS - 1) && (m == MOMENT_NUM - 1), dst);
+            vx_uint64 sum = 0;
+            for (vx_uint16 t = 0; t < 2 * VEC_NUM; t++) {
+#pragma HLS unroll
+                sum += TABLES[t][m][l];
+            }
+            dst.pixel[0] = sum;
+            moments[static_cast<vx_uint32>(l) * MOMENT_NUM + m] = dst;
+        }
+    }
+}
+
 /***************************************************************************************************************************************************/
 /** @brief Implements the Table Lookup Image Kernel.
  * @param DataType   The data type can be vx_uint8 and vx_int16
@@ -129,6 +129,95 @@ void ImgChannelCombine(vx_uint8 input0[SRC_PIXELS],
         (input0, input1, NULL, NULL, output);                     //
 }
 
+/*********************************************************************************************************************/
+/** @brief  Implements the Channel Combine Kernel for vectorized images (2, 3 or 4 planes). \n
+ *  @details each "image type" has a "data type" \n
+ *                      - VX_DF_IMAGE_U16 (vx_uint16) \n
+ *                      - VX_DF_IMAGE_U32 (vx_uint32) \n
+ *                      - VX_DF_IMAGE_RGB (vx_uint32) \n
+ *                      - VX_DF_IMAGE_RGBX (vx_uint32) \n
+ * @param DstType       The "data type" of the output image
+ * @param VEC_NUM       The amount of pixels computed in parallel (1 - 8)
+ * @param SRC_PIXELS    The pixels of the input image
+ * @param DST_PIXELS    The pixels of the output image.
+ *                      Can differ for RGB, since the 24-bit are interleaved.
+ * @param DST_IMAGE     The "image type" of the output image
+ * @param input0        The 1. plane of the input image
+ * @param input1        The 2. plane of the input image
+ * @param input2        The 3. plane of the input image (optional)
+ * @param input3        The 4. plane of the input image (optional)
+ * @param output        The output image
+ */
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS, vx_df_image_e DST_IMAGE> //
+void ImgChannelCombine(vx_image_data<vx_uint8, VEC_NUM> input0[SRC_PIXELS / VEC_NUM],                              //
+                       vx_image_data<vx_uint8, VEC_NUM> input1[SRC_PIXELS / VEC_NUM],                              //
+                       vx_image_data<vx_uint8, VEC_NUM> input2[SRC_PIXELS / VEC_NUM],                              //
+                       vx_image_data<vx_uint8, VEC_NUM> input3[SRC_PIXELS / VEC_NUM],                              //
+                       vx_image_data<DstType, VEC_NUM> output[DST_PIXELS / VEC_NUM]) {                             //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input0, input1, input2, input3, output);
+    ChannelCombineVector<DstType, 4, VEC_NUM, SRC_PIXELS, DST_PIXELS, DST_IMAGE> //
+        (input0, input1, input2, input3, output);                                //
+}
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS, vx_df_image_e DST_IMAGE> //
+void ImgChannelCombine(vx_uint8 input0[SRC_PIXELS],                                                                //
+                       vx_uint8 input1[SRC_PIXELS],                                                                //
+                       vx_uint8 input2[SRC_PIXELS],                                                                //
+                       vx_uint8 input3[SRC_PIXELS],                                                                //
+                       DstType output[DST_PIXELS]) {                                                               //
+#pragma HLS INLINE
+    ChannelCombineVector<DstType, 4, VEC_NUM, SRC_PIXELS, DST_PIXELS, DST_IMAGE>( //
+        (vx_image_data<vx_uint8, VEC_NUM> *)input0,                               //
+        (vx_image_data<vx_uint8, VEC_NUM> *)input1,                               //
+        (vx_image_data<vx_uint8, VEC_NUM> *)input2,                               //
+        (vx_image_data<vx_uint8, VEC_NUM> *)input3,                               //
+        (vx_image_data<DstType, VEC_NUM> *)output);                               //
+}
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS, vx_df_image_e DST_IMAGE> //
+void ImgChannelCombine(vx_image_data<vx_uint8, VEC_NUM> input0[SRC_PIXELS / VEC_NUM],                              //
+                       vx_image_data<vx_uint8, VEC_NUM> input1[SRC_PIXELS / VEC_NUM],                              //
+                       vx_image_data<vx_uint8, VEC_NUM> input2[SRC_PIXELS / VEC_NUM],                              //
+                       vx_image_data<DstType, VEC_NUM> output[DST_PIXELS / VEC_NUM]) {                             //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input0, input1, input2, output);
+    ChannelCombineVector<DstType, 3, VEC_NUM, SRC_PIXELS, DST_PIXELS, DST_IMAGE> //
+        (input0, input1, input2, NULL, output);                                  //
+}
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS, vx_df_image_e DST_IMAGE> //
+void ImgChannelCombine(vx_uint8 input0[SRC_PIXELS],                                                                //
+                       vx_uint8 input1[SRC_PIXELS],                                                                //
+                       vx_uint8 input2[SRC_PIXELS],                                                                //
+                       DstType output[DST_PIXELS]) {                                                               //
+#pragma HLS INLINE
+    ChannelCombineVector<DstType, 3, VEC_NUM, SRC_PIXELS, DST_PIXELS, DST_IMAGE>( //
+        (vx_image_data<vx_uint8, VEC_NUM> *)input0,                               //
+        (vx_image_data<vx_uint8, VEC_NUM> *)input1,                               //
+        (vx_image_data<vx_uint8, VEC_NUM> *)input2,                               //
+        NULL,                                                                     //
+        (vx_image_data<DstType, VEC_NUM> *)output);                               //
+}
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS, vx_df_image_e DST_IMAGE> //
+void ImgChannelCombine(vx_image_data<vx_uint8, VEC_NUM> input0[SRC_PIXELS / VEC_NUM],                              //
+                       vx_image_data<vx_uint8, VEC_NUM> input1[SRC_PIXELS / VEC_NUM],                              //
+                       vx_image_data<DstType, VEC_NUM> output[DST_PIXELS / VEC_NUM]) {                             //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input0, input1, output);
+    ChannelCombineVector<DstType, 2, VEC_NUM, SRC_PIXELS, DST_PIXELS, DST_IMAGE> //
+        (input0, input1, NULL, NULL, output);                                    //
+}
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS, vx_df_image_e DST_IMAGE> //
+void ImgChannelCombine(vx_uint8 input0[SRC_PIXELS],                                                                //
+                       vx_uint8 input1[SRC_PIXELS],                                                                //
+                       DstType output[DST_PIXELS]) {                                                               //
+#pragma HLS INLINE
+    ChannelCombineVector<DstType, 2, VEC_NUM, SRC_PIXELS, DST_PIXELS, DST_IMAGE>( //
+        (vx_image_data<vx_uint8, VEC_NUM> *)input0,                               //
+        (vx_image_data<vx_uint8, VEC_NUM> *)input1,                               //
+        NULL,                                                                     //
+        NULL,                                                                     //
+        (vx_image_data<DstType, VEC_NUM> *)output);                               //
+}
+
 /*********************************************************************************************************************/
 /** @brief  Implements the Channel Extraction Kernel. \n
  *  @details each "image type" has a "data type" \n
@@ -161,6 +250,40 @@ void ImgChannelExtract(SrcType input[SRC_PIXELS],                             //
     ChannelExtract<SrcType, CHANNEL_ID, SRC_PIXELS, DST_PIXELS, SRC_IMAGE>(input, output);
 }
 
+/*********************************************************************************************************************/
+/** @brief  Implements the Channel Extraction Kernel for vectorized images. \n
+ *  @details each "image type" has a "data type" \n
+ *                      - VX_DF_IMAGE_U16 (vx_uint16) \n
+ *                      - VX_DF_IMAGE_U32 (vx_uint32) \n
+ *                      - VX_DF_IMAGE_RGB (vx_uint32) \n
+ *                      - VX_DF_IMAGE_RGBX (vx_uint32) \n
+ * @param SrcType       The data type of the input image
+ * @param VEC_NUM       The amount of pixels computed in parallel (1 - 8)
+ * @param CHANNEL_ID    The id of the channel to extract
+ * @param SRC_PIXELS    The pixels of the input image
+ *                      Can differ for RGB, since the 24-bit are interleaved.
+ * @param DST_PIXELS    The pixels of the output image
+ * @param SRC_IMAGE     The image type of the input image (vx_df_image_e)
+ * @param input         The input image
+ * @param output        The output image
+ */
+template <typename SrcType, vx_uint8 VEC_NUM, const vx_uint16 CHANNEL_ID, vx_uint32 SRC_PIXELS, //
+          vx_uint32 DST_PIXELS, vx_df_image_e SRC_IMAGE>                                       //
+void ImgChannelExtract(vx_image_data<SrcType, VEC_NUM> input[SRC_PIXELS / VEC_NUM],            //
+                       vx_image_data<vx_uint8, VEC_NUM> output[DST_PIXELS / VEC_NUM]) {        //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, output);
+    ChannelExtractVector<SrcType, CHANNEL_ID, VEC_NUM, SRC_PIXELS, DST_PIXELS, SRC_IMAGE>(input, output);
+}
+template <typename SrcType, vx_uint8 VEC_NUM, const vx_uint16 CHANNEL_ID, vx_uint32 SRC_PIXELS, //
+          vx_uint32 DST_PIXELS, vx_df_image_e SRC_IMAGE>                                       //
+void ImgChannelExtract(SrcType input[SRC_PIXELS],                                              //
+                       vx_uint8 output[DST_PIXELS]) {                                          //
+#pragma HLS INLINE
+    ChannelExtractVector<SrcType, CHANNEL_ID, VEC_NUM, SRC_PIXELS, DST_PIXELS, SRC_IMAGE>(     //
+        (vx_image_data<SrcType, VEC_NUM> *)input, (vx_image_data<vx_uint8, VEC_NUM> *)output); //
+}
+
 /*********************************************************************************************************************/
 /** @brief Converts image bit depth. The output image dimensions
  *         should be the same as the dimensions of the input image. \n
@@ -232,9 +355,221 @@ void ImgConvertColor(SrcType input[SRC_PIXELS],
     ConvertColor<SrcType, DstType, SRC_PIXELS, DST_PIXELS, SRC_IMAGE, DST_IAMGE>(input, output);
 }
 
+/*********************************************************************************************************************/
+/** @brief  Converts the Color of a vectorized image between RGB/RGBX/Gray \n
+ *  @details Possible Conversions are \n
+ *      VX_DF_IMAGE_U8   -> VX_DF_IMAGE_RGB \n
+ *      VX_DF_IMAGE_U8   -> VX_DF_IMAGE_RGBX \n
+ *      VX_DF_IMAGE_RGB  -> VX_DF_IMAGE_U8 \n
+ *      VX_DF_IMAGE_RGB  -> VX_DF_IMAGE_RGBX \n
+ *      VX_DF_IMAGE_RGBX -> VX_DF_IMAGE_U8 \n
+ *      VX_DF_IMAGE_RGBX -> VX_DF_IMAGE_RGB \n
+ * @param SrcType       The datatype of the input image  (uint8 (Gray), uint32 (RGB, RGBX))
+ * @param DstType       The datatype of the output image (uint8 (Gray), uint32 (RGB, RGBX))
+ * @param VEC_NUM       The amount of pixels computed in parallel (1 - 8)
+ * @param SRC_PIXELS    The pixels of the input image (3/4 of the image pixels for RGB)
+ * @param DST_PIXELS    The pixels of the output image (3/4 of the image pixels for RGB)
+ * @param SRC_IMAGE     The color type of the input image (RGB, RGBX, U8)
+ * @param DST_IMAGE     The color type of the output image (RGB, RGBX, U8)
+ * @param input         The input image
+ * @param output        The output image
+ */
+template <typename SrcType, typename DstType, vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS, //
+          vx_df_image_e SRC_IMAGE, vx_df_image_e DST_IMAGE>                                                 //
+void ImgConvertColor(vx_image_data<SrcType, VEC_NUM> input[SRC_PIXELS / VEC_NUM],                           //
+                     vx_image_data<DstType, VEC_NUM> output[DST_PIXELS / VEC_NUM]) {                        //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, output);
+    ConvertColorVector<SrcType, DstType, VEC_NUM, SRC_PIXELS, DST_PIXELS, SRC_IMAGE, DST_IMAGE>(input, output);
+}
+template <typename SrcType, typename DstType, vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS, //
+          vx_df_image_e SRC_IMAGE, vx_df_image_e DST_IMAGE>                                                 //
+void ImgConvertColor(SrcType input[SRC_PIXELS],                                                             //
+                     DstType output[DST_PIXELS]) {                                                          //
+#pragma HLS INLINE
+    ConvertColorVector<SrcType, DstType, VEC_NUM, SRC_PIXELS, DST_PIXELS, SRC_IMAGE, DST_IMAGE>( //
+        (vx_image_data<SrcType, VEC_NUM> *)input, (vx_image_data<DstType, VEC_NUM> *)output);    //
+}
+
+/*********************************************************************************************************************/
+/** @brief  Converts a vectorized sRGB image into the HSV, YCbCr (BT.601/BT.709) or approximate Lab color space \n
+ *  @details The 3 channels of the color space are stored in place of R, G, B. They can be extracted by
+ *           ImgChannelExtract and be thresholded by ImgThreshold (e.g. color keying in HSV). \n
+ * @param VEC_NUM       The amount of pixels computed in parallel (1 - 8)
+ * @param SRC_PIXELS    The pixels of the input image (3/4 of the image pixels for RGB)
+ * @param DST_PIXELS    The pixels of the output image (3/4 of the image pixels for RGB)
+ * @param SRC_IMAGE     The color type of the input image (RGB, RGBX)
+ * @param DST_IMAGE     The color type of the output image (RGB, RGBX)
+ * @param COLOR_SPACE   The color space of the output image (HIFLIPVX::ColorSpace)
+ * @param input         The input image
+ * @param output        The output image
+ */
+template <vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS, vx_df_image_e SRC_IMAGE, //
+          vx_df_image_e DST_IMAGE, HIFLIPVX::ColorSpace COLOR_SPACE>                            //
+void ImgRgbToColorSpace(vx_image_data<vx_uint32, VEC_NUM> input[SRC_PIXELS / VEC_NUM],          //
+                        vx_image_data<vx_uint32, VEC_NUM> output[DST_PIXELS / VEC_NUM]) {       //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, output);
+    ConvertColorSpace<VEC_NUM, SRC_PIXELS, DST_PIXELS, SRC_IMAGE, DST_IMAGE, COLOR_SPACE, true>(input, output);
+}
+template <vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS, vx_df_image_e SRC_IMAGE, //
+          vx_df_image_e DST_IMAGE, HIFLIPVX::ColorSpace COLOR_SPACE>                            //
+void ImgRgbToColorSpace(vx_uint32 input[SRC_PIXELS],                                            //
+                        vx_uint32 output[DST_PIXELS]) {                                         //
+#pragma HLS INLINE
+    ConvertColorSpace<VEC_NUM, SRC_PIXELS, DST_PIXELS, SRC_IMAGE, DST_IMAGE, COLOR_SPACE, true>( //
+        (vx_image_data<vx_uint32, VEC_NUM> *)input, (vx_image_data<vx_uint32, VEC_NUM> *)output); //
+}
+
+/*********************************************************************************************************************/
+/** @brief  Converts a vectorized HSV, YCbCr (BT.601/BT.709) or approximate Lab image back to sRGB \n
+ * @param VEC_NUM       The amount of pixels computed in parallel (1 - 8)
+ * @param SRC_PIXELS    The pixels of the input image (3/4 of the image pixels for RGB)
+ * @param DST_PIXELS    The pixels of the output image (3/4 of the image pixels for RGB)
+ * @param SRC_IMAGE     The color type of the input image (RGB, RGBX)
+ * @param DST_IMAGE     The color type of the output image (RGB, RGBX)
+ * @param COLOR_SPACE   The color space of the input image (HIFLIPVX::ColorSpace)
+ * @param input         The input image
+ * @param output        The output image
+ */
+template <vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS, vx_df_image_e SRC_IMAGE, //
+          vx_df_image_e DST_IMAGE, HIFLIPVX::ColorSpace COLOR_SPACE>                            //
+void ImgColorSpaceToRgb(vx_image_data<vx_uint32, VEC_NUM> input[SRC_PIXELS / VEC_NUM],          //
+                        vx_image_data<vx_uint32, VEC_NUM> output[DST_PIXELS / VEC_NUM]) {       //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, output);
+    ConvertColorSpace<VEC_NUM, SRC_PIXELS, DST_PIXELS, SRC_IMAGE, DST_IMAGE, COLOR_SPACE, false>(input, output);
+}
+template <vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS, vx_df_image_e SRC_IMAGE, //
+          vx_df_image_e DST_IMAGE, HIFLIPVX::ColorSpace COLOR_SPACE>                            //
+void ImgColorSpaceToRgb(vx_uint32 input[SRC_PIXELS],                                            //
+                        vx_uint32 output[DST_PIXELS]) {                                         //
+#pragma HLS INLINE
+    ConvertColorSpace<VEC_NUM, SRC_PIXELS, DST_PIXELS, SRC_IMAGE, DST_IMAGE, COLOR_SPACE, false>( //
+        (vx_image_data<vx_uint32, VEC_NUM> *)input, (vx_image_data<vx_uint32, VEC_NUM> *)output);  //
+}
+
+/*********************************************************************************************************************/
+/** @brief  Converts the Color of a YUV image (BT.709 full range) to RGB/RGBX/Gray \n
+ *  @details Possible Conversions are \n
+ *      VX_DF_IMAGE_YUYV, VX_DF_IMAGE_UYVY -> VX_DF_IMAGE_U8, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX (1 input) \n
+ *      VX_DF_IMAGE_NV12, VX_DF_IMAGE_NV21 -> VX_DF_IMAGE_U8, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX (2 inputs) \n
+ *      VX_DF_IMAGE_IYUV                   -> VX_DF_IMAGE_U8, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX (3 inputs) \n
+ *      The subsampled chroma is replicated to the neighboring pixels. \n
+ *      The RGB output packs 4 pixels into 3 words, which results in (3 * WIDTH * HEIGHT / 4) output pixels.
+ * @param DstType       The datatype of the output image (uint8 (Gray), uint32 (RGB, RGBX))
+ * @param VEC_NUM       The vector size (1, 2, 4, 8) (YUYV/UYVY: 2, 4, 8)
+ * @param WIDTH         The image width (even)
+ * @param HEIGHT        The image height (even)
+ * @param SRC_IMAGE     The color type of the input image (YUYV, UYVY, NV12, NV21, IYUV)
+ * @param DST_IMAGE     The color type of the output image (RGB, RGBX, U8)
+ * @param input         The packed input image (16 bit per pixel: luma and alternating U and V)
+ * @param input_y       The luma plane of the input image (WIDTH * HEIGHT)
+ * @param input_uv      The interleaved chroma plane of the input image (WIDTH * HEIGHT / 4)
+ * @param input_u       The U plane of the input image (WIDTH * HEIGHT / 4)
+ * @param input_v       The V plane of the input image (WIDTH * HEIGHT / 4)
+ * @param output        The output image
+ */
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 WIDTH, vx_uint16 HEIGHT, //
+          vx_df_image_e SRC_IMAGE, vx_df_image_e DST_IMAGE>                      //
+void ImgConvertColorYuv(vx_image_data<vx_uint16, VEC_NUM> input[(WIDTH * HEIGHT) / VEC_NUM], //
+                        vx_image_data<DstType, VEC_NUM> *output) {                           //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, output);
+    ConvertColorYuvPacked<DstType, VEC_NUM, WIDTH, HEIGHT, SRC_IMAGE, DST_IMAGE>(input, output);
+}
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 WIDTH, vx_uint16 HEIGHT, //
+          vx_df_image_e SRC_IMAGE, vx_df_image_e DST_IMAGE>                      //
+void ImgConvertColorYuv(vx_uint16 input[WIDTH * HEIGHT],                         //
+                        DstType *output) {                                       //
+#pragma HLS INLINE
+    ConvertColorYuvPacked<DstType, VEC_NUM, WIDTH, HEIGHT, SRC_IMAGE, DST_IMAGE>( //
+        (vx_image_data<vx_uint16, VEC_NUM> *)input,                               //
+        (vx_image_data<DstType, VEC_NUM> *)output);                               //
+}
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 WIDTH, vx_uint16 HEIGHT,                   //
+          vx_df_image_e SRC_IMAGE, vx_df_image_e DST_IMAGE>                                        //
+void ImgConvertColorYuv(vx_image_data<vx_uint8, VEC_NUM> input_y[(WIDTH * HEIGHT) / VEC_NUM],      //
+                        vx_image_data<vx_uint16, (VEC_NUM + 1) / 2> *input_uv,                     //
+                        vx_image_data<DstType, VEC_NUM> *output) {                                 //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input_y, input_uv, output);
+    ConvertColorYuvPlanar<DstType, VEC_NUM, WIDTH, HEIGHT, SRC_IMAGE, DST_IMAGE>( //
+        input_y, input_uv, NULL, NULL, output);                                   //
+}
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 WIDTH, vx_uint16 HEIGHT, //
+          vx_df_image_e SRC_IMAGE, vx_df_image_e DST_IMAGE>                      //
+void ImgConvertColorYuv(vx_uint8 input_y[WIDTH * HEIGHT],                        //
+                        vx_uint16 input_uv[(WIDTH * HEIGHT) / 4],                //
+                        DstType *output) {                                       //
+#pragma HLS INLINE
+    ConvertColorYuvPlanar<DstType, VEC_NUM, WIDTH, HEIGHT, SRC_IMAGE, DST_IMAGE>( //
+        (vx_image_data<vx_uint8, VEC_NUM> *)input_y,                              //
+        (vx_image_data<vx_uint16, (VEC_NUM + 1) / 2> *)input_uv, NULL, NULL,      //
+        (vx_image_data<DstType, VEC_NUM> *)output);                               //
+}
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 WIDTH, vx_uint16 HEIGHT,              //
+          vx_df_image_e SRC_IMAGE, vx_df_image_e DST_IMAGE>                                   //
+void ImgConvertColorYuv(vx_image_data<vx_uint8, VEC_NUM> input_y[(WIDTH * HEIGHT) / VEC_NUM], //
+                        vx_image_data<vx_uint8, (VEC_NUM + 1) / 2> *input_u,                  //
+                        vx_image_data<vx_uint8, (VEC_NUM + 1) / 2> *input_v,                  //
+                        vx_image_data<DstType, VEC_NUM> *output) {                            //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input_y, input_u, input_v, output);
+    ConvertColorYuvPlanar<DstType, VEC_NUM, WIDTH, HEIGHT, SRC_IMAGE, DST_IMAGE>( //
+        input_y, NULL, input_u, input_v, output);                                 //
+}
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 WIDTH, vx_uint16 HEIGHT, //
+          vx_df_image_e SRC_IMAGE, vx_df_image_e DST_IMAGE>                      //
+void ImgConvertColorYuv(vx_uint8 input_y[WIDTH * HEIGHT],                        //
+                        vx_uint8 input_u[(WIDTH * HEIGHT) / 4],                  //
+                        vx_uint8 input_v[(WIDTH * HEIGHT) / 4],                  //
+                        DstType *output) {                                       //
+#pragma HLS INLINE
+    ConvertColorYuvPlanar<DstType, VEC_NUM, WIDTH, HEIGHT, SRC_IMAGE, DST_IMAGE>( //
+        (vx_image_data<vx_uint8, VEC_NUM> *)input_y, NULL,                        //
+        (vx_image_data<vx_uint8, (VEC_NUM + 1) / 2> *)input_u,                    //
+        (vx_image_data<vx_uint8, (VEC_NUM + 1) / 2> *)input_v,                    //
+        (vx_image_data<DstType, VEC_NUM> *)output);                               //
+}
+
+/*********************************************************************************************************************/
+/** @brief  Demosaics a raw Bayer image (RGGB, BGGR, GRBG, GBRG) to RGB/RGBX/Gray \n
+ * @details Uses a 5x5 sliding window with replicated borders. The bilinear method averages the nearest pixels of
+ *          the same color. The Malvar-He-Cutler method adds a gradient correction to reduce color fringes at edges.
+ *          The RGB output packs 4 pixels into 3 words, which results in (3 * WIDTH * HEIGHT / 4) output pixels.
+ * @param DstType       The datatype of the output image (uint8 (Gray), uint32 (RGB, RGBX))
+ * @param VEC_NUM       The vector size (1, 2, 4)
+ * @param WIDTH         The image width
+ * @param HEIGHT        The image height
+ * @param PATTERN       The color filter array layout (HIFLIPVX::BayerPattern)
+ * @param METHOD        The interpolation method (HIFLIPVX::DemosaicMethod)
+ * @param DST_IMAGE     The color type of the output image (RGB, RGBX, U8)
+ * @param input         The raw input image
+ * @param output        The output image
+ */
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 WIDTH, vx_uint16 HEIGHT, HIFLIPVX::BayerPattern PATTERN, //
+          HIFLIPVX::DemosaicMethod METHOD, vx_df_image_e DST_IMAGE>                                            //
+void ImgDemosaic(vx_image_data<vx_uint8, VEC_NUM> input[(WIDTH * HEIGHT) / VEC_NUM],                           //
+                 vx_image_data<DstType, VEC_NUM> *output) {                                                    //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, output);
+    Demosaic<DstType, VEC_NUM, WIDTH, HEIGHT, PATTERN, METHOD, DST_IMAGE>(input, output);
+}
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 WIDTH, vx_uint16 HEIGHT, HIFLIPVX::BayerPattern PATTERN, //
+          HIFLIPVX::DemosaicMethod METHOD, vx_df_image_e DST_IMAGE>                                            //
+void ImgDemosaic(vx_uint8 input[WIDTH * HEIGHT],                                                               //
+                 DstType *output) {                                                                            //
+#pragma HLS INLINE
+    Demosaic<DstType, VEC_NUM, WIDTH, HEIGHT, PATTERN, METHOD, DST_IMAGE>( //
+        (vx_image_data<vx_uint8, VEC_NUM> *)input,                         //
+        (vx_image_data<DstType, VEC_NUM> *)output);                        //
+}
+
 /*********************************************************************************************************************/
 /** @brief  Converts between two buffers with a different vector sizes (parallelization degree). \n
- * @details Input/output pixels can differ slightly if vector sizes are not a multiple of each other. \n
+ * @details Any vector sizes are supported (e.g. 3 -> 4, 6 -> 8, 5 -> 2) at one vector per clock on the wider side. \n
+ *          Input/output pixels can differ slightly if vector sizes are not a multiple of each other. \n
  *          In that case the bigger image needs to be aligned and filled with zeroes. \n
  * @param DataType      The data type of the input and output
  * @param IMAGES        The amount of images (batches)
@@ -573,6 +908,253 @@ void ImgScaleImage(vx_uint8 input[SRC_COLS * SRC_ROWS],               //
         (vx_image_data<vx_uint8, 1> *)output);                      //
 }
 
+/*********************************************************************************************************************/
+/** @brief  Scale a vectorized image up or down by an arbitrary ratio using bilinear or nearest neighbor interpolation
+ * @param DataType      The data type of the input and output image (vx_uint8, vx_uint16)
+ * @param VEC_NUM       The amount of pixels computed in parallel (1, 2, 4, 8)
+ * @param SRC_COLS      The columns of the input image
+ * @param SRC_ROWS      The rows of the input image
+ * @param DST_COLS      The columns of the output image
+ * @param DST_ROWS      The rows of the output image
+ * @param SCALE_TYPE    The type of interpolation (VX_INTERPOLATION_NEAREST_NEIGHBOR, VX_INTERPOLATION_BILINEAR)
+ * @param input         The input image
+ * @param output        The output image
+ */
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint16 SRC_COLS, vx_uint16 SRC_ROWS,        //
+          vx_uint16 DST_COLS, vx_uint16 DST_ROWS, vx_interpolation_type_e SCALE_TYPE>         //
+void ImgScaleImage(vx_image_data<DataType, VEC_NUM> input[(SRC_COLS * SRC_ROWS) / VEC_NUM],    //
+                   vx_image_data<DataType, VEC_NUM> output[(DST_COLS * DST_ROWS) / VEC_NUM]) { //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, output);
+    ScaleImageVector<DataType, VEC_NUM, SRC_COLS, SRC_ROWS, DST_COLS, DST_ROWS, SCALE_TYPE>(input, output);
+}
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint16 SRC_COLS, vx_uint16 SRC_ROWS, //
+          vx_uint16 DST_COLS, vx_uint16 DST_ROWS, vx_interpolation_type_e SCALE_TYPE>  //
+void ImgScaleImage(DataType input[SRC_COLS * SRC_ROWS],                                //
+                   DataType output[DST_COLS * DST_ROWS]) {                             //
+#pragma HLS INLINE
+    ScaleImageVector<DataType, VEC_NUM, SRC_COLS, SRC_ROWS, DST_COLS, DST_ROWS, SCALE_TYPE>( //
+        (vx_image_data<DataType, VEC_NUM> *)input,                                          //
+        (vx_image_data<DataType, VEC_NUM> *)output);                                        //
+}
+
+/*********************************************************************************************************************/
+/** @brief  Computes a Gaussian pyramid (scale 0.5, 5x5 Gaussian, replicated border) in a single pass over the input
+ * @details The amount of levels is given by the amount of outputs. Level 0 is a copy of the input image, to feed
+ *          all levels of a multi-scale pipeline from one read of the input.
+ * @param DataType      The data type of the input and output images (vx_uint8, vx_uint16)
+ * @param WIDTH         The width of the input image (multiple of 2^levels)
+ * @param HEIGHT        The height of the input image (multiple of 2^levels)
+ * @param input         The input image
+ * @param level0        The level 0 (WIDTH x HEIGHT)
+ * @param level1        The level 1 (WIDTH / 2 x HEIGHT / 2)
+ * @param level2        The level 2 (WIDTH / 4 x HEIGHT / 4)
+ * @param level3        The level 3 (WIDTH / 8 x HEIGHT / 8)
+ */
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT>                  //
+void ImgPyramid(vx_image_data<DataType, 1> input[WIDTH * HEIGHT],                //
+                vx_image_data<DataType, 1> level0[WIDTH * HEIGHT],               //
+                vx_image_data<DataType, 1> level1[(WIDTH / 2) * (HEIGHT / 2)]) { //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, level0, level1);
+    Pyramid<DataType, WIDTH, HEIGHT, 2>(input, level0, level1, NULL, NULL);
+}
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT> //
+void ImgPyramid(DataType input[WIDTH * HEIGHT],                 //
+                DataType level0[WIDTH * HEIGHT],                //
+                DataType level1[(WIDTH / 2) * (HEIGHT / 2)]) {  //
+#pragma HLS INLINE
+    Pyramid<DataType, WIDTH, HEIGHT, 2>((vx_image_data<DataType, 1> *)input,               //
+                                        (vx_image_data<DataType, 1> *)level0,              //
+                                        (vx_image_data<DataType, 1> *)level1, NULL, NULL); //
+}
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT>                  //
+void ImgPyramid(vx_image_data<DataType, 1> input[WIDTH * HEIGHT],                //
+                vx_image_data<DataType, 1> level0[WIDTH * HEIGHT],               //
+                vx_image_data<DataType, 1> level1[(WIDTH / 2) * (HEIGHT / 2)],   //
+                vx_image_data<DataType, 1> level2[(WIDTH / 4) * (HEIGHT / 4)]) { //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, level0, level1, level2);
+    Pyramid<DataType, WIDTH, HEIGHT, 3>(input, level0, level1, level2, NULL);
+}
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT> //
+void ImgPyramid(DataType input[WIDTH * HEIGHT],                 //
+                DataType level0[WIDTH * HEIGHT],                //
+                DataType level1[(WIDTH / 2) * (HEIGHT / 2)],    //
+                DataType level2[(WIDTH / 4) * (HEIGHT / 4)]) {  //
+#pragma HLS INLINE
+    Pyramid<DataType, WIDTH, HEIGHT, 3>((vx_image_data<DataType, 1> *)input,         //
+                                        (vx_image_data<DataType, 1> *)level0,        //
+                                        (vx_image_data<DataType, 1> *)level1,        //
+                                        (vx_image_data<DataType, 1> *)level2, NULL); //
+}
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT>                  //
+void ImgPyramid(vx_image_data<DataType, 1> input[WIDTH * HEIGHT],                //
+                vx_image_data<DataType, 1> level0[WIDTH * HEIGHT],               //
+                vx_image_data<DataType, 1> level1[(WIDTH / 2) * (HEIGHT / 2)],   //
+                vx_image_data<DataType, 1> level2[(WIDTH / 4) * (HEIGHT / 4)],   //
+                vx_image_data<DataType, 1> level3[(WIDTH / 8) * (HEIGHT / 8)]) { //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, level0, level1, level2, level3);
+    Pyramid<DataType, WIDTH, HEIGHT, 4>(input, level0, level1, level2, level3);
+}
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT> //
+void ImgPyramid(DataType input[WIDTH * HEIGHT],                 //
+                DataType level0[WIDTH * HEIGHT],                //
+                DataType level1[(WIDTH / 2) * (HEIGHT / 2)],    //
+                DataType level2[(WIDTH / 4) * (HEIGHT / 4)],    //
+                DataType level3[(WIDTH / 8) * (HEIGHT / 8)]) {  //
+#pragma HLS INLINE
+    Pyramid<DataType, WIDTH, HEIGHT, 4>((vx_image_data<DataType, 1> *)input,   //
+                                        (vx_image_data<DataType, 1> *)level0,  //
+                                        (vx_image_data<DataType, 1> *)level1,  //
+                                        (vx_image_data<DataType, 1> *)level2,  //
+                                        (vx_image_data<DataType, 1> *)level3); //
+}
+
+/*********************************************************************************************************************/
+/** @brief  Warps an image with an affine transformation (bilinear or nearest neighbor, constant 0 border)
+ * @details The source of output pixel (x, y) is (m[0] x + m[2] y + m[4], m[1] x + m[3] y + m[5]). The input is read
+ *          into a rolling cache of 2 * MAX_DISPLACEMENT + 3 rows instead of a full frame buffer.
+ * @param DataType         The data type of the input and output images (vx_uint8, vx_uint16)
+ * @param WIDTH            The width of the input and output images
+ * @param HEIGHT           The height of the input and output images
+ * @param MAX_DISPLACEMENT The maximum vertical distance between a destination pixel and its source in rows
+ * @param INTERPOLATION    The interpolation type (VX_INTERPOLATION_BILINEAR, VX_INTERPOLATION_NEAREST_NEIGHBOR)
+ * @param input            The input image
+ * @param output           The output image
+ * @param matrix           The 2x3 affine matrix in OpenVX (column-major) order
+ */
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint16 MAX_DISPLACEMENT, //
+          vx_interpolation_type_e INTERPOLATION>                                            //
+void ImgWarpAffine(vx_image_data<DataType, 1> input[WIDTH * HEIGHT],                        //
+                   vx_image_data<DataType, 1> output[WIDTH * HEIGHT],                       //
+                   const vx_float32 matrix[6]) {                                            //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, output);
+    Warp<DataType, WIDTH, HEIGHT, MAX_DISPLACEMENT, INTERPOLATION, false>(input, output, matrix);
+}
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint16 MAX_DISPLACEMENT, //
+          vx_interpolation_type_e INTERPOLATION>                                            //
+void ImgWarpAffine(DataType input[WIDTH * HEIGHT],                                          //
+                   DataType output[WIDTH * HEIGHT],                                         //
+                   const vx_float32 matrix[6]) {                                            //
+#pragma HLS INLINE
+    Warp<DataType, WIDTH, HEIGHT, MAX_DISPLACEMENT, INTERPOLATION, false>((vx_image_data<DataType, 1> *)input,  //
+                                                                          (vx_image_data<DataType, 1> *)output, //
+                                                                          matrix);                              //
+}
+
+/*********************************************************************************************************************/
+/** @brief  Warps an image with a perspective transformation (bilinear or nearest neighbor, constant 0 border)
+ * @details The source of output pixel (x, y) is (x0 / z0, y0 / z0) with x0 = m[0] x + m[3] y + m[6],
+ *          y0 = m[1] x + m[4] y + m[7] and z0 = m[2] x + m[5] y + m[8]. The input is read into a rolling cache of
+ *          2 * MAX_DISPLACEMENT + 3 rows instead of a full frame buffer.
+ * @param DataType         The data type of the input and output images (vx_uint8, vx_uint16)
+ * @param WIDTH            The width of the input and output images
+ * @param HEIGHT           The height of the input and output images
+ * @param MAX_DISPLACEMENT The maximum vertical distance between a destination pixel and its source in rows
+ * @param INTERPOLATION    The interpolation type (VX_INTERPOLATION_BILINEAR, VX_INTERPOLATION_NEAREST_NEIGHBOR)
+ * @param input            The input image
+ * @param output           The output image
+ * @param matrix           The 3x3 perspective matrix in OpenVX (column-major) order
+ */
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint16 MAX_DISPLACEMENT, //
+          vx_interpolation_type_e INTERPOLATION>                                            //
+void ImgWarpPerspective(vx_image_data<DataType, 1> input[WIDTH * HEIGHT],                   //
+                        vx_image_data<DataType, 1> output[WIDTH * HEIGHT],                  //
+                        const vx_float32 matrix[9]) {                                       //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, output);
+    Warp<DataType, WIDTH, HEIGHT, MAX_DISPLACEMENT, INTERPOLATION, true>(input, output, matrix);
+}
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint16 MAX_DISPLACEMENT, //
+          vx_interpolation_type_e INTERPOLATION>                                            //
+void ImgWarpPerspective(DataType input[WIDTH * HEIGHT],                                     //
+                        DataType output[WIDTH * HEIGHT],                                    //
+                        const vx_float32 matrix[9]) {                                       //
+#pragma HLS INLINE
+    Warp<DataType, WIDTH, HEIGHT, MAX_DISPLACEMENT, INTERPOLATION, true>((vx_image_data<DataType, 1> *)input,  //
+                                                                         (vx_image_data<DataType, 1> *)output, //
+                                                                         matrix);                              //
+}
+
+#if !defined(__SYNTHESIS__)
+/*********************************************************************************************************************/
+/** @brief  CPU version of ImgWarpAffine with bit-exact results (8 pixels at once if compiled with AVX2, e.g. -mavx2)
+ * @param DataType         The data type of the input and output images (vx_uint8, vx_uint16)
+ * @param WIDTH            The width of the input and output images
+ * @param HEIGHT           The height of the input and output images
+ * @param MAX_DISPLACEMENT The maximum vertical distance between a destination pixel and its source in rows
+ * @param INTERPOLATION    The interpolation type (VX_INTERPOLATION_BILINEAR, VX_INTERPOLATION_NEAREST_NEIGHBOR)
+ * @param input            The input image
+ * @param output           The output image
+ * @param matrix           The 2x3 affine matrix in OpenVX (column-major) order
+ */
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint16 MAX_DISPLACEMENT, //
+          vx_interpolation_type_e INTERPOLATION>                                            //
+void CpuWarpAffine(const DataType input[WIDTH * HEIGHT],                                    //
+                   DataType output[WIDTH * HEIGHT],                                         //
+                   const vx_float32 matrix[6]) {                                            //
+    WarpCpu<DataType, WIDTH, HEIGHT, MAX_DISPLACEMENT, INTERPOLATION, false>(input, output, matrix);
+}
+
+/*********************************************************************************************************************/
+/** @brief  CPU version of ImgWarpPerspective with bit-exact results (scalar, needs a 64-bit division per pixel)
+ * @param DataType         The data type of the input and output images (vx_uint8, vx_uint16)
+ * @param WIDTH            The width of the input and output images
+ * @param HEIGHT           The height of the input and output images
+ * @param MAX_DISPLACEMENT The maximum vertical distance between a destination pixel and its source in rows
+ * @param INTERPOLATION    The interpolation type (VX_INTERPOLATION_BILINEAR, VX_INTERPOLATION_NEAREST_NEIGHBOR)
+ * @param input            The input image
+ * @param output           The output image
+ * @param matrix           The 3x3 perspective matrix in OpenVX (column-major) order
+ */
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint16 MAX_DISPLACEMENT, //
+          vx_interpolation_type_e INTERPOLATION>                                            //
+void CpuWarpPerspective(const DataType input[WIDTH * HEIGHT],                               //
+                        DataType output[WIDTH * HEIGHT],                                    //
+                        const vx_float32 matrix[9]) {                                       //
+    WarpCpu<DataType, WIDTH, HEIGHT, MAX_DISPLACEMENT, INTERPOLATION, true>(input, output, matrix);
+}
+#endif
+
+/*********************************************************************************************************************/
+/** @brief  Remaps an image with a subsampled displacement grid (bilinear or nearest neighbor, constant 0 border)
+ * @details The source of pixel (x, y) is (x + dx, y + dy). The displacement is bilinearly interpolated from a grid with
+ *          one (dx, dy) entry in signed 12.4 fixed point every 2^GRID_BITS pixels. A 16x16 grid reads 4 bytes per 256
+ *          pixels instead of 8 bytes per pixel for a dense float map. The input is read into a rolling cache of
+ *          2 * MAX_DISPLACEMENT + 3 rows.
+ * @param DataType         The data type of the input and output images (vx_uint8, vx_uint16)
+ * @param WIDTH            The width of the input and output images (multiple of the grid size)
+ * @param HEIGHT           The height of the input and output images (multiple of the grid size)
+ * @param GRID_BITS        The grid size is 2^GRID_BITS pixels in both directions (1 - 7)
+ * @param MAX_DISPLACEMENT The maximum vertical displacement in rows
+ * @param INTERPOLATION    The interpolation type (VX_INTERPOLATION_BILINEAR, VX_INTERPOLATION_NEAREST_NEIGHBOR)
+ * @param input            The input image
+ * @param map              The displacement grid ((WIDTH / GRID + 1) x (HEIGHT / GRID + 1) entries of dx and dy)
+ * @param output           The output image
+ */
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint8 GRID_BITS, vx_uint16 MAX_DISPLACEMENT, //
+          vx_interpolation_type_e INTERPOLATION>                                                                //
+void ImgRemap(vx_image_data<DataType, 1> input[WIDTH * HEIGHT],                                                 //
+              vx_image_data<vx_int16, 2> map[((WIDTH >> GRID_BITS) + 1) * ((HEIGHT >> GRID_BITS) + 1)],         //
+              vx_image_data<DataType, 1> output[WIDTH * HEIGHT]) {                                              //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, map, output);
+    Remap<DataType, WIDTH, HEIGHT, GRID_BITS, MAX_DISPLACEMENT, INTERPOLATION>(input, map, output);
+}
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint8 GRID_BITS, vx_uint16 MAX_DISPLACEMENT, //
+          vx_interpolation_type_e INTERPOLATION>                                                                //
+void ImgRemap(DataType input[WIDTH * HEIGHT],                                                                   //
+              vx_int16 map[2 * ((WIDTH >> GRID_BITS) + 1) * ((HEIGHT >> GRID_BITS) + 1)],                       //
+              DataType output[WIDTH * HEIGHT]) {                                                                //
+#pragma HLS INLINE
+    Remap<DataType, WIDTH, HEIGHT, GRID_BITS, MAX_DISPLACEMENT, INTERPOLATION>((vx_image_data<DataType, 1> *)input,   //
+                                                                               (vx_image_data<vx_int16, 2> *)map,     //
+                                                                               (vx_image_data<DataType, 1> *)output); //
+}
+
 /**
  * @brief Downscales an image by computing the mean value of FACTOR * FACTOR pixels.
  * @tparam DataType Data type of the input / output image(unsigned)(8 - bit, 16 - bit)
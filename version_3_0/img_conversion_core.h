@@ -15,7 +15,7 @@
 #ifndef SRC_IMG_CONVERSION_CORE_H_
 #define SRC_IMG_CONVERSION_CORE_H_
 
-#include "vx_helper.h"
+#include "img_filter_window.h"
 
 /*********************************************************************************************************************/
 /** @brief Read from Gray Input
@@ -1016,6 +1016,1184 @@ void ConvertColor(SrcType input[SRC_PIXELS], DstType output[DST_PIXELS]) {
         ConvertRgbxToRgb<SrcType, DstType, SRC_PIXELS, DST_PIXELS>(input, output);
 }
 
+/*********************************************************************************************************************/
+/** @brief Converts a YUV pixel to RGB (BT.709 full range)
+ * @param y           The luma value
+ * @param u           The blue-difference chroma value
+ * @param v           The red-difference chroma value
+ * @param output_data The RGB pixel
+ */
+void ConvertYuvToRgb(vx_uint8 y, vx_uint8 u, vx_uint8 v, vx_uint8 output_data[3]) {
+#pragma HLS INLINE
+
+    // Remove chroma offset and scale luma to 10-bit fraction
+    const vx_int32 Y = static_cast<vx_int32>(y) << 10;
+    const vx_int32 U = static_cast<vx_int32>(u) - 128;
+    const vx_int32 V = static_cast<vx_int32>(v) - 128;
+
+    // Convert (coefficients have a 10-bit fraction)
+    const vx_int32 r = (Y + 1613 * V + 512) >> 10;          // (int)((1.5748 * 1024) + 0.5)
+    const vx_int32 g = (Y - 192 * U - 479 * V + 512) >> 10; // (int)((0.1873 * 1024) + 0.5), (0.4681 * 1024)
+    const vx_int32 b = (Y + 1900 * U + 512) >> 10;          // (int)((1.8556 * 1024) + 0.5)
+
+    // Saturate
+    output_data[0] = static_cast<vx_uint8>(MIN(MAX(r, 0), 255));
+    output_data[1] = static_cast<vx_uint8>(MIN(MAX(g, 0), 255));
+    output_data[2] = static_cast<vx_uint8>(MIN(MAX(b, 0), 255));
+}
+
+/*********************************************************************************************************************/
+/** @brief Writes a vector of converted pixels to the output image (U8, RGB or RGBX).
+ * @details For VX_DF_IMAGE_RGB the 3 bytes of each pixel are packed into 32-bit words. 4 input vectors result in 3
+ *          output vectors. The remaining bytes are stored in the buffer.
+ * @param DstType     The datatype of the output image (uint8 (U8), uint32 (RGB, RGBX))
+ * @param VEC_NUM     The amount of pixels computed in parallel
+ * @param OUTPUT_TYPE The color type of the output image (U8, RGB, RGBX)
+ * @param luma        The luma of the pixels (U8)
+ * @param rgb         The RGB values of the pixels (RGB, RGBX)
+ * @param cases       Different cases how the rgb pixels are distributed among the output vectors
+ * @param buffer      The bytes that have not been written yet (RGB)
+ * @param last_ptr    The index of the last output vector
+ * @param ptr         The index of the next output vector
+ * @param output      The output image
+ */
+template <typename DstType, vx_uint8 VEC_NUM, vx_df_image_e OUTPUT_TYPE>
+void ConvertColorWriteVector(vx_uint8 luma[VEC_NUM], vx_uint8 rgb[VEC_NUM][3], vx_uint8 &cases,
+                             vx_uint8 buffer[3 * VEC_NUM], vx_uint32 last_ptr, vx_uint32 &ptr,
+                             vx_image_data<DstType, VEC_NUM> *output) {
+#pragma HLS INLINE
+
+    vx_image_data<DstType, VEC_NUM> dst;
+
+    // Gray-scale is the luma of the pixel
+    if (OUTPUT_TYPE == VX_DF_IMAGE_U8) {
+        for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+            dst.pixel[j] = static_cast<DstType>(luma[j]);
+        }
+        GenerateDmaSignal<DstType, VEC_NUM>((ptr == 0), (ptr == last_ptr), dst);
+        output[ptr] = dst;
+        ptr++;
+
+        // One pixel per 32-bit word
+    } else if (OUTPUT_TYPE == VX_DF_IMAGE_RGBX) {
+        for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+            dst.pixel[j] = OutputRgbx<DstType>(rgb[j]);
+        }
+        GenerateDmaSignal<DstType, VEC_NUM>((ptr == 0), (ptr == last_ptr), dst);
+        output[ptr] = dst;
+        ptr++;
+
+        // 4 pixels in 3 32-bit words
+    } else if (OUTPUT_TYPE == VX_DF_IMAGE_RGB) {
+        const vx_uint16 pending = (cases == 0) ? (0) : ((4 - cases) * VEC_NUM);
+        vx_uint8 bytes[7 * VEC_NUM];
+#pragma HLS array_partition variable = bytes complete dim = 0
+
+        // Append the new bytes to the pending bytes
+        for (vx_uint16 k = 0; k < 7 * VEC_NUM; k++) {
+#pragma HLS unroll
+            const vx_uint16 n = k - pending;
+            if (k < pending)
+                bytes[k] = buffer[k];
+            else if (n < 3 * VEC_NUM)
+                bytes[k] = rgb[n / 3][n % 3];
+            else
+                bytes[k] = 0;
+        }
+
+        // Write a vector if enough bytes are available and keep the rest
+        if (cases != 0) {
+            for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+                dst.pixel[j] = OutputRgb<DstType>(&bytes[4 * j]);
+            }
+            GenerateDmaSignal<DstType, VEC_NUM>((ptr == 0), (ptr == last_ptr), dst);
+            output[ptr] = dst;
+            ptr++;
+            for (vx_uint16 k = 0; k < 3 * VEC_NUM; k++) {
+#pragma HLS unroll
+                buffer[k] = bytes[4 * VEC_NUM + k];
+            }
+        } else {
+            for (vx_uint16 k = 0; k < 3 * VEC_NUM; k++) {
+#pragma HLS unroll
+                buffer[k] = bytes[k];
+            }
+        }
+        cases = (cases + 1) & 3;
+    }
+}
+
+/*********************************************************************************************************************/
+/** @brief Reads a vector of pixels from the input image (U8, RGB or RGBX) and returns their RGB values.
+ * @details For VX_DF_IMAGE_RGB the 3 bytes of each pixel are packed into 32-bit words. 3 input vectors result in 4
+ *          pixel vectors, no input vector is read in every 4th call. The remaining bytes are stored in the buffer.
+ * @param SrcType    The datatype of the input image (uint8 (U8), uint32 (RGB, RGBX))
+ * @param VEC_NUM    The amount of pixels computed in parallel
+ * @param INPUT_TYPE The color type of the input image (U8, RGB, RGBX)
+ * @param input      The input image
+ * @param cases      Different cases how the rgb pixels are distributed among the input vectors
+ * @param buffer     The bytes that have not been used yet (RGB)
+ * @param ptr        The index of the next input vector
+ * @param rgb        The RGB values of the pixels
+ */
+template <typename SrcType, vx_uint8 VEC_NUM, vx_df_image_e INPUT_TYPE>
+void ConvertColorReadVector(vx_image_data<SrcType, VEC_NUM> *input, vx_uint8 &cases, vx_uint8 buffer[3 * VEC_NUM],
+                            vx_uint32 &ptr, vx_uint8 rgb[VEC_NUM][3]) {
+#pragma HLS INLINE
+
+    vx_image_data<SrcType, VEC_NUM> src;
+
+    // Gray-scale is replicated to all channels
+    if (INPUT_TYPE == VX_DF_IMAGE_U8) {
+        src = input[ptr];
+        ptr++;
+        for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+            vx_uint8 data = 0;
+            InputGray<SrcType>(src.pixel[j], data, rgb[j]);
+        }
+
+        // One pixel per 32-bit word
+    } else if (INPUT_TYPE == VX_DF_IMAGE_RGBX) {
+        src = input[ptr];
+        ptr++;
+        for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+            vx_uint32 data = 0;
+            InputRgbx<SrcType>(src.pixel[j], data, rgb[j]);
+        }
+
+        // 4 pixels in 3 32-bit words
+    } else if (INPUT_TYPE == VX_DF_IMAGE_RGB) {
+        const vx_uint16 pending = cases * VEC_NUM;
+        vx_uint8 words[VEC_NUM][4];
+        vx_uint8 bytes[7 * VEC_NUM];
+#pragma HLS array_partition variable = words complete dim = 0
+#pragma HLS array_partition variable = bytes complete dim = 0
+
+        // Read a vector if not enough bytes are pending
+        if (cases < 3) {
+            src = input[ptr];
+            ptr++;
+        }
+        for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+            vx_uint32 data = 0;
+            InputRgb<SrcType>(src.pixel[j], data, words[j]);
+        }
+
+        // Append the new bytes to the pending bytes
+        for (vx_uint16 k = 0; k < 7 * VEC_NUM; k++) {
+#pragma HLS unroll
+            const vx_uint16 n = k - pending;
+            if (k < pending)
+                bytes[k] = buffer[k];
+            else if (n < 4 * VEC_NUM)
+                bytes[k] = words[n / 4][n % 4];
+            else
+                bytes[k] = 0;
+        }
+
+        // Use 3 bytes per pixel and keep the rest
+        for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+            rgb[j][0] = bytes[3 * j + 0];
+            rgb[j][1] = bytes[3 * j + 1];
+            rgb[j][2] = bytes[3 * j + 2];
+        }
+        for (vx_uint16 k = 0; k < 3 * VEC_NUM; k++) {
+#pragma HLS unroll
+            buffer[k] = bytes[3 * VEC_NUM + k];
+        }
+        cases = (cases + 1) & 3;
+    }
+}
+
+/*********************************************************************************************************************/
+/** @brief Converts the Color of a vectorized image between VX_DF_IMAGE_RGB / VX_DF_IMAGE_RGBX / VX_DF_IMAGE_U8
+ * @param SrcType     The datatype of the input image  (uint8 (Gray), uint32 (RGB, RGBX))
+ * @param DstType     The datatype of the output image (uint8 (Gray), uint32 (RGB, RGBX))
+ * @param VEC_NUM     The amount of pixels computed in parallel (1 - 8)
+ * @param SRC_PIXELS  The elements of the input image (3/4 of the pixels for RGB)
+ * @param DST_PIXELS  The elements of the output image (3/4 of the pixels for RGB)
+ * @param INPUT_TYPE  The color type of the input image (RGB, RGBX, Gray)
+ * @param OUTPUT_TYPE The color type of the output image (RGB, RGBX, Gray)
+ * @param input       The input image
+ * @param output      The output image
+ */
+template <typename SrcType, typename DstType, vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS,
+          vx_df_image_e INPUT_TYPE, vx_df_image_e OUTPUT_TYPE>
+void ConvertColorVector(vx_image_data<SrcType, VEC_NUM> input[SRC_PIXELS / VEC_NUM],
+                        vx_image_data<DstType, VEC_NUM> output[DST_PIXELS / VEC_NUM]) {
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint32 PIXELS = (INPUT_TYPE == VX_DF_IMAGE_RGB) ? ((SRC_PIXELS / 3) * 4) : (SRC_PIXELS);
+    const vx_uint32 DST_VECTORS = DST_PIXELS / VEC_NUM;
+
+    // Check function parameters/types
+    ConvertColorDataTypes<SrcType, DstType, INPUT_TYPE, OUTPUT_TYPE>();
+    STATIC_ASSERT(INPUT_TYPE != OUTPUT_TYPE, color_conversion_type_not_supported);
+    STATIC_ASSERT((VEC_NUM >= 1) && (VEC_NUM <= 8), vec_num_must_be_between_1_and_8);
+    STATIC_ASSERT((PIXELS % (4 * VEC_NUM)) == 0, pixels_must_be_multiple_of_4_times_vec_num);
+
+    // Buffers for the RGB packing
+    vx_uint8 read_cases = 0, write_cases = 0;
+    vx_uint8 read_buffer[3 * VEC_NUM], write_buffer[3 * VEC_NUM];
+#pragma HLS array_partition variable = read_buffer complete dim = 0
+#pragma HLS array_partition variable = write_buffer complete dim = 0
+
+    // Convert VEC_NUM pixels per clock cycle
+    for (vx_uint32 i = 0, src_ptr = 0, dst_ptr = 0; i < PIXELS / VEC_NUM; i++) {
+#pragma HLS PIPELINE II = 1
+        vx_uint8 rgb[VEC_NUM][3];
+        vx_uint8 luma[VEC_NUM];
+#pragma HLS array_partition variable = rgb complete dim = 0
+#pragma HLS array_partition variable = luma complete dim = 0
+
+        // Read from input
+        ConvertColorReadVector<SrcType, VEC_NUM, INPUT_TYPE>(input, read_cases, read_buffer, src_ptr, rgb);
+
+        // Gray-scale (BT.601)
+        for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+            luma[j] = OutputGray<vx_uint8>(rgb[j]);
+        }
+
+        // Write to output
+        ConvertColorWriteVector<DstType, VEC_NUM, OUTPUT_TYPE>(luma, rgb, write_cases, write_buffer, DST_VECTORS - 1,
+                                                               dst_ptr, output);
+    }
+}
+
+/*********************************************************************************************************************/
+/** @brief Implements the Channel Extraction Kernel for vectorized images.
+ * @param SrcType    The datatype of the input image  (vx_uint16 (U16), vx_uint32 (U32, RGB, RGBX))
+ * @param CHANNEL_ID The id of the channel to extract
+ * @param VEC_NUM    The amount of pixels computed in parallel (1 - 8)
+ * @param SRC_PIXELS The elements of the input image (3/4 of the pixels for RGB)
+ * @param DST_PIXELS The pixels of the output image
+ * @param INPUT_TYPE The color type of the input image (VX_DF_IMAGE_U16, VX_DF_IMAGE_U32, VX_DF_IMAGE_RGB,
+ *                   VX_DF_IMAGE_RGBX)
+ * @param input      The input image
+ * @param output     The output image
+ */
+template <typename SrcType, const vx_uint16 CHANNEL_ID, vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS,
+          vx_df_image_e INPUT_TYPE>
+void ChannelExtractVector(vx_image_data<SrcType, VEC_NUM> input[SRC_PIXELS / VEC_NUM],
+                          vx_image_data<vx_uint8, VEC_NUM> output[DST_PIXELS / VEC_NUM]) {
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint32 DST_VECTORS = DST_PIXELS / VEC_NUM;
+
+    // Check function parameters/types
+    ChannelExtractDataTypes<SrcType, CHANNEL_ID, INPUT_TYPE>();
+    STATIC_ASSERT((VEC_NUM >= 1) && (VEC_NUM <= 8), vec_num_must_be_between_1_and_8);
+    STATIC_ASSERT((INPUT_TYPE != VX_DF_IMAGE_RGB) || ((DST_PIXELS % (4 * VEC_NUM)) == 0),
+                  pixels_must_be_multiple_of_4_times_vec_num);
+
+    // Buffers for the RGB unpacking
+    vx_uint8 cases = 0;
+    vx_uint8 buffer[3 * VEC_NUM];
+#pragma HLS array_partition variable = buffer complete dim = 0
+
+    // Extract VEC_NUM pixels per clock cycle
+    for (vx_uint32 i = 0, src_ptr = 0; i < DST_VECTORS; i++) {
+#pragma HLS PIPELINE II = 1
+        vx_image_data<vx_uint8, VEC_NUM> dst;
+
+        // Packed RGB needs to be unpacked first, the other types hold one pixel per element
+        if (INPUT_TYPE == VX_DF_IMAGE_RGB) {
+            vx_uint8 rgb[VEC_NUM][3];
+#pragma HLS array_partition variable = rgb complete dim = 0
+            ConvertColorReadVector<SrcType, VEC_NUM, VX_DF_IMAGE_RGB>(input, cases, buffer, src_ptr, rgb);
+            for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+                dst.pixel[j] = rgb[j][CHANNEL_ID % 3];
+            }
+        } else {
+            vx_image_data<SrcType, VEC_NUM> src = input[i];
+            for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+                dst.pixel[j] = static_cast<vx_uint8>((src.pixel[j] >> (8 * CHANNEL_ID)) & 0xFF);
+            }
+        }
+
+        // Write to output
+        GenerateDmaSignal<vx_uint8, VEC_NUM>((i == 0), (i == DST_VECTORS - 1), dst);
+        output[i] = dst;
+    }
+}
+
+/*********************************************************************************************************************/
+/** @brief Implements the Channel Combine Kernel for vectorized images.
+ * @param DstType        The datatype of the output image  (vx_uint16 (U16), vx_uint32 (U32, RGB, RGBX))
+ * @param CHANNEL_AMOUNT The amount of channels to combine
+ * @param VEC_NUM        The amount of pixels computed in parallel (1 - 8)
+ * @param SRC_PIXELS     The pixels of the input planes
+ * @param DST_PIXELS     The elements of the output image (3/4 of the pixels for RGB)
+ * @param OUTPUT_TYPE    The color type of the output image (VX_DF_IMAGE_U16, VX_DF_IMAGE_U32, VX_DF_IMAGE_RGB,
+ *                       VX_DF_IMAGE_RGBX)
+ * @param input0         The 1. plane of the input image
+ * @param input1         The 2. plane of the input image
+ * @param input2         The 3. plane of the input image (optional)
+ * @param input3         The 4. plane of the input image (optional)
+ * @param output         The output image
+ */
+template <typename DstType, vx_uint16 CHANNEL_AMOUNT, vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS,
+          vx_df_image_e OUTPUT_TYPE>
+void ChannelCombineVector(vx_image_data<vx_uint8, VEC_NUM> input0[SRC_PIXELS / VEC_NUM],
+                          vx_image_data<vx_uint8, VEC_NUM> input1[SRC_PIXELS / VEC_NUM],
+                          vx_image_data<vx_uint8, VEC_NUM> input2[SRC_PIXELS / VEC_NUM],
+                          vx_image_data<vx_uint8, VEC_NUM> input3[SRC_PIXELS / VEC_NUM],
+                          vx_image_data<DstType, VEC_NUM> output[DST_PIXELS / VEC_NUM]) {
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint32 DST_VECTORS = DST_PIXELS / VEC_NUM;
+
+    // Check function parameters/types
+    ChannelCombineDataTypes<DstType, CHANNEL_AMOUNT, OUTPUT_TYPE>();
+    STATIC_ASSERT((VEC_NUM >= 1) && (VEC_NUM <= 8), vec_num_must_be_between_1_and_8);
+    STATIC_ASSERT((OUTPUT_TYPE != VX_DF_IMAGE_RGB) || ((SRC_PIXELS % (4 * VEC_NUM)) == 0),
+                  pixels_must_be_multiple_of_4_times_vec_num);
+
+    // Buffers for the RGB packing
+    vx_uint8 cases = 0;
+    vx_uint8 buffer[3 * VEC_NUM];
+#pragma HLS array_partition variable = buffer complete dim = 0
+
+    // Combine VEC_NUM pixels per clock cycle
+    for (vx_uint32 i = 0, dst_ptr = 0; i < SRC_PIXELS / VEC_NUM; i++) {
+#pragma HLS PIPELINE II = 1
+        vx_image_data<vx_uint8, VEC_NUM> src[4];
+        vx_uint8 channels[VEC_NUM][4];
+#pragma HLS array_partition variable = src complete dim = 0
+#pragma HLS array_partition variable = channels complete dim = 0
+
+        // Read from input planes
+        if (CHANNEL_AMOUNT > 0)
+            src[0] = input0[i];
+        if (CHANNEL_AMOUNT > 1)
+            src[1] = input1[i];
+        if (CHANNEL_AMOUNT > 2)
+            src[2] = input2[i];
+        if (CHANNEL_AMOUNT > 3)
+            src[3] = input3[i];
+        for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+            for (vx_uint16 k = 0; k < 4; k++) {
+#pragma HLS unroll
+                channels[j][k] = (k < CHANNEL_AMOUNT) ? (src[k].pixel[j]) : (0);
+            }
+        }
+
+        // RGB and RGBX are written like a color conversion, U16 and U32 hold one pixel per element
+        if ((OUTPUT_TYPE == VX_DF_IMAGE_RGB) || (OUTPUT_TYPE == VX_DF_IMAGE_RGBX)) {
+            vx_uint8 rgb[VEC_NUM][3];
+            vx_uint8 luma[VEC_NUM];
+#pragma HLS array_partition variable = rgb complete dim = 0
+#pragma HLS array_partition variable = luma complete dim = 0
+            for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+                rgb[j][0] = channels[j][0];
+                rgb[j][1] = channels[j][1];
+                rgb[j][2] = channels[j][2];
+                luma[j] = 0;
+            }
+            ConvertColorWriteVector<DstType, VEC_NUM, OUTPUT_TYPE>(luma, rgb, cases, buffer, DST_VECTORS - 1, dst_ptr,
+                                                                   output);
+        } else {
+            vx_image_data<DstType, VEC_NUM> dst;
+            for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+                DstType data = 0;
+                for (vx_uint16 k = 0; k < CHANNEL_AMOUNT; k++) {
+#pragma HLS unroll
+                    data |= static_cast<DstType>(channels[j][k]) << (8 * k);
+                }
+                dst.pixel[j] = data;
+            }
+            GenerateDmaSignal<DstType, VEC_NUM>((i == 0), (i == DST_VECTORS - 1), dst);
+            output[i] = dst;
+        }
+    }
+}
+
+/*********************************************************************************************************************/
+/** @brief Divides a 16-bit value by 255 and rounds to the nearest integer
+ * @param value The dividend (0 - 65535)
+ * @return      value / 255
+ */
+inline vx_uint32 DivideBy255(vx_uint32 value) {
+#pragma HLS INLINE
+    const vx_uint32 data = value + 128;
+    return (data + (data >> 8)) >> 8;
+}
+
+/*********************************************************************************************************************/
+/** @brief Computes the integer square root (digit by digit)
+ * @param BITS  The bit width of the input (even)
+ * @param value The input
+ * @return      floor(sqrt(value))
+ */
+template <vx_uint8 BITS> vx_uint32 IntegerSqrt(vx_uint32 value) {
+#pragma HLS INLINE
+    vx_uint32 result = 0;
+    vx_uint32 remainder = 0;
+    for (vx_int16 shift = BITS - 2; shift >= 0; shift -= 2) {
+#pragma HLS unroll
+        remainder = (remainder << 2) | ((value >> shift) & 3);
+        const vx_uint32 trial = (result << 2) | 1;
+        result <<= 1;
+        if (remainder >= trial) {
+            remainder -= trial;
+            result |= 1;
+        }
+    }
+    return result;
+}
+
+/*********************************************************************************************************************/
+/** @brief Computes the integer cube root (digit by digit)
+ * @param BITS  The bit width of the input (multiple of 3)
+ * @param value The input
+ * @return      floor(cbrt(value))
+ */
+template <vx_uint8 BITS> vx_uint32 IntegerCbrt(vx_uint32 value) {
+#pragma HLS INLINE
+    vx_uint32 result = 0;
+    for (vx_int16 shift = BITS - 3; shift >= 0; shift -= 3) {
+#pragma HLS unroll
+        result <<= 1;
+        const vx_uint32 trial = 3 * result * (result + 1) + 1;
+        if ((value >> shift) >= trial) {
+            value -= trial << shift;
+            result++;
+        }
+    }
+    return result;
+}
+
+/*********************************************************************************************************************/
+/** @brief Converts an sRGB pixel to HSV (all channels 8-bit, hue 0 - 255 covers 0 - 360 degree)
+ * @param rgb The RGB values of the pixel
+ * @param hsv The HSV values of the pixel
+ */
+inline void RgbToHsv(vx_uint8 rgb[3], vx_uint8 hsv[3]) {
+#pragma HLS INLINE
+    const vx_int32 r = rgb[0], g = rgb[1], b = rgb[2];
+    const vx_int32 max = MAX(MAX(r, g), b);
+    const vx_int32 min = MIN(MIN(r, g), b);
+    const vx_int32 delta = max - min;
+
+    // Hue: sector of the maximum channel plus the position inside of the sector
+    vx_int32 numerator = 0;
+    if (max == r)
+        numerator = g - b;
+    else if (max == g)
+        numerator = 2 * delta + b - r;
+    else
+        numerator = 4 * delta + r - g;
+    if (numerator < 0)
+        numerator += 6 * delta;
+    const vx_int32 hue = (delta == 0) ? (0) : ((numerator * 256 + 3 * delta) / (6 * delta));
+
+    hsv[0] = static_cast<vx_uint8>(hue & 255);
+    hsv[1] = static_cast<vx_uint8>((max == 0) ? (0) : ((delta * 255 + max / 2) / max));
+    hsv[2] = static_cast<vx_uint8>(max);
+}
+
+/*********************************************************************************************************************/
+/** @brief Converts an HSV pixel to sRGB (all channels 8-bit, hue 0 - 255 covers 0 - 360 degree)
+ * @param hsv The HSV values of the pixel
+ * @param rgb The RGB values of the pixel
+ */
+inline void HsvToRgb(vx_uint8 hsv[3], vx_uint8 rgb[3]) {
+#pragma HLS INLINE
+    const vx_uint32 h6 = static_cast<vx_uint32>(hsv[0]) * 6;
+    const vx_uint32 s = hsv[1], v = hsv[2];
+    const vx_uint32 sector = h6 >> 8;
+    const vx_uint32 f = h6 & 255;
+
+    // Intermediate values of the falling, constant and rising channels
+    const vx_uint8 p = static_cast<vx_uint8>(DivideBy255(v * (255 - s)));
+    const vx_uint8 q = static_cast<vx_uint8>(DivideBy255(v * (255 - ((s * f + 128) >> 8))));
+    const vx_uint8 t = static_cast<vx_uint8>(DivideBy255(v * (255 - ((s * (256 - f) + 128) >> 8))));
+    const vx_uint8 w = static_cast<vx_uint8>(v);
+
+    const vx_uint8 r[6] = {w, q, p, p, t, w};
+    const vx_uint8 g[6] = {t, w, w, q, p, p};
+    const vx_uint8 b[6] = {p, p, t, w, w, q};
+    rgb[0] = r[sector];
+    rgb[1] = g[sector];
+    rgb[2] = b[sector];
+}
+
+/*********************************************************************************************************************/
+/** @brief Converts an sRGB pixel to full range YCbCr (JPEG/JFIF) with Q14 coefficients
+ * @param COLOR_SPACE The coefficients (COLOR_SPACE_YCBCR_BT601, COLOR_SPACE_YCBCR_BT709)
+ * @param rgb         The RGB values of the pixel
+ * @param ycbcr       The YCbCr values of the pixel
+ */
+template <HIFLIPVX::ColorSpace COLOR_SPACE> void RgbToYCbCr(vx_uint8 rgb[3], vx_uint8 ycbcr[3]) {
+#pragma HLS INLINE
+    const bool BT709 = (COLOR_SPACE == HIFLIPVX::COLOR_SPACE_YCBCR_BT709);
+    const vx_int32 OFFSET = (128 << 14) + (1 << 13);
+    const vx_int32 r = rgb[0], g = rgb[1], b = rgb[2];
+
+    const vx_int32 y = (BT709) ? (3483 * r + 11718 * g + 1183 * b) : (4899 * r + 9617 * g + 1868 * b);
+    const vx_int32 cb = (BT709) ? (-1877 * r - 6315 * g + 8192 * b) : (-2765 * r - 5427 * g + 8192 * b);
+    const vx_int32 cr = (BT709) ? (8192 * r - 7441 * g - 751 * b) : (8192 * r - 6860 * g - 1332 * b);
+
+    ycbcr[0] = static_cast<vx_uint8>(MIN((y + (1 << 13)) >> 14, 255));
+    ycbcr[1] = static_cast<vx_uint8>(MIN((cb + OFFSET) >> 14, 255));
+    ycbcr[2] = static_cast<vx_uint8>(MIN((cr + OFFSET) >> 14, 255));
+}
+
+/*********************************************************************************************************************/
+/** @brief Converts a full range YCbCr (JPEG/JFIF) pixel to sRGB with Q14 coefficients
+ * @param COLOR_SPACE The coefficients (COLOR_SPACE_YCBCR_BT601, COLOR_SPACE_YCBCR_BT709)
+ * @param ycbcr       The YCbCr values of the pixel
+ * @param rgb         The RGB values of the pixel
+ */
+template <HIFLIPVX::ColorSpace COLOR_SPACE> void YCbCrToRgb(vx_uint8 ycbcr[3], vx_uint8 rgb[3]) {
+#pragma HLS INLINE
+    const bool BT709 = (COLOR_SPACE == HIFLIPVX::COLOR_SPACE_YCBCR_BT709);
+    const vx_int32 y = (static_cast<vx_int32>(ycbcr[0]) << 14) + (1 << 13);
+    const vx_int32 cb = static_cast<vx_int32>(ycbcr[1]) - 128;
+    const vx_int32 cr = static_cast<vx_int32>(ycbcr[2]) - 128;
+
+    const vx_int32 r = (BT709) ? (y + 25802 * cr) : (y + 22970 * cr);
+    const vx_int32 g = (BT709) ? (y - 3069 * cb - 7670 * cr) : (y - 5638 * cb - 11700 * cr);
+    const vx_int32 b = (BT709) ? (y + 30402 * cb) : (y + 29032 * cb);
+
+    rgb[0] = static_cast<vx_uint8>(MIN(MAX(r, 0) >> 14, 255));
+    rgb[1] = static_cast<vx_uint8>(MIN(MAX(g, 0) >> 14, 255));
+    rgb[2] = static_cast<vx_uint8>(MIN(MAX(b, 0) >> 14, 255));
+}
+
+/*********************************************************************************************************************/
+/** @brief Converts an sRGB value into linear light (Q16)
+ * @param value The sRGB value
+ * @return      The linear value (0 - 65535)
+ */
+inline vx_uint16 SrgbToLinear(vx_uint8 value) {
+#pragma HLS INLINE
+    static const vx_uint16 LUT[256] = {
+        0, 20, 40, 60, 80, 99, 119, 139, 159, 179, 199, 219, 241, 264, 288, 313,
+        340, 367, 396, 427, 458, 491, 526, 562, 599, 637, 677, 718, 761, 805, 851, 898,
+        947, 997, 1048, 1101, 1156, 1212, 1270, 1330, 1391, 1453, 1517, 1583, 1651, 1720, 1790, 1863,
+        1937, 2013, 2090, 2170, 2250, 2333, 2418, 2504, 2592, 2681, 2773, 2866, 2961, 3058, 3157, 3258,
+        3360, 3464, 3570, 3678, 3788, 3900, 4014, 4129, 4247, 4366, 4488, 4611, 4736, 4864, 4993, 5124,
+        5257, 5392, 5530, 5669, 5810, 5953, 6099, 6246, 6395, 6547, 6700, 6856, 7014, 7174, 7335, 7500,
+        7666, 7834, 8004, 8177, 8352, 8528, 8708, 8889, 9072, 9258, 9445, 9635, 9828, 10022, 10219, 10417,
+        10619, 10822, 11028, 11235, 11446, 11658, 11873, 12090, 12309, 12530, 12754, 12980, 13209, 13440, 13673, 13909,
+        14146, 14387, 14629, 14874, 15122, 15371, 15623, 15878, 16135, 16394, 16656, 16920, 17187, 17456, 17727, 18001,
+        18277, 18556, 18837, 19121, 19407, 19696, 19987, 20281, 20577, 20876, 21177, 21481, 21787, 22096, 22407, 22721,
+        23038, 23357, 23678, 24002, 24329, 24658, 24990, 25325, 25662, 26001, 26344, 26688, 27036, 27386, 27739, 28094,
+        28452, 28813, 29176, 29542, 29911, 30282, 30656, 31033, 31412, 31794, 32179, 32567, 32957, 33350, 33745, 34143,
+        34544, 34948, 35355, 35764, 36176, 36591, 37008, 37429, 37852, 38278, 38706, 39138, 39572, 40009, 40449, 40891,
+        41337, 41785, 42236, 42690, 43147, 43606, 44069, 44534, 45002, 45473, 45947, 46423, 46903, 47385, 47871, 48359,
+        48850, 49344, 49841, 50341, 50844, 51349, 51858, 52369, 52884, 53401, 53921, 54445, 54971, 55500, 56032, 56567,
+        57105, 57646, 58190, 58737, 59287, 59840, 60396, 60955, 61517, 62082, 62650, 63221, 63795, 64372, 64952, 65535
+    };
+    return LUT[value];
+}
+
+/*********************************************************************************************************************/
+/** @brief Converts a linear light value (Q16) into sRGB. The table is indexed by the square root of the linear value,
+ *         since the sRGB curve is steep for dark values.
+ * @param value The linear value (0 - 65535)
+ * @return      The sRGB value
+ */
+inline vx_uint8 LinearToSrgb(vx_uint32 value) {
+#pragma HLS INLINE
+    static const vx_uint8 LUT[512] = {
+        0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 5,
+        5, 6, 6, 7, 8, 8, 9, 10, 10, 11, 12, 12, 13, 14, 14, 15, 16, 16, 17, 18,
+        18, 19, 20, 20, 21, 22, 22, 23, 24, 24, 25, 26, 26, 27, 28, 28, 29, 29, 30, 31,
+        31, 32, 33, 33, 34, 34, 35, 36, 36, 37, 38, 38, 39, 39, 40, 41, 41, 42, 42, 43,
+        44, 44, 45, 45, 46, 47, 47, 48, 48, 49, 49, 50, 51, 51, 52, 52, 53, 54, 54, 55,
+        55, 56, 56, 57, 58, 58, 59, 59, 60, 60, 61, 62, 62, 63, 63, 64, 64, 65, 65, 66,
+        67, 67, 68, 68, 69, 69, 70, 70, 71, 72, 72, 73, 73, 74, 74, 75, 75, 76, 76, 77,
+        78, 78, 79, 79, 80, 80, 81, 81, 82, 82, 83, 83, 84, 85, 85, 86, 86, 87, 87, 88,
+        88, 89, 89, 90, 90, 91, 91, 92, 93, 93, 94, 94, 95, 95, 96, 96, 97, 97, 98, 98,
+        99, 99, 100, 100, 101, 101, 102, 102, 103, 103, 104, 105, 105, 106, 106, 107, 107, 108, 108, 109,
+        109, 110, 110, 111, 111, 112, 112, 113, 113, 114, 114, 115, 115, 116, 116, 117, 117, 118, 118, 119,
+        119, 120, 120, 121, 121, 122, 122, 123, 123, 124, 124, 125, 125, 126, 126, 127, 127, 128, 128, 129,
+        129, 130, 130, 131, 131, 132, 132, 133, 133, 134, 134, 135, 135, 136, 136, 137, 137, 138, 138, 139,
+        139, 140, 140, 141, 141, 142, 142, 143, 143, 144, 144, 145, 145, 146, 146, 146, 147, 147, 148, 148,
+        149, 149, 150, 150, 151, 151, 152, 152, 153, 153, 154, 154, 155, 155, 156, 156, 157, 157, 158, 158,
+        159, 159, 159, 160, 160, 161, 161, 162, 162, 163, 163, 164, 164, 165, 165, 166, 166, 167, 167, 168,
+        168, 169, 169, 169, 170, 170, 171, 171, 172, 172, 173, 173, 174, 174, 175, 175, 176, 176, 177, 177,
+        177, 178, 178, 179, 179, 180, 180, 181, 181, 182, 182, 183, 183, 184, 184, 184, 185, 185, 186, 186,
+        187, 187, 188, 188, 189, 189, 190, 190, 191, 191, 191, 192, 192, 193, 193, 194, 194, 195, 195, 196,
+        196, 197, 197, 197, 198, 198, 199, 199, 200, 200, 201, 201, 202, 202, 202, 203, 203, 204, 204, 205,
+        205, 206, 206, 207, 207, 207, 208, 208, 209, 209, 210, 210, 211, 211, 212, 212, 212, 213, 213, 214,
+        214, 215, 215, 216, 216, 217, 217, 217, 218, 218, 219, 219, 220, 220, 221, 221, 222, 222, 222, 223,
+        223, 224, 224, 225, 225, 226, 226, 226, 227, 227, 228, 228, 229, 229, 230, 230, 230, 231, 231, 232,
+        232, 233, 233, 234, 234, 234, 235, 235, 236, 236, 237, 237, 238, 238, 238, 239, 239, 240, 240, 241,
+        241, 242, 242, 242, 243, 243, 244, 244, 245, 245, 246, 246, 246, 247, 247, 248, 248, 249, 249, 250,
+        250, 250, 251, 251, 252, 252, 253, 253, 253, 254, 254, 255
+    };
+    return LUT[IntegerSqrt<18>(MIN(value, 65535) << 2)];
+}
+
+/*********************************************************************************************************************/
+/** @brief The nonlinear function of CIE Lab: f(t) = cbrt(t) or a linear segment for small t
+ * @param value t in Q16 (normalized by the white point)
+ * @return      f(t) in Q10
+ */
+inline vx_int32 LabForward(vx_int32 value) {
+#pragma HLS INLINE
+    const vx_uint32 t = static_cast<vx_uint32>(MIN(MAX(value, 0), 65535));
+    if (t > 580)
+        return static_cast<vx_int32>(IntegerCbrt<30>(t << 14));
+    else
+        return static_cast<vx_int32>(((t * 7974 + 32768) >> 16) + 141);
+}
+
+/*********************************************************************************************************************/
+/** @brief The inverse of LabForward
+ * @param value f(t) in Q14
+ * @return      t in Q16
+ */
+inline vx_int32 LabInverse(vx_int32 value) {
+#pragma HLS INLINE
+    if (value > 3390) {
+        const vx_int64 f = value;
+        return static_cast<vx_int32>((f * f * f + (1LL << 25)) >> 26);
+    } else {
+        return ((value - 2260) * 65536) / 127583;
+    }
+}
+
+/*********************************************************************************************************************/
+/** @brief Converts an sRGB pixel to approximate CIE Lab (D65). Uses 8-bit encoding: L * 255 / 100, a + 128, b + 128
+ * @param rgb The RGB values of the pixel
+ * @param lab The Lab values of the pixel
+ */
+inline void RgbToLab(vx_uint8 rgb[3], vx_uint8 lab[3]) {
+#pragma HLS INLINE
+    const vx_int32 r = SrgbToLinear(rgb[0]);
+    const vx_int32 g = SrgbToLinear(rgb[1]);
+    const vx_int32 b = SrgbToLinear(rgb[2]);
+
+    // XYZ normalized by the D65 white point (Q16)
+    const vx_int32 x = static_cast<vx_int32>((static_cast<vx_int64>(7110) * r + 6164 * g + 3110 * b + 8192) >> 14);
+    const vx_int32 y = static_cast<vx_int32>((static_cast<vx_int64>(3484) * r + 11717 * g + 1183 * b + 8192) >> 14);
+    const vx_int32 z = static_cast<vx_int32>((static_cast<vx_int64>(291) * r + 1794 * g + 14299 * b + 8192) >> 14);
+
+    // f(t) in Q10
+    const vx_int32 fx = LabForward(x);
+    const vx_int32 fy = LabForward(y);
+    const vx_int32 fz = LabForward(z);
+
+    // L = 116 * f(y) - 16, a = 500 * (f(x) - f(y)), b = 200 * (f(y) - f(z))
+    const vx_int32 l_value = ((116 * fy - (16 << 10)) * 255) / 100;
+    const vx_int32 a_value = 500 * (fx - fy) + (128 << 10);
+    const vx_int32 b_value = 200 * (fy - fz) + (128 << 10);
+    lab[0] = static_cast<vx_uint8>(MIN((MAX(l_value, 0) + 512) >> 10, 255));
+    lab[1] = static_cast<vx_uint8>(MIN((MAX(a_value, 0) + 512) >> 10, 255));
+    lab[2] = static_cast<vx_uint8>(MIN((MAX(b_value, 0) + 512) >> 10, 255));
+}
+
+/*********************************************************************************************************************/
+/** @brief Converts an approximate CIE Lab (D65) pixel to sRGB. Uses 8-bit encoding: L * 255 / 100, a + 128, b + 128
+ * @param lab The Lab values of the pixel
+ * @param rgb The RGB values of the pixel
+ */
+inline void LabToRgb(vx_uint8 lab[3], vx_uint8 rgb[3]) {
+#pragma HLS INLINE
+
+    // f(t) in Q14
+    const vx_int32 fy = ((static_cast<vx_int32>(lab[0]) * 100 * 16384 + 127) / 255 + (16 << 14) + 58) / 116;
+    const vx_int32 fx = fy + ((static_cast<vx_int32>(lab[1]) - 128) * 16384) / 500;
+    const vx_int32 fz = fy - ((static_cast<vx_int32>(lab[2]) - 128) * 16384) / 200;
+
+    // XYZ normalized by the D65 white point (Q16)
+    const vx_int64 x = LabInverse(fx);
+    const vx_int64 y = LabInverse(fy);
+    const vx_int64 z = LabInverse(fz);
+
+    // Linear RGB (Q16)
+    const vx_int64 r = (50461 * x - 25184 * y - 8893 * z + 8192) >> 14;
+    const vx_int64 g = (-15094 * x + 30737 * y + 741 * z + 8192) >> 14;
+    const vx_int64 b = (866 * x - 3343 * y + 18861 * z + 8192) >> 14;
+    rgb[0] = LinearToSrgb(static_cast<vx_uint32>(MAX(r, static_cast<vx_int64>(0))));
+    rgb[1] = LinearToSrgb(static_cast<vx_uint32>(MAX(g, static_cast<vx_int64>(0))));
+    rgb[2] = LinearToSrgb(static_cast<vx_uint32>(MAX(b, static_cast<vx_int64>(0))));
+}
+
+/*********************************************************************************************************************/
+/** @brief Converts a pixel from sRGB into a color space or back
+ * @param COLOR_SPACE The color space (HSV, YCbCr BT.601/BT.709, Lab)
+ * @param FROM_RGB    true: sRGB -> color space, false: color space -> sRGB
+ * @param input       The 3 channels of the input pixel
+ * @param output      The 3 channels of the output pixel
+ */
+template <HIFLIPVX::ColorSpace COLOR_SPACE, bool FROM_RGB>
+void ColorSpacePixel(vx_uint8 input[3], vx_uint8 output[3]) {
+#pragma HLS INLINE
+    if (COLOR_SPACE == HIFLIPVX::COLOR_SPACE_HSV) {
+        if (FROM_RGB)
+            RgbToHsv(input, output);
+        else
+            HsvToRgb(input, output);
+    } else if (COLOR_SPACE == HIFLIPVX::COLOR_SPACE_LAB) {
+        if (FROM_RGB)
+            RgbToLab(input, output);
+        else
+            LabToRgb(input, output);
+    } else {
+        if (FROM_RGB)
+            RgbToYCbCr<COLOR_SPACE>(input, output);
+        else
+            YCbCrToRgb<COLOR_SPACE>(input, output);
+    }
+}
+
+/*********************************************************************************************************************/
+/** @brief Converts a vectorized image from sRGB into a color space or back. Both images store 3 channels per pixel
+ *         in the VX_DF_IMAGE_RGB (24-bit) or VX_DF_IMAGE_RGBX (32-bit) layout, so the channels of the color space can
+ *         be extracted by the channel extraction.
+ * @param VEC_NUM     The amount of pixels computed in parallel (1 - 8)
+ * @param SRC_PIXELS  The elements of the input image (3/4 of the pixels for RGB)
+ * @param DST_PIXELS  The elements of the output image (3/4 of the pixels for RGB)
+ * @param INPUT_TYPE  The layout of the input image (VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX)
+ * @param OUTPUT_TYPE The layout of the output image (VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX)
+ * @param COLOR_SPACE The color space (HSV, YCbCr BT.601/BT.709, Lab)
+ * @param FROM_RGB    true: sRGB -> color space, false: color space -> sRGB
+ * @param input       The input image
+ * @param output      The output image
+ */
+template <vx_uint8 VEC_NUM, vx_uint32 SRC_PIXELS, vx_uint32 DST_PIXELS, vx_df_image_e INPUT_TYPE,
+          vx_df_image_e OUTPUT_TYPE, HIFLIPVX::ColorSpace COLOR_SPACE, bool FROM_RGB>
+void ConvertColorSpace(vx_image_data<vx_uint32, VEC_NUM> input[SRC_PIXELS / VEC_NUM],
+                       vx_image_data<vx_uint32, VEC_NUM> output[DST_PIXELS / VEC_NUM]) {
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint32 PIXELS = (INPUT_TYPE == VX_DF_IMAGE_RGB) ? ((SRC_PIXELS / 3) * 4) : (SRC_PIXELS);
+    const vx_uint32 DST_VECTORS = DST_PIXELS / VEC_NUM;
+
+    // Check function parameters/types
+    STATIC_ASSERT((INPUT_TYPE == VX_DF_IMAGE_RGB) || (INPUT_TYPE == VX_DF_IMAGE_RGBX), input_must_be_rgb_or_rgbx);
+    STATIC_ASSERT((OUTPUT_TYPE == VX_DF_IMAGE_RGB) || (OUTPUT_TYPE == VX_DF_IMAGE_RGBX), output_must_be_rgb_or_rgbx);
+    STATIC_ASSERT((VEC_NUM >= 1) && (VEC_NUM <= 8), vec_num_must_be_between_1_and_8);
+    STATIC_ASSERT((PIXELS % (4 * VEC_NUM)) == 0, pixels_must_be_multiple_of_4_times_vec_num);
+
+    // Buffers for the RGB packing
+    vx_uint8 read_cases = 0, write_cases = 0;
+    vx_uint8 read_buffer[3 * VEC_NUM], write_buffer[3 * VEC_NUM];
+#pragma HLS array_partition variable = read_buffer complete dim = 0
+#pragma HLS array_partition variable = write_buffer complete dim = 0
+
+    // Convert VEC_NUM pixels per clock cycle
+    for (vx_uint32 i = 0, src_ptr = 0, dst_ptr = 0; i < PIXELS / VEC_NUM; i++) {
+#pragma HLS PIPELINE II = 1
+        vx_uint8 src[VEC_NUM][3];
+        vx_uint8 dst[VEC_NUM][3];
+        vx_uint8 luma[VEC_NUM];
+#pragma HLS array_partition variable = src complete dim = 0
+#pragma HLS array_partition variable = dst complete dim = 0
+#pragma HLS array_partition variable = luma complete dim = 0
+
+        // Read from input
+        ConvertColorReadVector<vx_uint32, VEC_NUM, INPUT_TYPE>(input, read_cases, read_buffer, src_ptr, src);
+
+        // Convert the color space
+        for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+            ColorSpacePixel<COLOR_SPACE, FROM_RGB>(src[j], dst[j]);
+            luma[j] = 0;
+        }
+
+        // Write to output
+        ConvertColorWriteVector<vx_uint32, VEC_NUM, OUTPUT_TYPE>(luma, dst, write_cases, write_buffer,
+                                                                 DST_VECTORS - 1, dst_ptr, output);
+    }
+}
+
+/*********************************************************************************************************************/
+// Check data types and sizes of a YUV color conversion
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_df_image_e INPUT_TYPE,
+          vx_df_image_e OUTPUT_TYPE>
+void ConvertColorYuvChecks() {
+
+    // Constants
+    const vx_uint32 OUTPUT_SIZE = sizeof(DstType);
+    const bool OUT_IS_SIGNED = std::numeric_limits<DstType>::is_signed;
+
+    // Check types and sizes (static assertions)
+    const bool allowed_input = (INPUT_TYPE == VX_DF_IMAGE_NV12) || (INPUT_TYPE == VX_DF_IMAGE_NV21) ||
+                               (INPUT_TYPE == VX_DF_IMAGE_IYUV) || (INPUT_TYPE == VX_DF_IMAGE_YUYV) ||
+                               (INPUT_TYPE == VX_DF_IMAGE_UYVY);
+    const bool allowed_output = (OUTPUT_SIZE == 1 && OUTPUT_TYPE == VX_DF_IMAGE_U8) ||
+                                (OUTPUT_SIZE == 4 && OUTPUT_TYPE == VX_DF_IMAGE_RGB) ||
+                                (OUTPUT_SIZE == 4 && OUTPUT_TYPE == VX_DF_IMAGE_RGBX);
+    STATIC_ASSERT(allowed_input, color_conversion_type_not_supported);
+    STATIC_ASSERT(OUT_IS_SIGNED == false, datatype_of_input_and_output_must_be_unsigned);
+    STATIC_ASSERT(allowed_output, missmatch_output_datatype_size_and_output_type);
+    STATIC_ASSERT((VEC_NUM == 1) || (VEC_NUM == 2) || (VEC_NUM == 4) || (VEC_NUM == 8), vec_num_must_be_1_2_4_or_8);
+    STATIC_ASSERT(((WIDTH % 2) == 0) && ((HEIGHT % 2) == 0), width_and_height_must_be_even_for_chroma_subsampling);
+    STATIC_ASSERT((WIDTH % VEC_NUM) == 0, width_must_be_multiple_of_vec_num);
+    STATIC_ASSERT((OUTPUT_TYPE != VX_DF_IMAGE_RGB) || (((WIDTH * HEIGHT) % (4 * VEC_NUM)) == 0),
+                  rgb_output_needs_multiple_of_4_vectors);
+}
+
+/*********************************************************************************************************************/
+/** @brief Converts a packed 4:2:2 YUV image (YUYV, UYVY) to U8, RGB or RGBX
+ * @param DstType     The datatype of the output image (uint8 (U8), uint32 (RGB, RGBX))
+ * @param VEC_NUM     The amount of pixels computed in parallel (2, 4, 8)
+ * @param WIDTH       The image width
+ * @param HEIGHT      The image height
+ * @param INPUT_TYPE  The color type of the input image (YUYV, UYVY)
+ * @param OUTPUT_TYPE The color type of the output image (U8, RGB, RGBX)
+ * @param input       The input image (16-bit per pixel: luma and one chroma value)
+ * @param output      The output image
+ */
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_df_image_e INPUT_TYPE,
+          vx_df_image_e OUTPUT_TYPE>
+void ConvertColorYuvPacked(vx_image_data<vx_uint16, VEC_NUM> input[(WIDTH * HEIGHT) / VEC_NUM],
+                           vx_image_data<DstType, VEC_NUM> *output) {
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint32 VECTORS = (WIDTH * HEIGHT) / VEC_NUM;
+    const vx_uint32 DST_VECTORS = (OUTPUT_TYPE == VX_DF_IMAGE_RGB) ? ((3 * VECTORS) / 4) : (VECTORS);
+    const bool YUYV = (INPUT_TYPE == VX_DF_IMAGE_YUYV);
+
+    // Check data types of color conversion
+    ConvertColorYuvChecks<DstType, VEC_NUM, WIDTH, HEIGHT, INPUT_TYPE, OUTPUT_TYPE>();
+    STATIC_ASSERT((INPUT_TYPE == VX_DF_IMAGE_YUYV) || (INPUT_TYPE == VX_DF_IMAGE_UYVY), input_must_be_yuyv_or_uyvy);
+    STATIC_ASSERT((VEC_NUM % 2) == 0, vec_num_must_be_even_for_packed_yuv);
+
+    // Global variables
+    vx_uint8 cases = 0;
+    vx_uint8 buffer[3 * VEC_NUM];
+#pragma HLS array_partition variable = buffer complete dim = 0
+
+    // Convert the image
+    for (vx_uint32 i = 0, ptr = 0; i < VECTORS; i++) {
+#pragma HLS PIPELINE II = 1
+        vx_uint8 luma[VEC_NUM];
+        vx_uint8 rgb[VEC_NUM][3];
+#pragma HLS array_partition variable = luma complete dim = 0
+#pragma HLS array_partition variable = rgb complete dim = 0
+
+        // Read from input
+        vx_image_data<vx_uint16, VEC_NUM> src = input[i];
+
+        // Each pair of pixels shares its chroma values
+        for (vx_uint16 j = 0; j < VEC_NUM; j += 2) {
+#pragma HLS unroll
+            const vx_uint16 data0 = src.pixel[j + 0];
+            const vx_uint16 data1 = src.pixel[j + 1];
+            const vx_uint8 u = static_cast<vx_uint8>(YUYV ? (data0 >> 8) : (data0 & 0xFF));
+            const vx_uint8 v = static_cast<vx_uint8>(YUYV ? (data1 >> 8) : (data1 & 0xFF));
+            luma[j + 0] = static_cast<vx_uint8>(YUYV ? (data0 & 0xFF) : (data0 >> 8));
+            luma[j + 1] = static_cast<vx_uint8>(YUYV ? (data1 & 0xFF) : (data1 >> 8));
+            ConvertYuvToRgb(luma[j + 0], u, v, rgb[j + 0]);
+            ConvertYuvToRgb(luma[j + 1], u, v, rgb[j + 1]);
+        }
+
+        // Write to output
+        ConvertColorWriteVector<DstType, VEC_NUM, OUTPUT_TYPE>(luma, rgb, cases, buffer, DST_VECTORS - 1, ptr, output);
+    }
+}
+
+/*********************************************************************************************************************/
+/** @brief Converts a 4:2:0 YUV image (NV12, NV21, IYUV) to U8, RGB or RGBX
+ * @details The chroma of the even rows is stored in a line buffer and reused by the odd rows.
+ * @param DstType     The datatype of the output image (uint8 (U8), uint32 (RGB, RGBX))
+ * @param VEC_NUM     The amount of pixels computed in parallel (1, 2, 4, 8)
+ * @param WIDTH       The image width
+ * @param HEIGHT      The image height
+ * @param INPUT_TYPE  The color type of the input image (NV12, NV21, IYUV)
+ * @param OUTPUT_TYPE The color type of the output image (U8, RGB, RGBX)
+ * @param input_y     The luma plane
+ * @param input_uv    The interleaved chroma plane (NV12, NV21)
+ * @param input_u     The U plane (IYUV)
+ * @param input_v     The V plane (IYUV)
+ * @param output      The output image
+ */
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_df_image_e INPUT_TYPE,
+          vx_df_image_e OUTPUT_TYPE>
+void ConvertColorYuvPlanar(vx_image_data<vx_uint8, VEC_NUM> input_y[(WIDTH * HEIGHT) / VEC_NUM],
+                           vx_image_data<vx_uint16, (VEC_NUM + 1) / 2> *input_uv,
+                           vx_image_data<vx_uint8, (VEC_NUM + 1) / 2> *input_u,
+                           vx_image_data<vx_uint8, (VEC_NUM + 1) / 2> *input_v,
+                           vx_image_data<DstType, VEC_NUM> *output) {
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint16 CHROMA_VEC = (VEC_NUM + 1) / 2;
+    const vx_uint32 VECTORS = (WIDTH * HEIGHT) / VEC_NUM;
+    const vx_uint32 DST_VECTORS = (OUTPUT_TYPE == VX_DF_IMAGE_RGB) ? ((3 * VECTORS) / 4) : (VECTORS);
+    const vx_uint16 LINE_VECTORS = WIDTH / (2 * CHROMA_VEC);
+
+    // Check data types of color conversion
+    ConvertColorYuvChecks<DstType, VEC_NUM, WIDTH, HEIGHT, INPUT_TYPE, OUTPUT_TYPE>();
+    STATIC_ASSERT((INPUT_TYPE == VX_DF_IMAGE_NV12) || (INPUT_TYPE == VX_DF_IMAGE_NV21) ||
+                      (INPUT_TYPE == VX_DF_IMAGE_IYUV),
+                  input_must_be_nv12_nv21_or_iyuv);
+
+    // Line buffer for the chroma of the even rows (U in the lower, V in the upper byte)
+    vx_image_data<vx_uint16, CHROMA_VEC> linebuffer[LINE_VECTORS];
+    vx_image_data<vx_uint16, CHROMA_VEC> chroma;
+
+    // Global variables
+    vx_uint8 cases = 0;
+    vx_uint8 buffer[3 * VEC_NUM];
+#pragma HLS array_partition variable = buffer complete dim = 0
+
+    // Convert the image
+    for (vx_uint32 i = 0, ptr = 0, chroma_ptr = 0, x = 0, y = 0; i < VECTORS; i++) {
+#pragma HLS PIPELINE II = 1
+        vx_uint8 luma[VEC_NUM];
+        vx_uint8 rgb[VEC_NUM][3];
+#pragma HLS array_partition variable = luma complete dim = 0
+#pragma HLS array_partition variable = rgb complete dim = 0
+
+        // Read luma from input
+        vx_image_data<vx_uint8, VEC_NUM> src = input_y[i];
+
+        // Read chroma from input (even rows) or from the line buffer (odd rows)
+        if ((VEC_NUM > 1) || ((x % 2) == 0)) {
+            const vx_uint16 line_ptr = static_cast<vx_uint16>(x / (2 * CHROMA_VEC));
+            if ((y % 2) == 0) {
+                if (INPUT_TYPE == VX_DF_IMAGE_IYUV) {
+                    vx_image_data<vx_uint8, CHROMA_VEC> src_u = input_u[chroma_ptr];
+                    vx_image_data<vx_uint8, CHROMA_VEC> src_v = input_v[chroma_ptr];
+                    for (vx_uint16 k = 0; k < CHROMA_VEC; k++) {
+#pragma HLS unroll
+                        chroma.pixel[k] = static_cast<vx_uint16>(src_u.pixel[k]) |
+                                          static_cast<vx_uint16>(static_cast<vx_uint16>(src_v.pixel[k]) << 8);
+                    }
+                } else {
+                    vx_image_data<vx_uint16, CHROMA_VEC> src_uv = input_uv[chroma_ptr];
+                    for (vx_uint16 k = 0; k < CHROMA_VEC; k++) {
+#pragma HLS unroll
+                        const vx_uint16 data = src_uv.pixel[k];
+                        chroma.pixel[k] = (INPUT_TYPE == VX_DF_IMAGE_NV12)
+                                              ? (data)
+                                              : static_cast<vx_uint16>((data >> 8) | ((data & 0xFF) << 8));
+                    }
+                }
+                linebuffer[line_ptr] = chroma;
+                chroma_ptr++;
+            } else {
+                chroma = linebuffer[line_ptr];
+            }
+        }
+
+        // Each chroma value is shared by 2 horizontal pixels
+        for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+            const vx_uint16 data = chroma.pixel[j / 2];
+            luma[j] = src.pixel[j];
+            ConvertYuvToRgb(luma[j], static_cast<vx_uint8>(data & 0xFF), static_cast<vx_uint8>(data >> 8), rgb[j]);
+        }
+
+        // Write to output
+        ConvertColorWriteVector<DstType, VEC_NUM, OUTPUT_TYPE>(luma, rgb, cases, buffer, DST_VECTORS - 1, ptr, output);
+
+        // Update image coordinates
+        x += VEC_NUM;
+        if (x == WIDTH) {
+            x = 0;
+            y++;
+        }
+    }
+}
+
+/*********************************************************************************************************************/
+/** @brief Interpolates the RGB values of a single pixel of a raw Bayer image
+ * @details All kernels are scaled by 16. Malvar-He-Cutler adds a gradient correction of the center color to the
+ *          bilinear interpolation.
+ * @param METHOD      The interpolation method (bilinear, Malvar-He-Cutler)
+ * @param window      The 5x5 neighborhood of the pixel
+ * @param site        The color of the center pixel (0: red, 1: green in a red row, 2: green in a blue row, 3: blue)
+ * @param rgb         The RGB values of the pixel
+ */
+template <HIFLIPVX::DemosaicMethod METHOD>
+void DemosaicPixel(vx_uint8 window[5][5], vx_uint8 site, vx_uint8 rgb[3]) {
+#pragma HLS INLINE
+
+    // Neighbors of the center pixel
+    const vx_int32 c = window[2][2];
+    const vx_int32 cross1 = window[1][2] + window[3][2] + window[2][1] + window[2][3]; // distance 1 (N, S, W, E)
+    const vx_int32 diag1 = window[1][1] + window[1][3] + window[3][1] + window[3][3];  // distance 1 (diagonal)
+    const vx_int32 hor1 = window[2][1] + window[2][3];                                // distance 1 (W, E)
+    const vx_int32 ver1 = window[1][2] + window[3][2];                                // distance 1 (N, S)
+    const vx_int32 hor2 = window[2][0] + window[2][4];                                // distance 2 (W, E)
+    const vx_int32 ver2 = window[0][2] + window[4][2];                                // distance 2 (N, S)
+    const vx_int32 cross2 = hor2 + ver2;                                              // distance 2 (N, S, W, E)
+
+    // Green at red/blue, red/blue at blue/red, red/blue in the same row and red/blue in the same column
+    vx_int32 cross = 0, diag = 0, hor = 0, ver = 0;
+    if (METHOD == HIFLIPVX::DEMOSAIC_BILINEAR) {
+        cross = 4 * cross1;
+        diag = 4 * diag1;
+        hor = 8 * hor1;
+        ver = 8 * ver1;
+    } else {
+        cross = 8 * c + 4 * cross1 - 2 * cross2;
+        diag = 12 * c + 4 * diag1 - 3 * cross2;
+        hor = 10 * c + 8 * hor1 - 2 * diag1 - 2 * hor2 + ver2;
+        ver = 10 * c + 8 * ver1 - 2 * diag1 - 2 * ver2 + hor2;
+    }
+
+    // Select the interpolated colors by the color of the center pixel
+    vx_int32 r = 0, g = 0, b = 0;
+    switch (site) {
+    case 0:
+        r = 16 * c, g = cross, b = diag;
+        break;
+    case 1:
+        r = hor, g = 16 * c, b = ver;
+        break;
+    case 2:
+        r = ver, g = 16 * c, b = hor;
+        break;
+    default:
+        r = diag, g = cross, b = 16 * c;
+        break;
+    }
+
+    // Normalize (round to nearest) and saturate
+    rgb[0] = static_cast<vx_uint8>(MIN(MAX((r + 8) >> 4, 0), 255));
+    rgb[1] = static_cast<vx_uint8>(MIN(MAX((g + 8) >> 4, 0), 255));
+    rgb[2] = static_cast<vx_uint8>(MIN(MAX((b + 8) >> 4, 0), 255));
+}
+
+/*********************************************************************************************************************/
+/** @brief Demosaics a raw Bayer image to U8, RGB or RGBX using the sliding window of the filter functions
+ * @param DstType     The datatype of the output image (uint8 (U8), uint32 (RGB, RGBX))
+ * @param VEC_NUM     The amount of pixels computed in parallel (1, 2, 4)
+ * @param WIDTH       The image width
+ * @param HEIGHT      The image height
+ * @param PATTERN     The color filter array layout (BayerPattern)
+ * @param METHOD      The interpolation method (DemosaicMethod)
+ * @param OUTPUT_TYPE The color type of the output image (U8, RGB, RGBX)
+ * @param input       The raw input image
+ * @param output      The output image
+ */
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 WIDTH, vx_uint16 HEIGHT, HIFLIPVX::BayerPattern PATTERN,
+          HIFLIPVX::DemosaicMethod METHOD, vx_df_image_e OUTPUT_TYPE>
+void Demosaic(vx_image_data<vx_uint8, VEC_NUM> input[(WIDTH * HEIGHT) / VEC_NUM],
+              vx_image_data<DstType, VEC_NUM> *output) {
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint16 KERN_SIZE = 5;
+    const vx_uint16 KERN_RAD = KERN_SIZE >> 1;
+    const vx_uint16 VEC_COLS = WIDTH / VEC_NUM;
+    const vx_uint16 WIN_COLS = (KERN_RAD << 1) + VEC_NUM + (VEC_NUM - (KERN_RAD % VEC_NUM)) % VEC_NUM;
+    const vx_uint16 OHD_COLS = (WIN_COLS - KERN_RAD) / VEC_NUM - 1;
+    const vx_uint32 VECTORS = (WIDTH * HEIGHT) / VEC_NUM;
+    const vx_uint32 DST_VECTORS = (OUTPUT_TYPE == VX_DF_IMAGE_RGB) ? ((3 * VECTORS) / 4) : (VECTORS);
+    const bool OUT_IS_SIGNED = std::numeric_limits<DstType>::is_signed;
+    const vx_uint32 OUTPUT_SIZE = sizeof(DstType);
+
+    // Position of red in the upper left 2x2 pixels (blue is at the opposite position)
+    const vx_uint8 RED_X = ((PATTERN == HIFLIPVX::BAYER_RGGB) || (PATTERN == HIFLIPVX::BAYER_GBRG)) ? (0) : (1);
+    const vx_uint8 RED_Y = ((PATTERN == HIFLIPVX::BAYER_RGGB) || (PATTERN == HIFLIPVX::BAYER_GRBG)) ? (0) : (1);
+
+    // Check function parameters/types
+    const bool allowed_output = (OUTPUT_SIZE == 1 && OUTPUT_TYPE == VX_DF_IMAGE_U8) ||
+                                (OUTPUT_SIZE == 4 && OUTPUT_TYPE == VX_DF_IMAGE_RGB) ||
+                                (OUTPUT_SIZE == 4 && OUTPUT_TYPE == VX_DF_IMAGE_RGBX);
+    STATIC_ASSERT(OUT_IS_SIGNED == false, datatype_of_output_must_be_unsigned);
+    STATIC_ASSERT(allowed_output, missmatch_output_datatype_size_and_output_type);
+    STATIC_ASSERT((VEC_NUM == 1) || (VEC_NUM == 2) || (VEC_NUM == 4), vec_num_must_be_1_2_or_4);
+    STATIC_ASSERT((WIDTH % VEC_NUM) == 0, width_must_be_multiple_of_vec_num);
+    STATIC_ASSERT((OUTPUT_TYPE != VX_DF_IMAGE_RGB) || (((WIDTH * HEIGHT) % (4 * VEC_NUM)) == 0),
+                  rgb_output_needs_multiple_of_4_vectors);
+
+    // Linebuffer
+    vx_data_pack<vx_uint8, (KERN_SIZE - 1) * VEC_NUM> linebuffer[VEC_COLS];
+    HIFLIPVX_DATAPACK(linebuffer);
+
+    // Sliding window
+    vx_uint8 window[KERN_SIZE][WIN_COLS];
+#pragma HLS array_partition variable = window complete dim = 0
+
+    // Output buffer for the RGB format
+    vx_uint8 cases = 0;
+    vx_uint8 rgb_buffer[3 * VEC_NUM];
+#pragma HLS array_partition variable = rgb_buffer complete dim = 0
+
+    vx_uint32 ptr_src = 0;
+    vx_uint32 ptr_dst = 0;
+
+    // Compute the demosaicing (pipelined)
+    for (vx_uint16 y = 0; y < HEIGHT + KERN_RAD; ++y) {
+        for (vx_uint16 x = 0; x < VEC_COLS + OHD_COLS; ++x) {
+#pragma HLS PIPELINE II = 1
+
+            vx_uint8 input_buffer[VEC_NUM];
+#pragma HLS array_partition variable = input_buffer complete dim = 0
+            vx_uint8 buffer[KERN_SIZE][VEC_NUM];
+#pragma HLS array_partition variable = buffer complete dim = 0
+
+            // Read input data from global memory
+            vx_image_data<vx_uint8, VEC_NUM> input_data;
+            if ((y < HEIGHT) && (x < VEC_COLS)) {
+                input_data = input[ptr_src];
+                ++ptr_src;
+            }
+            for (vx_uint16 v = 0; v < VEC_NUM; ++v) {
+#pragma HLS unroll
+                input_buffer[v] = input_data.pixel[v];
+            }
+
+            // Linebuffer and sliding window with replicated border
+            ReadFromLineBuffer_<vx_uint8, VEC_NUM, KERN_SIZE, VEC_COLS>(input_buffer, linebuffer, buffer, x);
+            WriteToLineBuffer_<vx_uint8, VEC_NUM, KERN_SIZE, VEC_COLS>(buffer, linebuffer, x);
+            SlidingWindow<vx_uint8, VEC_NUM, HEIGHT, KERN_RAD, VEC_COLS, WIN_COLS, KERN_SIZE, VX_BORDER_REPLICATE>(
+                buffer, window, x, y);
+
+            // Interpolate the missing colors of all pixels of the vector
+            vx_uint8 luma[VEC_NUM];
+            vx_uint8 rgb[VEC_NUM][3];
+#pragma HLS array_partition variable = luma complete dim = 0
+#pragma HLS array_partition variable = rgb complete dim = 0
+            for (vx_uint16 v = 0; v < VEC_NUM; ++v) {
+#pragma HLS unroll
+                vx_uint8 kernel_window[KERN_SIZE][KERN_SIZE];
+#pragma HLS array_partition variable = kernel_window complete dim = 0
+                for (vx_uint16 i = 0; i < KERN_SIZE; i++) {
+#pragma HLS unroll
+                    for (vx_uint16 j = 0; j < KERN_SIZE; j++) {
+#pragma HLS unroll
+                        kernel_window[i][j] = window[i][j + v];
+                    }
+                }
+
+                // Color of the pixel in the color filter array
+                const vx_uint8 x_odd = static_cast<vx_uint8>((((x - OHD_COLS) * VEC_NUM + v) & 1) ^ RED_X);
+                const vx_uint8 y_odd = static_cast<vx_uint8>(((y - KERN_RAD) & 1) ^ RED_Y);
+                const vx_uint8 site = (y_odd == 0) ? ((x_odd == 0) ? (0) : (1)) : ((x_odd == 0) ? (2) : (3));
+
+                DemosaicPixel<METHOD>(kernel_window, site, rgb[v]);
+                luma[v] = OutputGray<vx_uint8>(rgb[v]);
+            }
+
+            // Write output data to global memory
+            if ((y >= KERN_RAD) && (x >= OHD_COLS))
+                ConvertColorWriteVector<DstType, VEC_NUM, OUTPUT_TYPE>(luma, rgb, cases, rgb_buffer, DST_VECTORS - 1,
+                                                                       ptr_dst, output);
+        }
+    }
+}
+
 /*********************************************************************************************************************/
 /** @brief Converts image bit depth.
  * @param SrcType      The datatype of the input image (8, 16, 32 bit unsigned/signed)
@@ -1347,136 +2525,90 @@ void ConverterPassThrough(vx_image_data<TypeData, SRC_PARALLEL> src[(BATCHES * S
             // Input
             inputbuffer = src[ptr];
 
-            // Conversion ;)
-            for (vx_int64 k = 0; k < PARALLEL; ++k)
-                outputbuffer.pixel[k] = inputbuffer.pixel[k];
-
-            // Set user(SOF) & last(EOF)
-            GenerateDmaSignal<TypeData, DST_PARALLEL>((ptr == 0), (ptr == VECTOR - 1), outputbuffer);
-
-            // Output
-            dst[ptr] = outputbuffer;
-            ++ptr;
-        }
-    }
-}
-
-/*********************************************************************************************************************/
-template <typename TypeData, vx_int64 BATCHES, vx_int64 SRC_PIXELS, vx_int64 DST_PIXELS, vx_int64 SRC_PARALLEL,
-          vx_int64 DST_PARALLEL>
-void ConvertSrcBigger(vx_image_data<TypeData, SRC_PARALLEL> src[(BATCHES * SRC_PIXELS) / SRC_PARALLEL],
-                      vx_image_data<TypeData, DST_PARALLEL> dst[(BATCHES * DST_PIXELS) / DST_PARALLEL]) {
-#pragma HLS INLINE
-
-    // Constants
-    const vx_int64 DST_VECTOR = DST_PIXELS / DST_PARALLEL;
-    const vx_int64 SRC_VECTOR = SRC_PIXELS / SRC_PARALLEL;
-    const vx_int64 BUFFER_SIZE = MIN(SRC_PARALLEL * DST_PARALLEL, MAX(DST_PIXELS, SRC_PIXELS));
-    const vx_int64 VECTOR = MAX((BATCHES * DST_PIXELS) / (SRC_PARALLEL * DST_PARALLEL),
-                                (BATCHES * SRC_PIXELS) / (SRC_PARALLEL * DST_PARALLEL));
-
-    // Long buffer to overcome the SRC/DST PARALLEL missmatch
-    TypeData buffer[BUFFER_SIZE]; // TODO: Initialize
-#pragma HLS array_partition variable = buffer complete dim = 0
-
-    // Iteration
-    for (vx_int64 i = 0, src_ptr = 0, dst_ptr = 0; i < VECTOR; ++i) {
-        for (vx_int64 j = 0; j < SRC_PARALLEL; ++j) {
-#pragma HLS pipeline II = 1
-
-            // Input buffer
-            vx_image_data<TypeData, SRC_PARALLEL> inputbuffer;
-            //#pragma HLS array_partition variable = inputbuffer complete dim = 0
-
-            // Output buffer
-            vx_image_data<TypeData, DST_PARALLEL> outputbuffer;
-            //#pragma HLS array_partition variable = outputbuffer complete dim = 0
-
-            // Read data from input and write to buffer
-            if ((j < DST_PARALLEL) && (src_ptr < (BATCHES * SRC_VECTOR))) {
-
-                inputbuffer = src[src_ptr];
-                ++src_ptr;
-
-                for (vx_int64 k = 0; k < SRC_PARALLEL; ++k)
-                    buffer[j * SRC_PARALLEL + k] = inputbuffer.pixel[k];
-            }
-
-            // Read data from buffer and write to output
-            if ((j < SRC_PARALLEL) && (dst_ptr < (BATCHES * DST_VECTOR))) {
-
-                for (vx_int64 k = 0; k < DST_PARALLEL; ++k)
-                    outputbuffer.pixel[k] = buffer[j * DST_PARALLEL + k];
+            // Conversion ;)
+            for (vx_int64 k = 0; k < PARALLEL; ++k)
+                outputbuffer.pixel[k] = inputbuffer.pixel[k];
 
-                // Set user(SOF) & last(EOF)
-                GenerateDmaSignal<TypeData, DST_PARALLEL>((dst_ptr == 0), (dst_ptr == DST_VECTOR - 1), outputbuffer);
+            // Set user(SOF) & last(EOF)
+            GenerateDmaSignal<TypeData, DST_PARALLEL>((ptr == 0), (ptr == VECTOR - 1), outputbuffer);
 
-                dst[dst_ptr] = outputbuffer;
-                ++dst_ptr;
-            }
+            // Output
+            dst[ptr] = outputbuffer;
+            ++ptr;
         }
     }
 }
 
 /*********************************************************************************************************************/
+// Converts between arbitrary vector sizes (e.g. 3 -> 4, 6 -> 8, 5 -> 2) using a shift register of
+// LCM(SRC_PARALLEL, DST_PARALLEL) elements. Within one LCM period, LCM / SRC_PARALLEL input vectors and
+// LCM / DST_PARALLEL output vectors are transferred, so the wider side transfers one vector per clock cycle.
 template <typename TypeData, vx_int64 BATCHES, vx_int64 SRC_PIXELS, vx_int64 DST_PIXELS, vx_int64 SRC_PARALLEL,
           vx_int64 DST_PARALLEL>
-void ConvertDstBigger(vx_image_data<TypeData, SRC_PARALLEL> src[(BATCHES * SRC_PIXELS) / SRC_PARALLEL],
+void ConverterGearbox(vx_image_data<TypeData, SRC_PARALLEL> src[(BATCHES * SRC_PIXELS) / SRC_PARALLEL],
                       vx_image_data<TypeData, DST_PARALLEL> dst[(BATCHES * DST_PIXELS) / DST_PARALLEL]) {
 #pragma HLS INLINE
 
     // Constants
-    const vx_int64 GCD_PARALLEL = GCD(DST_PARALLEL, SRC_PARALLEL);
-    const vx_int64 LCM_PARALLEL = LCM(DST_PARALLEL, SRC_PARALLEL);
-    const vx_int64 BUFFER_SIZE = MIN(LCM_PARALLEL, MAX(DST_PIXELS, SRC_PIXELS));
-    const vx_int64 DST_VECTOR = DST_PIXELS / DST_PARALLEL;
+    const vx_int64 LCM_PARALLEL = LCM(SRC_PARALLEL, DST_PARALLEL);
+    const vx_int64 SRC_STEPS = LCM_PARALLEL / SRC_PARALLEL;
+    const vx_int64 DST_STEPS = LCM_PARALLEL / DST_PARALLEL;
+    const vx_int64 STEPS = MAX(SRC_STEPS, DST_STEPS);
     const vx_int64 SRC_VECTOR = SRC_PIXELS / SRC_PARALLEL;
-    const vx_int64 VECTOR = MAX(SRC_VECTOR, DST_VECTOR);
+    const vx_int64 DST_VECTOR = DST_PIXELS / DST_PARALLEL;
+    const vx_int64 PERIODS = (MAX(SRC_PIXELS, DST_PIXELS) + LCM_PARALLEL - 1) / LCM_PARALLEL;
 
-    // Long buffer to overcome the SRC/DST PARALLEL missmatch
-    TypeData buffer[BUFFER_SIZE];
+    // Shift register that holds one LCM period
+    TypeData buffer[LCM_PARALLEL];
 #pragma HLS array_partition variable = buffer complete dim = 0
+    for (vx_int64 k = 0; k < LCM_PARALLEL; ++k) {
+#pragma HLS unroll
+        buffer[k] = 0;
+    }
 
-    // Itaeration
+    // Iteration
     for (vx_int64 batch = 0; batch < BATCHES; ++batch) {
-        for (vx_int64 src_ptr = 0, dst_ptr = 0; (src_ptr < VECTOR); ++src_ptr) {
+        for (vx_int64 i = 0, src_ptr = 0, dst_ptr = 0, dst_cnt = 0; i < (PERIODS * STEPS); ++i) {
 #pragma HLS pipeline II = 1
 
             // Input buffer
             vx_image_data<TypeData, SRC_PARALLEL> inputbuffer;
-            //#pragma HLS array_partition variable = inputbuffer complete dim = 0
 
             // Output buffer
             vx_image_data<TypeData, DST_PARALLEL> outputbuffer;
-            //#pragma HLS array_partition variable = outputbuffer complete dim = 0
-
-            // Buffer pointer
-            const vx_int64 src_cnt = (src_ptr % (DST_PARALLEL / GCD_PARALLEL)) * SRC_PARALLEL;
-            const vx_int64 dst_cnt = (dst_ptr % (SRC_PARALLEL / GCD_PARALLEL)) * DST_PARALLEL;
 
-            // Read data from input and write to buffer
-            if (src_ptr < SRC_VECTOR) {
+            // Step inside of the LCM period
+            const vx_int64 step = i % STEPS;
+            if (step == 0)
+                dst_cnt = 0;
 
-                inputbuffer = src[batch * SRC_VECTOR + src_ptr];
+            // Read data from input and write to the shift register (zeros once the input is read completely)
+            if (step < SRC_STEPS) {
+                if (src_ptr < SRC_VECTOR) {
+                    inputbuffer = src[batch * SRC_VECTOR + src_ptr];
+                    ++src_ptr;
+                } else {
+                    for (vx_int64 k = 0; k < SRC_PARALLEL; ++k)
+                        inputbuffer.pixel[k] = 0;
+                }
 
                 for (vx_int64 k = 0; k < SRC_PARALLEL; ++k)
-                    buffer[src_cnt + k] = inputbuffer.pixel[k];
+                    buffer[step * SRC_PARALLEL + k] = inputbuffer.pixel[k];
             }
 
-            // Read data from buffer and write to output
-            if (dst_ptr < DST_VECTOR) {
-                if ((src_cnt + SRC_PARALLEL) >= (dst_cnt + DST_PARALLEL)) {
+            // Write to output, as soon as the shift register contains the next output vector
+            const vx_int64 available = MIN(step + 1, SRC_STEPS) * SRC_PARALLEL;
+            if ((((dst_cnt + 1) * DST_PARALLEL) <= available) && (dst_ptr < DST_VECTOR)) {
 
-                    for (vx_int64 k = 0; k < DST_PARALLEL; ++k)
-                        outputbuffer.pixel[k] = buffer[dst_cnt + k];
+                for (vx_int64 k = 0; k < DST_PARALLEL; ++k)
+                    outputbuffer.pixel[k] = buffer[dst_cnt * DST_PARALLEL + k];
 
-                    // Set user(SOF) & last(EOF)
-                    GenerateDmaSignal<TypeData, DST_PARALLEL>((dst_ptr == 0), (dst_ptr == DST_VECTOR - 1),
-                                                              outputbuffer);
+                // Set user(SOF) & last(EOF)
+                GenerateDmaSignal<TypeData, DST_PARALLEL>((dst_ptr == 0), (dst_ptr == DST_VECTOR - 1), outputbuffer);
 
-                    dst[batch * DST_VECTOR + dst_ptr] = outputbuffer;
-                    ++dst_ptr;
-                }
+                dst[batch * DST_VECTOR + dst_ptr] = outputbuffer;
+                ++dst_ptr;
+                ++dst_cnt;
             }
         }
     }
@@ -1507,7 +2639,7 @@ void DataWidthConverter(vx_image_data<TypeData, SRC_PARALLEL> src[(BATCHES * SRC
         if (MULTIPLE == true) {
             ConverterSrcMulitple<TypeData, BATCHES, SRC_PIXELS, DST_PIXELS, SRC_PARALLEL, DST_PARALLEL>(src, dst);
         } else {
-            ConvertSrcBigger<TypeData, BATCHES, SRC_PIXELS, DST_PIXELS, SRC_PARALLEL, DST_PARALLEL>(src, dst);
+            ConverterGearbox<TypeData, BATCHES, SRC_PIXELS, DST_PIXELS, SRC_PARALLEL, DST_PARALLEL>(src, dst);
         }
 
         // Up Conversion
@@ -1515,7 +2647,7 @@ void DataWidthConverter(vx_image_data<TypeData, SRC_PARALLEL> src[(BATCHES * SRC
         if (MULTIPLE == true) {
             ConverterDstMulitple<TypeData, BATCHES, SRC_PIXELS, DST_PIXELS, SRC_PARALLEL, DST_PARALLEL>(src, dst);
         } else {
-            ConvertDstBigger<TypeData, BATCHES, SRC_PIXELS, DST_PIXELS, SRC_PARALLEL, DST_PARALLEL>(src, dst);
+            ConverterGearbox<TypeData, BATCHES, SRC_PIXELS, DST_PIXELS, SRC_PARALLEL, DST_PARALLEL>(src, dst);
         }
 
         // Pass through
@@ -1983,6 +3115,1039 @@ void ScaleImage(vx_image_data<vx_uint8, 1> input[COLS_IN * ROWS_IN],
     }
 }
 
+/*********************************************************************************************************************/
+/** @brief Computes the 2 neighboring source coordinates of a destination coordinate for resizing
+ * @details src = (dst + 0.5) * (SRC_SIZE / DST_SIZE) - 0.5 using replicated borders
+ * @param SRC_SIZE    The size of the input image in this direction
+ * @param DST_SIZE    The size of the output image in this direction
+ * @param WEIGHT_BITS The fraction bits of the weight
+ * @param SCALE_TYPE  The type of interpolation (VX_INTERPOLATION_NEAREST_NEIGHBOR or VX_INTERPOLATION_BILINEAR)
+ * @param dst         The destination coordinate
+ * @param src_lo      The lower source coordinate
+ * @param src_hi      The upper source coordinate
+ * @param weight      The weight of the upper source coordinate
+ */
+template <vx_uint16 SRC_SIZE, vx_uint16 DST_SIZE, vx_uint8 WEIGHT_BITS, vx_interpolation_type_e SCALE_TYPE>
+void ScaleImageCoordinate(vx_uint32 dst, vx_uint16 &src_lo, vx_uint16 &src_hi, vx_uint32 &weight) {
+#pragma HLS INLINE
+
+    // Compute the scale factor with "ACCURACY" fraction size
+    const vx_uint32 ACCURACY = 24;
+    const vx_int64 ONE = (static_cast<vx_int64>(1) << ACCURACY);
+    const vx_int64 MASK_FRACTION = ONE - 1;
+    const vx_uint32 WEIGHT_ONE = (1 << WEIGHT_BITS);
+    const vx_int64 SCALE = (vx_int64)(((vx_float64)SRC_SIZE / (vx_float64)DST_SIZE) * std::pow(2, ACCURACY) + 0.5);
+
+    // src = ((2 * dst + 1) * scale - 1) / 2
+    const vx_int64 src = ((((static_cast<vx_int64>(dst) << 1) + 1) * SCALE) - ONE) / 2;
+    vx_int64 lo = src >> ACCURACY;
+    vx_uint32 fraction = static_cast<vx_uint32>((src & MASK_FRACTION) >> (ACCURACY - WEIGHT_BITS));
+
+    // Replicated borders
+    if (src < 0) {
+        lo = 0;
+        fraction = 0;
+    } else if (lo >= SRC_SIZE - 1) {
+        lo = SRC_SIZE - 1;
+        fraction = 0;
+    }
+
+    // Nearest neighbor rounds to the closer source coordinate
+    if (SCALE_TYPE == VX_INTERPOLATION_NEAREST_NEIGHBOR)
+        fraction = (fraction >= (WEIGHT_ONE / 2)) ? (WEIGHT_ONE) : (0);
+
+    src_lo = static_cast<vx_uint16>(lo);
+    src_hi = static_cast<vx_uint16>(MIN(lo + 1, static_cast<vx_int64>(SRC_SIZE - 1)));
+    weight = fraction;
+}
+
+/*********************************************************************************************************************/
+/** @brief Resize a vectorized image by an arbitrary ratio (up- and downscaling) using bilinear or nearest neighbor
+ * interpolation
+ * @details The image is scaled horizontally while it is read. The 2 last horizontally scaled rows are buffered for
+ *          the vertical interpolation. An output row is computed together with its lower source row. If multiple
+ *          output rows share the same source rows (upscaling), the remaining ones are computed from the buffer.
+ *          Horizontally, the input is read in vectors while downscaling and the output is written in vectors while
+ *          upscaling. Therefore, VEC_NUM pixels are computed per clock cycle in both cases.
+ * @param DataType    The data type of the input and output image (vx_uint8, vx_uint16)
+ * @param VEC_NUM     The amount of pixels computed in parallel (1, 2, 4, 8)
+ * @param COLS_IN     The columns of the input image
+ * @param ROWS_IN     The rows of the input image
+ * @param COLS_OUT    The columns of the output image
+ * @param ROWS_OUT    The rows of the output image
+ * @param SCALE_TYPE  The type of interpolation (VX_INTERPOLATION_NEAREST_NEIGHBOR or VX_INTERPOLATION_BILINEAR)
+ * @param input       The input image
+ * @param output      The output image
+ */
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint16 COLS_IN, vx_uint16 ROWS_IN, vx_uint16 COLS_OUT,
+          vx_uint16 ROWS_OUT, vx_interpolation_type_e SCALE_TYPE>
+void ScaleImageVector(vx_image_data<DataType, VEC_NUM> input[(COLS_IN * ROWS_IN) / VEC_NUM],
+                      vx_image_data<DataType, VEC_NUM> output[(COLS_OUT * ROWS_OUT) / VEC_NUM]) {
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint8 WEIGHT_BITS = (sizeof(DataType) == 1) ? (12) : (16);
+    const vx_uint32 WEIGHT_ONE = (1 << WEIGHT_BITS);
+    const vx_uint64 ROUND = (static_cast<vx_uint64>(1) << (2 * WEIGHT_BITS - 1));
+    const vx_uint64 MAX_VALUE = static_cast<vx_uint64>(std::numeric_limits<DataType>::max());
+    const vx_int32 VEC_COLS_IN = COLS_IN / VEC_NUM;
+    const vx_int32 VEC_COLS_OUT = COLS_OUT / VEC_NUM;
+    const vx_uint32 DST_VECTORS = (COLS_OUT * ROWS_OUT) / VEC_NUM;
+    const bool UPSCALE_X = (COLS_OUT >= COLS_IN);
+    const vx_int32 ROW_ITERATIONS = (UPSCALE_X) ? (VEC_COLS_OUT + 1) : (VEC_COLS_IN);
+
+    // Check function parameters/types
+    const bool allowed_type = std::is_same<DataType, vx_uint8>::value || std::is_same<DataType, vx_uint16>::value;
+    STATIC_ASSERT(allowed_type, data_type_must_be_uint8_or_uint16);
+    STATIC_ASSERT((VEC_NUM == 1) || (VEC_NUM == 2) || (VEC_NUM == 4) || (VEC_NUM == 8), vec_num_must_be_1_2_4_or_8);
+    STATIC_ASSERT(((COLS_IN % VEC_NUM) == 0) && ((COLS_OUT % VEC_NUM) == 0), columns_must_be_multiple_of_vec_num);
+    STATIC_ASSERT(SCALE_TYPE == VX_INTERPOLATION_NEAREST_NEIGHBOR || SCALE_TYPE == VX_INTERPOLATION_BILINEAR,
+                  scale_type_not_supported);
+
+    // The 2 last horizontally scaled rows (with WEIGHT_BITS fraction, fits into 32 bit)
+    vx_uint32 linebuffer[2][COLS_OUT / VEC_NUM][VEC_NUM];
+#pragma HLS array_partition variable = linebuffer complete dim = 1
+#pragma HLS array_partition variable = linebuffer complete dim = 3
+
+    // The 2 last input vectors and the horizontally scaled pixels that have not been written yet
+    DataType window[2 * VEC_NUM];
+#pragma HLS array_partition variable = window complete dim = 0
+    vx_uint32 pending[2 * VEC_NUM];
+#pragma HLS array_partition variable = pending complete dim = 0
+
+    // Compute the resized image
+    for (vx_uint32 y = 0, y_dst = 0, dst_ptr = 0; y < ROWS_IN; y++) {
+
+        // Check if the next output row can be computed together with the current input row
+        vx_uint16 y_lo = 0, y_hi = 0;
+        vx_uint32 y_weight = 0;
+        ScaleImageCoordinate<ROWS_IN, ROWS_OUT, WEIGHT_BITS, SCALE_TYPE>(y_dst, y_lo, y_hi, y_weight);
+        const bool row_next = (y_dst < ROWS_OUT) && (y_hi == y);
+        const vx_uint8 cur = static_cast<vx_uint8>(y % 2);
+        const vx_uint8 top = static_cast<vx_uint8>(y_lo % 2);
+
+        // Scale the input row horizontally
+        for (vx_int32 i = 0, src_ptr = 0, x_dst = 0, x_vec = 0, pending_num = 0; i < ROW_ITERATIONS; i++) {
+#pragma HLS PIPELINE II = 1
+
+            vx_uint32 result[VEC_NUM];
+#pragma HLS array_partition variable = result complete dim = 0
+            bool result_valid = false;
+
+            // Upscaling: compute one output vector from the 2 buffered input vectors
+            if (UPSCALE_X) {
+                vx_uint16 x_lo[VEC_NUM], x_hi[VEC_NUM];
+                vx_uint32 x_weight[VEC_NUM];
+#pragma HLS array_partition variable = x_lo complete dim = 0
+#pragma HLS array_partition variable = x_hi complete dim = 0
+#pragma HLS array_partition variable = x_weight complete dim = 0
+                const vx_int32 x_vec_dst = MAX(i - 1, 0);
+                for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+                    ScaleImageCoordinate<COLS_IN, COLS_OUT, WEIGHT_BITS, SCALE_TYPE>(x_vec_dst * VEC_NUM + j, x_lo[j],
+                                                                                     x_hi[j], x_weight[j]);
+                }
+
+                // Read the next input vector, if it is needed
+                const vx_int32 src_needed = static_cast<vx_int32>(x_lo[0] / VEC_NUM) + 2;
+                if ((src_ptr < VEC_COLS_IN) && (src_ptr < src_needed)) {
+                    vx_image_data<DataType, VEC_NUM> src = input[y * VEC_COLS_IN + src_ptr];
+                    for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+                        window[j] = window[VEC_NUM + j];
+                        window[VEC_NUM + j] = src.pixel[j];
+                    }
+                    src_ptr++;
+                }
+
+                // Interpolate horizontally
+                const vx_int32 base = (src_ptr - 2) * VEC_NUM;
+                for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+                    const vx_int32 lo_ptr = MIN(MAX(x_lo[j] - base, 0), 2 * VEC_NUM - 1);
+                    const vx_int32 hi_ptr = MIN(MAX(x_hi[j] - base, 0), 2 * VEC_NUM - 1);
+                    const vx_uint32 lo = static_cast<vx_uint32>(window[lo_ptr]);
+                    const vx_uint32 hi = static_cast<vx_uint32>(window[hi_ptr]);
+                    result[j] = lo * (WEIGHT_ONE - x_weight[j]) + hi * x_weight[j];
+                }
+                result_valid = (i > 0);
+
+                // Downscaling: compute up to VEC_NUM output pixels from the 2 last input vectors
+            } else {
+                vx_image_data<DataType, VEC_NUM> src = input[y * VEC_COLS_IN + i];
+                for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+                    window[j] = window[VEC_NUM + j];
+                    window[VEC_NUM + j] = src.pixel[j];
+                }
+
+                // Interpolate the output pixels, whose source pixels have been read
+                const vx_int32 base = (i - 1) * VEC_NUM;
+                vx_uint32 value[VEC_NUM];
+                bool valid[VEC_NUM];
+#pragma HLS array_partition variable = value complete dim = 0
+#pragma HLS array_partition variable = valid complete dim = 0
+                vx_int32 valid_num = 0;
+                for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+                    vx_uint16 x_lo = 0, x_hi = 0;
+                    vx_uint32 x_weight = 0;
+                    ScaleImageCoordinate<COLS_IN, COLS_OUT, WEIGHT_BITS, SCALE_TYPE>(x_dst + j, x_lo, x_hi, x_weight);
+                    valid[j] = ((x_dst + j) < COLS_OUT) && (x_hi < (i + 1) * VEC_NUM) && ((j == 0) || valid[j - 1]);
+                    const vx_int32 lo_ptr = MIN(MAX(x_lo - base, 0), 2 * VEC_NUM - 1);
+                    const vx_int32 hi_ptr = MIN(MAX(x_hi - base, 0), 2 * VEC_NUM - 1);
+                    const vx_uint32 lo = static_cast<vx_uint32>(window[lo_ptr]);
+                    const vx_uint32 hi = static_cast<vx_uint32>(window[hi_ptr]);
+                    value[j] = lo * (WEIGHT_ONE - x_weight) + hi * x_weight;
+                    if (valid[j])
+                        valid_num++;
+                }
+
+                // Append the output pixels to the pending ones
+                for (vx_int32 j = 2 * VEC_NUM - 1; j >= 0; j--) {
+#pragma HLS unroll
+                    const vx_int32 k = j - pending_num;
+                    if ((k >= 0) && (k < VEC_NUM))
+                        pending[j] = value[k];
+                }
+                x_dst += valid_num;
+                pending_num += valid_num;
+
+                // Output a vector, if enough pixels are pending
+                if (pending_num >= VEC_NUM) {
+                    for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+                        result[j] = pending[j];
+                        pending[j] = pending[VEC_NUM + j];
+                    }
+                    pending_num -= VEC_NUM;
+                    result_valid = true;
+                }
+            }
+
+            // Buffer the horizontally scaled vector and compute the output vector
+            if (result_valid) {
+                vx_image_data<DataType, VEC_NUM> dst;
+                for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+                    const vx_uint64 lo = (y_lo == y) ? (result[j]) : (linebuffer[top][x_vec][j]);
+                    const vx_uint64 hi = result[j];
+                    const vx_uint64 sum = lo * (WEIGHT_ONE - y_weight) + hi * y_weight + ROUND;
+                    dst.pixel[j] = static_cast<DataType>(MIN(sum >> (2 * WEIGHT_BITS), MAX_VALUE));
+                    linebuffer[cur][x_vec][j] = result[j];
+                }
+                if (row_next) {
+                    GenerateDmaSignal<DataType, VEC_NUM>((dst_ptr == 0), (dst_ptr == DST_VECTORS - 1), dst);
+                    output[dst_ptr] = dst;
+                    dst_ptr++;
+                }
+                x_vec++;
+            }
+        }
+        if (row_next)
+            y_dst++;
+
+        // Compute the remaining output rows from the buffered rows (vertical upscaling)
+        for (bool row_buffered = true; row_buffered;) {
+            ScaleImageCoordinate<ROWS_IN, ROWS_OUT, WEIGHT_BITS, SCALE_TYPE>(y_dst, y_lo, y_hi, y_weight);
+            row_buffered = (y_dst < ROWS_OUT) && (y_hi == y);
+            if (row_buffered) {
+                const vx_uint8 buffered_top = static_cast<vx_uint8>(y_lo % 2);
+                for (vx_int32 x_vec = 0; x_vec < VEC_COLS_OUT; x_vec++) {
+#pragma HLS PIPELINE II = 1
+                    vx_image_data<DataType, VEC_NUM> dst;
+                    for (vx_uint16 j = 0; j < VEC_NUM; j++) {
+#pragma HLS unroll
+                        const vx_uint64 lo = linebuffer[buffered_top][x_vec][j];
+                        const vx_uint64 hi = linebuffer[cur][x_vec][j];
+                        const vx_uint64 sum = lo * (WEIGHT_ONE - y_weight) + hi * y_weight + ROUND;
+                        dst.pixel[j] = static_cast<DataType>(MIN(sum >> (2 * WEIGHT_BITS), MAX_VALUE));
+                    }
+                    GenerateDmaSignal<DataType, VEC_NUM>((dst_ptr == 0), (dst_ptr == DST_VECTORS - 1), dst);
+                    output[dst_ptr] = dst;
+                    dst_ptr++;
+                }
+                y_dst++;
+            }
+        }
+    }
+}
+
+/*********************************************************************************************************************/
+/** @brief Computes one level of a Gaussian pyramid (5x5 Gaussian and downscale by 2) from a pixel stream
+ * @details Each even input pixel position is the center of an output pixel. The center is computed as soon as the
+ *          pixel 2 rows below and 2 columns right of it (or the last row/column) arrives. The borders are replicated.
+ * @param DataType    The data type of the input and output image (vx_uint8, vx_uint16)
+ * @param WIDTH       The width of the input image of this level
+ * @param HEIGHT      The height of the input image of this level
+ * @param valid       Input: the input pixel is valid | Output: the output pixel is valid
+ * @param data        Input: the input pixel | Output: the output pixel
+ * @param linebuffer  The last 4 input rows
+ * @param window      The last 5 vertically filtered pixels
+ * @param x           The column of the next input pixel
+ * @param y           The row of the next input pixel
+ */
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT>
+void PyramidLevel(bool &valid, DataType &data, DataType linebuffer[4][WIDTH], vx_uint32 window[5], vx_uint16 &x,
+                  vx_uint16 &y) {
+#pragma HLS INLINE
+
+    // Gaussian kernel [1 4 6 4 1] in both directions
+    const vx_uint32 KERNEL[5] = {1, 4, 6, 4, 1};
+    const vx_uint32 NORM_SHIFT = 8;
+
+    bool output_valid = false;
+    DataType output_data = 0;
+
+    if (valid) {
+
+        // The 5 rows of the current column (y - 4 ... y)
+        DataType column[5];
+#pragma HLS array_partition variable = column complete dim = 0
+        for (vx_uint16 i = 0; i < 4; i++) {
+#pragma HLS unroll
+            column[i] = linebuffer[i][x];
+        }
+        column[4] = data;
+        for (vx_uint16 i = 0; i < 3; i++) {
+#pragma HLS unroll
+            linebuffer[i][x] = column[i + 1];
+        }
+        linebuffer[3][x] = data;
+
+        // Row of the output center and filter vertically (replicated border)
+        const vx_int32 y_center = (y == HEIGHT - 1) ? (HEIGHT - 2) : (y - 2);
+        vx_uint32 sum_v = 0;
+        for (vx_int32 i = -2; i <= 2; i++) {
+#pragma HLS unroll
+            const vx_int32 row = MIN(MAX(y_center + i, 0), HEIGHT - 1);
+            sum_v += KERNEL[i + 2] * static_cast<vx_uint32>(column[row - y + 4]);
+        }
+
+        // Shift the vertically filtered pixels
+        for (vx_uint16 i = 0; i < 4; i++) {
+#pragma HLS unroll
+            window[i] = window[i + 1];
+        }
+        window[4] = sum_v;
+
+        // Column of the output center and filter horizontally (replicated border)
+        const vx_int32 x_center = (x == WIDTH - 1) ? (WIDTH - 2) : (x - 2);
+        vx_uint32 sum = 0;
+        for (vx_int32 i = -2; i <= 2; i++) {
+#pragma HLS unroll
+            const vx_int32 col = MIN(MAX(x_center + i, 0), WIDTH - 1);
+            sum += KERNEL[i + 2] * window[col - x + 4];
+        }
+
+        // Only even centers are part of the next level
+        output_valid = (y_center >= 0) && ((y_center % 2) == 0) && (x_center >= 0) && ((x_center % 2) == 0);
+        output_data = static_cast<DataType>((sum + (1 << (NORM_SHIFT - 1))) >> NORM_SHIFT);
+
+        // Update the coordinates
+        if (x == WIDTH - 1) {
+            x = 0;
+            y++;
+        } else {
+            x++;
+        }
+    }
+
+    valid = output_valid;
+    data = output_data;
+}
+
+/*********************************************************************************************************************/
+/** @brief Computes a Gaussian pyramid (scale 0.5) with up to 4 levels in a single pass over the input image
+ * @details Every level filters the output stream of the previous level. The output streams run at 1/4, 1/16 and 1/64
+ *          of the input rate.
+ * @param DataType    The data type of the input and output images (vx_uint8, vx_uint16)
+ * @param WIDTH       The width of the input image
+ * @param HEIGHT      The height of the input image
+ * @param LEVELS      The amount of pyramid levels including the input image (2, 3, 4)
+ * @param input       The input image
+ * @param level0      The level 0 (copy of the input image)
+ * @param level1      The level 1 (WIDTH / 2 x HEIGHT / 2)
+ * @param level2      The level 2 (WIDTH / 4 x HEIGHT / 4)
+ * @param level3      The level 3 (WIDTH / 8 x HEIGHT / 8)
+ */
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint8 LEVELS>
+void Pyramid(vx_image_data<DataType, 1> input[WIDTH * HEIGHT], vx_image_data<DataType, 1> level0[WIDTH * HEIGHT],
+             vx_image_data<DataType, 1> level1[(WIDTH / 2) * (HEIGHT / 2)],
+             vx_image_data<DataType, 1> level2[(WIDTH / 4) * (HEIGHT / 4)],
+             vx_image_data<DataType, 1> level3[(WIDTH / 8) * (HEIGHT / 8)]) {
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint32 PIXELS0 = WIDTH * HEIGHT;
+    const vx_uint32 PIXELS1 = PIXELS0 / 4;
+    const vx_uint32 PIXELS2 = PIXELS0 / 16;
+    const vx_uint32 PIXELS3 = PIXELS0 / 64;
+    const vx_uint16 DOWNSCALE = static_cast<vx_uint16>(1 << (LEVELS - 1));
+
+    // Check function parameters/types
+    const bool allowed_type = std::is_same<DataType, vx_uint8>::value || std::is_same<DataType, vx_uint16>::value;
+    STATIC_ASSERT(allowed_type, data_type_must_be_uint8_or_uint16);
+    STATIC_ASSERT((LEVELS >= 2) && (LEVELS <= 4), levels_must_be_2_3_or_4);
+    STATIC_ASSERT(((WIDTH % (2 * DOWNSCALE)) == 0) && ((HEIGHT % (2 * DOWNSCALE)) == 0),
+                  width_and_height_must_be_multiple_of_2_to_the_power_of_levels);
+
+    // Line buffers and windows of all levels
+    DataType linebuffer1[4][WIDTH];
+    DataType linebuffer2[4][WIDTH / 2];
+    DataType linebuffer3[4][WIDTH / 4];
+#pragma HLS array_partition variable = linebuffer1 complete dim = 1
+#pragma HLS array_partition variable = linebuffer2 complete dim = 1
+#pragma HLS array_partition variable = linebuffer3 complete dim = 1
+    vx_uint32 window1[5], window2[5], window3[5];
+#pragma HLS array_partition variable = window1 complete dim = 0
+#pragma HLS array_partition variable = window2 complete dim = 0
+#pragma HLS array_partition variable = window3 complete dim = 0
+
+    // Coordinates of the next input pixel of all levels
+    vx_uint16 x1 = 0, y1 = 0, x2 = 0, y2 = 0, x3 = 0, y3 = 0;
+
+    // Stream the input image once and compute all levels
+    for (vx_uint32 i = 0, ptr1 = 0, ptr2 = 0, ptr3 = 0; i < PIXELS0; i++) {
+#pragma HLS PIPELINE II = 1
+
+        // Read from input and write level 0
+        vx_image_data<DataType, 1> src = input[i];
+        vx_image_data<DataType, 1> dst;
+        DataType data = src.pixel[0];
+        bool valid = true;
+        GenerateDmaSignal<DataType, 1>((i == 0), (i == PIXELS0 - 1), dst);
+        dst.pixel[0] = data;
+        level0[i] = dst;
+
+        // Level 1
+        PyramidLevel<DataType, WIDTH, HEIGHT>(valid, data, linebuffer1, window1, x1, y1);
+        if (valid) {
+            GenerateDmaSignal<DataType, 1>((ptr1 == 0), (ptr1 == PIXELS1 - 1), dst);
+            dst.pixel[0] = data;
+            level1[ptr1] = dst;
+            ptr1++;
+        }
+
+        // Level 2
+        if (LEVELS >= 3) {
+            PyramidLevel<DataType, WIDTH / 2, HEIGHT / 2>(valid, data, linebuffer2, window2, x2, y2);
+            if (valid) {
+                GenerateDmaSignal<DataType, 1>((ptr2 == 0), (ptr2 == PIXELS2 - 1), dst);
+                dst.pixel[0] = data;
+                level2[ptr2] = dst;
+                ptr2++;
+            }
+        }
+
+        // Level 3
+        if (LEVELS >= 4) {
+            PyramidLevel<DataType, WIDTH / 4, HEIGHT / 4>(valid, data, linebuffer3, window3, x3, y3);
+            if (valid) {
+                GenerateDmaSignal<DataType, 1>((ptr3 == 0), (ptr3 == PIXELS3 - 1), dst);
+                dst.pixel[0] = data;
+                level3[ptr3] = dst;
+                ptr3++;
+            }
+        }
+    }
+}
+
+/*********************************************************************************************************************/
+/** @brief Samples a rolling row cache at a source coordinate (bilinear or nearest neighbor, constant 0 border)
+ * @param DataType         The data type of the image (vx_uint8, vx_uint16)
+ * @param WIDTH            The width of the image
+ * @param HEIGHT           The height of the image
+ * @param MAX_DISPLACEMENT The maximum vertical distance between a destination pixel and its source in rows
+ * @param INTERPOLATION    The interpolation type (VX_INTERPOLATION_BILINEAR, VX_INTERPOLATION_NEAREST_NEIGHBOR)
+ * @param cache            The cache holding the rows y - MAX_DISPLACEMENT to y + MAX_DISPLACEMENT + 1
+ * @param inside           False, if the source coordinate is invalid
+ * @param src_x            The source column in 8-bit fixed point
+ * @param src_y            The source row in 8-bit fixed point
+ * @param y                The destination row
+ * @param first_slot       The cache slot of row y - MAX_DISPLACEMENT
+ * @return                 The sampled pixel
+ */
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint16 MAX_DISPLACEMENT,
+          vx_interpolation_type_e INTERPOLATION>
+DataType WarpSample(DataType cache[2 * MAX_DISPLACEMENT + 3][WIDTH], bool inside, vx_int64 src_x, vx_int64 src_y,
+                    vx_int64 y, vx_uint16 first_slot) {
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint16 CACHE_ROWS = 2 * MAX_DISPLACEMENT + 3;
+    const vx_uint8 WEIGHT_BITS = 8;
+    const vx_uint32 WEIGHT_ONE = static_cast<vx_uint32>(1) << WEIGHT_BITS;
+    const vx_uint32 ROUND = static_cast<vx_uint32>(1) << (2 * WEIGHT_BITS - 1);
+    const bool NEAREST = (INTERPOLATION == VX_INTERPOLATION_NEAREST_NEIGHBOR);
+
+    // Integer coordinate and weights
+    if (NEAREST) {
+        src_x += WEIGHT_ONE / 2;
+        src_y += WEIGHT_ONE / 2;
+    }
+    const vx_int64 x0 = src_x >> WEIGHT_BITS;
+    const vx_int64 y0 = src_y >> WEIGHT_BITS;
+    const vx_uint32 wx = (NEAREST) ? (0) : (static_cast<vx_uint32>(src_x) & (WEIGHT_ONE - 1));
+    const vx_uint32 wy = (NEAREST) ? (0) : (static_cast<vx_uint32>(src_y) & (WEIGHT_ONE - 1));
+
+    // Read the 4 neighbors from the cache
+    vx_uint32 neighbor[2][2];
+#pragma HLS array_partition variable = neighbor complete dim = 0
+    for (vx_uint8 j = 0; j < 2; j++) {
+#pragma HLS unroll
+        for (vx_uint8 k = 0; k < 2; k++) {
+#pragma HLS unroll
+            const vx_int64 row = y0 + j;
+            const vx_int64 col = x0 + k;
+            const vx_int64 rel = row - (y - MAX_DISPLACEMENT);
+            const bool valid = inside && (row >= 0) && (row < HEIGHT) && (col >= 0) && (col < WIDTH) && (rel >= 0) &&
+                               (rel < CACHE_ROWS - 1);
+            vx_uint16 slot = first_slot + static_cast<vx_uint16>(rel);
+            if (slot >= CACHE_ROWS)
+                slot -= CACHE_ROWS;
+            neighbor[j][k] = (valid) ? (static_cast<vx_uint32>(cache[slot][col])) : (0);
+        }
+    }
+
+    // Bilinear interpolation (nearest neighbor has zero weights)
+    const vx_uint32 top = neighbor[0][0] * (WEIGHT_ONE - wx) + neighbor[0][1] * wx;
+    const vx_uint32 bottom = neighbor[1][0] * (WEIGHT_ONE - wx) + neighbor[1][1] * wx;
+    return static_cast<DataType>((top * (WEIGHT_ONE - wy) + bottom * wy + ROUND) >> (2 * WEIGHT_BITS));
+}
+
+/*********************************************************************************************************************/
+/** @brief Converts a warp matrix to 32-bit fixed point (the affine matrix gets the constant third row 0, 0, 1)
+ * @param PERSPECTIVE True for a 3x3 perspective matrix, false for a 2x3 affine matrix
+ * @param matrix      The transformation matrix in OpenVX (column-major) order (6 or 9 elements)
+ * @param coeff       The 3x3 matrix in fixed point
+ */
+template <bool PERSPECTIVE> void WarpMatrixToFixed(const vx_float32 matrix[], vx_int64 coeff[9]) {
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint8 MATRIX_ROWS = (PERSPECTIVE) ? (3) : (2);
+    const vx_int64 COEFF_ONE = static_cast<vx_int64>(1) << 32;
+
+    for (vx_uint8 i = 0; i < 3; i++) {
+#pragma HLS unroll
+        for (vx_uint8 j = 0; j < 3; j++) {
+#pragma HLS unroll
+            if (j < MATRIX_ROWS) {
+                const vx_float32 element = matrix[MATRIX_ROWS * i + j];
+                coeff[3 * i + j] = static_cast<vx_int64>(element * static_cast<vx_float32>(COEFF_ONE));
+            } else {
+                coeff[3 * i + j] = (i == 2) ? (COEFF_ONE) : (0);
+            }
+        }
+    }
+}
+
+/*********************************************************************************************************************/
+/** @brief Warps an image with an affine or perspective transformation, reading the source from a rolling row cache
+ * @details The matrix maps output to source coordinates in the OpenVX (column-major) order. It is converted once to
+ *          32-bit fixed point and the source coordinates are updated by additions, so the results are bit-exact on
+ *          every target. The cache holds 2 * MAX_DISPLACEMENT + 3 input rows, the output is delayed by
+ *          MAX_DISPLACEMENT + 2 rows. Samples outside the image or outside the cached rows are 0 (constant border).
+ * @param DataType         The data type of the input and output images (vx_uint8, vx_uint16)
+ * @param WIDTH            The width of the input and output images
+ * @param HEIGHT           The height of the input and output images
+ * @param MAX_DISPLACEMENT The maximum vertical distance between a destination pixel and its source in rows
+ * @param INTERPOLATION    The interpolation type (VX_INTERPOLATION_BILINEAR, VX_INTERPOLATION_NEAREST_NEIGHBOR)
+ * @param PERSPECTIVE      True for a 3x3 perspective matrix, false for a 2x3 affine matrix
+ * @param input            The input image
+ * @param output           The output image
+ * @param matrix           The transformation matrix (6 or 9 elements)
+ */
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint16 MAX_DISPLACEMENT,
+          vx_interpolation_type_e INTERPOLATION, bool PERSPECTIVE>
+void Warp(vx_image_data<DataType, 1> input[WIDTH * HEIGHT], vx_image_data<DataType, 1> output[WIDTH * HEIGHT],
+          const vx_float32 matrix[]) {
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint32 PIXELS = WIDTH * HEIGHT;
+    const vx_uint16 CACHE_ROWS = 2 * MAX_DISPLACEMENT + 3;
+    const vx_uint16 LATENCY = MAX_DISPLACEMENT + 2;
+    const vx_uint8 COEFF_BITS = 32;
+    const vx_uint8 WEIGHT_BITS = 8;
+    const vx_int64 WEIGHT_ONE = static_cast<vx_int64>(1) << WEIGHT_BITS;
+
+    // Check function parameters/types
+    const bool allowed_type = std::is_same<DataType, vx_uint8>::value || std::is_same<DataType, vx_uint16>::value;
+    STATIC_ASSERT(allowed_type, data_type_must_be_uint8_or_uint16);
+    STATIC_ASSERT((INTERPOLATION == VX_INTERPOLATION_NEAREST_NEIGHBOR) || (INTERPOLATION == VX_INTERPOLATION_BILINEAR),
+                  interpolation_must_be_bilinear_or_nearest);
+    STATIC_ASSERT(MAX_DISPLACEMENT < HEIGHT, max_displacement_must_be_smaller_than_height);
+
+    // Row cache (rows are distributed to allow 2 reads and 1 write per clock)
+    DataType cache[CACHE_ROWS][WIDTH];
+#pragma HLS array_partition variable = cache complete dim = 1
+#pragma HLS array_partition variable = cache cyclic factor = 2 dim = 2
+
+    // Convert the matrix to fixed point
+    vx_int64 coeff[9];
+#pragma HLS array_partition variable = coeff complete dim = 0
+    WarpMatrixToFixed<PERSPECTIVE>(matrix, coeff);
+
+    // Mapped coordinates of the first pixel of the current row and of the current pixel
+    vx_int64 row_x = coeff[6], row_y = coeff[7], row_z = coeff[8];
+    vx_int64 map_x = row_x, map_y = row_y, map_z = row_z;
+
+    // Cache slot of the input row that is written and of the first row that can be read (row y - MAX_DISPLACEMENT)
+    vx_uint16 write_slot = 0, first_slot = 1;
+
+    // Reads input row t and computes output row y = t - LATENCY
+    for (vx_uint32 i = 0, ptr = 0, x = 0, t = 0; i < (HEIGHT + LATENCY) * WIDTH; i++) {
+#pragma HLS PIPELINE II = 1
+
+        // Fill the row cache
+        if (t < HEIGHT)
+            cache[write_slot][x] = input[i].pixel[0];
+
+        // Compute the output
+        if (t >= LATENCY) {
+            const vx_int64 y = static_cast<vx_int64>(t - LATENCY);
+
+            // Source coordinate in 8-bit fixed point
+            bool inside = true;
+            vx_int64 src_x = 0, src_y = 0;
+            if (PERSPECTIVE) {
+                inside = (map_z > 0);
+                if (inside) {
+                    src_x = (map_x * WEIGHT_ONE) / map_z;
+                    src_y = (map_y * WEIGHT_ONE) / map_z;
+                }
+            } else {
+                src_x = map_x >> (COEFF_BITS - WEIGHT_BITS);
+                src_y = map_y >> (COEFF_BITS - WEIGHT_BITS);
+            }
+            const DataType result = WarpSample<DataType, WIDTH, HEIGHT, MAX_DISPLACEMENT, INTERPOLATION>(
+                cache, inside, src_x, src_y, y, first_slot);
+
+            // Write the output
+            vx_image_data<DataType, 1> dst;
+            GenerateDmaSignal<DataType, 1>((ptr == 0), (ptr == PIXELS - 1), dst);
+            dst.pixel[0] = result;
+            output[ptr] = dst;
+            ptr++;
+
+            // Mapped coordinate of the next pixel
+            if (x == WIDTH - 1) {
+                row_x += coeff[3];
+                row_y += coeff[4];
+                row_z += coeff[5];
+                map_x = row_x;
+                map_y = row_y;
+                map_z = row_z;
+            } else {
+                map_x += coeff[0];
+                map_y += coeff[1];
+                map_z += coeff[2];
+            }
+        }
+
+        // Next pixel and cache slots
+        if (x == WIDTH - 1) {
+            x = 0;
+            t++;
+            write_slot = first_slot;
+            first_slot = (first_slot == CACHE_ROWS - 1) ? (0) : (first_slot + 1);
+        } else {
+            x++;
+        }
+    }
+}
+
+#if !defined(__SYNTHESIS__)
+/*********************************************************************************************************************/
+/** @brief CPU version of WarpSample, reading from a full frame but only from the rows the row cache of Warp holds
+ * @param DataType      The data type of the input and output images (vx_uint8, vx_uint16)
+ * @param WIDTH         The width of the input image
+ * @param INTERPOLATION The interpolation type (VX_INTERPOLATION_BILINEAR, VX_INTERPOLATION_NEAREST_NEIGHBOR)
+ * @param input         The input image
+ * @param inside        False, if the source coordinate is invalid
+ * @param src_x         The source column in 8-bit fixed point
+ * @param src_y         The source row in 8-bit fixed point
+ * @param first_row     The first input row that can be read
+ * @param last_row      The last input row that can be read
+ * @return              The sampled pixel
+ */
+template <typename DataType, vx_uint16 WIDTH, vx_interpolation_type_e INTERPOLATION>
+DataType WarpSampleCpu(const DataType input[], bool inside, vx_int64 src_x, vx_int64 src_y, vx_int64 first_row,
+                       vx_int64 last_row) {
+
+    // Constants
+    const vx_uint8 WEIGHT_BITS = 8;
+    const vx_uint32 WEIGHT_ONE = static_cast<vx_uint32>(1) << WEIGHT_BITS;
+    const vx_uint32 ROUND = static_cast<vx_uint32>(1) << (2 * WEIGHT_BITS - 1);
+    const bool NEAREST = (INTERPOLATION == VX_INTERPOLATION_NEAREST_NEIGHBOR);
+
+    // Integer coordinate and weights
+    if (NEAREST) {
+        src_x += WEIGHT_ONE / 2;
+        src_y += WEIGHT_ONE / 2;
+    }
+    const vx_int64 x0 = src_x >> WEIGHT_BITS;
+    const vx_int64 y0 = src_y >> WEIGHT_BITS;
+    const vx_uint32 wx = (NEAREST) ? (0) : (static_cast<vx_uint32>(src_x) & (WEIGHT_ONE - 1));
+    const vx_uint32 wy = (NEAREST) ? (0) : (static_cast<vx_uint32>(src_y) & (WEIGHT_ONE - 1));
+
+    // Read the 4 neighbors
+    vx_uint32 neighbor[2][2];
+    for (vx_uint8 j = 0; j < 2; j++) {
+        for (vx_uint8 k = 0; k < 2; k++) {
+            const vx_int64 row = y0 + j;
+            const vx_int64 col = x0 + k;
+            const bool valid = inside && (row >= first_row) && (row <= last_row) && (col >= 0) && (col < WIDTH);
+            neighbor[j][k] = (valid) ? (static_cast<vx_uint32>(input[row * WIDTH + col])) : (0);
+        }
+    }
+
+    // Bilinear interpolation (nearest neighbor has zero weights)
+    const vx_uint32 top = neighbor[0][0] * (WEIGHT_ONE - wx) + neighbor[0][1] * wx;
+    const vx_uint32 bottom = neighbor[1][0] * (WEIGHT_ONE - wx) + neighbor[1][1] * wx;
+    return static_cast<DataType>((top * (WEIGHT_ONE - wy) + bottom * wy + ROUND) >> (2 * WEIGHT_BITS));
+}
+
+#ifdef __AVX2_WARP__
+/*********************************************************************************************************************/
+/** @brief Computes an output row of an affine warp with AVX2, 8 pixels at once (same arithmetic as WarpSampleCpu)
+ * @details The 64-bit source coordinates are shifted to 8-bit fixed point and packed to 32 bits. The 4 neighbors are
+ *          read with masked gathers. Lanes whose 4-byte gather would read beyond the image are read one by one.
+ * @param DataType      The data type of the input and output images (vx_uint8, vx_uint16)
+ * @param WIDTH         The width of the input and output images
+ * @param HEIGHT        The height of the input and output images
+ * @param INTERPOLATION The interpolation type (VX_INTERPOLATION_BILINEAR, VX_INTERPOLATION_NEAREST_NEIGHBOR)
+ * @param input         The input image
+ * @param output        The output row
+ * @param row_x         The mapped x coordinate of the first pixel of the row in 32-bit fixed point
+ * @param row_y         The mapped y coordinate of the first pixel of the row in 32-bit fixed point
+ * @param step_x        The x increment from one pixel to the next
+ * @param step_y        The y increment from one pixel to the next
+ * @param first_row     The first input row that can be read
+ * @param last_row      The last input row that can be read
+ * @return              The amount of computed pixels (multiple of 8)
+ */
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_interpolation_type_e INTERPOLATION>
+vx_uint16 WarpRowAvx2(const DataType input[], DataType output[], vx_int64 row_x, vx_int64 row_y, vx_int64 step_x,
+                      vx_int64 step_y, vx_int64 first_row, vx_int64 last_row) {
+
+    // Constants
+    const vx_int32 WEIGHT_BITS = 8;
+    const vx_int32 LAST_GATHER = static_cast<vx_int32>(WIDTH * HEIGHT * sizeof(DataType)) - 4;
+    const bool NEAREST = (INTERPOLATION == VX_INTERPOLATION_NEAREST_NEIGHBOR);
+    const __m256i PACK = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    const __m256i PIXEL_MASK = _mm256_set1_epi32((sizeof(DataType) == 1) ? (0xff) : (0xffff));
+    const __m256i WEIGHT_ONE = _mm256_set1_epi32(1 << WEIGHT_BITS);
+    const __m256i WEIGHT_MASK = _mm256_set1_epi32((NEAREST) ? (0) : ((1 << WEIGHT_BITS) - 1));
+    const __m256i OFFSET = _mm256_set1_epi32((NEAREST) ? (1 << (WEIGHT_BITS - 1)) : (0));
+    const __m256i ROUND = _mm256_set1_epi32(1 << (2 * WEIGHT_BITS - 1));
+    const __m256i FIRST_ROW = _mm256_set1_epi32(static_cast<vx_int32>(first_row) - 1);
+    const __m256i LAST_ROW = _mm256_set1_epi32(static_cast<vx_int32>(last_row) + 1);
+    const __m256i FIRST_COL = _mm256_set1_epi32(-1);
+    const __m256i LAST_COL = _mm256_set1_epi32(WIDTH);
+    const __m256i COLS = _mm256_set1_epi32(WIDTH);
+    const __m256i BYTES = _mm256_set1_epi32(sizeof(DataType));
+    const __m256i LAST = _mm256_set1_epi32(LAST_GATHER);
+
+    // Mapped coordinates of 8 pixels (4 per register)
+    __m256i map_x[2], map_y[2];
+    map_x[0] = _mm256_setr_epi64x(row_x, row_x + step_x, row_x + 2 * step_x, row_x + 3 * step_x);
+    map_y[0] = _mm256_setr_epi64x(row_y, row_y + step_y, row_y + 2 * step_y, row_y + 3 * step_y);
+    map_x[1] = _mm256_add_epi64(map_x[0], _mm256_set1_epi64x(4 * step_x));
+    map_y[1] = _mm256_add_epi64(map_y[0], _mm256_set1_epi64x(4 * step_y));
+    const __m256i STEP_X = _mm256_set1_epi64x(8 * step_x);
+    const __m256i STEP_Y = _mm256_set1_epi64x(8 * step_y);
+
+    vx_uint16 x = 0;
+    for (; x + 8 <= WIDTH; x += 8) {
+
+        // Source coordinate in 8-bit fixed point (the low 32 bits of the logical and arithmetic shift are the same)
+        __m256i src[2];
+        for (vx_uint8 i = 0; i < 2; i++) {
+            const __m256i lo = _mm256_permutevar8x32_epi32(_mm256_srli_epi64((i == 0) ? map_x[0] : map_y[0], 24), PACK);
+            const __m256i hi = _mm256_permutevar8x32_epi32(_mm256_srli_epi64((i == 0) ? map_x[1] : map_y[1], 24), PACK);
+            src[i] = _mm256_add_epi32(_mm256_permute2x128_si256(lo, hi, 0x20), OFFSET);
+        }
+        const __m256i x0 = _mm256_srai_epi32(src[0], WEIGHT_BITS);
+        const __m256i y0 = _mm256_srai_epi32(src[1], WEIGHT_BITS);
+        const __m256i wx = _mm256_and_si256(src[0], WEIGHT_MASK);
+        const __m256i wy = _mm256_and_si256(src[1], WEIGHT_MASK);
+
+        // Read the 4 neighbors
+        __m256i neighbor[2][2];
+        for (vx_uint8 j = 0; j < 2; j++) {
+            for (vx_uint8 k = 0; k < 2; k++) {
+                const __m256i row = _mm256_add_epi32(y0, _mm256_set1_epi32(j));
+                const __m256i col = _mm256_add_epi32(x0, _mm256_set1_epi32(k));
+                const __m256i valid = _mm256_and_si256(
+                    _mm256_and_si256(_mm256_cmpgt_epi32(row, FIRST_ROW), _mm256_cmpgt_epi32(LAST_ROW, row)),
+                    _mm256_and_si256(_mm256_cmpgt_epi32(col, FIRST_COL), _mm256_cmpgt_epi32(LAST_COL, col)));
+                const __m256i index = _mm256_add_epi32(_mm256_mullo_epi32(row, COLS), col);
+                const __m256i offset = _mm256_mullo_epi32(index, BYTES);
+                const __m256i safe = _mm256_andnot_si256(_mm256_cmpgt_epi32(offset, LAST), valid);
+                const __m256i data = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(),
+                                                                 reinterpret_cast<const int *>(input), offset, safe, 1);
+                neighbor[j][k] = _mm256_and_si256(data, PIXEL_MASK);
+
+                // Lanes at the end of the image
+                const vx_int32 unsafe = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_andnot_si256(safe, valid)));
+                if (unsafe != 0) {
+                    alignas(32) vx_int32 lanes[8], indices[8];
+                    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), neighbor[j][k]);
+                    _mm256_store_si256(reinterpret_cast<__m256i *>(indices), index);
+                    for (vx_uint8 l = 0; l < 8; l++) {
+                        if ((unsafe >> l) & 1)
+                            lanes[l] = static_cast<vx_int32>(input[indices[l]]);
+                    }
+                    neighbor[j][k] = _mm256_load_si256(reinterpret_cast<const __m256i *>(lanes));
+                }
+            }
+        }
+
+        // Bilinear interpolation (nearest neighbor has zero weights)
+        const __m256i wx_inv = _mm256_sub_epi32(WEIGHT_ONE, wx);
+        const __m256i wy_inv = _mm256_sub_epi32(WEIGHT_ONE, wy);
+        const __m256i top =
+            _mm256_add_epi32(_mm256_mullo_epi32(neighbor[0][0], wx_inv), _mm256_mullo_epi32(neighbor[0][1], wx));
+        const __m256i bottom =
+            _mm256_add_epi32(_mm256_mullo_epi32(neighbor[1][0], wx_inv), _mm256_mullo_epi32(neighbor[1][1], wx));
+        const __m256i sum = _mm256_add_epi32(_mm256_mullo_epi32(top, wy_inv), _mm256_mullo_epi32(bottom, wy));
+        const __m256i result = _mm256_srli_epi32(_mm256_add_epi32(sum, ROUND), 2 * WEIGHT_BITS);
+
+        // Write the output
+        alignas(32) vx_uint32 pixel[8];
+        _mm256_store_si256(reinterpret_cast<__m256i *>(pixel), result);
+        for (vx_uint8 l = 0; l < 8; l++)
+            output[x + l] = static_cast<DataType>(pixel[l]);
+
+        // Mapped coordinates of the next 8 pixels
+        for (vx_uint8 i = 0; i < 2; i++) {
+            map_x[i] = _mm256_add_epi64(map_x[i], STEP_X);
+            map_y[i] = _mm256_add_epi64(map_y[i], STEP_Y);
+        }
+    }
+    return x;
+}
+#endif
+
+/*********************************************************************************************************************/
+/** @brief CPU version of Warp that gives the same results. Affine rows are vectorized with AVX2 if it is enabled.
+ * @details Uses the same fixed-point matrix and only reads the rows the rolling cache of Warp would hold. Perspective
+ *          transformations need a 64-bit division per pixel and always use the scalar loop.
+ * @param DataType         The data type of the input and output images (vx_uint8, vx_uint16)
+ * @param WIDTH            The width of the input and output images
+ * @param HEIGHT           The height of the input and output images
+ * @param MAX_DISPLACEMENT The maximum vertical distance between a destination pixel and its source in rows
+ * @param INTERPOLATION    The interpolation type (VX_INTERPOLATION_BILINEAR, VX_INTERPOLATION_NEAREST_NEIGHBOR)
+ * @param PERSPECTIVE      True for a 3x3 perspective matrix, false for a 2x3 affine matrix
+ * @param input            The input image
+ * @param output           The output image
+ * @param matrix           The transformation matrix (6 or 9 elements)
+ */
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint16 MAX_DISPLACEMENT,
+          vx_interpolation_type_e INTERPOLATION, bool PERSPECTIVE>
+void WarpCpu(const DataType input[WIDTH * HEIGHT], DataType output[WIDTH * HEIGHT], const vx_float32 matrix[]) {
+
+    // Constants
+    const vx_uint8 COEFF_BITS = 32;
+    const vx_uint8 WEIGHT_BITS = 8;
+    const vx_int64 WEIGHT_ONE = static_cast<vx_int64>(1) << WEIGHT_BITS;
+    const vx_int64 SIMD_RANGE = static_cast<vx_int64>(1) << 54; // source coordinates fit into 32 bits
+
+    // Check function parameters/types
+    const bool allowed_type = std::is_same<DataType, vx_uint8>::value || std::is_same<DataType, vx_uint16>::value;
+    STATIC_ASSERT(allowed_type, data_type_must_be_uint8_or_uint16);
+    STATIC_ASSERT((INTERPOLATION == VX_INTERPOLATION_NEAREST_NEIGHBOR) || (INTERPOLATION == VX_INTERPOLATION_BILINEAR),
+                  interpolation_must_be_bilinear_or_nearest);
+    STATIC_ASSERT(MAX_DISPLACEMENT < HEIGHT, max_displacement_must_be_smaller_than_height);
+
+    // Convert the matrix to fixed point
+    vx_int64 coeff[9];
+    WarpMatrixToFixed<PERSPECTIVE>(matrix, coeff);
+
+    for (vx_int64 y = 0; y < HEIGHT; y++) {
+
+        // Mapped coordinates of the first pixel and the rows the row cache holds
+        const vx_int64 row_x = coeff[6] + y * coeff[3];
+        const vx_int64 row_y = coeff[7] + y * coeff[4];
+        const vx_int64 row_z = coeff[8] + y * coeff[5];
+        const vx_int64 first_row = MAX(y - MAX_DISPLACEMENT, 0);
+        const vx_int64 last_row = MIN(y + MAX_DISPLACEMENT + 1, HEIGHT - 1);
+        DataType *dst = &output[y * WIDTH];
+        vx_uint16 x = 0;
+
+#ifdef __AVX2_WARP__
+        const vx_int64 end_x = row_x + (WIDTH - 1) * coeff[0];
+        const vx_int64 end_y = row_y + (WIDTH - 1) * coeff[1];
+        const bool in_range = (MAX(MAX(row_x, end_x), MAX(row_y, end_y)) < SIMD_RANGE) &&
+                              (MIN(MIN(row_x, end_x), MIN(row_y, end_y)) > -SIMD_RANGE);
+        if ((PERSPECTIVE == false) && in_range)
+            x = WarpRowAvx2<DataType, WIDTH, HEIGHT, INTERPOLATION>(input, dst, row_x, row_y, coeff[0], coeff[1],
+                                                                    first_row, last_row);
+#else
+        (void)SIMD_RANGE;
+#endif
+
+        // Remaining pixels
+        for (; x < WIDTH; x++) {
+            const vx_int64 map_x = row_x + x * coeff[0];
+            const vx_int64 map_y = row_y + x * coeff[1];
+            const vx_int64 map_z = row_z + x * coeff[2];
+            bool inside = true;
+            vx_int64 src_x = 0, src_y = 0;
+            if (PERSPECTIVE) {
+                inside = (map_z > 0);
+                if (inside) {
+                    src_x = (map_x * WEIGHT_ONE) / map_z;
+                    src_y = (map_y * WEIGHT_ONE) / map_z;
+                }
+            } else {
+                src_x = map_x >> (COEFF_BITS - WEIGHT_BITS);
+                src_y = map_y >> (COEFF_BITS - WEIGHT_BITS);
+            }
+            dst[x] = WarpSampleCpu<DataType, WIDTH, INTERPOLATION>(input, inside, src_x, src_y, first_row, last_row);
+        }
+    }
+}
+#endif
+
+/*********************************************************************************************************************/
+/** @brief Remaps an image with a subsampled displacement grid, reading the source from a rolling row cache
+ * @details Grid entry (i, j) holds the displacement (dx, dy) of pixel (j * GRID, i * GRID) in signed 12.4 fixed
+ *          point. The displacement of every pixel is bilinearly interpolated from the 4 surrounding entries and the
+ *          source pixel (x + dx, y + dy) is sampled from a cache of 2 * MAX_DISPLACEMENT + 3 input rows. The grid is
+ *          streamed row by row (one row ahead of the output), so only 3 grid rows are buffered.
+ * @param DataType         The data type of the input and output images (vx_uint8, vx_uint16)
+ * @param WIDTH            The width of the input and output images (multiple of the grid size)
+ * @param HEIGHT           The height of the input and output images (multiple of the grid size)
+ * @param GRID_BITS        The grid size is 2^GRID_BITS pixels in both directions
+ * @param MAX_DISPLACEMENT The maximum vertical displacement in rows
+ * @param INTERPOLATION    The interpolation type (VX_INTERPOLATION_BILINEAR, VX_INTERPOLATION_NEAREST_NEIGHBOR)
+ * @param input            The input image
+ * @param map              The displacement grid ((WIDTH / GRID + 1) x (HEIGHT / GRID + 1) entries of dx and dy)
+ * @param output           The output image
+ */
+template <typename DataType, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint8 GRID_BITS, vx_uint16 MAX_DISPLACEMENT,
+          vx_interpolation_type_e INTERPOLATION>
+void Remap(vx_image_data<DataType, 1> input[WIDTH * HEIGHT],
+           vx_image_data<vx_int16, 2> map[((WIDTH >> GRID_BITS) + 1) * ((HEIGHT >> GRID_BITS) + 1)],
+           vx_image_data<DataType, 1> output[WIDTH * HEIGHT]) {
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint32 PIXELS = WIDTH * HEIGHT;
+    const vx_uint16 GRID = static_cast<vx_uint16>(1) << GRID_BITS;
+    const vx_uint16 GRID_COLS = (WIDTH >> GRID_BITS) + 1;
+    const vx_uint16 GRID_ROWS = (HEIGHT >> GRID_BITS) + 1;
+    const vx_uint16 CACHE_ROWS = 2 * MAX_DISPLACEMENT + 3;
+    const vx_uint16 LATENCY = MAX_DISPLACEMENT + 2;
+    const vx_uint8 FRACTION_BITS = 4;
+    const vx_uint8 WEIGHT_BITS = 8;
+
+    // Check function parameters/types
+    const bool allowed_type = std::is_same<DataType, vx_uint8>::value || std::is_same<DataType, vx_uint16>::value;
+    STATIC_ASSERT(allowed_type, data_type_must_be_uint8_or_uint16);
+    STATIC_ASSERT((INTERPOLATION == VX_INTERPOLATION_NEAREST_NEIGHBOR) || (INTERPOLATION == VX_INTERPOLATION_BILINEAR),
+                  interpolation_must_be_bilinear_or_nearest);
+    STATIC_ASSERT((GRID_BITS >= 1) && (GRID_BITS <= 7), grid_size_must_be_between_2_and_128);
+    STATIC_ASSERT(((WIDTH % GRID) == 0) && ((HEIGHT % GRID) == 0), width_and_height_must_be_multiple_of_grid_size);
+    STATIC_ASSERT(MAX_DISPLACEMENT < HEIGHT, max_displacement_must_be_smaller_than_height);
+
+    // Row cache (rows are distributed to allow 2 reads and 1 write per clock)
+    DataType cache[CACHE_ROWS][WIDTH];
+#pragma HLS array_partition variable = cache complete dim = 1
+#pragma HLS array_partition variable = cache cyclic factor = 2 dim = 2
+
+    // Grid rows of the current band, the third row is filled with the grid row after the next band
+    vx_int16 grid_x[3][GRID_COLS], grid_y[3][GRID_COLS];
+#pragma HLS array_partition variable = grid_x complete dim = 1
+#pragma HLS array_partition variable = grid_x cyclic factor = 2 dim = 2
+#pragma HLS array_partition variable = grid_y complete dim = 1
+#pragma HLS array_partition variable = grid_y cyclic factor = 2 dim = 2
+
+    // Cache slot of the input row that is written and of the first row that can be read (row y - MAX_DISPLACEMENT)
+    vx_uint16 write_slot = 0, first_slot = 1;
+
+    // Grid row that is read next, its slot, the slot of the upper grid row of the current band
+    vx_uint16 grid_row = 0, grid_write = 0, grid_top = 0;
+    bool grid_read = true;
+
+    // Reads input row t and computes output row y = t - LATENCY
+    for (vx_uint32 i = 0, ptr = 0, grid_ptr = 0, x = 0, t = 0; i < (HEIGHT + LATENCY) * WIDTH; i++) {
+#pragma HLS PIPELINE II = 1
+
+        // Fill the row cache
+        if (t < HEIGHT)
+            cache[write_slot][x] = input[i].pixel[0];
+
+        // Read the next grid row
+        if (grid_read && (x < GRID_COLS)) {
+            vx_image_data<vx_int16, 2> entry = map[grid_ptr];
+            grid_x[grid_write][x] = entry.pixel[0];
+            grid_y[grid_write][x] = entry.pixel[1];
+            grid_ptr++;
+        }
+
+        // Compute the output
+        if (t >= LATENCY) {
+            const vx_int64 y = static_cast<vx_int64>(t - LATENCY);
+
+            // Bilinear interpolation of the displacement
+            const vx_uint16 grid_bottom = (grid_top == 2) ? (0) : (grid_top + 1);
+            const vx_uint16 col = static_cast<vx_uint16>(x >> GRID_BITS);
+            const vx_int32 u = static_cast<vx_int32>(x & (GRID - 1));
+            const vx_int32 v = static_cast<vx_int32>(y & (GRID - 1));
+            const vx_int32 top_x = grid_x[grid_top][col] * (GRID - u) + grid_x[grid_top][col + 1] * u;
+            const vx_int32 top_y = grid_y[grid_top][col] * (GRID - u) + grid_y[grid_top][col + 1] * u;
+            const vx_int32 bottom_x = grid_x[grid_bottom][col] * (GRID - u) + grid_x[grid_bottom][col + 1] * u;
+            const vx_int32 bottom_y = grid_y[grid_bottom][col] * (GRID - u) + grid_y[grid_bottom][col + 1] * u;
+            const vx_int64 dx = static_cast<vx_int64>(top_x) * (GRID - v) + static_cast<vx_int64>(bottom_x) * v;
+            const vx_int64 dy = static_cast<vx_int64>(top_y) * (GRID - v) + static_cast<vx_int64>(bottom_y) * v;
+
+            // Source coordinate in 8-bit fixed point
+            const vx_int64 src_x = static_cast<vx_int64>(x) * (1 << WEIGHT_BITS) +
+                                   ((dx * (1 << WEIGHT_BITS)) >> (FRACTION_BITS + 2 * GRID_BITS));
+            const vx_int64 src_y =
+                y * (1 << WEIGHT_BITS) + ((dy * (1 << WEIGHT_BITS)) >> (FRACTION_BITS + 2 * GRID_BITS));
+            const DataType result = WarpSample<DataType, WIDTH, HEIGHT, MAX_DISPLACEMENT, INTERPOLATION>(
+                cache, true, src_x, src_y, y, first_slot);
+
+            // Write the output
+            vx_image_data<DataType, 1> dst;
+            GenerateDmaSignal<DataType, 1>((ptr == 0), (ptr == PIXELS - 1), dst);
+            dst.pixel[0] = result;
+            output[ptr] = dst;
+            ptr++;
+        }
+
+        // Next pixel, cache slots and grid rows
+        if (x == WIDTH - 1) {
+            if (grid_read) {
+                grid_row++;
+                grid_write = (grid_write == 2) ? (0) : (grid_write + 1);
+            }
+            if ((t >= LATENCY) && (((t - LATENCY) & (GRID - 1)) == GRID - 1))
+                grid_top = (grid_top == 2) ? (0) : (grid_top + 1);
+            x = 0;
+            t++;
+            write_slot = first_slot;
+            first_slot = (first_slot == CACHE_ROWS - 1) ? (0) : (first_slot + 1);
+
+            // Grid rows 0 and 1 are read before the output starts, row b + 2 in the first row of band b
+            if (grid_row >= GRID_ROWS)
+                grid_read = false;
+            else if (grid_row < 2)
+                grid_read = (t == grid_row);
+            else
+                grid_read = (t >= LATENCY) && ((t - LATENCY) == static_cast<vx_uint32>(grid_row - 2) * GRID);
+        } else {
+            x++;
+        }
+    }
+}
+
 /*********************************************************************************************************************/
 /* Takes one image and scatters it to multiple outputs */
 
@@ -9,7 +9,8 @@
  * @author  Lester Kalms <lester.kalms@tu-dresden.de>
  * @version 3.0
  * @brief Description:\n
- *  These are accelerated feature (multicat, retain best, FAST, Canny, ORB) functions (Call from here)
+ *  These are accelerated feature (multicat, retain best, FAST, Canny, Hough, template matching, ORB) functions
+ *  (Call from here)
  */
 
 #ifndef SRC_IMG_FEATURES_BASE_H_
@@ -177,6 +178,82 @@ void ImgCannyEdgeDetector(UintType src[IMG_COLS * IMG_ROWS],
                       THRESH_UPPER, SOBEL_KERN_SIZE, HYST_KERN_SIZE, ROUND_POLICY>(src, dst);          //
 }
 
+/***************************************************************************************************************************************************/
+template <typename SrcType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint16 THETA_NUM, //
+          vx_uint8 RHO_SHIFT, vx_uint8 THETA_BANKS, vx_uint16 MAX_LINES, vx_uint16 THRESHOLD>            //
+void ImgHoughLines(vx_image_data<SrcType, VEC_NUM> edges[(IMG_COLS * IMG_ROWS) / VEC_NUM],                 //
+                   vx_image_data<vx_int32, HIFLIPVX::HOUGH_RECORD_SIZE> lines[MAX_LINES],                  //
+                   vx_image_data<vx_uint16, 1> line_count[1]) {                                            //
+#pragma HLS INLINE
+#pragma HLS DATA_PACK variable = edges
+#pragma HLS DATA_PACK variable = lines
+#pragma HLS DATA_PACK variable = line_count
+    HoughLines<SrcType, vx_uint8, VEC_NUM, IMG_COLS, IMG_ROWS, THETA_NUM, RHO_SHIFT, THETA_BANKS, MAX_LINES, //
+               THRESHOLD, false, 8, 0>(edges, NULL, lines, line_count);                                      //
+}
+template <typename SrcType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint16 THETA_NUM, //
+          vx_uint8 RHO_SHIFT, vx_uint8 THETA_BANKS, vx_uint16 MAX_LINES, vx_uint16 THRESHOLD>            //
+void ImgHoughLines(SrcType edges[IMG_COLS * IMG_ROWS],                                                     //
+                   vx_int32 lines[MAX_LINES * HIFLIPVX::HOUGH_RECORD_SIZE],                                //
+                   vx_uint16 line_count[1]) {                                                              //
+#pragma HLS INLINE
+    HoughLines<SrcType, vx_uint8, VEC_NUM, IMG_COLS, IMG_ROWS, THETA_NUM, RHO_SHIFT, THETA_BANKS, MAX_LINES, //
+               THRESHOLD, false, 8, 0>(                                                                      //
+        (vx_image_data<SrcType, VEC_NUM> *)edges, NULL,                                                      //
+        (vx_image_data<vx_int32, HIFLIPVX::HOUGH_RECORD_SIZE> *)lines,                                       //
+        (vx_image_data<vx_uint16, 1> *)line_count);                                                          //
+}
+template <typename SrcType, typename PhaseType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, //
+          vx_uint16 THETA_NUM, vx_uint8 RHO_SHIFT, vx_uint8 THETA_BANKS, vx_uint16 MAX_LINES,             //
+          vx_uint16 THRESHOLD, vx_uint8 PHASE_QUANTIZATION, vx_uint16 PHASE_WINDOW>                       //
+void ImgHoughLines(vx_image_data<SrcType, VEC_NUM> edges[(IMG_COLS * IMG_ROWS) / VEC_NUM],                //
+                   vx_image_data<PhaseType, VEC_NUM> phase[(IMG_COLS * IMG_ROWS) / VEC_NUM],              //
+                   vx_image_data<vx_int32, HIFLIPVX::HOUGH_RECORD_SIZE> lines[MAX_LINES],                 //
+                   vx_image_data<vx_uint16, 1> line_count[1]) {                                           //
+#pragma HLS INLINE
+#pragma HLS DATA_PACK variable = edges
+#pragma HLS DATA_PACK variable = phase
+#pragma HLS DATA_PACK variable = lines
+#pragma HLS DATA_PACK variable = line_count
+    HoughLines<SrcType, PhaseType, VEC_NUM, IMG_COLS, IMG_ROWS, THETA_NUM, RHO_SHIFT, THETA_BANKS, MAX_LINES, //
+               THRESHOLD, true, PHASE_QUANTIZATION, PHASE_WINDOW>(edges, phase, lines, line_count);           //
+}
+template <typename SrcType, typename PhaseType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, //
+          vx_uint16 THETA_NUM, vx_uint8 RHO_SHIFT, vx_uint8 THETA_BANKS, vx_uint16 MAX_LINES,             //
+          vx_uint16 THRESHOLD, vx_uint8 PHASE_QUANTIZATION, vx_uint16 PHASE_WINDOW>                       //
+void ImgHoughLines(SrcType edges[IMG_COLS * IMG_ROWS],                                                    //
+                   PhaseType phase[IMG_COLS * IMG_ROWS],                                                  //
+                   vx_int32 lines[MAX_LINES * HIFLIPVX::HOUGH_RECORD_SIZE],                               //
+                   vx_uint16 line_count[1]) {                                                             //
+#pragma HLS INLINE
+    HoughLines<SrcType, PhaseType, VEC_NUM, IMG_COLS, IMG_ROWS, THETA_NUM, RHO_SHIFT, THETA_BANKS, MAX_LINES, //
+               THRESHOLD, true, PHASE_QUANTIZATION, PHASE_WINDOW>(                                            //
+        (vx_image_data<SrcType, VEC_NUM> *)edges, (vx_image_data<PhaseType, VEC_NUM> *)phase,                 //
+        (vx_image_data<vx_int32, HIFLIPVX::HOUGH_RECORD_SIZE> *)lines,                                        //
+        (vx_image_data<vx_uint16, 1> *)line_count);                                                           //
+}
+
+/***************************************************************************************************************************************************/
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint16 TEMPLATE_SIZE, //
+          HIFLIPVX::TemplateMatchMode MODE, vx_border_e BORDER_TYPE>                                         //
+void ImgMatchTemplate(vx_image_data<vx_uint8, VEC_NUM> input[(IMG_COLS * IMG_ROWS) / VEC_NUM],                //
+                      vx_image_data<DstType, VEC_NUM> output[(IMG_COLS * IMG_ROWS) / VEC_NUM],                //
+                      const vx_uint8 templ[TEMPLATE_SIZE][TEMPLATE_SIZE]) {                                   //
+#pragma HLS INLINE
+#pragma HLS DATA_PACK variable = input
+#pragma HLS DATA_PACK variable = output
+    MatchTemplate<DstType, VEC_NUM, IMG_COLS, IMG_ROWS, TEMPLATE_SIZE, MODE, BORDER_TYPE>(input, output, templ);
+}
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint16 TEMPLATE_SIZE, //
+          HIFLIPVX::TemplateMatchMode MODE, vx_border_e BORDER_TYPE>                                         //
+void ImgMatchTemplate(vx_uint8 input[IMG_COLS * IMG_ROWS],                                                    //
+                      DstType output[IMG_COLS * IMG_ROWS],                                                    //
+                      const vx_uint8 templ[TEMPLATE_SIZE][TEMPLATE_SIZE]) {                                   //
+#pragma HLS INLINE
+    MatchTemplate<DstType, VEC_NUM, IMG_COLS, IMG_ROWS, TEMPLATE_SIZE, MODE, BORDER_TYPE>( //
+        (vx_image_data<vx_uint8, VEC_NUM> *)input, (vx_image_data<DstType, VEC_NUM> *)output, templ);
+}
+
 /***************************************************************************************************************************************************/
 template <vx_uint16 MAX_INPUT_FEATURES, vx_uint16 MAX_OUTPUT_FEATURES, vx_uint16 MIN_RESPONSE_VAL,
           vx_uint16 MAX_RESPONSE_VAL>
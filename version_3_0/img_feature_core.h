@@ -435,6 +435,465 @@ void CannyEdgeDetector(UintImage src[IMG_COLS * IMG_ROWS], UintImage dst[IMG_COL
 #endif
 }
 
+/***************************************************************************************************************************************************/
+// Increments a vote of a theta bank (reads the current and writes the previous vote to alternating tables)
+template <vx_uint32 BANK_SIZE>
+void HoughUpdateEntry(vx_uint32 i, vx_uint32 address, vx_bool ignore, vx_uint16 ACC_A[BANK_SIZE],
+                      vx_uint16 ACC_B[BANK_SIZE], vx_uint32 &pre_address, vx_uint16 &pre_val) {
+#pragma HLS INLINE
+
+    const vx_uint32 cur_address = (ignore == vx_false_e) ? (address) : (0);
+    vx_uint16 cur_val = 0;
+
+    // Read current vote & write previous vote
+    if (i % 2 == 0) {
+        cur_val = ACC_A[cur_address];
+        ACC_B[pre_address] = pre_val;
+    } else {
+        cur_val = ACC_B[cur_address];
+        ACC_A[pre_address] = pre_val;
+    }
+
+    // Increment vote (saturated)
+    if ((ignore == vx_false_e) && (cur_val < 0xFFFF))
+        ++cur_val;
+
+    // Update to store in next iteration
+    pre_address = cur_address;
+    pre_val = cur_val;
+}
+
+/***************************************************************************************************************************************************/
+// Inserts a line into the sorted list of the best lines (an earlier line stays in front for equal votes)
+template <vx_uint16 MAX_LINES>
+void HoughInsertLine(vx_uint16 votes, vx_uint16 theta, vx_int32 rho, vx_uint16 best_votes[MAX_LINES],
+                     vx_uint16 best_theta[MAX_LINES], vx_int32 best_rho[MAX_LINES]) {
+#pragma HLS INLINE
+    for (vx_int32 k = MAX_LINES - 1; k >= 0; k--) {
+#pragma HLS unroll
+        if (votes > best_votes[k]) {
+            if ((k == 0) || (votes <= best_votes[k - 1])) {
+                best_votes[k] = votes;
+                best_theta[k] = theta;
+                best_rho[k] = rho;
+            } else {
+                best_votes[k] = best_votes[k - 1];
+                best_theta[k] = best_theta[k - 1];
+                best_rho[k] = best_rho[k - 1];
+            }
+        }
+    }
+}
+
+/***************************************************************************************************************************************************/
+template <typename SrcType, typename PhaseType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS,
+          vx_uint16 THETA_NUM, vx_uint8 RHO_SHIFT, vx_uint8 THETA_BANKS, vx_uint16 MAX_LINES, vx_uint16 THRESHOLD,
+          bool USE_PHASE, vx_uint8 PHASE_QUANTIZATION, vx_uint16 PHASE_WINDOW>
+void HoughLines(vx_image_data<SrcType, VEC_NUM> edges[(IMG_COLS * IMG_ROWS) / VEC_NUM],
+                vx_image_data<PhaseType, VEC_NUM> phase[(IMG_COLS * IMG_ROWS) / VEC_NUM],
+                vx_image_data<vx_int32, HIFLIPVX::HOUGH_RECORD_SIZE> lines[MAX_LINES],
+                vx_image_data<vx_uint16, 1> line_count[1]) {
+#pragma HLS INLINE
+
+    // Constants: rho = x * cos(theta) + y * sin(theta) lies in [-(IMG_COLS - 1), max + min / 2]
+    const vx_uint16 VEC_COLS = IMG_COLS / VEC_NUM;
+    const vx_uint32 DIAGONAL = static_cast<vx_uint32>(MAX(IMG_COLS, IMG_ROWS)) + MIN(IMG_COLS, IMG_ROWS) / 2 + 1;
+    const vx_int32 RHO_OFFSET = static_cast<vx_int32>((IMG_COLS - 1) >> RHO_SHIFT) + 1;
+    const vx_uint32 RHO_NUM = static_cast<vx_uint32>(RHO_OFFSET) + (DIAGONAL >> RHO_SHIFT) + 2;
+    const vx_uint16 BANK_ROWS = THETA_NUM / THETA_BANKS;
+    const vx_uint32 BANK_SIZE = static_cast<vx_uint32>(BANK_ROWS) * RHO_NUM;
+    const vx_uint16 WINDOW = (USE_PHASE == true) ? (2 * PHASE_WINDOW + 1) : (THETA_NUM);
+    const vx_uint16 BLOCKS = (WINDOW + THETA_BANKS - 1) / THETA_BANKS;
+    const vx_uint32 PHASE_HALF = static_cast<vx_uint32>(1) << (PHASE_QUANTIZATION - 1);
+    const vx_uint8 TRIG_BITS = 14;
+    const vx_int64 HALF_TURN = static_cast<vx_int64>(1) << 39;
+    const vx_int32 ROUNDING = static_cast<vx_int32>(1) << (TRIG_BITS + RHO_SHIFT - 1);
+
+    // Check function parameters/types
+    const vx_type_e SRC_TYPE = GET_TYPE(SrcType);
+    STATIC_ASSERT((SRC_TYPE == VX_TYPE_UINT8) || (SRC_TYPE == VX_TYPE_UINT16), edges_must_be_8_or_16_bit_unsigned);
+    STATIC_ASSERT((VEC_NUM == 1) || (VEC_NUM == 2) || (VEC_NUM == 4) || (VEC_NUM == 8), vec_num_must_be_1_2_4_or_8);
+    STATIC_ASSERT((IMG_COLS % VEC_NUM) == 0, image_columns_must_be_multiple_of_vec_num);
+    STATIC_ASSERT((THETA_BANKS >= 1) && ((THETA_NUM % THETA_BANKS) == 0), theta_num_must_be_multiple_of_banks);
+    STATIC_ASSERT((MAX_LINES >= 1) && (THRESHOLD >= 1), max_lines_and_threshold_must_be_positive);
+    STATIC_ASSERT((PHASE_QUANTIZATION >= 1) && (PHASE_QUANTIZATION <= 8), phase_quantization_between_1_and_8);
+    STATIC_ASSERT(WINDOW <= THETA_NUM, phase_window_must_be_smaller_than_half_of_theta_num);
+
+    // Accumulator (2 tables per theta bank), cosine and sine (Q1.14) of the theta of each bank row
+    vx_uint16 ACC[2 * THETA_BANKS][BANK_SIZE];
+#pragma HLS array_partition variable = ACC complete dim = 1
+    vx_int16 COS[THETA_BANKS][BANK_ROWS], SIN[THETA_BANKS][BANK_ROWS];
+#pragma HLS array_partition variable = COS complete dim = 1
+#pragma HLS array_partition variable = SIN complete dim = 1
+    vx_uint32 pre_address[THETA_BANKS];
+    vx_uint16 pre_val[THETA_BANKS];
+#pragma HLS array_partition variable = pre_address complete dim = 0
+#pragma HLS array_partition variable = pre_val complete dim = 0
+
+    // Edges of the current row (column and first theta of the window) of each vector lane
+    vx_uint16 edge_x[VEC_NUM][VEC_COLS], edge_theta[VEC_NUM][VEC_COLS], edge_num[VEC_NUM];
+#pragma HLS array_partition variable = edge_x complete dim = 1
+#pragma HLS array_partition variable = edge_theta complete dim = 1
+#pragma HLS array_partition variable = edge_num complete dim = 0
+
+    // Reset the accumulator and compute the cosine and sine tables
+    for (vx_uint32 i = 0; i < BANK_SIZE; i++) {
+#pragma HLS PIPELINE II = 1
+        for (vx_uint16 b = 0; b < 2 * THETA_BANKS; b++) {
+#pragma HLS unroll
+            ACC[b][i] = 0;
+        }
+    }
+    for (vx_uint16 row = 0; row < BANK_ROWS; row++) {
+        for (vx_uint16 b = 0; b < THETA_BANKS; b++) {
+            const vx_int64 theta = static_cast<vx_int64>(row) * THETA_BANKS + b;
+            const vx_int64 angle = (theta * HALF_TURN + THETA_NUM / 2) / THETA_NUM;
+            vx_int32 cos_val = 0, sin_val = 0;
+            sinCosCordic<TRIG_BITS>(angle, cos_val, sin_val);
+            COS[b][row] = static_cast<vx_int16>(cos_val);
+            SIN[b][row] = static_cast<vx_int16>(sin_val);
+        }
+    }
+    for (vx_uint16 b = 0; b < THETA_BANKS; b++) {
+#pragma HLS unroll
+        pre_address[b] = 0;
+        pre_val[b] = 0;
+    }
+
+    // Vote for each edge pixel (all theta or a window around the gradient direction), row by row
+    vx_uint32 i = 0;
+    for (vx_uint16 y = 0; y < IMG_ROWS; y++) {
+
+        // Collect the edges of the row
+        for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+            edge_num[v] = 0;
+        }
+        for (vx_uint16 x = 0; x < VEC_COLS; x++) {
+#pragma HLS PIPELINE II = 1
+            const vx_uint32 ptr = static_cast<vx_uint32>(y) * VEC_COLS + x;
+            vx_image_data<SrcType, VEC_NUM> src = edges[ptr];
+            vx_image_data<PhaseType, VEC_NUM> orientation;
+            if (USE_PHASE == true)
+                orientation = phase[ptr];
+            for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+                if (src.pixel[v] != 0) {
+                    vx_uint16 theta = 0;
+                    if (USE_PHASE == true) {
+                        const vx_uint32 bin = static_cast<vx_uint32>(orientation.pixel[v]) % PHASE_HALF;
+                        const vx_uint32 center = ((bin * THETA_NUM * 2 + PHASE_HALF) / (2 * PHASE_HALF)) % THETA_NUM;
+                        theta = static_cast<vx_uint16>((center + THETA_NUM - PHASE_WINDOW) % THETA_NUM);
+                    }
+                    edge_x[v][edge_num[v]] = x * VEC_NUM + v;
+                    edge_theta[v][edge_num[v]] = theta;
+                    edge_num[v]++;
+                }
+            }
+        }
+
+        // Vote: every bank computes the theta of the window that falls into it
+        for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+            for (vx_uint16 e = 0; e < edge_num[v]; e++) {
+                for (vx_uint16 block = 0; block < BLOCKS; block++, i++) {
+#pragma HLS PIPELINE II = 1
+                    const vx_int32 x = static_cast<vx_int32>(edge_x[v][e]);
+                    const vx_uint16 start = edge_theta[v][e];
+                    for (vx_uint16 b = 0; b < THETA_BANKS; b++) {
+#pragma HLS unroll
+                        const vx_uint16 shift = (b + THETA_BANKS - (start % THETA_BANKS)) % THETA_BANKS;
+                        const vx_uint16 offset = block * THETA_BANKS + shift;
+                        const vx_uint16 row = ((start + offset) % THETA_NUM) / THETA_BANKS;
+                        const vx_int32 rho = x * COS[b][row] + static_cast<vx_int32>(y) * SIN[b][row] + ROUNDING;
+                        const vx_int32 index = (rho >> (TRIG_BITS + RHO_SHIFT)) + RHO_OFFSET;
+                        const vx_uint32 address = static_cast<vx_uint32>(row) * RHO_NUM + static_cast<vx_uint32>(index);
+                        const vx_bool ignore = (offset < WINDOW) ? (vx_false_e) : (vx_true_e);
+                        HoughUpdateEntry<BANK_SIZE>(i, address, ignore, ACC[2 * b], ACC[2 * b + 1], pre_address[b],
+                                                    pre_val[b]);
+                    }
+                }
+            }
+        }
+    }
+
+    // Write the last votes into the table they were read from
+    for (vx_uint16 b = 0; b < THETA_BANKS; b++) {
+#pragma HLS unroll
+        if (i > 0)
+            ACC[2 * b + ((i - 1) % 2)][pre_address[b]] = pre_val[b];
+    }
+
+    // Keep the best local maxima (3x3) scanning the accumulator in (theta, rho) order
+    vx_uint16 best_votes[MAX_LINES], best_theta[MAX_LINES];
+    vx_int32 best_rho[MAX_LINES];
+#pragma HLS array_partition variable = best_votes complete dim = 0
+#pragma HLS array_partition variable = best_theta complete dim = 0
+#pragma HLS array_partition variable = best_rho complete dim = 0
+    for (vx_uint16 k = 0; k < MAX_LINES; k++) {
+#pragma HLS unroll
+        best_votes[k] = 0;
+        best_theta[k] = 0;
+        best_rho[k] = 0;
+    }
+    vx_uint16 line_prev2[RHO_NUM], line_prev1[RHO_NUM];
+    vx_uint16 window[3][3];
+#pragma HLS array_partition variable = window complete dim = 0
+    for (vx_uint16 theta = 0; theta <= THETA_NUM; theta++) {
+        for (vx_uint32 r = 0; r <= RHO_NUM; r++) {
+#pragma HLS PIPELINE II = 1
+
+            // Read the votes of the column (theta - 2, theta - 1, theta) at rho r
+            vx_uint16 column[3] = {0, 0, 0};
+            if (r < RHO_NUM) {
+                vx_uint16 votes = 0;
+                if (theta < THETA_NUM) {
+                    const vx_uint16 b = theta % THETA_BANKS;
+                    const vx_uint32 address = static_cast<vx_uint32>(theta / THETA_BANKS) * RHO_NUM + r;
+                    const vx_uint32 sum = static_cast<vx_uint32>(ACC[2 * b][address]) + ACC[2 * b + 1][address];
+                    votes = static_cast<vx_uint16>(MIN(sum, static_cast<vx_uint32>(0xFFFF)));
+                }
+                column[0] = (theta >= 2) ? (line_prev2[r]) : (static_cast<vx_uint16>(0));
+                column[1] = (theta >= 1) ? (line_prev1[r]) : (static_cast<vx_uint16>(0));
+                column[2] = votes;
+                line_prev2[r] = column[1];
+                line_prev1[r] = column[2];
+            }
+
+            // Shift the window
+            for (vx_uint16 t = 0; t < 3; t++) {
+#pragma HLS unroll
+                window[t][0] = (r == 0) ? (static_cast<vx_uint16>(0)) : (window[t][1]);
+                window[t][1] = (r == 0) ? (static_cast<vx_uint16>(0)) : (window[t][2]);
+                window[t][2] = column[t];
+            }
+
+            // The center (theta - 1, r - 1) is a line if it is larger than the previous and not smaller than the
+            // next neighbors
+            const vx_uint16 center = window[1][1];
+            bool peak = (theta >= 1) && (r >= 1) && (center >= THRESHOLD);
+            for (vx_uint16 t = 0; t < 3; t++) {
+#pragma HLS unroll
+                for (vx_uint16 c = 0; c < 3; c++) {
+#pragma HLS unroll
+                    const bool previous = (t == 0) || ((t == 1) && (c == 0));
+                    if ((previous == true) && (window[t][c] >= center))
+                        peak = false;
+                    if ((previous == false) && ((t != 1) || (c != 1)) && (window[t][c] > center))
+                        peak = false;
+                }
+            }
+            if (peak == true) {
+                const vx_int32 rho = (static_cast<vx_int32>(r) - 1 - RHO_OFFSET) * (1 << RHO_SHIFT);
+                HoughInsertLine<MAX_LINES>(center, theta - 1, rho, best_votes, best_theta, best_rho);
+            }
+        }
+    }
+
+    // Write the lines and their amount
+    vx_uint16 count = 0;
+    for (vx_uint16 k = 0; k < MAX_LINES; k++) {
+#pragma HLS unroll
+        if (best_votes[k] > 0)
+            count++;
+    }
+    for (vx_uint16 k = 0; k < count; k++) {
+#pragma HLS PIPELINE II = 1
+        vx_image_data<vx_int32, HIFLIPVX::HOUGH_RECORD_SIZE> dst;
+        GenerateDmaSignal<vx_int32, HIFLIPVX::HOUGH_RECORD_SIZE>((k == 0), (k == count - 1), dst);
+        dst.pixel[HIFLIPVX::HOUGH_RHO] = best_rho[k];
+        dst.pixel[HIFLIPVX::HOUGH_THETA] = static_cast<vx_int32>(best_theta[k]);
+        dst.pixel[HIFLIPVX::HOUGH_VOTES] = static_cast<vx_int32>(best_votes[k]);
+        lines[k] = dst;
+    }
+    vx_image_data<vx_uint16, 1> dst_count;
+    GenerateDmaSignal<vx_uint16, 1>(true, true, dst_count);
+    dst_count.pixel[0] = count;
+    line_count[0] = dst_count;
+}
+
+/***************************************************************************************************************************************************/
+// Computes the response of a template match from the window sums (a larger response is a better match)
+template <typename DstType, HIFLIPVX::TemplateMatchMode MODE, vx_int64 PIXELS>
+DstType MatchTemplateResponse(vx_uint32 correlation, vx_uint32 sum, vx_uint32 sqr, vx_uint32 pattern_sum,
+                              vx_uint32 pattern_sqr, vx_float32 pattern_dev) {
+#pragma HLS INLINE
+
+    // Constants
+    const vx_int64 DST_MIN = static_cast<vx_int64>(std::numeric_limits<DstType>::min());
+    const vx_int64 NCC_ONE = 16384;
+
+    vx_int64 result = 0;
+
+    // SSD: sum(I^2) - 2 * sum(I * T) + sum(T^2), the response is the negative mean
+    if (MODE == HIFLIPVX::MATCH_SSD) {
+        const vx_int64 ssd = static_cast<vx_int64>(sqr) - 2 * static_cast<vx_int64>(correlation) + pattern_sqr;
+        result = -((ssd + PIXELS / 2) / PIXELS);
+        if (result < DST_MIN)
+            result = DST_MIN;
+
+        // NCC: (N * sum(I * T) - sum(I) * sum(T)) / sqrt((N * sum(I^2) - sum(I)^2) * (N * sum(T^2) - sum(T)^2))
+    } else if (MODE == HIFLIPVX::MATCH_NCC) {
+        const vx_int64 covariance = PIXELS * correlation - static_cast<vx_int64>(sum) * pattern_sum;
+        const vx_int64 variance = PIXELS * sqr - static_cast<vx_int64>(sum) * sum;
+        const vx_float32 deviation = sqrtf(static_cast<vx_float32>(variance)) * pattern_dev;
+        if (deviation > 0.0f) {
+            const vx_float32 ncc = static_cast<vx_float32>(covariance) / deviation;
+            result = static_cast<vx_int64>(floorf(ncc * static_cast<vx_float32>(NCC_ONE) + 0.5f));
+            result = MAX(MIN(result, NCC_ONE), -NCC_ONE);
+        }
+    }
+
+    return static_cast<DstType>(result);
+}
+
+/***************************************************************************************************************************************************/
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint16 TEMPLATE_SIZE,
+          HIFLIPVX::TemplateMatchMode MODE, vx_border_e BORDER_TYPE>
+void MatchTemplate(vx_image_data<vx_uint8, VEC_NUM> input[(IMG_COLS * IMG_ROWS) / VEC_NUM],
+                   vx_image_data<DstType, VEC_NUM> output[(IMG_COLS * IMG_ROWS) / VEC_NUM],
+                   const vx_uint8 templ[TEMPLATE_SIZE][TEMPLATE_SIZE]) {
+#pragma HLS INLINE
+
+    // Constants: the window has an odd size (an even template is aligned to its upper left corner)
+    const vx_uint16 KERN_SIZE = TEMPLATE_SIZE | 1;
+    const vx_uint16 KERN_RAD = KERN_SIZE >> 1;
+    const vx_uint16 VEC_COLS = IMG_COLS / VEC_NUM;
+    const vx_uint16 WIN_COLS = (KERN_RAD << 1) + VEC_NUM + (VEC_NUM - (KERN_RAD % VEC_NUM)) % VEC_NUM;
+    const vx_uint16 OHD_COLS = (WIN_COLS - KERN_RAD) / VEC_NUM - 1;
+    const vx_int64 PIXELS = static_cast<vx_int64>(TEMPLATE_SIZE) * TEMPLATE_SIZE;
+
+    // Check function parameters/types
+    const vx_type_e DST_TYPE = GET_TYPE(DstType);
+    STATIC_ASSERT((DST_TYPE == VX_TYPE_INT16) || (DST_TYPE == VX_TYPE_INT32), response_must_be_16_or_32_bit_signed);
+    STATIC_ASSERT((VEC_NUM == 1) || (VEC_NUM == 2) || (VEC_NUM == 4) || (VEC_NUM == 8), vec_num_must_be_1_2_4_or_8);
+    STATIC_ASSERT((IMG_COLS % VEC_NUM) == 0, image_columns_must_be_multiple_of_vec_num);
+    STATIC_ASSERT((TEMPLATE_SIZE >= 2) && (TEMPLATE_SIZE <= 64), template_size_must_be_between_2_and_64);
+    STATIC_ASSERT((KERN_SIZE <= IMG_COLS) && (KERN_SIZE <= IMG_ROWS), template_must_be_smaller_than_image);
+    STATIC_ASSERT((MODE == HIFLIPVX::MATCH_SSD) || (MODE == HIFLIPVX::MATCH_NCC), match_mode_not_supported);
+
+    // Template, its sum and its deviation term: sqrt(N * sum(T^2) - sum(T)^2)
+    vx_uint8 pattern[TEMPLATE_SIZE][TEMPLATE_SIZE];
+#pragma HLS array_partition variable = pattern complete dim = 0
+    vx_uint32 pattern_sum = 0, pattern_sqr = 0;
+    for (vx_uint16 i = 0; i < TEMPLATE_SIZE; i++) {
+#pragma HLS PIPELINE II = 1
+        for (vx_uint16 j = 0; j < TEMPLATE_SIZE; j++) {
+#pragma HLS unroll
+            const vx_uint8 value = templ[i][j];
+            pattern[i][j] = value;
+            pattern_sum += value;
+            pattern_sqr += static_cast<vx_uint32>(value) * value;
+        }
+    }
+    const vx_int64 pattern_var = PIXELS * pattern_sqr - static_cast<vx_int64>(pattern_sum) * pattern_sum;
+    const vx_float32 pattern_dev = sqrtf(static_cast<vx_float32>(pattern_var));
+
+    // Linebuffer
+    vx_data_pack<vx_uint8, (KERN_SIZE - 1) * VEC_NUM> linebuffer[VEC_COLS];
+    HIFLIPVX_DATAPACK(linebuffer);
+
+    // Sliding windows of the pixels (correlation) and of the column sums (normalization terms)
+    vx_uint8 window[TEMPLATE_SIZE][1][WIN_COLS];
+#pragma HLS array_partition variable = window complete dim = 0
+    vx_uint16 sum_window[1][WIN_COLS];
+#pragma HLS array_partition variable = sum_window complete dim = 0
+    vx_uint32 sqr_window[1][WIN_COLS];
+#pragma HLS array_partition variable = sqr_window complete dim = 0
+
+    vx_uint32 ptr_src = 0;
+    vx_uint32 ptr_dst = 0;
+
+    // Compute the response (pipelined)
+    for (vx_uint16 y = 0; y < IMG_ROWS + KERN_RAD; ++y) {
+        for (vx_uint16 x = 0; x < VEC_COLS + OHD_COLS; ++x) {
+#pragma HLS PIPELINE II = 1
+
+            vx_uint8 input_buffer[VEC_NUM];
+#pragma HLS array_partition variable = input_buffer complete dim = 0
+            vx_uint8 buffer[KERN_SIZE][VEC_NUM], column[KERN_SIZE][VEC_NUM];
+#pragma HLS array_partition variable = buffer complete dim = 0
+#pragma HLS array_partition variable = column complete dim = 0
+            vx_uint16 column_sum[VEC_NUM];
+            vx_uint32 column_sqr[VEC_NUM];
+#pragma HLS array_partition variable = column_sum complete dim = 0
+#pragma HLS array_partition variable = column_sqr complete dim = 0
+
+            // Input & Output
+            vx_image_data<vx_uint8, VEC_NUM> input_data;
+            vx_image_data<DstType, VEC_NUM> output_data;
+
+            // Read input data from global memory
+            if ((y < IMG_ROWS) && (x < VEC_COLS)) {
+                input_data = input[ptr_src];
+                ++ptr_src;
+            }
+            for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+                input_buffer[v] = input_data.pixel[v];
+            }
+
+            // Linebuffer and new window column (vertical border)
+            ReadFromLineBuffer_<vx_uint8, VEC_NUM, KERN_SIZE, VEC_COLS>(input_buffer, linebuffer, buffer, x);
+            WriteToLineBuffer_<vx_uint8, VEC_NUM, KERN_SIZE, VEC_COLS>(buffer, linebuffer, x);
+            SlidingWindowVertical<vx_uint8, IMG_ROWS, KERN_RAD, VEC_NUM, KERN_SIZE, BORDER_TYPE>(buffer, column, y);
+
+            // Sum and squared sum of the new columns
+            for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+                vx_uint16 sum = 0;
+                vx_uint32 sqr = 0;
+                for (vx_uint16 i = 0; i < TEMPLATE_SIZE; i++) {
+#pragma HLS unroll
+                    sum += column[i][v];
+                    sqr += static_cast<vx_uint32>(column[i][v]) * column[i][v];
+                }
+                column_sum[v] = sum;
+                column_sqr[v] = sqr;
+            }
+
+            // Move the sliding windows (horizontal border)
+            for (vx_uint16 i = 0; i < TEMPLATE_SIZE; i++) {
+#pragma HLS unroll
+                SlidingWindowHorizontal<vx_uint8, KERN_RAD, VEC_COLS, VEC_NUM, WIN_COLS, BORDER_TYPE>(column[i],
+                                                                                                      window[i], x);
+            }
+            SlidingWindowHorizontal<vx_uint16, KERN_RAD, VEC_COLS, VEC_NUM, WIN_COLS, BORDER_TYPE>(column_sum,
+                                                                                                   sum_window, x);
+            SlidingWindowHorizontal<vx_uint32, KERN_RAD, VEC_COLS, VEC_NUM, WIN_COLS, BORDER_TYPE>(column_sqr,
+                                                                                                   sqr_window, x);
+
+            // Correlation of the template with the window and the window sums of each vector element
+            for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+                vx_uint32 correlation = 0, sum = 0, sqr = 0;
+                for (vx_uint16 i = 0; i < TEMPLATE_SIZE; i++) {
+#pragma HLS unroll
+                    for (vx_uint16 j = 0; j < TEMPLATE_SIZE; j++) {
+#pragma HLS unroll
+                        correlation += static_cast<vx_uint32>(window[i][0][j + v]) * pattern[i][j];
+                    }
+                }
+                for (vx_uint16 j = 0; j < TEMPLATE_SIZE; j++) {
+#pragma HLS unroll
+                    sum += sum_window[0][j + v];
+                    sqr += sqr_window[0][j + v];
+                }
+                output_data.pixel[v] = MatchTemplateResponse<DstType, MODE, PIXELS>(correlation, sum, sqr, pattern_sum,
+                                                                                    pattern_sqr, pattern_dev);
+            }
+
+            // Write output data to global memory
+            if ((y >= KERN_RAD) && (x >= OHD_COLS)) {
+                const bool sof = ((y == KERN_RAD) && (x == OHD_COLS));
+                const bool eof = ((y == IMG_ROWS + KERN_RAD - 1) && (x == VEC_COLS + OHD_COLS - 1));
+                GenerateDmaSignal<DstType, VEC_NUM>(sof, eof, output_data);
+                output[ptr_dst] = output_data;
+                ++ptr_dst;
+            }
+        }
+    }
+}
+
 /***************************************************************************************************************************************************/
 template <vx_uint16 MAX_INPUT_FEATURES, vx_uint16 MIN_RESPONSE_VAL, vx_uint16 SHIFT, vx_uint16 BINS>
 void RetainBestHistogram(vx_uint32 i, KeyPoint feature, vx_uint16 pre_bin, vx_uint16 pre_val, vx_uint16 &cur_bin,
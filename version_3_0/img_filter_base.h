@@ -683,4 +683,42 @@ void ImgConductivity(DataType input[VECTOR_PIXELS(HEIGHT, WIDTH, VEC_NUM)],
         (vx_image_data<contrastSquareT, 1> *)csquare);                       //
 }
 
+/**********************************************************************************************************************/
+/** @brief  Computes the disparity of rectified stereo images by block matching (sum of absolute differences).
+ *          The output is in pixels with 4 fractional bits (subpixel refinement) or -16 if the match is not unique.
+@param VEC_NUM          Amount of pixels computed in parallel (1, 2, 4, 8)
+@param WIDTH            Image width
+@param HEIGHT           Image height
+@param KERN_SIZE        Size of the matched blocks (3, 5, 7, ..., 31)
+@param DISPARITIES      Amount of disparities searched in parallel (2 - 256)
+@param UNIQUENESS_RATIO Margin in percent by which the best cost must beat all other costs (except neighbors)
+@param BORDER_TYPE      Type of border (Constant or Replicated)
+@param left             Left input image (reference)
+@param right            Right input image
+@param output           Disparity image
+*/
+template <vx_uint8 VEC_NUM, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint16 KERN_SIZE, vx_uint16 DISPARITIES, //
+          vx_uint8 UNIQUENESS_RATIO, vx_border_e BORDER_TYPE>                                              //
+void ImgStereoBM(                                                                                          //
+    vx_image_data<vx_uint8, VEC_NUM> left[VECTOR_PIXELS(HEIGHT, WIDTH, VEC_NUM)],                          //
+    vx_image_data<vx_uint8, VEC_NUM> right[VECTOR_PIXELS(HEIGHT, WIDTH, VEC_NUM)],                         //
+    vx_image_data<vx_int16, VEC_NUM> output[VECTOR_PIXELS(HEIGHT, WIDTH, VEC_NUM)]) {                      //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(left, right, output);
+    HwStereoBM<VECTOR_PIXELS(HEIGHT, WIDTH, VEC_NUM), VEC_NUM, WIDTH, HEIGHT, KERN_SIZE, DISPARITIES, //
+               UNIQUENESS_RATIO, BORDER_TYPE>(left, right, output);                                   //
+}
+template <vx_uint8 VEC_NUM, vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint16 KERN_SIZE, vx_uint16 DISPARITIES, //
+          vx_uint8 UNIQUENESS_RATIO, vx_border_e BORDER_TYPE>                                              //
+void ImgStereoBM(vx_uint8 left[VECTOR_PIXELS(HEIGHT, WIDTH, VEC_NUM)],                                     //
+                 vx_uint8 right[VECTOR_PIXELS(HEIGHT, WIDTH, VEC_NUM)],                                    //
+                 vx_int16 output[VECTOR_PIXELS(HEIGHT, WIDTH, VEC_NUM)]) {                                 //
+#pragma HLS INLINE
+    HwStereoBM<VECTOR_PIXELS(HEIGHT, WIDTH, VEC_NUM), VEC_NUM, WIDTH, HEIGHT, KERN_SIZE, DISPARITIES, //
+               UNIQUENESS_RATIO, BORDER_TYPE>(                                                        //
+        (vx_image_data<vx_uint8, VEC_NUM> *)left,                                                     //
+        (vx_image_data<vx_uint8, VEC_NUM> *)right,                                                    //
+        (vx_image_data<vx_int16, VEC_NUM> *)output);                                                  //
+}
+
 #endif /* SRC_IMG_FILTER_BASE_H_ */
@@ -342,6 +342,210 @@ void ComputeScaledKernel(KernType kernel_in[KERN_SIZE][KERN_SIZE],
     }
 }
 
+/** @brief Selects and computes a filter for a single output pixel
+@param InType       Data type of the input image
+@param OutType      Data type of the output image
+@param KernType     Data type of the kernel
+@param KERN_NUM     Amount of filter kernel
+@param KERN_TYPE    The type of the filter
+@param KERN_SIZE    Filter kernel size
+@param IN_NUM       Amount of input images
+@param OUT_ID       The kernel used for this output
+@param window       The window of the single output pixel
+@param kernel       The convolution kernels
+@param kernel_mult  Resulting pixels are 1. multiplied by this amount
+@param kernel_shift Resulting pixels are 2. shifted to the right by this amount
+@return             The result of the filter
+*/
+template <typename InType, typename OutType, typename KernType, typename KernModType, vx_uint16 KERN_NUM,
+          HIFLIPVX::FilterOperation KERN_TYPE, vx_hint_e PRECISION, vx_uint16 KERN_SIZE, vx_int64 THRESH_LOWER,
+          vx_int64 THRESH_UPPER, vx_uint16 IN_NUM, vx_uint16 OUT_ID, vx_uint32 QUANTIZATION>
+OutType ComputeFilterWindow(InType kernel_window[IN_NUM][KERN_SIZE][KERN_SIZE],
+                            KernType kernel[KERN_NUM][KERN_SIZE][KERN_SIZE], const vx_uint64 kernel_mult,
+                            const vx_uint32 kernel_shift, const KernModType kernel_modifier) {
+#pragma HLS INLINE
+
+    OutType result = 0;
+
+    switch (KERN_TYPE) {
+    case HIFLIPVX::GAUSSIAN_FILTER:
+        result = ComputeGaussian2d<InType, OutType, KernType, KERN_SIZE>(kernel[OUT_ID], kernel_window[0],
+                                                                         kernel_mult, kernel_shift);
+        break;
+    case HIFLIPVX::DERIVATIVE_X:
+        result = ComputeDerivativeX<InType, OutType, KernType, KERN_SIZE>(kernel[OUT_ID], kernel_window[0],
+                                                                          kernel_mult, kernel_shift);
+        break;
+    case HIFLIPVX::DERIVATIVE_Y:
+        result = ComputeDerivativeY<InType, OutType, KernType, KERN_SIZE>(kernel[OUT_ID], kernel_window[0],
+                                                                          kernel_mult, kernel_shift);
+        break;
+    case HIFLIPVX::CUSTOM_CONVOLUTION_U:
+        result = ComputeConvolve2d<InType, vx_uint64, OutType, KernType, KERN_SIZE>(
+            kernel[OUT_ID], kernel_window[0], kernel_mult, kernel_shift);
+        break;
+    case HIFLIPVX::CUSTOM_CONVOLUTION_S:
+        result = ComputeConvolve2d<InType, vx_int64, OutType, KernType, KERN_SIZE>(kernel[OUT_ID], kernel_window[0],
+                                                                                   kernel_mult, kernel_shift);
+        break;
+    case HIFLIPVX::BOX_FILTER:
+        result = ComputeBox2d<InType, OutType, KERN_SIZE>(kernel_window[0], kernel_mult, kernel_shift);
+        break;
+    case HIFLIPVX::MEDIAN_FILTER_NxN:
+        result = ComputeMedian<InType, OutType, KERN_SIZE>(kernel_window[0]);
+        break;
+    case HIFLIPVX::MEDIAN_FILTER_3x3:
+        result = ComputeMedian3x3<InType, OutType, KERN_SIZE>(kernel_window[0]);
+        break;
+    case HIFLIPVX::ERODE_IMAGE:
+        result = 0;
+        break;
+    case HIFLIPVX::DILATE_IMAGE:
+        result = 0;
+        break;
+    case HIFLIPVX::NON_MAX_SUPPRESSION:
+        result = NonMaxSuppression<InType, OutType, KernType, KERN_SIZE>(kernel[OUT_ID], kernel_window[0]);
+        break;
+    case HIFLIPVX::SEGMENT_TEST_DETECTOR:
+        result = SegmentTestDetector<InType, OutType, KERN_SIZE>(kernel_window[0]);
+        break;
+    case HIFLIPVX::HYSTERESIS:
+        result = Hysteresis<InType, OutType, KERN_SIZE, THRESH_LOWER, THRESH_UPPER>(kernel_window[0]);
+        break;
+    case HIFLIPVX::ORIENTED_NON_MAX_SUPPRESSION:
+        result = ComputeOrientedNonMaxSuppression<InType, OutType, KERN_SIZE, QUANTIZATION>(kernel_window[0],
+                                                                                            kernel_window[1]);
+        break;
+    case HIFLIPVX::FED:
+        result = ComputeFED<InType, KERN_SIZE, QUANTIZATION>(kernel_window[0], kernel_window[1]);
+        break;
+    case HIFLIPVX::DOH:
+        result = ComputeDoH<InType, OutType, KernType, KERN_NUM, KERN_SIZE>(kernel_window[0], kernel_window[1],
+                                                                            kernel, kernel_mult, kernel_shift);
+        break;
+    case HIFLIPVX::PERONA_MALIK_WIDE_REGION:
+        result = ComputePeronaMalikWideRegion<InType, KernType, KERN_NUM, KERN_SIZE, PRECISION>(
+            kernel_window[0], kernel, kernel_mult, kernel_shift, kernel_modifier);
+        break;
+    case HIFLIPVX::FORWARD1:
+        result = ForwardImageData<InType, KERN_SIZE>(kernel_window[0]);
+        break;
+    case HIFLIPVX::FORWARD2:
+        result = ForwardImageData<InType, KERN_SIZE>(kernel_window[1]);
+        break;
+    default:
+        result = 0;
+        break;
+    }
+
+    return result;
+}
+
+/** @brief Selects and computes a filter for a single output pixel of a 16-bit floating point image (vx_float16,
+           vx_bfloat16). The computation is done in vx_float32. Supports the convolution filters (gaussian, box,
+           derivatives, custom), the median filters, FED and forwarding the input.
+@param EXPONENT_BITS Amount of exponent bits of the input type
+@param others        The same as for the integer version
+*/
+template <typename InType, typename OutType, typename KernType, typename KernModType, vx_uint16 KERN_NUM,
+          HIFLIPVX::FilterOperation KERN_TYPE, vx_hint_e PRECISION, vx_uint16 KERN_SIZE, vx_int64 THRESH_LOWER,
+          vx_int64 THRESH_UPPER, vx_uint16 IN_NUM, vx_uint16 OUT_ID, vx_uint32 QUANTIZATION, vx_uint8 EXPONENT_BITS>
+OutType ComputeFilterWindow(vx_half_float<EXPONENT_BITS> kernel_window[IN_NUM][KERN_SIZE][KERN_SIZE],
+                            KernType kernel[KERN_NUM][KERN_SIZE][KERN_SIZE], const vx_uint64 kernel_mult,
+                            const vx_uint32 kernel_shift, const KernModType /* kernel_modifier */) {
+#pragma HLS INLINE
+
+    // Check function parameters/types
+    const bool supported_filter =
+        (KERN_TYPE == HIFLIPVX::GAUSSIAN_FILTER) || (KERN_TYPE == HIFLIPVX::DERIVATIVE_X) ||
+        (KERN_TYPE == HIFLIPVX::DERIVATIVE_Y) || (KERN_TYPE == HIFLIPVX::CUSTOM_CONVOLUTION_U) ||
+        (KERN_TYPE == HIFLIPVX::CUSTOM_CONVOLUTION_S) || (KERN_TYPE == HIFLIPVX::BOX_FILTER) ||
+        (KERN_TYPE == HIFLIPVX::MEDIAN_FILTER_NxN) || (KERN_TYPE == HIFLIPVX::MEDIAN_FILTER_3x3) ||
+        (KERN_TYPE == HIFLIPVX::FED) || (KERN_TYPE == HIFLIPVX::FORWARD1) || (KERN_TYPE == HIFLIPVX::FORWARD2);
+    STATIC_ASSERT(supported_filter, filter_type_is_not_supported_for_floating_point_pixels);
+
+    // Constants
+    const vx_uint16 KERN_RAD = KERN_SIZE >> 1;
+    const vx_uint16 KERN_RNG = KERN_SIZE - 1;
+    const vx_float32 norm = static_cast<vx_float32>(kernel_mult) /
+                            static_cast<vx_float32>(static_cast<vx_uint64>(1) << kernel_shift);
+
+    // Convert window to 32-bit float
+    vx_float32 window[IN_NUM][KERN_SIZE][KERN_SIZE];
+#pragma HLS array_partition variable = window complete dim = 0
+    for (vx_uint16 inId = 0; inId < IN_NUM; inId++) {
+#pragma HLS unroll
+        for (vx_uint16 i = 0; i < KERN_SIZE; i++) {
+#pragma HLS unroll
+            for (vx_uint16 j = 0; j < KERN_SIZE; j++) {
+#pragma HLS unroll
+                window[inId][i][j] = static_cast<vx_float32>(kernel_window[inId][i][j]);
+            }
+        }
+    }
+
+    vx_float32 result = 0.0f;
+
+    // Convolution and box filter
+    if ((KERN_TYPE == HIFLIPVX::GAUSSIAN_FILTER) || (KERN_TYPE == HIFLIPVX::CUSTOM_CONVOLUTION_U) ||
+        (KERN_TYPE == HIFLIPVX::CUSTOM_CONVOLUTION_S) || (KERN_TYPE == HIFLIPVX::BOX_FILTER)) {
+        vx_float32 sum = 0.0f;
+        for (vx_uint16 i = 0; i < KERN_SIZE; i++) {
+#pragma HLS unroll
+            for (vx_uint16 j = 0; j < KERN_SIZE; j++) {
+#pragma HLS unroll
+                const vx_float32 weight =
+                    (KERN_TYPE == HIFLIPVX::BOX_FILTER) ? (1.0f) : (static_cast<vx_float32>(kernel[OUT_ID][i][j]));
+                sum += weight * window[0][i][j];
+            }
+        }
+        result = sum * norm;
+
+        // Derivatives (right minus left and bottom minus top, like the integer version)
+    } else if ((KERN_TYPE == HIFLIPVX::DERIVATIVE_X) || (KERN_TYPE == HIFLIPVX::DERIVATIVE_Y)) {
+        vx_float32 sum = 0.0f;
+        for (vx_uint16 i = 0; i < KERN_SIZE; i++) {
+#pragma HLS unroll
+            for (vx_uint16 j = 0; j < KERN_RAD; j++) {
+#pragma HLS unroll
+                if (KERN_TYPE == HIFLIPVX::DERIVATIVE_X) {
+                    const vx_float32 weight = static_cast<vx_float32>(ABS(kernel[OUT_ID][i][j]));
+                    sum += weight * (window[0][i][KERN_RNG - j] - window[0][i][j]);
+                } else {
+                    const vx_float32 weight = static_cast<vx_float32>(ABS(kernel[OUT_ID][j][i]));
+                    sum += weight * (window[0][KERN_RNG - j][i] - window[0][j][i]);
+                }
+            }
+        }
+        result = sum * norm;
+
+        // Median filter
+    } else if ((KERN_TYPE == HIFLIPVX::MEDIAN_FILTER_NxN) || (KERN_TYPE == HIFLIPVX::MEDIAN_FILTER_3x3)) {
+        result = ComputeMedian<vx_float32, vx_float32, KERN_SIZE>(window[0]);
+
+        // Fast explicit diffusion step (QUANTIZATION is the step size with 16-bit fraction)
+    } else if (KERN_TYPE == HIFLIPVX::FED) {
+        const vx_float32 lt = window[0][KERN_RAD][KERN_RAD];
+        const vx_float32 coeff = window[IN_NUM - 1][KERN_RAD][KERN_RAD];
+        const vx_float32 xpos = (window[IN_NUM - 1][KERN_RAD][KERN_RNG] + coeff) * (window[0][KERN_RAD][KERN_RNG] - lt);
+        const vx_float32 xneg = (coeff + window[IN_NUM - 1][KERN_RAD][0]) * (lt - window[0][KERN_RAD][0]);
+        const vx_float32 ypos = (window[IN_NUM - 1][KERN_RNG][KERN_RAD] + coeff) * (window[0][KERN_RNG][KERN_RAD] - lt);
+        const vx_float32 yneg = (coeff + window[IN_NUM - 1][0][KERN_RAD]) * (lt - window[0][0][KERN_RAD]);
+        // Half step: the conductivity between two pixels is the mean of both coefficients (as in SwFED). Scaling the
+        // float instead of "QUANTIZATION >> 1" keeps the LSB of odd step sizes that the integer version drops.
+        const vx_float32 step = static_cast<vx_float32>(QUANTIZATION) / static_cast<vx_float32>(1 << 17);
+        result = lt + step * (xpos - xneg + ypos - yneg);
+
+        // Forward the input
+    } else if (KERN_TYPE == HIFLIPVX::FORWARD1) {
+        result = window[0][KERN_RAD][KERN_RAD];
+    } else if (KERN_TYPE == HIFLIPVX::FORWARD2) {
+        result = window[IN_NUM - 1][KERN_RAD][KERN_RAD];
+    }
+
+    return static_cast<OutType>(result);
+}
+
 /** @brief Selects and computes a filter
 @param InType       Data type of the input image
 @param OutType      Data type of the output image
@@ -359,7 +563,7 @@ void ComputeScaledKernel(KernType kernel_in[KERN_SIZE][KERN_SIZE],
 */
 template <typename InType, typename OutType, typename KernType, typename KernModType, vx_uint16 VEC_NUM_IN,
           vx_uint16 VEC_NUM_OUT, vx_uint16 KERN_NUM, HIFLIPVX::FilterOperation KERN_TYPE, vx_hint_e PRECISION,
-          vx_uint16 KERN_SIZE, vx_uint16 STEP, vx_uint16 WIN_COLS, InType THRESH_LOWER, InType THRESH_UPPER,
+          vx_uint16 KERN_SIZE, vx_uint16 STEP, vx_uint16 WIN_COLS, vx_int64 THRESH_LOWER, vx_int64 THRESH_UPPER,
           vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint16 IN_NUM, vx_uint16 OUT_ID, vx_uint32 QUANTIZATION>
 void ComputeFilter(InType window[IN_NUM][KERN_SIZE][WIN_COLS], KernType kernel[KERN_NUM][KERN_SIZE][KERN_SIZE],
                    const vx_uint64 kernel_mult, const vx_uint32 kernel_shift, const KernModType kernel_modifier,
@@ -395,78 +599,10 @@ void ComputeFilter(InType window[IN_NUM][KERN_SIZE][WIN_COLS], KernType kernel[K
         }
 
         // Compute filter for single vector element
-        OutType result = 0;
-
-        switch (KERN_TYPE) {
-        case HIFLIPVX::GAUSSIAN_FILTER:
-            result = ComputeGaussian2d<InType, OutType, KernType, KERN_SIZE>(kernel[OUT_ID], kernel_window[0],
-                                                                             kernel_mult, kernel_shift);
-            break;
-        case HIFLIPVX::DERIVATIVE_X:
-            result = ComputeDerivativeX<InType, OutType, KernType, KERN_SIZE>(kernel[OUT_ID], kernel_window[0],
-                                                                              kernel_mult, kernel_shift);
-            break;
-        case HIFLIPVX::DERIVATIVE_Y:
-            result = ComputeDerivativeY<InType, OutType, KernType, KERN_SIZE>(kernel[OUT_ID], kernel_window[0],
-                                                                              kernel_mult, kernel_shift);
-            break;
-        case HIFLIPVX::CUSTOM_CONVOLUTION_U:
-            result = ComputeConvolve2d<InType, vx_uint64, OutType, KernType, KERN_SIZE>(
-                kernel[OUT_ID], kernel_window[0], kernel_mult, kernel_shift);
-            break;
-        case HIFLIPVX::CUSTOM_CONVOLUTION_S:
-            result = ComputeConvolve2d<InType, vx_int64, OutType, KernType, KERN_SIZE>(kernel[OUT_ID], kernel_window[0],
-                                                                                       kernel_mult, kernel_shift);
-            break;
-        case HIFLIPVX::BOX_FILTER:
-            result = ComputeBox2d<InType, OutType, KERN_SIZE>(kernel_window[0], kernel_mult, kernel_shift);
-            break;
-        case HIFLIPVX::MEDIAN_FILTER_NxN:
-            result = ComputeMedian<InType, OutType, KERN_SIZE>(kernel_window[0]);
-            break;
-        case HIFLIPVX::MEDIAN_FILTER_3x3:
-            result = ComputeMedian3x3<InType, OutType, KERN_SIZE>(kernel_window[0]);
-            break;
-        case HIFLIPVX::ERODE_IMAGE:
-            result = 0;
-            break;
-        case HIFLIPVX::DILATE_IMAGE:
-            result = 0;
-            break;
-        case HIFLIPVX::NON_MAX_SUPPRESSION:
-            result = NonMaxSuppression<InType, OutType, KernType, KERN_SIZE>(kernel[OUT_ID], kernel_window[0]);
-            break;
-        case HIFLIPVX::SEGMENT_TEST_DETECTOR:
-            result = SegmentTestDetector<InType, OutType, KERN_SIZE>(kernel_window[0]);
-            break;
-        case HIFLIPVX::HYSTERESIS:
-            result = Hysteresis<InType, OutType, KERN_SIZE, THRESH_LOWER, THRESH_UPPER>(kernel_window[0]);
-            break;
-        case HIFLIPVX::ORIENTED_NON_MAX_SUPPRESSION:
-            result = ComputeOrientedNonMaxSuppression<InType, OutType, KERN_SIZE, QUANTIZATION>(kernel_window[0],
-                                                                                                kernel_window[1]);
-            break;
-        case HIFLIPVX::FED:
-            result = ComputeFED<InType, KERN_SIZE, QUANTIZATION>(kernel_window[0], kernel_window[1]);
-            break;
-        case HIFLIPVX::DOH:
-            result = ComputeDoH<InType, OutType, KernType, KERN_NUM, KERN_SIZE>(kernel_window[0], kernel_window[1],
-                                                                                kernel, kernel_mult, kernel_shift);
-            break;
-        case HIFLIPVX::PERONA_MALIK_WIDE_REGION:
-            result = ComputePeronaMalikWideRegion<InType, KernType, KERN_NUM, KERN_SIZE, PRECISION>(
-                kernel_window[0], kernel, kernel_mult, kernel_shift, kernel_modifier);
-            break;
-        case HIFLIPVX::FORWARD1:
-            result = ForwardImageData<InType, KERN_SIZE>(kernel_window[0]);
-            break;
-        case HIFLIPVX::FORWARD2:
-            result = ForwardImageData<InType, KERN_SIZE>(kernel_window[1]);
-            break;
-        default:
-            result = 0;
-            break;
-        }
+        const OutType result =
+            ComputeFilterWindow<InType, OutType, KernType, KernModType, KERN_NUM, KERN_TYPE, PRECISION, KERN_SIZE,
+                                THRESH_LOWER, THRESH_UPPER, IN_NUM, OUT_ID, QUANTIZATION>(
+                kernel_window, kernel, kernel_mult, kernel_shift, kernel_modifier);
 
         output_vector.pixel[vecId] = result;
     }
@@ -505,7 +641,7 @@ template <typename InType, typename OutType, typename KernType, typename KernMod
           vx_uint16 BUFFER_NUM, vx_uint32 VEC_PIX_IN, vx_uint32 VEC_PIX_OUT, vx_uint16 VEC_NUM_IN,
           vx_uint16 VEC_NUM_OUT, vx_uint16 KERN_NUM, HIFLIPVX::FilterOperation KERN_TYPE1,
           HIFLIPVX::FilterOperation KERN_TYPE2, vx_hint_e PRECISION, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS,
-          vx_uint16 KERN_SIZE, vx_uint16 STEP, vx_border_e BORDER_TYPE, InType THRESH_LOWER, InType THRESH_UPPER,
+          vx_uint16 KERN_SIZE, vx_uint16 STEP, vx_border_e BORDER_TYPE, vx_int64 THRESH_LOWER, vx_int64 THRESH_UPPER,
           vx_uint16 IN_NUM, vx_uint16 OUT_NUM, vx_uint32 QUANTIZATION>
 void ComputeFilter2dFunc(vx_image_data<InType, VEC_NUM_IN> input1[VEC_PIX_IN],
                          vx_image_data<InType, VEC_NUM_IN> input2[VEC_PIX_IN],
@@ -624,7 +760,7 @@ template <typename InType, typename OutType, typename KernType, typename KernMod
           vx_uint32 VEC_PIX_OUT, vx_uint16 VEC_NUM_IN, vx_uint16 VEC_NUM_OUT, vx_uint16 KERN_NUM,
           HIFLIPVX::FilterOperation KERN_TYPE1, HIFLIPVX::FilterOperation KERN_TYPE2, vx_hint_e PRECISION,
           vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint16 KERN_SIZE, vx_uint16 STEP, vx_border_e BORDER_TYPE,
-          InType THRESH_LOWER, InType THRESH_UPPER, vx_uint16 IN_NUM, vx_uint16 OUT_NUM, vx_uint32 QUANTIZATION>
+          vx_int64 THRESH_LOWER, vx_int64 THRESH_UPPER, vx_uint16 IN_NUM, vx_uint16 OUT_NUM, vx_uint32 QUANTIZATION>
 void ComputeFilter2dFunc_(vx_image_data<InType, VEC_NUM_IN> input1[VEC_PIX_IN],
                           vx_image_data<InType, VEC_NUM_IN> input2[VEC_PIX_IN],
                           vx_image_data<OutType, VEC_NUM_OUT> output1[VEC_PIX_OUT],
@@ -745,7 +881,7 @@ template <typename InType, typename OutType, typename KernType, typename KernMod
           vx_uint32 VEC_PIX_OUT, vx_uint16 VEC_NUM_IN, vx_uint16 VEC_NUM_OUT, vx_uint16 KERN_NUM,
           HIFLIPVX::FilterOperation KERN_TYPE1, HIFLIPVX::FilterOperation KERN_TYPE2, vx_hint_e PRECISION,
           vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint16 KERN_SIZE, vx_uint16 KERNEL_SCALE, vx_uint16 STEP,
-          vx_border_e BORDER_TYPE, InType THRESH_LOWER, InType THRESH_UPPER, vx_uint16 IN_NUM, vx_uint16 OUT_NUM,
+          vx_border_e BORDER_TYPE, vx_int64 THRESH_LOWER, vx_int64 THRESH_UPPER, vx_uint16 IN_NUM, vx_uint16 OUT_NUM,
           vx_uint32 QUANTIZATION>
 void ComputeFilter2d(vx_image_data<InType, VEC_NUM_IN> input1[VEC_PIX_IN],
                      vx_image_data<InType, VEC_NUM_IN> input2[VEC_PIX_IN],
@@ -825,7 +961,7 @@ void ComputeFilter2d(vx_image_data<InType, VEC_NUM_IN> input1[VEC_PIX_IN],
 template <typename InType, typename OutType, typename KernType, typename KernModType, vx_uint32 VEC_PIX,
           vx_uint16 VEC_NUM, vx_uint16 KERN_NUM, HIFLIPVX::FilterOperation KERN_TYPE1,
           HIFLIPVX::FilterOperation KERN_TYPE2, vx_hint_e PRECISION, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS,
-          vx_uint16 KERN_SIZE, vx_border_e BORDER_TYPE, InType THRESH_LOWER, InType THRESH_UPPER, vx_uint16 IN_NUM,
+          vx_uint16 KERN_SIZE, vx_border_e BORDER_TYPE, vx_int64 THRESH_LOWER, vx_int64 THRESH_UPPER, vx_uint16 IN_NUM,
           vx_uint16 OUT_NUM, vx_uint32 QUANTIZATION>
 void ComputeFilter2d_(vx_image_data<InType, VEC_NUM> input1[VEC_PIX], vx_image_data<InType, VEC_NUM> input2[VEC_PIX],
                       vx_image_data<OutType, VEC_NUM> output1[VEC_PIX],
@@ -882,7 +1018,11 @@ void HwBox(vx_image_data<ScalarType, VEC_NUM> input[VEC_PIX],
 #pragma HLS INLINE
 
     // Check function parameters/types
-    STATIC_ASSERT(std::numeric_limits<ScalarType>::is_signed == false, scalar_type_must_be_unsigned);
+    STATIC_ASSERT((std::numeric_limits<ScalarType>::is_signed == false) ||    //
+                      (std::numeric_limits<ScalarType>::is_integer == false), //
+                  scalar_type_must_be_unsigned_or_float);                     //
+    STATIC_ASSERT((SEPARABLE == vx_false_e) || (std::numeric_limits<ScalarType>::is_integer == true), //
+                  separable_filter_is_not_supported_for_floating_point_pixels);                    //
 
     // Kernel Type
     typedef vx_uint16 KernelType;
@@ -891,8 +1031,8 @@ void HwBox(vx_image_data<ScalarType, VEC_NUM> input[VEC_PIX],
     const vx_uint8 KERN_NUM = 1;
     const vx_uint8 SCALE = 1;
     const vx_uint8 STEP = 0;
-    const ScalarType THRESH_LOWER = 0;
-    const ScalarType THRESH_UPPER = 0;
+    const vx_int64 THRESH_LOWER = 0;
+    const vx_int64 THRESH_UPPER = 0;
     const vx_uint8 QUANTIZATION = 0;
     const vx_uint16 IN_NUM = 1;
     const vx_uint16 OUT_NUM = 1;
@@ -969,8 +1109,8 @@ void HwConvolve(vx_image_data<ScalarType, VEC_NUM> input[VEC_PIX],
     const vx_uint8 KERN_NUM = 1;
     const vx_uint8 SCALE = 1;
     const vx_uint8 STEP = 0;
-    const ScalarType THRESH_LOWER = 0;
-    const ScalarType THRESH_UPPER = 0;
+    const vx_int64 THRESH_LOWER = 0;
+    const vx_int64 THRESH_UPPER = 0;
     const vx_uint8 QUANTIZATION = 0;
     const vx_uint16 IN_NUM = 1;
     const vx_uint16 OUT_NUM = 1;
@@ -1106,7 +1246,11 @@ void HwGaussian(vx_image_data<ScalarType, VEC_NUM> input[VEC_PIX],
 #pragma HLS INLINE
 
     // Check function parameters/types
-    STATIC_ASSERT(std::numeric_limits<ScalarType>::is_signed == false, scalar_type_must_be_unsigned);
+    STATIC_ASSERT((std::numeric_limits<ScalarType>::is_signed == false) ||    //
+                      (std::numeric_limits<ScalarType>::is_integer == false), //
+                  scalar_type_must_be_unsigned_or_float);                     //
+    STATIC_ASSERT((SEPARABLE == vx_false_e) || (std::numeric_limits<ScalarType>::is_integer == true), //
+                  separable_filter_is_not_supported_for_floating_point_pixels);                    //
 
     // Kernel Type
     typedef vx_uint16 KernelType;
@@ -1115,8 +1259,8 @@ void HwGaussian(vx_image_data<ScalarType, VEC_NUM> input[VEC_PIX],
     const vx_uint8 KERN_NUM = 1;
     const vx_uint8 SCALE = 1;
     const vx_uint8 STEP = 0;
-    const ScalarType THRESH_LOWER = 0;
-    const ScalarType THRESH_UPPER = 0;
+    const vx_int64 THRESH_LOWER = 0;
+    const vx_int64 THRESH_UPPER = 0;
     const vx_uint8 QUANTIZATION = 0;
     const vx_uint16 IN_NUM = 1;
     const vx_uint16 OUT_NUM = 1 + FORWARD_COEFFICIENTS;
@@ -1180,7 +1324,9 @@ void HwMedian(vx_image_data<ScalarType, VEC_NUM> input[VEC_PIX],
 #pragma HLS INLINE
 
     // Check function parameters/types
-    STATIC_ASSERT(std::numeric_limits<ScalarType>::is_signed == false, scalar_type_must_be_unsigned);
+    STATIC_ASSERT((std::numeric_limits<ScalarType>::is_signed == false) ||    //
+                      (std::numeric_limits<ScalarType>::is_integer == false), //
+                  scalar_type_must_be_unsigned_or_float);                     //
 
     // Kernel Type
     typedef vx_uint16 KernelType;
@@ -1189,8 +1335,8 @@ void HwMedian(vx_image_data<ScalarType, VEC_NUM> input[VEC_PIX],
     const vx_uint8 KERN_NUM = 1;
     const vx_uint8 SCALE = 1;
     const vx_uint8 STEP = 0;
-    const ScalarType THRESH_LOWER = 0;
-    const ScalarType THRESH_UPPER = 0;
+    const vx_int64 THRESH_LOWER = 0;
+    const vx_int64 THRESH_UPPER = 0;
     const vx_uint8 QUANTIZATION = 0;
     const vx_uint16 IN_NUM = 1;
     const vx_uint16 OUT_NUM = 1;
@@ -1237,7 +1383,9 @@ void HwSobel(vx_image_data<InType, VEC_NUM> input[VEC_PIX],
 #pragma HLS INLINE
 
     // Check function parameters/types
-    STATIC_ASSERT(std::numeric_limits<InType>::is_signed == false, input_must_be_unsigned);
+    STATIC_ASSERT((std::numeric_limits<InType>::is_signed == false) ||    //
+                      (std::numeric_limits<InType>::is_integer == false), //
+                  input_must_be_unsigned_or_float);                       //
     STATIC_ASSERT(std::numeric_limits<OutType>::is_signed == true, output_must_be_signed);
 
     // Kernel Type
@@ -1247,8 +1395,8 @@ void HwSobel(vx_image_data<InType, VEC_NUM> input[VEC_PIX],
     const vx_uint8 KERN_NUM = 2;
     const vx_uint8 SCALE = 1;
     const vx_uint8 STEP = 0;
-    const InType THRESH_LOWER = 0;
-    const InType THRESH_UPPER = 0;
+    const vx_int64 THRESH_LOWER = 0;
+    const vx_int64 THRESH_UPPER = 0;
     const vx_uint8 QUANTIZATION = 0;
     const vx_uint16 IN_NUM = 1;
     const vx_uint16 OUT_NUM = 2;
@@ -1297,8 +1445,8 @@ void HwNonMaxSuppression(vx_image_data<DataType, VEC_NUM> input[VEC_PIX],
     const vx_uint8 KERN_NUM = 1;
     const vx_uint8 SCALE = 1;
     const vx_uint8 STEP = 0;
-    const DataType THRESH_LOWER = 0;
-    const DataType THRESH_UPPER = 0;
+    const vx_int64 THRESH_LOWER = 0;
+    const vx_int64 THRESH_UPPER = 0;
     const vx_uint8 QUANTIZATION = 0;
     const vx_uint16 IN_NUM = 1;
     const vx_uint16 OUT_NUM = 1;
@@ -1344,8 +1492,8 @@ void HwSegmentTestDetector(vx_image_data<ScalarType, VEC_NUM> input[VEC_PIX],
     const vx_uint8 KERN_SIZE = 7;
     const vx_uint8 SCALE = 1;
     const vx_uint8 STEP = 0;
-    const ScalarType THRESH_LOWER = 0;
-    const ScalarType THRESH_UPPER = 0;
+    const vx_int64 THRESH_LOWER = 0;
+    const vx_int64 THRESH_UPPER = 0;
     const vx_uint8 QUANTIZATION = 0;
     const vx_uint16 IN_NUM = 1;
     const vx_uint16 OUT_NUM = 1;
@@ -1421,8 +1569,8 @@ void HwConductivity(vx_image_data<DataType, VEC_NUM> input[VEC_PIX],
     typedef vx_int8 KernelType;
     const vx_uint8 KERN_SIZE = 3;
     const vx_uint8 KERN_NUM = 2;
-    const DataType THRESH_LOWER = 0;
-    const DataType THRESH_UPPER = 0;
+    const vx_int64 THRESH_LOWER = 0;
+    const vx_int64 THRESH_UPPER = 0;
     const vx_uint8 KERNEL_SCALE = 1;
     const vx_uint8 STEP = 0;
     const vx_uint8 QUANTIZATION = 0;
@@ -1455,15 +1603,17 @@ void HwFED(vx_image_data<DataType, VEC_NUM> input_lt[VEC_PIX],
            vx_image_data<DataType, VEC_NUM> output_fw_coeff[VEC_PIX]) {                                   //
 #pragma HLS INLINE
 
-    STATIC_ASSERT(std::numeric_limits<DataType>::is_signed == false, data_type_must_be_unsigned);
+    STATIC_ASSERT((std::numeric_limits<DataType>::is_signed == false) ||    //
+                      (std::numeric_limits<DataType>::is_integer == false), //
+                  data_type_must_be_unsigned_or_float);                     //
 
     // template parameter
     typedef vx_int8 KernelType;
     typedef vx_uint8 KernelModifier;
     const vx_uint8 KERN_SIZE = 3;
     const vx_uint8 KERN_NUM = 1;
-    const DataType THRESH_LOWER = 0;
-    const DataType THRESH_UPPER = 0;
+    const vx_int64 THRESH_LOWER = 0;
+    const vx_int64 THRESH_UPPER = 0;
     const vx_uint8 KERNEL_SCALE = 1;
     const vx_uint8 STEP = 0;
     const vx_uint16 IN_NUM = 2;
@@ -1507,7 +1657,9 @@ void HwScalableScharr3x3(vx_image_data<InType, VEC_NUM_IN> input[VEC_PIX_IN],
                          vx_image_data<OutType, VEC_NUM_OUT> output_ly[VEC_PIX_OUT]) {       //
 #pragma HLS INLINE
 
-    STATIC_ASSERT(std::numeric_limits<InType>::is_signed == false, input_must_be_unsigned);
+    STATIC_ASSERT((std::numeric_limits<InType>::is_signed == false) ||    //
+                      (std::numeric_limits<InType>::is_integer == false), //
+                  input_must_be_unsigned_or_float);                       //
     STATIC_ASSERT(std::numeric_limits<OutType>::is_signed == true, output_must_be_signed);
 
     // template parameter
@@ -1515,8 +1667,8 @@ void HwScalableScharr3x3(vx_image_data<InType, VEC_NUM_IN> input[VEC_PIX_IN],
     typedef vx_uint8 KernModType;
     const vx_uint8 KERN_NUM = 2;
     const vx_uint8 KERN_SIZE = 3;
-    const InType THRESH_LOWER = 0;
-    const InType THRESH_UPPER = 0;
+    const vx_int64 THRESH_LOWER = 0;
+    const vx_int64 THRESH_UPPER = 0;
     const vx_uint8 QUANTIZATION = 0;
     const vx_uint16 IN_NUM = 1;
     const vx_uint16 OUT_NUM = 2;
@@ -1559,8 +1711,8 @@ void HwDetHessian(vx_image_data<InType, VEC_NUM_IN> input_lx[VEC_PIX_IN],
 
     const vx_uint8 KERN_NUM = 2 + WITH_FIRST_ORDER_DERIVATION;
     const vx_uint8 KERN_SIZE = 3 + (WITH_FIRST_ORDER_DERIVATION << 1);
-    const InType THRESH_LOWER = 0;
-    const InType THRESH_UPPER = 0;
+    const vx_int64 THRESH_LOWER = 0;
+    const vx_int64 THRESH_UPPER = 0;
     const vx_uint8 QUANTIZATION = 0;
     const vx_uint16 IN_NUM = 2 - WITH_FIRST_ORDER_DERIVATION;
     const vx_uint16 OUT_NUM = 1;
@@ -1615,8 +1767,8 @@ void HwOrientedNonMaxSuppression(vx_image_data<ScalarType, VEC_NUM> input[VEC_PI
     const vx_uint8 KERN_SIZE = 3;
     const vx_uint8 SCALE = 1;
     const vx_uint8 STEP = 0;
-    const ScalarType THRESH_LOWER = 0;
-    const ScalarType THRESH_UPPER = 0;
+    const vx_int64 THRESH_LOWER = 0;
+    const vx_int64 THRESH_UPPER = 0;
     const vx_uint16 IN_NUM = 2;
     const vx_uint16 OUT_NUM = 1;
 
@@ -1635,4 +1787,214 @@ void HwOrientedNonMaxSuppression(vx_image_data<ScalarType, VEC_NUM> input[VEC_PI
         (input, input_no_window, output, NULL, kernel_vector, kernel_mult, kernel_shift, kernel_modifier); //
 }
 
+/*********************************************************************************************************************/
+/*
+ * Stereo Block Matching
+ */
+template <vx_uint16 DISPARITIES, vx_uint8 UNIQUENESS_RATIO>
+vx_int16 StereoBMDisparity(const vx_uint32 sad[DISPARITIES], const vx_int32 max_disparity) {
+#pragma HLS INLINE
+
+    // Constants
+    const vx_int16 SUBPIXEL_BITS = 4;
+    const vx_int16 INVALID_DISPARITY = -(1 << SUBPIXEL_BITS);
+
+    // Winner-take-all (lowest disparity on equal costs), disparities beyond the left image border are invalid
+    vx_int32 best = 0;
+    vx_uint32 best_sad = sad[0];
+    for (vx_uint16 d = 1; d < DISPARITIES; d++) {
+#pragma HLS unroll
+        if ((d <= max_disparity) && (sad[d] < best_sad)) {
+            best = d;
+            best_sad = sad[d];
+        }
+    }
+
+    // Uniqueness: no other disparity (apart from the direct neighbors) may have a similar cost
+    bool unique = true;
+    for (vx_uint16 d = 0; d < DISPARITIES; d++) {
+#pragma HLS unroll
+        const bool neighbor = (d >= best - 1) && (d <= best + 1);
+        if ((d <= max_disparity) && (neighbor == false) &&
+            (sad[d] * 100 <= best_sad * static_cast<vx_uint32>(100 + UNIQUENESS_RATIO)))
+            unique = false;
+    }
+
+    // Subpixel refinement: equiangular line fit through the costs of the neighbors
+    vx_int32 disparity = best << SUBPIXEL_BITS;
+    if ((best > 0) && (best < DISPARITIES - 1) && (best < max_disparity)) {
+        const vx_int32 prev = static_cast<vx_int32>(sad[best - 1]);
+        const vx_int32 next = static_cast<vx_int32>(sad[best + 1]);
+        const vx_int32 denominator = 2 * (MAX(prev, next) - static_cast<vx_int32>(best_sad));
+        const vx_int32 numerator = (prev - next) * (1 << SUBPIXEL_BITS);
+        if (denominator > 0)
+            disparity += (numerator + ((numerator >= 0) ? (denominator >> 1) : -(denominator >> 1))) / denominator;
+    }
+
+    return (unique == true) ? static_cast<vx_int16>(disparity) : INVALID_DISPARITY;
+}
+
+/*********************************************************************************************************************/
+template <vx_uint32 VEC_PIX, vx_uint8 VEC_NUM, vx_uint16 IMG_COLS, vx_uint16 IMG_ROWS, vx_uint16 KERN_SIZE, //
+          vx_uint16 DISPARITIES, vx_uint8 UNIQUENESS_RATIO, vx_border_e BORDER_TYPE>                        //
+void HwStereoBM(vx_image_data<vx_uint8, VEC_NUM> left[VEC_PIX],                                              //
+                vx_image_data<vx_uint8, VEC_NUM> right[VEC_PIX],                                             //
+                vx_image_data<vx_int16, VEC_NUM> output[VEC_PIX]) {                                          //
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint16 KERN_RAD = KERN_SIZE >> 1;
+    const vx_uint16 VEC_COLS = IMG_COLS / VEC_NUM;
+    const vx_uint16 WIN_COLS = (KERN_RAD << 1) + VEC_NUM + (VEC_NUM - (KERN_RAD % VEC_NUM)) % VEC_NUM;
+    const vx_uint16 OHD_COLS = (WIN_COLS - KERN_RAD) / VEC_NUM - 1;
+    const vx_uint16 HIST_COLS = ((DISPARITIES - 1 + VEC_NUM - 1) / VEC_NUM) * VEC_NUM;
+
+    // Check function parameters/types
+    STATIC_ASSERT((VEC_NUM == 1) || (VEC_NUM == 2) || (VEC_NUM == 4) || (VEC_NUM == 8), vec_num_must_be_1_2_4_or_8);
+    STATIC_ASSERT((IMG_COLS % VEC_NUM) == 0, image_columns_must_be_multiple_of_vec_num);
+    STATIC_ASSERT(((KERN_SIZE % 2) == 1) && (KERN_SIZE >= 3) && (KERN_SIZE <= 31), kernel_size_must_be_odd_3_to_31);
+    STATIC_ASSERT((DISPARITIES >= 2) && (DISPARITIES <= 256) && (DISPARITIES <= IMG_COLS), disparities_not_allowed);
+    STATIC_ASSERT((BORDER_TYPE == VX_BORDER_CONSTANT) || (BORDER_TYPE == VX_BORDER_REPLICATE), border_not_supported);
+
+    // Linebuffers
+    vx_data_pack<vx_uint8, (KERN_SIZE - 1) * VEC_NUM> linebuffer_left[VEC_COLS];
+    vx_data_pack<vx_uint8, (KERN_SIZE - 1) * VEC_NUM> linebuffer_right[VEC_COLS];
+    HIFLIPVX_DATAPACK(linebuffer_left, linebuffer_right);
+
+    // Previous columns of the right image, its first column (left border) and the column costs of all disparities
+    vx_uint8 history[KERN_SIZE][HIST_COLS];
+#pragma HLS array_partition variable = history complete dim = 0
+    vx_uint8 first_column[KERN_SIZE];
+#pragma HLS array_partition variable = first_column complete dim = 0
+    vx_uint16 window[DISPARITIES][1][WIN_COLS];
+#pragma HLS array_partition variable = window complete dim = 0
+
+    vx_uint32 ptr_src = 0;
+    vx_uint32 ptr_dst = 0;
+
+    // Compute the disparities (pipelined)
+    for (vx_uint16 y = 0; y < IMG_ROWS + KERN_RAD; ++y) {
+        for (vx_uint16 x = 0; x < VEC_COLS + OHD_COLS; ++x) {
+#pragma HLS PIPELINE II = 1
+
+            vx_uint8 input_left[VEC_NUM], input_right[VEC_NUM];
+#pragma HLS array_partition variable = input_left complete dim = 0
+#pragma HLS array_partition variable = input_right complete dim = 0
+            vx_uint8 buffer_left[KERN_SIZE][VEC_NUM], buffer_right[KERN_SIZE][VEC_NUM];
+#pragma HLS array_partition variable = buffer_left complete dim = 0
+#pragma HLS array_partition variable = buffer_right complete dim = 0
+            vx_uint8 column_left[KERN_SIZE][VEC_NUM], column_right[KERN_SIZE][VEC_NUM];
+#pragma HLS array_partition variable = column_left complete dim = 0
+#pragma HLS array_partition variable = column_right complete dim = 0
+            vx_uint8 columns[KERN_SIZE][HIST_COLS + VEC_NUM];
+#pragma HLS array_partition variable = columns complete dim = 0
+            vx_uint16 cost[DISPARITIES][VEC_NUM];
+#pragma HLS array_partition variable = cost complete dim = 0
+            vx_uint32 sad[DISPARITIES];
+#pragma HLS array_partition variable = sad complete dim = 0
+
+            // Input & Output
+            vx_image_data<vx_uint8, VEC_NUM> left_data, right_data;
+            vx_image_data<vx_int16, VEC_NUM> output_data;
+
+            // Read input data from global memory
+            if ((y < IMG_ROWS) && (x < VEC_COLS)) {
+                left_data = left[ptr_src];
+                right_data = right[ptr_src];
+                ++ptr_src;
+            }
+            for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+                input_left[v] = left_data.pixel[v];
+                input_right[v] = right_data.pixel[v];
+            }
+
+            // Linebuffers and new columns (vertical border)
+            ReadFromLineBuffer_<vx_uint8, VEC_NUM, KERN_SIZE, VEC_COLS>(input_left, linebuffer_left, buffer_left, x);
+            WriteToLineBuffer_<vx_uint8, VEC_NUM, KERN_SIZE, VEC_COLS>(buffer_left, linebuffer_left, x);
+            ReadFromLineBuffer_<vx_uint8, VEC_NUM, KERN_SIZE, VEC_COLS>(input_right, linebuffer_right, buffer_right,
+                                                                        x);
+            WriteToLineBuffer_<vx_uint8, VEC_NUM, KERN_SIZE, VEC_COLS>(buffer_right, linebuffer_right, x);
+            SlidingWindowVertical<vx_uint8, IMG_ROWS, KERN_RAD, VEC_NUM, KERN_SIZE, BORDER_TYPE>(buffer_left,
+                                                                                                 column_left, y);
+            SlidingWindowVertical<vx_uint8, IMG_ROWS, KERN_RAD, VEC_NUM, KERN_SIZE, BORDER_TYPE>(buffer_right,
+                                                                                                 column_right, y);
+
+            // Right columns of all disparities, columns beyond the left border are replicated or zero
+            for (vx_uint16 i = 0; i < KERN_SIZE; i++) {
+#pragma HLS unroll
+                if (x == 0)
+                    first_column[i] = (BORDER_TYPE == VX_BORDER_REPLICATE) ? column_right[i][0] : 0;
+                for (vx_uint16 j = 0; j < HIST_COLS; j++) {
+#pragma HLS unroll
+                    const bool border = (static_cast<vx_int32>(x) * VEC_NUM + j < HIST_COLS);
+                    columns[i][j] = (border == true) ? first_column[i] : history[i][j];
+                }
+                for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+                    columns[i][HIST_COLS + v] = column_right[i][v];
+                }
+            }
+
+            // Column costs: sum of absolute differences between the left column and the shifted right columns
+            for (vx_uint16 d = 0; d < DISPARITIES; d++) {
+#pragma HLS unroll
+                for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+                    vx_uint16 sum = 0;
+                    for (vx_uint16 i = 0; i < KERN_SIZE; i++) {
+#pragma HLS unroll
+                        const vx_int16 a = static_cast<vx_int16>(column_left[i][v]);
+                        const vx_int16 b = static_cast<vx_int16>(columns[i][HIST_COLS + v - d]);
+                        const vx_int16 diff = a - b;
+                        sum += static_cast<vx_uint16>(ABS(diff));
+                    }
+                    cost[d][v] = sum;
+                }
+            }
+
+            // Store the right columns for the next disparities
+            for (vx_uint16 i = 0; i < KERN_SIZE; i++) {
+#pragma HLS unroll
+                for (vx_uint16 j = 0; j < HIST_COLS; j++) {
+#pragma HLS unroll
+                    history[i][j] = columns[i][j + VEC_NUM];
+                }
+            }
+
+            // Move the sliding windows of the column costs (horizontal border)
+            for (vx_uint16 d = 0; d < DISPARITIES; d++) {
+#pragma HLS unroll
+                SlidingWindowHorizontal<vx_uint16, KERN_RAD, VEC_COLS, VEC_NUM, WIN_COLS, BORDER_TYPE>(cost[d],
+                                                                                                       window[d], x);
+            }
+
+            // Block costs of all disparities and the resulting disparity of each vector element
+            for (vx_uint16 v = 0; v < VEC_NUM; v++) {
+#pragma HLS unroll
+                for (vx_uint16 d = 0; d < DISPARITIES; d++) {
+#pragma HLS unroll
+                    vx_uint32 sum = 0;
+                    for (vx_uint16 j = 0; j < KERN_SIZE; j++) {
+#pragma HLS unroll
+                        sum += window[d][0][j + v];
+                    }
+                    sad[d] = sum;
+                }
+                const vx_int32 max_disparity = (static_cast<vx_int32>(x) - OHD_COLS) * VEC_NUM + v;
+                output_data.pixel[v] = StereoBMDisparity<DISPARITIES, UNIQUENESS_RATIO>(sad, max_disparity);
+            }
+
+            // Write output data to global memory
+            if ((y >= KERN_RAD) && (x >= OHD_COLS)) {
+                const bool sof = ((y == KERN_RAD) && (x == OHD_COLS));
+                const bool eof = ((y == IMG_ROWS + KERN_RAD - 1) && (x == VEC_COLS + OHD_COLS - 1));
+                GenerateDmaSignal<vx_int16, VEC_NUM>(sof, eof, output_data);
+                output[ptr_dst] = output_data;
+                ++ptr_dst;
+            }
+        }
+    }
+}
+
 #endif /* SRC_IMG_FILTER_CORE_H_ */
@@ -569,8 +569,8 @@ OutType SegmentTestDetector(InType window[KERN_SIZE][KERN_SIZE]) { //
 }
 
 /*********************************************************************************************************************/
-template <typename InType, typename OutType, vx_uint16 KERN_SIZE, InType THRESH_LOWER, InType THRESH_UPPER> //
-OutType Hysteresis(InType window[KERN_SIZE][KERN_SIZE]) {                                                   //
+template <typename InType, typename OutType, vx_uint16 KERN_SIZE, vx_int64 THRESH_LOWER, vx_int64 THRESH_UPPER> //
+OutType Hysteresis(InType window[KERN_SIZE][KERN_SIZE]) {                                                       //
 #pragma HLS INLINE
 
     // Constants
@@ -1394,6 +1394,233 @@ void TestFilterDatatype() {
     delete[] output_hw_y;
 }
 
+/**********************************************************************************************************************/
+/*! \brief Test the 16-bit floating point filters against the 8-bit filters (error in 8-bit units) */
+template <typename imgFloatT, vx_uint16 COLS_FHD, vx_uint16 ROWS_FHD> //
+void TestFilterHalfFloat(std::string name) {
+
+    const vx_uint32 PIXELS_FHD = COLS_FHD * ROWS_FHD;
+
+    vx_uint8 *input = new vx_uint8[PIXELS_FHD];
+    vx_uint8 *output_ref = new vx_uint8[PIXELS_FHD];
+    imgFloatT *input_float = new imgFloatT[PIXELS_FHD];
+    imgFloatT *output_float = new imgFloatT[PIXELS_FHD];
+
+    for (vx_uint32 i = 0; i < PIXELS_FHD; i++) {
+        input[i] = rand() % 256;
+        input_float[i] = static_cast<vx_float32>(input[i]) / 255.0f;
+    }
+
+    // Box filter
+    ImgBox<vx_uint8, 1, COLS_FHD, ROWS_FHD, 3, VX_BORDER_REPLICATE, vx_false_e>(input, output_ref);
+    ImgBox<imgFloatT, 1, COLS_FHD, ROWS_FHD, 3, VX_BORDER_REPLICATE, vx_false_e>(input_float, output_float);
+    vx_float32 absDifMaxBox = 0.0f;
+    for (vx_uint32 i = 0; i < PIXELS_FHD; i++) {
+        vx_float32 absDif = fabsf(static_cast<vx_float32>(output_ref[i]) - output_float[i] * 255.0f);
+        absDifMaxBox = MAX(absDifMaxBox, absDif);
+    }
+
+    // Gaussian filter
+    ImgGaussian<vx_uint8, 1, COLS_FHD, ROWS_FHD, 5, VX_BORDER_REPLICATE, vx_false_e>(input, output_ref);
+    ImgGaussian<imgFloatT, 1, COLS_FHD, ROWS_FHD, 5, VX_BORDER_REPLICATE, vx_false_e>(input_float, output_float);
+    vx_float32 absDifMaxGaussian = 0.0f;
+    for (vx_uint32 i = 0; i < PIXELS_FHD; i++) {
+        vx_float32 absDif = fabsf(static_cast<vx_float32>(output_ref[i]) - output_float[i] * 255.0f);
+        absDifMaxGaussian = MAX(absDifMaxGaussian, absDif);
+    }
+
+    // Fast explicit diffusion against the floating point reference (second input are the coefficients)
+    const float TAU_SW = 0.0643982589f;
+    const vx_uint32 TAU_HW = vx_uint32(0.0643982589f * (1 << 16));
+    float *input_ref[2] = {new float[PIXELS_FHD], new float[PIXELS_FHD]};
+    float *output_fed = new float[PIXELS_FHD];
+    imgFloatT *coeff_float = new imgFloatT[PIXELS_FHD];
+    for (vx_uint32 i = 0; i < PIXELS_FHD; i++) {
+        coeff_float[i] = static_cast<vx_float32>(rand() % 256) / 255.0f;
+        input_ref[0][i] = input_float[i];
+        input_ref[1][i] = coeff_float[i];
+    }
+    SwFED<COLS_FHD, ROWS_FHD>(input_ref[0], input_ref[1], output_fed, TAU_SW);
+    ImgFastExplicitDiffusion<imgFloatT, 1, COLS_FHD, ROWS_FHD, TAU_HW, VX_BORDER_REPLICATE>(input_float, coeff_float,
+                                                                                            output_float);
+    vx_float32 absDifMaxFed = 0.0f;
+    for (vx_uint32 i = 0; i < PIXELS_FHD; i++) {
+        vx_float32 absDif = fabsf(output_fed[i] - output_float[i]) * 255.0f;
+        absDifMaxFed = MAX(absDifMaxFed, absDif);
+    }
+
+    std::cout << name.c_str();
+    printf("Max. absolut error: Box %0.2f | Gaussian %0.2f | FED %0.2f\n", absDifMaxBox, absDifMaxGaussian,
+           absDifMaxFed);
+
+    // Free Memory
+    delete[] input;
+    delete[] output_ref;
+    delete[] input_float;
+    delete[] output_float;
+    delete[] input_ref[0];
+    delete[] input_ref[1];
+    delete[] output_fed;
+    delete[] coeff_float;
+}
+
+/**********************************************************************************************************************/
+/*! \brief SW: Computes the disparity by block matching (same costs, border handling, uniqueness and refinement) */
+template <vx_uint16 WIDTH, vx_uint16 HEIGHT, vx_uint16 KERN_SIZE, vx_uint16 DISPARITIES, vx_uint8 UNIQUENESS_RATIO,
+          vx_border_e BORDER_TYPE>
+void SwStereoBM(vx_uint8 *left, vx_uint8 *right, vx_int16 *output) {
+
+    const vx_int32 KERN_RAD = KERN_SIZE / 2;
+    const bool REPLICATE = (BORDER_TYPE == VX_BORDER_REPLICATE);
+    vx_uint32 *cost = new vx_uint32[WIDTH * DISPARITIES];
+    vx_uint32 sad[DISPARITIES];
+
+    for (vx_int32 y = 0; y < HEIGHT; y++) {
+
+        // Column costs of the row (right columns beyond the left border are replicated or zero)
+        for (vx_int32 x = 0; x < WIDTH; x++) {
+            for (vx_int32 d = 0; d < DISPARITIES; d++) {
+                vx_uint32 sum = 0;
+                for (vx_int32 i = -KERN_RAD; i <= KERN_RAD; i++) {
+                    const vx_int32 row = y + i;
+                    const bool inside = (row >= 0) && (row < HEIGHT);
+                    const vx_int32 ptr = MAX(MIN(row, HEIGHT - 1), 0) * WIDTH;
+                    vx_int32 a = (inside || REPLICATE) ? left[ptr + x] : 0;
+                    vx_int32 b = (inside || REPLICATE) ? right[ptr + MAX(x - d, 0)] : 0;
+                    if ((x - d < 0) && (REPLICATE == false))
+                        b = 0;
+                    sum += abs(a - b);
+                }
+                cost[x * DISPARITIES + d] = sum;
+            }
+        }
+
+        for (vx_int32 x = 0; x < WIDTH; x++) {
+
+            // Block costs (column costs beyond the left and right border are replicated or zero)
+            for (vx_int32 d = 0; d < DISPARITIES; d++) {
+                sad[d] = 0;
+                for (vx_int32 j = -KERN_RAD; j <= KERN_RAD; j++) {
+                    const vx_int32 col = x + j;
+                    if ((col >= 0 && col < WIDTH) || REPLICATE)
+                        sad[d] += cost[MAX(MIN(col, WIDTH - 1), 0) * DISPARITIES + d];
+                }
+            }
+
+            // Winner-take-all of the disparities inside the image
+            vx_int32 best = 0;
+            for (vx_int32 d = 1; d < MIN(DISPARITIES, x + 1); d++) {
+                if (sad[d] < sad[best])
+                    best = d;
+            }
+
+            // Uniqueness check
+            bool unique = true;
+            for (vx_int32 d = 0; d < MIN(DISPARITIES, x + 1); d++) {
+                if ((abs(d - best) > 1) && ((vx_uint64)sad[d] * 100 <= (vx_uint64)sad[best] * (100 + UNIQUENESS_RATIO)))
+                    unique = false;
+            }
+
+            // Subpixel refinement (rounded half away from zero)
+            vx_int32 disparity = best * 16;
+            if ((best > 0) && (best < MIN(DISPARITIES - 1, x))) {
+                const vx_int32 prev = sad[best - 1], next = sad[best + 1];
+                const vx_int32 denominator = 2 * (MAX(prev, next) - (vx_int32)sad[best]);
+                if (denominator > 0) {
+                    const vx_float64 offset = 16.0 * (vx_float64)(prev - next) / (vx_float64)denominator;
+                    disparity += (vx_int32)((offset >= 0.0) ? floor(offset + 0.5) : ceil(offset - 0.5));
+                }
+            }
+            output[y * WIDTH + x] = unique ? (vx_int16)disparity : (vx_int16)-16;
+        }
+    }
+    delete[] cost;
+}
+
+/**********************************************************************************************************************/
+/*! \brief Tests the stereo block matching against the software reference on a synthetic scene with known disparity */
+template <vx_uint8 VEC_NUM, vx_uint16 KERN_SIZE, vx_uint16 DISPARITIES, vx_uint8 UNIQUENESS_RATIO,
+          vx_border_e BORDER_TYPE>
+void TestStereoBM(vx_uint8 *left, vx_uint8 *right, vx_int16 *truth) {
+
+    const vx_uint16 WIDTH = 160;
+    const vx_uint16 HEIGHT = 96;
+    const vx_uint32 PIXELS = WIDTH * HEIGHT;
+
+    vx_int16 *output_sw = new vx_int16[PIXELS];
+    vx_int16 *output_hw = new vx_int16[PIXELS];
+
+    SwStereoBM<WIDTH, HEIGHT, KERN_SIZE, DISPARITIES, UNIQUENESS_RATIO, BORDER_TYPE>(left, right, output_sw);
+    ImgStereoBM<VEC_NUM, WIDTH, HEIGHT, KERN_SIZE, DISPARITIES, UNIQUENESS_RATIO, BORDER_TYPE>(left, right,
+                                                                                              output_hw);
+
+    // Errors against the reference, and the disparity error against the scene (outside of the border)
+    vx_uint32 errors = 0, valid = 0, correct = 0, checked = 0;
+    for (vx_uint32 i = 0; i < PIXELS; i++)
+        errors += (output_hw[i] != output_sw[i]) ? 1 : 0;
+    for (vx_int32 y = KERN_SIZE; y < HEIGHT - KERN_SIZE; y++) {
+        for (vx_int32 x = DISPARITIES + KERN_SIZE; x < WIDTH - KERN_SIZE; x++) {
+            const vx_int16 disparity = output_hw[y * WIDTH + x];
+            checked++;
+            if (disparity >= 0) {
+                valid++;
+                correct += (abs(disparity - truth[y * WIDTH + x]) <= 8) ? 1 : 0;
+            }
+        }
+    }
+    printf("Stereo BM:             Errors: %d | %d pixel/clock | %2dx%-2d | %3d disparities | %5.1f%% valid | %5.1f%% "
+           "correct (+-0.5)\n",
+           errors, VEC_NUM, KERN_SIZE, KERN_SIZE, DISPARITIES, 100.0f * valid / checked,
+           100.0f * correct / MAX(valid, 1u));
+
+    delete[] output_sw;
+    delete[] output_hw;
+}
+
+/**********************************************************************************************************************/
+/*! \brief Creates a stereo pair with a known subpixel disparity (background plane and a closer rectangle) */
+void TestStereoBMMain(void) {
+
+    const vx_uint16 WIDTH = 160;
+    const vx_uint16 HEIGHT = 96;
+    const vx_uint32 PIXELS = WIDTH * HEIGHT;
+    const vx_uint16 SAMPLES = 512;
+
+    vx_uint8 *left = new vx_uint8[PIXELS];
+    vx_uint8 *right = new vx_uint8[PIXELS];
+    vx_int16 *truth = new vx_int16[PIXELS];
+    vx_uint8 *texture = new vx_uint8[SAMPLES * HEIGHT];
+
+    // Random texture that is linearly interpolated between samples
+    for (vx_uint32 i = 0; i < SAMPLES * HEIGHT; i++)
+        texture[i] = rand() % 256;
+
+    // The right image sees the texture at x, the left image at x - disparity (in 1/16 pixel)
+    for (vx_int32 y = 0; y < HEIGHT; y++) {
+        for (vx_int32 x = 0; x < WIDTH; x++) {
+            const bool inside = (x >= 70) && (x < 120) && (y >= 30) && (y < 70);
+            const vx_int32 disparity = inside ? 20 * 16 + 8 : 9 * 16 + 4;
+            const vx_int32 pos_right = (x + 64) * 16, pos_left = (x + 64) * 16 - disparity;
+            const vx_uint8 *row = &texture[y * SAMPLES];
+            right[y * WIDTH + x] = (vx_uint8)((row[pos_right / 32] * (32 - pos_right % 32) +
+                                               row[pos_right / 32 + 1] * (pos_right % 32) + 16) / 32);
+            left[y * WIDTH + x] = (vx_uint8)((row[pos_left / 32] * (32 - pos_left % 32) +
+                                              row[pos_left / 32 + 1] * (pos_left % 32) + 16) / 32);
+            truth[y * WIDTH + x] = (vx_int16)disparity;
+        }
+    }
+
+    TestStereoBM<1, 9, 32, 10, VX_BORDER_CONSTANT>(left, right, truth);
+    TestStereoBM<2, 15, 24, 5, VX_BORDER_REPLICATE>(left, right, truth);
+    TestStereoBM<4, 7, 48, 15, VX_BORDER_REPLICATE>(left, right, truth);
+    TestStereoBM<8, 5, 25, 0, VX_BORDER_CONSTANT>(left, right, truth);
+
+    delete[] left;
+    delete[] right;
+    delete[] truth;
+    delete[] texture;
+}
+
 /**********************************************************************************************************************/
 /*! \brief Test all filter functions */
 void TestFilterMain(void) {
@@ -1417,8 +1644,13 @@ void TestFilterMain(void) {
         { TestFilterDatatype<vx_uint32, vx_int32, COLS_FHD, ROWS_FHD>(); }
     }
 
+    TestFilterHalfFloat<vx_float16, COLS_FHD, ROWS_FHD>("FLOAT 16-Bit:  ");
+    TestFilterHalfFloat<vx_bfloat16, COLS_FHD, ROWS_FHD>("BFLOAT 16-Bit: ");
+
     sw_test_fed();
 #endif
+
+    TestStereoBMMain();
 }
 
 #endif /* SRC_IMG_FILTER_TEST_H_ */
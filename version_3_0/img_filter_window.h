@@ -316,7 +316,7 @@ void SlidingWindowConstantY(const InType input[KERN_SIZE][VEC_NUM], InType outpu
 #pragma HLS unroll
         for (vx_uint16 v = 0; v < VEC_NUM; v++) {
 #pragma HLS UNROLL
-            output[i][v] = (y > KERN_SIZE - 2 - i) ? (input[i][v]) : (0);
+            output[i][v] = (y > KERN_SIZE - 2 - i) ? (input[i][v]) : (static_cast<InType>(0));
         }
     }
 
@@ -331,7 +331,7 @@ void SlidingWindowConstantY(const InType input[KERN_SIZE][VEC_NUM], InType outpu
 #pragma HLS unroll
         for (vx_uint16 v = 0; v < VEC_NUM; v++) {
 #pragma HLS UNROLL
-            output[i][v] = (y < IMG_ROWS + KERN_SIZE - 1 - i) ? (input[i][v]) : (0);
+            output[i][v] = (y < IMG_ROWS + KERN_SIZE - 1 - i) ? (input[i][v]) : (static_cast<InType>(0));
         }
     }
 }
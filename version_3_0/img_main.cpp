@@ -59,6 +59,11 @@
 #define THRESH_UPPER static_cast<vx_int64>(100)
 #define THRESH_LOWER static_cast<vx_int64>(20)
 #define PHASE_QUANTIZATION static_cast<vx_uint8>(3)
+#define BACKGROUND_ALPHA static_cast<vx_uint32>(0x0CCD)       // 0x0CCD=0.05 learning rate
+#define BACKGROUND_THRESHOLD static_cast<vx_uint16>(40)       // 40=2.5 standard deviations (4-bit fraction)
+#define BACKGROUND_MIN_VARIANCE static_cast<vx_uint16>(64)    // 64=4.0 (4-bit fraction)
+#define BACKGROUND_INIT_VARIANCE static_cast<vx_uint16>(256)  // 256=16.0 (4-bit fraction)
+#define BACKGROUND_SELECTIVE true                             // foreground pixels do not update the model
 
 // Typedefs
 typedef vx_uint32 pixelwise_type_1;
@@ -67,6 +72,13 @@ typedef pixelwise_type_1 pixelwise_image_1;
 #else
 typedef vx_image_data<pixelwise_type_1, VEC_NUM> pixelwise_image_1;
 #endif
+#if (VEC_NUM == 1 && defined(__SDSCC__))
+typedef vx_uint8 background_image;
+typedef vx_uint32 background_model_image;
+#else
+typedef vx_image_data<vx_uint8, VEC_NUM> background_image;
+typedef vx_image_data<vx_uint32, VEC_NUM> background_model_image;
+#endif
 
 // Copy a data object to another.
 void HwTestCopy(pixelwise_image_1 input[VEC_PIX], pixelwise_image_1 output[VEC_PIX]) {
@@ -253,6 +265,55 @@ void HwTestPhase(pixelwise_image_1 input1[VEC_PIX], pixelwise_image_1 input2[VEC
     ImgPhase<pixelwise_type_1, VEC_NUM, PIXELS_FHD, PHASE_QUANTIZATION>(input1, input2, output);
 }
 
+// Weighted sum of multiple input images in one pass
+void HwTestWeightedSum(pixelwise_image_1 input1[VEC_PIX], pixelwise_image_1 input2[VEC_PIX],
+                       pixelwise_image_1 output[VEC_PIX]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input1
+#pragma HLS INTERFACE axis port = input2
+#pragma HLS INTERFACE axis port = output
+    const vx_uint32 weights[2] = {ALPHA, 0x10000 - ALPHA};
+    ImgWeightedSum<pixelwise_type_1, VEC_NUM, PIXELS_FHD, PIXELWISE_CONV_TYPE, PIXELWISE_ROUND_TYPE>(input1, input2,
+                                                                                                    output, weights);
+}
+
+// Background subtraction with a running Gaussian model per pixel (model is read and updated in the same pass)
+void HwTestBackgroundSubtract(background_image input[VEC_PIX], background_model_image model_in[VEC_PIX],
+                              background_model_image model_out[VEC_PIX], background_image mask[VEC_PIX]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = model_in
+#pragma HLS INTERFACE axis port = model_out
+#pragma HLS INTERFACE axis port = mask
+    ImgBackgroundSubtract<VEC_NUM, PIXELS_FHD, BACKGROUND_ALPHA, BACKGROUND_THRESHOLD, BACKGROUND_MIN_VARIANCE,
+                          BACKGROUND_INIT_VARIANCE, BACKGROUND_SELECTIVE>(input, model_in, model_out, mask);
+}
+
+// Computes saturate((input1 - input2) * MULT_SCALE + input3) in one pass (fused pixelwise operations)
+typedef PixelwiseNode<HIFLIPVX::ARITHMETIC_SUBTRACTION, PixelwiseSource<0>, PixelwiseSource<1>,
+                      VX_CONVERT_POLICY_SATURATE>
+    fused_sub;
+typedef PixelwiseNode<HIFLIPVX::MULTIPLY_CONSTANT, fused_sub, fused_sub, VX_CONVERT_POLICY_SATURATE,
+                      PIXELWISE_ROUND_TYPE, MULT_SCALE>
+    fused_mul;
+typedef PixelwiseNode<HIFLIPVX::ARITHMETIC_ADDITION, fused_mul, PixelwiseSource<2>, VX_CONVERT_POLICY_SATURATE>
+    fused_add;
+void HwTestPixelwiseFused(pixelwise_image_1 input1[VEC_PIX], pixelwise_image_1 input2[VEC_PIX],
+                          pixelwise_image_1 input3[VEC_PIX], pixelwise_image_1 output[VEC_PIX]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input1
+#pragma HLS INTERFACE axis port = input2
+#pragma HLS INTERFACE axis port = input3
+#pragma HLS INTERFACE axis port = output
+    ImgPixelwiseFused<pixelwise_type_1, VEC_NUM, PIXELS_FHD, fused_add>(input1, input2, input3, output);
+}
+
 /*********************************************************************************************************************/
 // Test the pixelwise algorithms
 void TestPixelwiseFunctions() {
@@ -261,6 +322,10 @@ void TestPixelwiseFunctions() {
     pixelwise_image_1 *inputA = CreateImage<pixelwise_image_1, PIXELS_FHD, VEC_NUM>();
     pixelwise_image_1 *inputB = CreateImage<pixelwise_image_1, PIXELS_FHD, VEC_NUM>();
     pixelwise_image_1 *outputA = CreateImage<pixelwise_image_1, PIXELS_FHD, VEC_NUM>();
+    background_image *inputD = CreateImage<background_image, PIXELS_FHD, VEC_NUM>();
+    background_image *outputB = CreateImage<background_image, PIXELS_FHD, VEC_NUM>();
+    background_model_image *modelA = CreateImage<background_model_image, PIXELS_FHD, VEC_NUM>();
+    background_model_image *modelB = CreateImage<background_model_image, PIXELS_FHD, VEC_NUM>();
 
     // Create random data
     for (vx_uint32 i = 0; i < PIXELS_FHD; i++) {
@@ -268,6 +333,8 @@ void TestPixelwiseFunctions() {
         vx_uint8 b = rand() % 256;
         ((pixelwise_type_1 *)(inputA))[i] = a;
         ((pixelwise_type_1 *)(inputB))[i] = b;
+        ((vx_uint8 *)(inputD))[i] = a;
+        ((vx_uint32 *)(modelA))[i] = 0;
     }
 
     // Pixelwise operations
@@ -287,11 +354,18 @@ void TestPixelwiseFunctions() {
     HwTestMultiplyConstant(inputA, outputA);
     HwTestThreshold(inputA, outputA);
     HwTestWeightedAverage(inputA, inputB, outputA);
+    HwTestPixelwiseFused(inputA, inputB, inputA, outputA);
+    HwTestWeightedSum(inputA, inputB, outputA);
+    HwTestBackgroundSubtract(inputD, modelA, modelB, outputB);
 
     // Free memory
     DestroyImage<pixelwise_image_1>(inputA);
     DestroyImage<pixelwise_image_1>(inputB);
     DestroyImage<pixelwise_image_1>(outputA);
+    DestroyImage<background_image>(inputD);
+    DestroyImage<background_image>(outputB);
+    DestroyImage<background_model_image>(modelA);
+    DestroyImage<background_model_image>(modelB);
 }
 
 /***************************************************************************************************************************************************/
@@ -310,6 +384,9 @@ void TestPixelwiseFunctions() {
 #define NMS_QUANTIZATION static_cast<vx_uint32>(3)
 #define FED_STEP_SIZE static_cast<vx_uint32>(3000)
 #define CONDUCT_PRECISION static_cast<vx_hint_e>(VX_HINT_PERFORMANCE_DEFAULT)
+#define STEREO_KERN_SIZE static_cast<vx_uint16>(9)
+#define STEREO_DISPARITIES static_cast<vx_uint16>(64)
+#define STEREO_UNIQUENESS static_cast<vx_uint8>(15)
 
 // Typedefs
 typedef vx_uint8 filter_u_type;
@@ -320,10 +397,12 @@ typedef vx_uint32 contrast_type;
 typedef filter_u_type filter_u_image;
 typedef filter_s_type filter_s_image;
 typedef contrast_type contrast_image;
+typedef vx_int16 disparity_image;
 #else
 typedef vx_image_data<filter_u_type, VEC_NUM> filter_u_image;
 typedef vx_image_data<filter_s_type, VEC_NUM> filter_s_image;
 typedef vx_image_data<contrast_type, 1> contrast_image;
+typedef vx_image_data<vx_int16, VEC_NUM> disparity_image;
 #endif
 
 // Convolution kernel for the HwConvolve filter
@@ -522,6 +601,18 @@ void TestConductivity(filter_u_image input1[VEC_PIX], //
         input1, contrast_factor, output1);
 }
 
+// Computes the disparity of rectified stereo images by block matching
+void TestHwStereoBM(filter_u_image left[VEC_PIX], filter_u_image right[VEC_PIX], disparity_image output[VEC_PIX]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = left
+#pragma HLS INTERFACE axis port = right
+#pragma HLS INTERFACE axis port = output
+    ImgStereoBM<VEC_NUM, COLS_FHD, ROWS_FHD, STEREO_KERN_SIZE, STEREO_DISPARITIES, STEREO_UNIQUENESS, FILTER_BORDER>(
+        left, right, output);
+}
+
 /*********************************************************************************************************************/
 // Test the windowed algorithms
 void TestFilterFunctions() {
@@ -536,6 +627,7 @@ void TestFilterFunctions() {
     filter_s_image *dstX = CreateImage<filter_s_image, PIXELS_FHD, VEC_NUM>();
     filter_s_image *dstY = CreateImage<filter_s_image, PIXELS_FHD, VEC_NUM>();
     contrast_image *contrast = CreateImage<contrast_image, 1, 1>();
+    disparity_image *disparity = CreateImage<disparity_image, PIXELS_FHD, VEC_NUM>();
 
     // Create random data
     for (vx_uint32 i = 0; i < PIXELS_FHD; i++) {
@@ -567,6 +659,7 @@ void TestFilterFunctions() {
     TestDeterminantOfHessian(srcA, dstX);
     TestFastExplicitDiffusion(srcA, srcB, dstA, dstB);
     TestConductivity(srcA, contrast, dstA);
+    TestHwStereoBM(srcA, srcB, disparity);
 
     // Free memory
     DestroyImage<filter_u_image>(srcA);
@@ -577,6 +670,7 @@ void TestFilterFunctions() {
     DestroyImage<filter_s_image>(srcY);
     DestroyImage<filter_s_image>(dstX);
     DestroyImage<filter_s_image>(dstY);
+    DestroyImage<disparity_image>(disparity);
 }
 
 /***************************************************************************************************************************************************/
@@ -590,11 +684,27 @@ void TestFilterFunctions() {
 #define BIT_DEPTH_CONVERSION VX_CONVERT_POLICY_SATURATE // VX_CONVERT_POLICY_SATURATE, VX_CONVERT_POLICY_WRAP
 #define BIT_DEPTH_SHIFT 8                               //
 #define SCALE_INTERPOLATION VX_INTERPOLATION_AREA       // VX_INTERPOLATION_BILINEAR, VX_INTERPOLATION_NEAREST_NEIGHBOR
-#define DW_CONV_SRC_PARALLEL 3                          //
-#define DW_CONV_DST_PARALLEL 2                          //
+#define DW_CONV_SRC_PARALLEL 3                          // any vector size
+#define DW_CONV_DST_PARALLEL 4                          // any vector size
 #define CHANNEL_SIZE                                                                                                   \
     (CHANNEL_TYPE == VX_DF_IMAGE_RGB) ? ((PIXELS_FHD * 3) / 4) : (PIXELS_FHD) // TODO: alignement not correct
 #define SCATTER_GATHER_MODE HIFLIPVX::VX_SCATTER_GATHER_MODE_CYCLIC           //
+#define SCALE_VEC_NUM 4                                                       // 1, 2, 4, 8
+#define SCALE_VEC_INTERPOLATION VX_INTERPOLATION_BILINEAR                     // VX_INTERPOLATION_NEAREST_NEIGHBOR
+#define CHANNEL_VEC_NUM 4                                                     // 1, 2, 4, 8
+#define YUV_VEC_NUM 2                                                         // 1, 2, 4, 8
+#define YUV_TYPE VX_DF_IMAGE_NV12                                             // VX_DF_IMAGE_NV12, VX_DF_IMAGE_NV21
+#define COLOR_SPACE_VEC_NUM 4                                                 // 1, 2, 4, 8
+#define COLOR_SPACE HIFLIPVX::COLOR_SPACE_HSV                                 // COLOR_SPACE_YCBCR_BT601, ..._LAB
+#define COLOR_KEY_LOWER 70                                                    // lower hue of the color key (green)
+#define COLOR_KEY_UPPER 100                                                   // upper hue of the color key (green)
+#define DEMOSAIC_VEC_NUM 2                                                    // 1, 2, 4
+#define DEMOSAIC_PATTERN HIFLIPVX::BAYER_RGGB                                 // BAYER_BGGR, BAYER_GRBG, BAYER_GBRG
+#define DEMOSAIC_METHOD HIFLIPVX::DEMOSAIC_MALVAR_HE_CUTLER                   // DEMOSAIC_BILINEAR
+#define WARP_MAX_DISPLACEMENT 32                                              // maximum vertical source distance in rows
+#define WARP_INTERPOLATION VX_INTERPOLATION_BILINEAR                          // VX_INTERPOLATION_NEAREST_NEIGHBOR
+#define REMAP_GRID_BITS 3                                                     // grid size 2^REMAP_GRID_BITS
+#define REMAP_GRID_PIXELS (((COLS_FHD >> REMAP_GRID_BITS) + 1) * ((ROWS_FHD >> REMAP_GRID_BITS) + 1))
 
 // Typedefs
 typedef vx_uint32 channel_type;       // vx_uint16, vx_uint32
@@ -632,6 +742,42 @@ typedef dw_conv_type dw_conv_image_dst;
 #else
 typedef vx_image_data<dw_conv_type, DW_CONV_DST_PARALLEL> dw_conv_image_dst;
 #endif
+#if (SCALE_VEC_NUM == 1 && defined(__SDSCC__))
+typedef vx_uint8 scale_vec_image;
+#else
+typedef vx_image_data<vx_uint8, SCALE_VEC_NUM> scale_vec_image;
+#endif
+#if (CHANNEL_VEC_NUM == 1 && defined(__SDSCC__))
+typedef channel_type channel_vec_image;
+typedef vx_uint8 conversion_u8_vec_image;
+#else
+typedef vx_image_data<channel_type, CHANNEL_VEC_NUM> channel_vec_image;
+typedef vx_image_data<vx_uint8, CHANNEL_VEC_NUM> conversion_u8_vec_image;
+#endif
+#if (YUV_VEC_NUM == 1 && defined(__SDSCC__))
+typedef vx_uint8 yuv_luma_image;
+typedef vx_uint16 yuv_chroma_image;
+typedef vx_uint32 yuv_rgbx_image;
+#else
+typedef vx_image_data<vx_uint8, YUV_VEC_NUM> yuv_luma_image;
+typedef vx_image_data<vx_uint16, (YUV_VEC_NUM + 1) / 2> yuv_chroma_image;
+typedef vx_image_data<vx_uint32, YUV_VEC_NUM> yuv_rgbx_image;
+#endif
+#if (COLOR_SPACE_VEC_NUM == 1 && defined(__SDSCC__))
+typedef vx_uint32 color_space_image;
+typedef vx_uint8 color_space_u8_image;
+#else
+typedef vx_image_data<vx_uint32, COLOR_SPACE_VEC_NUM> color_space_image;
+typedef vx_image_data<vx_uint8, COLOR_SPACE_VEC_NUM> color_space_u8_image;
+#endif
+#if (DEMOSAIC_VEC_NUM == 1 && defined(__SDSCC__))
+typedef vx_uint8 demosaic_raw_image;
+typedef vx_uint32 demosaic_rgbx_image;
+#else
+typedef vx_image_data<vx_uint8, DEMOSAIC_VEC_NUM> demosaic_raw_image;
+typedef vx_image_data<vx_uint32, DEMOSAIC_VEC_NUM> demosaic_rgbx_image;
+#endif
+typedef vx_image_data<vx_int16, 2> remap_grid_image;
 
 // Implements the Channel Combine Kernel.
 void HwChannelCombine(conversion_u8_image input1[PIXELS_FHD], //
@@ -670,6 +816,97 @@ void HwColourConversion(channel_image input[CHANNEL_SIZE], conversion_u8_image o
     ImgConvertColor<channel_type, vx_uint8, CHANNEL_SIZE, PIXELS_FHD, CHANNEL_TYPE, VX_DF_IMAGE_U8>(input, output);
 }
 
+// Converts the Color of a vectorized image between RGB/RGBX/Gray
+void HwColourConversionVector(channel_vec_image input[CHANNEL_SIZE / CHANNEL_VEC_NUM],
+                              conversion_u8_vec_image output[PIXELS_FHD / CHANNEL_VEC_NUM]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = output
+    ImgConvertColor<channel_type, vx_uint8, CHANNEL_VEC_NUM, CHANNEL_SIZE, PIXELS_FHD, CHANNEL_TYPE, VX_DF_IMAGE_U8>(
+        input, output);
+}
+
+// Converts the Color of a semi-planar YUV image (NV12, NV21) to RGBX
+void HwColourConversionYuv(yuv_luma_image input_y[PIXELS_FHD / YUV_VEC_NUM],
+                           yuv_chroma_image input_uv[(PIXELS_FHD / 4) / ((YUV_VEC_NUM + 1) / 2)],
+                           yuv_rgbx_image output[PIXELS_FHD / YUV_VEC_NUM]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input_y
+#pragma HLS INTERFACE axis port = input_uv
+#pragma HLS INTERFACE axis port = output
+    ImgConvertColorYuv<vx_uint32, YUV_VEC_NUM, COLS_FHD, ROWS_FHD, YUV_TYPE, VX_DF_IMAGE_RGBX>(input_y, input_uv,
+                                                                                              output);
+}
+
+// Converts an RGBX image into a color space (HSV, YCbCr, Lab) and back
+void HwColorSpace(color_space_image input[PIXELS_FHD / COLOR_SPACE_VEC_NUM],
+                  color_space_image output[PIXELS_FHD / COLOR_SPACE_VEC_NUM],
+                  color_space_image output_rgb[PIXELS_FHD / COLOR_SPACE_VEC_NUM]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = output
+#pragma HLS INTERFACE axis port = output_rgb
+    ImgRgbToColorSpace<COLOR_SPACE_VEC_NUM, PIXELS_FHD, PIXELS_FHD, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGBX, COLOR_SPACE>(
+        input, output);
+    ImgColorSpaceToRgb<COLOR_SPACE_VEC_NUM, PIXELS_FHD, PIXELS_FHD, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGBX, COLOR_SPACE>(
+        output, output_rgb);
+}
+
+// Color keying: creates a mask of all RGBX pixels with a hue inside of [COLOR_KEY_LOWER, COLOR_KEY_UPPER]
+void HwColorKeying(color_space_image input[PIXELS_FHD / COLOR_SPACE_VEC_NUM],
+                   color_space_u8_image output[PIXELS_FHD / COLOR_SPACE_VEC_NUM]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = output
+
+    // FIFOs to stream data between functions
+#ifdef __XILINX__
+    color_space_image hsv[PIXELS_FHD / COLOR_SPACE_VEC_NUM];
+#pragma HLS STREAM variable = hsv depth = 16
+#pragma HLS data_pack variable = hsv
+    color_space_u8_image hue[PIXELS_FHD / COLOR_SPACE_VEC_NUM];
+#pragma HLS STREAM variable = hue depth = 16
+#pragma HLS data_pack variable = hue
+#else
+    color_space_image *hsv = new color_space_image[PIXELS_FHD / COLOR_SPACE_VEC_NUM];
+    color_space_u8_image *hue = new color_space_u8_image[PIXELS_FHD / COLOR_SPACE_VEC_NUM];
+#endif
+
+    // Computation
+#pragma HLS DATAFLOW
+    ImgRgbToColorSpace<COLOR_SPACE_VEC_NUM, PIXELS_FHD, PIXELS_FHD, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGBX,
+                       HIFLIPVX::COLOR_SPACE_HSV>(input, hsv);
+    ImgChannelExtract<vx_uint32, COLOR_SPACE_VEC_NUM, 0, PIXELS_FHD, PIXELS_FHD, VX_DF_IMAGE_RGBX>(hsv, hue);
+    ImgThreshold<vx_uint8, COLOR_SPACE_VEC_NUM, PIXELS_FHD, VX_THRESHOLD_TYPE_RANGE, COLOR_KEY_UPPER,
+                 COLOR_KEY_LOWER>(hue, output);
+
+    // Free Memory
+#ifndef __XILINX__
+    delete[] hsv;
+    delete[] hue;
+#endif
+}
+
+// Demosaics a Bayer raw image to RGBX
+void HwDemosaic(demosaic_raw_image input[PIXELS_FHD / DEMOSAIC_VEC_NUM],
+                demosaic_rgbx_image output[PIXELS_FHD / DEMOSAIC_VEC_NUM]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = output
+    ImgDemosaic<vx_uint32, DEMOSAIC_VEC_NUM, COLS_FHD, ROWS_FHD, DEMOSAIC_PATTERN, DEMOSAIC_METHOD, VX_DF_IMAGE_RGBX>(
+        input, output);
+}
+
 // Converts image bit depth.
 void HwConvertBitDepth(bit_depth_src_image input[VEC_PIX], bit_depth_dst_image output[VEC_PIX]) {
 #ifndef __SDSCC__
@@ -691,6 +928,68 @@ void HwScaleImage(conversion_u8_image input[PIXELS_FHD], conversion_u8_image out
     ImgScaleImage<COLS_FHD, ROWS_FHD, COLS_HD, ROWS_HD, SCALE_INTERPOLATION>(input, output);
 }
 
+// Computes a Gaussian pyramid with 3 levels in a single pass over the input image
+void HwPyramid(conversion_u8_image input[PIXELS_FHD], conversion_u8_image level0[PIXELS_FHD],
+               conversion_u8_image level1[PIXELS_FHD / 4], conversion_u8_image level2[PIXELS_FHD / 16]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = level0
+#pragma HLS INTERFACE axis port = level1
+#pragma HLS INTERFACE axis port = level2
+    ImgPyramid<vx_uint8, COLS_FHD, ROWS_FHD>(input, level0, level1, level2);
+}
+
+// Warps an image with an affine transformation
+void HwWarpAffine(conversion_u8_image input[PIXELS_FHD], conversion_u8_image output[PIXELS_FHD],
+                  const vx_float32 matrix[6]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = output
+#pragma HLS INTERFACE s_axilite port = matrix
+    ImgWarpAffine<vx_uint8, COLS_FHD, ROWS_FHD, WARP_MAX_DISPLACEMENT, WARP_INTERPOLATION>(input, output, matrix);
+}
+
+// Warps an image with a perspective transformation
+void HwWarpPerspective(conversion_u8_image input[PIXELS_FHD], conversion_u8_image output[PIXELS_FHD],
+                       const vx_float32 matrix[9]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = output
+#pragma HLS INTERFACE s_axilite port = matrix
+    ImgWarpPerspective<vx_uint8, COLS_FHD, ROWS_FHD, WARP_MAX_DISPLACEMENT, WARP_INTERPOLATION>(input, output, matrix);
+}
+
+// Remaps an image with a subsampled displacement grid
+void HwRemap(conversion_u8_image input[PIXELS_FHD], remap_grid_image map[REMAP_GRID_PIXELS],
+             conversion_u8_image output[PIXELS_FHD]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = map
+#pragma HLS INTERFACE axis port = output
+    ImgRemap<vx_uint8, COLS_FHD, ROWS_FHD, REMAP_GRID_BITS, WARP_MAX_DISPLACEMENT, WARP_INTERPOLATION>(input, map,
+                                                                                                        output);
+}
+
+// Scale a vectorized image up or down by an arbitrary ratio using bilinear or nearest neighbor interpolation
+void HwScaleImageVector(scale_vec_image input[PIXELS_FHD / SCALE_VEC_NUM],
+                        scale_vec_image output[PIXELS_HD / SCALE_VEC_NUM]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = output
+    ImgScaleImage<vx_uint8, SCALE_VEC_NUM, COLS_FHD, ROWS_FHD, COLS_HD, ROWS_HD, SCALE_VEC_INTERPOLATION>(input,
+                                                                                                        output);
+}
+
 //  Converts converts between two buffers with a different vector sizes (parallelization degree). If needed: bigger
 //  image needs to be aligned.
 void HwDataWidthConverter(dw_conv_image_src input[PIXELS_FHD / DW_CONV_SRC_PARALLEL],
@@ -754,6 +1053,8 @@ void TestConversionFunctions() {
     bit_depth_dst_image *dst_bitdepth = CreateImage<bit_depth_dst_image, PIXELS_FHD, VEC_NUM>();
     dw_conv_image_src *src_dw_conv = CreateImage<dw_conv_image_src, PIXELS_FHD, DW_CONV_SRC_PARALLEL>();
     dw_conv_image_dst *dst_dw_conv = CreateImage<dw_conv_image_dst, PIXELS_FHD, DW_CONV_DST_PARALLEL>();
+    color_space_image *src_color_space = CreateImage<color_space_image, PIXELS_FHD, COLOR_SPACE_VEC_NUM>();
+    color_space_image *dst_color_space = CreateImage<color_space_image, PIXELS_FHD, COLOR_SPACE_VEC_NUM>();
     multicast_image *src_multicast = CreateImage<multicast_image, PIXELS_FHD, VEC_NUM>();
     multicast_image *dst1_multicast = CreateImage<multicast_image, PIXELS_FHD, VEC_NUM>();
     multicast_image *dst2_multicast = CreateImage<multicast_image, PIXELS_FHD, VEC_NUM>();
@@ -778,6 +1079,7 @@ void TestConversionFunctions() {
         ((dw_conv_type *)(src_dw_conv))[i] = d;
         if (i < CHANNEL_SIZE)
             ((channel_type *)(src_channel))[i] = a;
+        ((vx_uint32 *)(src_color_space))[i] = a | (b << 8) | (c << 16);
         ((multicast_type *)(src_multicast))[i] = a;
         if (i < (PIXELS_FHD / 2)) {
             ((scatter_gather_type *)(src1_gather))[i] = a;
@@ -786,13 +1088,28 @@ void TestConversionFunctions() {
         ((scatter_gather_type *)(src1_scatter))[i] = a;
     }
 
+    // Rotation by 1 degree around the image center and a mild perspective distortion
+    const vx_float32 warp_affine[6] = {0.99985f, -0.01745f, 0.01745f, 0.99985f, -9.28f, 16.80f};
+    const vx_float32 warp_perspective[9] = {1.0f, 0.0f, 0.00001f, 0.01f, 1.0f, 0.0f, -5.0f, 2.0f, 1.0f};
+
     // Compute
     HwChannelCombine(src_fhd_u8_a, src_fhd_u8_b, src_fhd_u8_c, dst_channel); // src_fhd_u8_d,
     HwChannelExtract(src_channel, dst_fhd_u8_a);
     HwColourConversion(src_channel, dst_fhd_u8_a);
+    HwColourConversionVector((channel_vec_image *)src_channel, (conversion_u8_vec_image *)dst_fhd_u8_a);
+    HwColourConversionYuv((yuv_luma_image *)src_fhd_u8_a, (yuv_chroma_image *)src_fhd_u8_b,
+                          (yuv_rgbx_image *)dst_channel);
+    HwColorSpace(src_color_space, dst_color_space, (color_space_image *)dst_channel);
+    HwColorKeying(src_color_space, (color_space_u8_image *)dst_fhd_u8_a);
     HwConvertBitDepth(src_bitdepth, dst_bitdepth);
     HwDataWidthConverter(src_dw_conv, dst_dw_conv);
+    HwDemosaic((demosaic_raw_image *)src_fhd_u8_a, (demosaic_rgbx_image *)dst_channel);
     HwScaleImage(src_fhd_u8_a, dst_hd_u8_a);
+    HwScaleImageVector((scale_vec_image *)src_fhd_u8_a, (scale_vec_image *)dst_hd_u8_a);
+    HwPyramid(src_fhd_u8_a, src_fhd_u8_d, dst_fhd_u8_a, dst_hd_u8_a);
+    HwWarpAffine(src_fhd_u8_a, dst_fhd_u8_a, warp_affine);
+    HwWarpPerspective(src_fhd_u8_a, dst_fhd_u8_a, warp_perspective);
+    HwRemap(src_fhd_u8_a, (remap_grid_image *)src_fhd_u8_b, dst_fhd_u8_a);
     HwMulticast(src_multicast, dst1_multicast, dst2_multicast);
     HwGather(src1_gather, src2_gather, dst1_gather);
     HwScatter(src1_scatter, dst1_scatter, dst2_scatter);
@@ -810,6 +1127,8 @@ void TestConversionFunctions() {
     DestroyImage<bit_depth_dst_image>(dst_bitdepth);
     DestroyImage<dw_conv_image_src>(src_dw_conv);
     DestroyImage<dw_conv_image_dst>(dst_dw_conv);
+    DestroyImage<color_space_image>(src_color_space);
+    DestroyImage<color_space_image>(dst_color_space);
     DestroyImage<multicast_image>(src_multicast);
     DestroyImage<multicast_image>(dst1_multicast);
     DestroyImage<multicast_image>(dst2_multicast);
@@ -831,8 +1150,24 @@ void TestConversionFunctions() {
 #define HIST_OFFSET 0
 #define HIST_RANGE (1 << 8) // (1 << 8), (1 << 16)
 #define MIN_MAX_CAPACITY 32
+#define MIN_MAX_VEC_NUM 4 // 1, 2, 4, 8
 #define CONTRAST_PERCENTILE 45875 // 0.7
 #define CONTRAST_BORDER 3
+#define INTEGRAL_VEC_NUM 4 // 1, 2, 4, 8
+#define MEAN_STDDEV_VEC_NUM 4 // 1, 2, 4, 8
+#define MEAN_STDDEV_TILES_X 8
+#define MEAN_STDDEV_TILE_ROWS 8 // 1 (row statistics with MEAN_STDDEV_TILES_X = 1)
+#define MEAN_STDDEV_TILES (MEAN_STDDEV_TILES_X * (ROWS_FHD / MEAN_STDDEV_TILE_ROWS))
+#define EQUALIZE_DAMPING 192 // 0 (no temporal damping) - 255
+#define CLAHE_TILES_X 8
+#define CLAHE_TILES_Y 8
+#define CLAHE_CLIP_LIMIT 32 // 2.0 (Q4)
+#define CCL_MAX_LABELS 4096
+#define CCL_CONNECTIVITY 8 // 4, 8
+#define MOMENTS_VEC_NUM 4 // 1, 2, 4, 8
+#define MOMENTS_ORDER 3   // 2, 3
+#define MOMENTS_LABELS 256
+#define MOMENTS_NUM (((MOMENTS_ORDER + 1) * (MOMENTS_ORDER + 2)) / 2)
 
 // Typedefs
 typedef vx_uint8 controlflow_src_type; // all
@@ -862,6 +1197,20 @@ typedef vx_image_data<analysis_type, 1> analysis_image;
 typedef vx_image_data<contrast_dst_type, 1> contrast_dst_image;
 #endif
 typedef vx_image_data<vx_uint16, 2> coordinates_image;
+typedef vx_image_data<vx_uint16, INTEGRAL_VEC_NUM> integral_src_image;
+typedef vx_image_data<vx_uint32, INTEGRAL_VEC_NUM> integral_dst_image;
+typedef vx_image_data<vx_uint64, INTEGRAL_VEC_NUM> integral_sqr_image;
+typedef vx_image_data<analysis_type, MEAN_STDDEV_VEC_NUM> mean_stddev_image;
+typedef vx_image_data<vx_float32, 1> mean_stddev_f32_image;
+typedef vx_image_data<analysis_type, MIN_MAX_VEC_NUM> min_max_image;
+typedef vx_image_data<analysis_type, 1> min_max_val_image;
+typedef vx_image_data<vx_uint16, 1> min_max_count_image;
+typedef vx_image_data<vx_uint8, 1> ccl_mask_image;
+typedef vx_image_data<vx_uint32, HIFLIPVX::BLOB_RECORD_SIZE> ccl_blob_image;
+typedef vx_image_data<vx_uint16, 1> ccl_count_image;
+typedef vx_image_data<vx_uint8, MOMENTS_VEC_NUM> moments_image;
+typedef vx_image_data<vx_uint16, MOMENTS_VEC_NUM> moments_label_image;
+typedef vx_image_data<vx_uint64, 1> moments_dst_image;
 
 // These features allow for conditional graph flow in OpenVX, via support for a variety of operations between two
 // scalars.
@@ -888,6 +1237,26 @@ void HwEqualizeHist(analysis_u8_image input1[PIXELS_FHD], analysis_u8_image inpu
     ImgEqualizeHist<PIXELS_FHD>(input1, input2, output);
 }
 
+// Equalizes the histogram of a video stream in one pass, using the lookup table of the previous frame.
+void HwEqualizeHistStream(analysis_u8_image input[PIXELS_FHD], analysis_u8_image output[PIXELS_FHD]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = output
+    ImgEqualizeHistStream<PIXELS_FHD, EQUALIZE_DAMPING>(input, output);
+}
+
+// Contrast limited adaptive histogram equalization of a video stream, using the tile lookup tables of the previous frame.
+void HwClahe(analysis_u8_image input[PIXELS_FHD], analysis_u8_image output[PIXELS_FHD]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = output
+    ImgClahe<COLS_FHD, ROWS_FHD, CLAHE_TILES_X, CLAHE_TILES_Y, CLAHE_CLIP_LIMIT>(input, output);
+}
+
 // Generates a distribution from an image.
 void HwHistogram(hist_image input[VEC_PIX], analysis_u32_image output[HIST_BINS]) {
 #ifndef __SDSCC__
@@ -917,6 +1286,19 @@ void HwIntegral(analysis_u8_image input[PIXELS_FHD], analysis_u32_image output[P
     ImgIntegral<COLS_FHD, ROWS_FHD>(input, output);
 }
 
+// Computes the integral image and the squared integral image of a vectorized 16-bit input in one pass.
+void HwIntegralVector(integral_src_image input[PIXELS_FHD / INTEGRAL_VEC_NUM],
+                      integral_dst_image output[PIXELS_FHD / INTEGRAL_VEC_NUM],
+                      integral_sqr_image output_sqr[PIXELS_FHD / INTEGRAL_VEC_NUM]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = output
+#pragma HLS INTERFACE axis port = output_sqr
+    ImgIntegral<vx_uint16, vx_uint32, vx_uint64, INTEGRAL_VEC_NUM, COLS_FHD, ROWS_FHD>(input, output, output_sqr);
+}
+
 // Computes the mean pixel value and the standard deviation of the pixels in the input image (which has a dimension
 // width and height).
 void HwMeanStdDev1(analysis_image input1[PIXELS_FHD], analysis_f32_image mean[1], analysis_image input2[PIXELS_FHD],
@@ -942,6 +1324,23 @@ void HwMeanStdDev2(analysis_image input1[PIXELS_FHD], analysis_f32_image mean[1]
     ImgMeanStdDev<analysis_type, COLS_FHD, ROWS_FHD>(input1, mean);
 }
 
+// Computes the mean pixel value and the standard deviation of a vectorized input image and of its tiles in a single
+// pass.
+void HwMeanStdDev3(mean_stddev_image input[PIXELS_FHD / MEAN_STDDEV_VEC_NUM], mean_stddev_f32_image mean[1],
+                   mean_stddev_f32_image stddev[1], mean_stddev_f32_image tile_mean[MEAN_STDDEV_TILES],
+                   mean_stddev_f32_image tile_stddev[MEAN_STDDEV_TILES]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = mean
+#pragma HLS INTERFACE axis port = stddev
+#pragma HLS INTERFACE axis port = tile_mean
+#pragma HLS INTERFACE axis port = tile_stddev
+    ImgMeanStdDev<analysis_type, MEAN_STDDEV_VEC_NUM, COLS_FHD, ROWS_FHD, MEAN_STDDEV_TILES_X,
+                  MEAN_STDDEV_TILE_ROWS>(input, mean, stddev, tile_mean, tile_stddev);
+}
+
 // Finds the minimum and maximum values in an image and a location for each. If the input image has several
 // minimums/maximums, the kernel returns all of them.
 void HwMinMaxLocation1(analysis_image input[PIXELS_FHD], analysis_image min_val[1], analysis_image max_val[1],
@@ -973,6 +1372,60 @@ void HwMinMaxLocation2(analysis_image input[PIXELS_FHD], analysis_image min_val[
     ImgMinMaxLocation<analysis_type, COLS_FHD, ROWS_FHD>(input, min_val, max_val);
 }
 
+// Finds the minimum and maximum values in a vectorized image and their first locations. The vector lanes are merged by
+// a tree reduction at the end of the image.
+void HwMinMaxLocation3(min_max_image input[PIXELS_FHD / MIN_MAX_VEC_NUM], min_max_val_image min_val[1],
+                       min_max_val_image max_val[1], coordinates_image min_loc[MIN_MAX_CAPACITY],
+                       coordinates_image max_loc[MIN_MAX_CAPACITY], min_max_count_image min_count[1],
+                       min_max_count_image max_count[1]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = min_val
+#pragma HLS INTERFACE axis port = max_val
+#pragma HLS INTERFACE axis port = min_loc
+#pragma HLS INTERFACE axis port = max_loc
+#pragma HLS INTERFACE axis port = min_count
+#pragma HLS INTERFACE axis port = max_count
+    ImgMinMaxLocation<analysis_type, MIN_MAX_VEC_NUM, COLS_FHD, ROWS_FHD, MIN_MAX_CAPACITY>(
+        input, min_val, max_val, min_loc, max_loc, min_count, max_count);
+}
+
+// Labels the connected components of a binary image in a single pass and outputs the area, bounding box and centroid
+// of each component.
+void HwConnectedComponents(ccl_mask_image input[PIXELS_FHD], ccl_blob_image blobs[CCL_MAX_LABELS - 1],
+                           ccl_count_image blob_count[1]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = blobs
+#pragma HLS INTERFACE axis port = blob_count
+    ImgConnectedComponents<COLS_FHD, ROWS_FHD, CCL_MAX_LABELS, CCL_CONNECTIVITY>(input, blobs, blob_count);
+}
+
+// Computes the raw moments up to MOMENTS_ORDER of a gray image in a single pass (e.g. for centroid and orientation)
+void HwMoments1(moments_image input[PIXELS_FHD / MOMENTS_VEC_NUM], moments_dst_image moments[MOMENTS_NUM]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = moments
+    ImgMoments<vx_uint8, MOMENTS_VEC_NUM, COLS_FHD, ROWS_FHD, MOMENTS_ORDER>(input, moments);
+}
+
+// Computes the raw moments up to MOMENTS_ORDER of every label of a label image in a single pass
+void HwMoments2(moments_label_image input[PIXELS_FHD / MOMENTS_VEC_NUM],
+                moments_dst_image moments[MOMENTS_LABELS * MOMENTS_NUM]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = moments
+    ImgMoments<vx_uint16, MOMENTS_VEC_NUM, COLS_FHD, ROWS_FHD, MOMENTS_ORDER, MOMENTS_LABELS>(input, moments);
+}
+
 // Implements the Table Lookup Image Kernel.
 void HwTableLookup(hist_image input[PIXELS_FHD], hist_image lut[HIST_BINS], hist_image output[PIXELS_FHD]) {
 #ifndef __SDSCC__
@@ -1010,6 +1463,26 @@ void TestAnalysisFunctions() {
     analysis_f32_image *dst1_analysis_f32 = CreateImage<analysis_f32_image, 1, 1>();
     analysis_f32_image *dst2_analysis_f32 = CreateImage<analysis_f32_image, 1, 1>();
     contrast_dst_image *dst1_contrast_u16 = CreateImage<contrast_dst_image, 1, 1>();
+    integral_src_image *src1_integral = CreateImage<integral_src_image, PIXELS_FHD, INTEGRAL_VEC_NUM>();
+    integral_dst_image *dst1_integral = CreateImage<integral_dst_image, PIXELS_FHD, INTEGRAL_VEC_NUM>();
+    integral_sqr_image *dst2_integral = CreateImage<integral_sqr_image, PIXELS_FHD, INTEGRAL_VEC_NUM>();
+    mean_stddev_image *src1_mean_stddev = CreateImage<mean_stddev_image, PIXELS_FHD, MEAN_STDDEV_VEC_NUM>();
+    mean_stddev_f32_image *dst1_mean_stddev = CreateImage<mean_stddev_f32_image, 1, 1>();
+    mean_stddev_f32_image *dst2_mean_stddev = CreateImage<mean_stddev_f32_image, 1, 1>();
+    mean_stddev_f32_image *dst3_mean_stddev = CreateImage<mean_stddev_f32_image, MEAN_STDDEV_TILES, 1>();
+    mean_stddev_f32_image *dst4_mean_stddev = CreateImage<mean_stddev_f32_image, MEAN_STDDEV_TILES, 1>();
+    min_max_image *src1_min_max = CreateImage<min_max_image, PIXELS_FHD, MIN_MAX_VEC_NUM>();
+    min_max_val_image *dst1_min_max = CreateImage<min_max_val_image, 1, 1>();
+    min_max_val_image *dst2_min_max = CreateImage<min_max_val_image, 1, 1>();
+    min_max_count_image *dst3_min_max = CreateImage<min_max_count_image, 1, 1>();
+    min_max_count_image *dst4_min_max = CreateImage<min_max_count_image, 1, 1>();
+    ccl_mask_image *src1_ccl = CreateImage<ccl_mask_image, PIXELS_FHD, 1>();
+    ccl_blob_image *dst1_ccl = CreateImage<ccl_blob_image, CCL_MAX_LABELS - 1, 1>();
+    ccl_count_image *dst2_ccl = CreateImage<ccl_count_image, 1, 1>();
+    moments_image *src1_moments = CreateImage<moments_image, PIXELS_FHD, MOMENTS_VEC_NUM>();
+    moments_label_image *src2_moments = CreateImage<moments_label_image, PIXELS_FHD, MOMENTS_VEC_NUM>();
+    moments_dst_image *dst1_moments = CreateImage<moments_dst_image, MOMENTS_NUM, 1>();
+    moments_dst_image *dst2_moments = CreateImage<moments_dst_image, MOMENTS_LABELS * MOMENTS_NUM, 1>();
 
     // Create random data
     for (vx_uint32 i = 0; i < PIXELS_FHD; i++) {
@@ -1023,6 +1496,12 @@ void TestAnalysisFunctions() {
         ((vx_uint8 *)(src2_analysis_u8))[i] = b;
         ((hist_type *)(src0_histogram))[i] = a;
         ((hist_type *)(src1_histogram))[i] = a;
+        ((vx_uint16 *)(src1_integral))[i] = (a << 8) | b;
+        ((analysis_type *)(src1_mean_stddev))[i] = a;
+        ((analysis_type *)(src1_min_max))[i] = a;
+        ((vx_uint8 *)(src1_ccl))[i] = (a > 192) ? 255 : 0;
+        ((vx_uint8 *)(src1_moments))[i] = a;
+        ((vx_uint16 *)(src2_moments))[i] = b;
         if (i < HIST_BINS) {
             ((hist_type *)(src2_histogram))[i] = b;
         }
@@ -1031,14 +1510,23 @@ void TestAnalysisFunctions() {
     // Compute
     HwScalarOperation(src1_controlflow, src2_controlflow, dst1_controlflow);
     HwEqualizeHist(src1_analysis_u8, src1_analysis_u8, dst1_analysis_u32);
+    HwEqualizeHistStream(src1_analysis_u8, src2_analysis_u8);
+    HwClahe(src1_analysis_u8, src2_analysis_u8);
     HwHistogram(src0_histogram, dst2_analysis_u32);
     HwContrastFactor(src0_histogram, dst1_contrast_u16);
     HwIntegral(src1_analysis_u8, dst1_analysis_u32);
+    HwIntegralVector(src1_integral, dst1_integral, dst2_integral);
     HwMeanStdDev1(src1_analysis, dst1_analysis_f32, src1_analysis, dst2_analysis_f32);
     HwMeanStdDev2(src1_analysis, dst1_analysis_f32);
+    HwMeanStdDev3(src1_mean_stddev, dst1_mean_stddev, dst2_mean_stddev, dst3_mean_stddev, dst4_mean_stddev);
     HwMinMaxLocation1(src1_analysis, dst1_analysis, dst2_analysis, dst1_coordinates, dst2_coordinates,
                       dst1_analysis_u16, dst2_analysis_u16);
     HwMinMaxLocation2(src1_analysis, dst1_analysis, dst2_analysis);
+    HwMinMaxLocation3(src1_min_max, dst1_min_max, dst2_min_max, dst1_coordinates, dst2_coordinates, dst3_min_max,
+                      dst4_min_max);
+    HwConnectedComponents(src1_ccl, dst1_ccl, dst2_ccl);
+    HwMoments1(src1_moments, dst1_moments);
+    HwMoments2(src2_moments, dst2_moments);
     HwTableLookup(src1_histogram, src2_histogram, dst1_histogram);
 
     // Free memory
@@ -1061,12 +1549,134 @@ void TestAnalysisFunctions() {
     DestroyImage<analysis_u16_image>(dst2_analysis_u16);
     DestroyImage<analysis_f32_image>(dst1_analysis_f32);
     DestroyImage<analysis_f32_image>(dst2_analysis_f32);
+    DestroyImage<integral_src_image>(src1_integral);
+    DestroyImage<integral_dst_image>(dst1_integral);
+    DestroyImage<integral_sqr_image>(dst2_integral);
+    DestroyImage<mean_stddev_image>(src1_mean_stddev);
+    DestroyImage<mean_stddev_f32_image>(dst1_mean_stddev);
+    DestroyImage<mean_stddev_f32_image>(dst2_mean_stddev);
+    DestroyImage<mean_stddev_f32_image>(dst3_mean_stddev);
+    DestroyImage<mean_stddev_f32_image>(dst4_mean_stddev);
+    DestroyImage<min_max_image>(src1_min_max);
+    DestroyImage<min_max_val_image>(dst1_min_max);
+    DestroyImage<min_max_val_image>(dst2_min_max);
+    DestroyImage<min_max_count_image>(dst3_min_max);
+    DestroyImage<min_max_count_image>(dst4_min_max);
+    DestroyImage<ccl_mask_image>(src1_ccl);
+    DestroyImage<ccl_blob_image>(dst1_ccl);
+    DestroyImage<ccl_count_image>(dst2_ccl);
+    DestroyImage<moments_image>(src1_moments);
+    DestroyImage<moments_label_image>(src2_moments);
+    DestroyImage<moments_dst_image>(dst1_moments);
+    DestroyImage<moments_dst_image>(dst2_moments);
 }
 
 /***************************************************************************************************************************************************/
 /* Accelerated Feature Detection functions */
 /***************************************************************************************************************************************************/
 
+// Defines
+#define HOUGH_VEC_NUM 4 // 1, 2, 4, 8
+#define HOUGH_THETA_NUM 180
+#define HOUGH_RHO_SHIFT 1 // rho step of 2 pixels
+#define HOUGH_THETA_BANKS 4
+#define HOUGH_MAX_LINES 16
+#define HOUGH_THRESHOLD 100
+#define HOUGH_QUANTIZATION 8
+#define HOUGH_PHASE_WINDOW 5
+#define MATCH_VEC_NUM 2 // 1, 2, 4, 8
+#define MATCH_COLS 256  // search region
+#define MATCH_ROWS 256  // search region
+#define MATCH_PIXELS (MATCH_COLS * MATCH_ROWS)
+#define MATCH_TEMPLATE_SIZE 32
+#define MATCH_MODE HIFLIPVX::MATCH_NCC
+#define MATCH_BORDER VX_BORDER_REPLICATE
+
+// Typedefs
+typedef vx_image_data<vx_uint8, HOUGH_VEC_NUM> hough_image;
+typedef vx_image_data<vx_int32, HIFLIPVX::HOUGH_RECORD_SIZE> hough_line_image;
+typedef vx_image_data<vx_uint16, 1> hough_count_image;
+typedef vx_image_data<vx_uint8, MATCH_VEC_NUM> match_src_image;
+typedef vx_image_data<vx_int16, MATCH_VEC_NUM> match_dst_image;
+
+// Finds the strongest lines of an edge image (e.g. output of the Canny edge detector) voting for all theta
+void HwHoughLines1(hough_image edges[PIXELS_FHD / HOUGH_VEC_NUM], hough_line_image lines[HOUGH_MAX_LINES],
+                   hough_count_image line_count[1]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = edges
+#pragma HLS INTERFACE axis port = lines
+#pragma HLS INTERFACE axis port = line_count
+    ImgHoughLines<vx_uint8, HOUGH_VEC_NUM, COLS_FHD, ROWS_FHD, HOUGH_THETA_NUM, HOUGH_RHO_SHIFT, HOUGH_THETA_BANKS,
+                  HOUGH_MAX_LINES, HOUGH_THRESHOLD>(edges, lines, line_count);
+}
+
+// Finds the strongest lines of an edge image voting only for theta close to the gradient direction (ImgPhase output)
+void HwHoughLines2(hough_image edges[PIXELS_FHD / HOUGH_VEC_NUM], hough_image phase[PIXELS_FHD / HOUGH_VEC_NUM],
+                   hough_line_image lines[HOUGH_MAX_LINES], hough_count_image line_count[1]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = edges
+#pragma HLS INTERFACE axis port = phase
+#pragma HLS INTERFACE axis port = lines
+#pragma HLS INTERFACE axis port = line_count
+    ImgHoughLines<vx_uint8, vx_uint8, HOUGH_VEC_NUM, COLS_FHD, ROWS_FHD, HOUGH_THETA_NUM, HOUGH_RHO_SHIFT,
+                  HOUGH_THETA_BANKS, HOUGH_MAX_LINES, HOUGH_THRESHOLD, HOUGH_QUANTIZATION, HOUGH_PHASE_WINDOW>(
+        edges, phase, lines, line_count);
+}
+
+// Matches a template against a search region (the response can be passed to ImgFeatureExtraction)
+void HwMatchTemplate(match_src_image input[MATCH_PIXELS / MATCH_VEC_NUM],
+                     match_dst_image output[MATCH_PIXELS / MATCH_VEC_NUM],
+                     const vx_uint8 templ[MATCH_TEMPLATE_SIZE][MATCH_TEMPLATE_SIZE]) {
+#ifndef __SDSCC__
+#pragma HLS interface ap_ctrl_none port = return
+#endif
+#pragma HLS INTERFACE axis port = input
+#pragma HLS INTERFACE axis port = output
+    ImgMatchTemplate<vx_int16, MATCH_VEC_NUM, MATCH_COLS, MATCH_ROWS, MATCH_TEMPLATE_SIZE, MATCH_MODE, MATCH_BORDER>(
+        input, output, templ);
+}
+
+/*********************************************************************************************************************/
+// Test the feature algorithms
+void TestFeatureFunctions() {
+
+    // Allocate memory
+    hough_image *src1_hough = CreateImage<hough_image, PIXELS_FHD, HOUGH_VEC_NUM>();
+    hough_image *src2_hough = CreateImage<hough_image, PIXELS_FHD, HOUGH_VEC_NUM>();
+    hough_line_image *dst1_hough = CreateImage<hough_line_image, HOUGH_MAX_LINES, 1>();
+    hough_count_image *dst2_hough = CreateImage<hough_count_image, 1, 1>();
+    match_src_image *src1_match = CreateImage<match_src_image, MATCH_PIXELS, MATCH_VEC_NUM>();
+    match_dst_image *dst1_match = CreateImage<match_dst_image, MATCH_PIXELS, MATCH_VEC_NUM>();
+    vx_uint8 templ_match[MATCH_TEMPLATE_SIZE][MATCH_TEMPLATE_SIZE];
+
+    // Create random data (sparse edges)
+    for (vx_uint32 i = 0; i < PIXELS_FHD; i++) {
+        ((vx_uint8 *)(src1_hough))[i] = ((rand() % 64) == 0) ? 255 : 0;
+        ((vx_uint8 *)(src2_hough))[i] = rand() % 256;
+    }
+    for (vx_uint32 i = 0; i < MATCH_PIXELS; i++)
+        ((vx_uint8 *)(src1_match))[i] = rand() % 256;
+    for (vx_uint32 i = 0; i < MATCH_TEMPLATE_SIZE * MATCH_TEMPLATE_SIZE; i++)
+        templ_match[i / MATCH_TEMPLATE_SIZE][i % MATCH_TEMPLATE_SIZE] = rand() % 256;
+
+    // Compute
+    HwHoughLines1(src1_hough, dst1_hough, dst2_hough);
+    HwHoughLines2(src1_hough, src2_hough, dst1_hough, dst2_hough);
+    HwMatchTemplate(src1_match, dst1_match, templ_match);
+
+    // Free memory
+    DestroyImage<hough_image>(src1_hough);
+    DestroyImage<hough_image>(src2_hough);
+    DestroyImage<hough_line_image>(dst1_hough);
+    DestroyImage<hough_count_image>(dst2_hough);
+    DestroyImage<match_src_image>(src1_match);
+    DestroyImage<match_dst_image>(dst1_match);
+}
+
 /***************************************************************************************************************************************************/
 /* Example Applications. (including loop level parallelism) */
 /***************************************************************************************************************************************************/
@@ -1299,6 +1909,7 @@ int main(void) {
      TestFilterFunctions();
      TestConversionFunctions();
      TestAnalysisFunctions();
+     TestFeatureFunctions();
      TestExampleApplications();
 
     printf("Finished\n");
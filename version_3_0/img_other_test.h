@@ -19,6 +19,13 @@
 #include "img_analysis_base.h"
 #include "img_conversion_base.h"
 #include "img_feature_base.h"
+#include <vector>
+
+// The multi-threaded software tests use std::thread on the host (compile and link with -pthread)
+#if !defined(__SYNTHESIS__) && !defined(__XILINX__)
+#include <thread>
+#define __SW_THREADS__
+#endif
 
 /*********************************************************************************************************************/
 /* Test Functions Headers */
@@ -26,10 +33,28 @@
 
 void swTestOtherMain(void);
 void swTestColorConversion(void);
+void swTestColorConversionVector(void);
+void swTestColorConversionYuv(void);
+void swTestColorSpace(void);
+void swTestDemosaic(void);
+void swTestDataWidthConverter(void);
 void swTestScaleDown(void);
+void swTestScaleImageVector(void);
+void swTestPyramid(void);
+void swTestWarp(void);
+void swTestRemap(void);
 void swTestIntegral(void);
+void swTestIntegralVector(void);
+void swTestMeanStdDev(void);
+void swTestMinMaxLocation(void);
 void swTestHistogram(void);
+void swTestEqualizeHistStream(void);
+void swTestClahe(void);
+void swTestConnectedComponents(void);
+void swTestMoments(void);
 void swTestTableLookup(void);
+void swTestHoughLines(void);
+void swTestMatchTemplate(void);
 void swTestRetainBest(void);
 
 /*********************************************************************************************************************/
@@ -39,10 +64,28 @@ void swTestRetainBest(void);
 /*! \brief Calls all Software Test Functions */
 void swTestOtherMain(void) {
     // swTestColorConversion();
+    // swTestColorConversionVector();
+    // swTestColorConversionYuv();
+    // swTestColorSpace();
+    // swTestDemosaic();
     // swTestIntegral();
+    // swTestIntegralVector();
+    // swTestMeanStdDev();
+    // swTestMinMaxLocation();
+    // swTestDataWidthConverter();
     // swTestScaleDown();
+    // swTestScaleImageVector();
+    // swTestPyramid();
+    // swTestWarp();
+    // swTestRemap();
     // swTestHistogram();
+    // swTestEqualizeHistStream();
+    // swTestClahe();
+    // swTestConnectedComponents();
+    // swTestMoments();
     // swTestTableLookup();
+    // swTestHoughLines();
+    // swTestMatchTemplate();
     // swTestRetainBest();
 }
 
@@ -182,6 +225,476 @@ void swTestColorConversion(void) {
     }
 }
 
+/*! \brief Compares a vectorized color conversion against the non-vectorized one and prints the mismatches */
+template <typename SrcType, typename DstType, vx_uint8 VEC_NUM, vx_uint32 PIXELS, vx_df_image_e SRC_IMAGE,
+          vx_df_image_e DST_IMAGE>
+void swTestColorConversionVectorCompare(const char *name) {
+    const vx_uint32 SRC_PIXELS = (SRC_IMAGE == VX_DF_IMAGE_RGB) ? (PIXELS * 3 / 4) : (PIXELS);
+    const vx_uint32 DST_PIXELS = (DST_IMAGE == VX_DF_IMAGE_RGB) ? (PIXELS * 3 / 4) : (PIXELS);
+
+    SrcType *src = new SrcType[SRC_PIXELS];
+    DstType *dst_ref = new DstType[DST_PIXELS];
+    DstType *dst_vec = new DstType[DST_PIXELS];
+    for (vx_uint32 i = 0; i < SRC_PIXELS; i++)
+        src[i] = (SrcType)(((vx_uint32)rand() << 16) ^ (vx_uint32)rand());
+
+    ImgConvertColor<SrcType, DstType, SRC_PIXELS, DST_PIXELS, SRC_IMAGE, DST_IMAGE>(src, dst_ref);
+    ImgConvertColor<SrcType, DstType, VEC_NUM, SRC_PIXELS, DST_PIXELS, SRC_IMAGE, DST_IMAGE>(src, dst_vec);
+
+    vx_uint32 errors = 0;
+    for (vx_uint32 i = 0; i < DST_PIXELS; i++)
+        errors += (dst_ref[i] != dst_vec[i]) ? 1 : 0;
+    printf(" %-12s (%d pixel/clock): %d mismatches\n", name, VEC_NUM, errors);
+
+    delete[] src;
+    delete[] dst_ref;
+    delete[] dst_vec;
+}
+
+/*! \brief Compares vectorized channel extraction and combination against the non-vectorized functions */
+template <vx_uint8 VEC_NUM, vx_uint32 PIXELS>
+void swTestChannelVectorCompare(void) {
+    const vx_uint32 RGB_PIXELS = PIXELS * 3 / 4;
+
+    vx_uint8 *plane[4], *plane_ref = new vx_uint8[PIXELS], *plane_vec = new vx_uint8[PIXELS];
+    vx_uint32 *rgb_ref = new vx_uint32[PIXELS], *rgb_vec = new vx_uint32[PIXELS];
+    vx_uint16 *u16_ref = new vx_uint16[PIXELS], *u16_vec = new vx_uint16[PIXELS];
+    for (vx_uint32 i = 0; i < 4; i++) {
+        plane[i] = new vx_uint8[PIXELS];
+        for (vx_uint32 j = 0; j < PIXELS; j++)
+            plane[i][j] = (vx_uint8)rand();
+    }
+    vx_uint32 errors = 0;
+
+    // Channel Combine
+    ImgChannelCombine<vx_uint32, PIXELS, RGB_PIXELS, VX_DF_IMAGE_RGB>(plane[0], plane[1], plane[2], rgb_ref);
+    ImgChannelCombine<vx_uint32, VEC_NUM, PIXELS, RGB_PIXELS, VX_DF_IMAGE_RGB>(plane[0], plane[1], plane[2], rgb_vec);
+    for (vx_uint32 i = 0; i < RGB_PIXELS; i++)
+        errors += (rgb_ref[i] != rgb_vec[i]) ? 1 : 0;
+    ImgChannelCombine<vx_uint32, PIXELS, PIXELS, VX_DF_IMAGE_RGBX>(plane[0], plane[1], plane[2], rgb_ref);
+    ImgChannelCombine<vx_uint32, VEC_NUM, PIXELS, PIXELS, VX_DF_IMAGE_RGBX>(plane[0], plane[1], plane[2], rgb_vec);
+    for (vx_uint32 i = 0; i < PIXELS; i++)
+        errors += (rgb_ref[i] != rgb_vec[i]) ? 1 : 0;
+    ImgChannelCombine<vx_uint32, PIXELS, PIXELS, VX_DF_IMAGE_U32>(plane[0], plane[1], plane[2], plane[3], rgb_ref);
+    ImgChannelCombine<vx_uint32, VEC_NUM, PIXELS, PIXELS, VX_DF_IMAGE_U32>(plane[0], plane[1], plane[2], plane[3],
+                                                                           rgb_vec);
+    for (vx_uint32 i = 0; i < PIXELS; i++)
+        errors += (rgb_ref[i] != rgb_vec[i]) ? 1 : 0;
+    ImgChannelCombine<vx_uint16, PIXELS, PIXELS, VX_DF_IMAGE_U16>(plane[0], plane[1], u16_ref);
+    ImgChannelCombine<vx_uint16, VEC_NUM, PIXELS, PIXELS, VX_DF_IMAGE_U16>(plane[0], plane[1], u16_vec);
+    for (vx_uint32 i = 0; i < PIXELS; i++)
+        errors += (u16_ref[i] != u16_vec[i]) ? 1 : 0;
+    printf(" Channel Combine (%d pixel/clock): %d mismatches\n", VEC_NUM, errors);
+
+    // Channel Extract
+    errors = 0;
+    for (vx_uint32 i = 0; i < PIXELS; i++)
+        rgb_ref[i] = (vx_uint32)(((vx_uint32)rand() << 16) ^ (vx_uint32)rand());
+    ImgChannelExtract<vx_uint32, 1, RGB_PIXELS, PIXELS, VX_DF_IMAGE_RGB>(rgb_ref, plane_ref);
+    ImgChannelExtract<vx_uint32, VEC_NUM, 1, RGB_PIXELS, PIXELS, VX_DF_IMAGE_RGB>(rgb_ref, plane_vec);
+    for (vx_uint32 i = 0; i < PIXELS; i++)
+        errors += (plane_ref[i] != plane_vec[i]) ? 1 : 0;
+    ImgChannelExtract<vx_uint32, 2, RGB_PIXELS, PIXELS, VX_DF_IMAGE_RGB>(rgb_ref, plane_ref);
+    ImgChannelExtract<vx_uint32, VEC_NUM, 2, RGB_PIXELS, PIXELS, VX_DF_IMAGE_RGB>(rgb_ref, plane_vec);
+    for (vx_uint32 i = 0; i < PIXELS; i++)
+        errors += (plane_ref[i] != plane_vec[i]) ? 1 : 0;
+    ImgChannelExtract<vx_uint32, 3, PIXELS, PIXELS, VX_DF_IMAGE_RGBX>(rgb_ref, plane_ref);
+    ImgChannelExtract<vx_uint32, VEC_NUM, 3, PIXELS, PIXELS, VX_DF_IMAGE_RGBX>(rgb_ref, plane_vec);
+    for (vx_uint32 i = 0; i < PIXELS; i++)
+        errors += (plane_ref[i] != plane_vec[i]) ? 1 : 0;
+    ImgChannelExtract<vx_uint16, 1, PIXELS, PIXELS, VX_DF_IMAGE_U16>(u16_ref, plane_ref);
+    ImgChannelExtract<vx_uint16, VEC_NUM, 1, PIXELS, PIXELS, VX_DF_IMAGE_U16>(u16_ref, plane_vec);
+    for (vx_uint32 i = 0; i < PIXELS; i++)
+        errors += (plane_ref[i] != plane_vec[i]) ? 1 : 0;
+    printf(" Channel Extract (%d pixel/clock): %d mismatches\n", VEC_NUM, errors);
+
+    for (vx_uint32 i = 0; i < 4; i++)
+        delete[] plane[i];
+    delete[] plane_ref;
+    delete[] plane_vec;
+    delete[] rgb_ref;
+    delete[] rgb_vec;
+    delete[] u16_ref;
+    delete[] u16_vec;
+}
+
+/*! \brief Tests the vectorized Color Conversion, Channel Extract and Channel Combine Functions */
+void swTestColorConversionVector(void) {
+    const vx_uint32 PIXELS = 64 * 48;
+    printf("Vectorized color conversion:\n");
+    swTestColorConversionVectorCompare<vx_uint8, vx_uint32, 4, PIXELS, VX_DF_IMAGE_U8, VX_DF_IMAGE_RGB>("U8 -> RGB");
+    swTestColorConversionVectorCompare<vx_uint8, vx_uint32, 8, PIXELS, VX_DF_IMAGE_U8, VX_DF_IMAGE_RGBX>("U8 -> RGBX");
+    swTestColorConversionVectorCompare<vx_uint32, vx_uint8, 2, PIXELS, VX_DF_IMAGE_RGB, VX_DF_IMAGE_U8>("RGB -> U8");
+    swTestColorConversionVectorCompare<vx_uint32, vx_uint8, 8, PIXELS, VX_DF_IMAGE_RGB, VX_DF_IMAGE_U8>("RGB -> U8");
+    swTestColorConversionVectorCompare<vx_uint32, vx_uint32, 4, PIXELS, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX>(
+        "RGB -> RGBX");
+    swTestColorConversionVectorCompare<vx_uint32, vx_uint8, 4, PIXELS, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_U8>("RGBX -> U8");
+    swTestColorConversionVectorCompare<vx_uint32, vx_uint32, 8, PIXELS, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGB>(
+        "RGBX -> RGB");
+    printf("Vectorized channel functions:\n");
+    swTestChannelVectorCompare<2, PIXELS>();
+    swTestChannelVectorCompare<4, PIXELS>();
+    swTestChannelVectorCompare<8, PIXELS>();
+    printf("\n");
+}
+
+/*! \brief Tests the Color Conversion Function from YUV formats (compares against a floating point reference) */
+void swTestColorConversionYuv(void) {
+
+    const vx_uint16 WIDTH = 16;
+    const vx_uint16 HEIGHT = 8;
+    const vx_uint8 VEC_NUM = 2;
+    const vx_uint32 PIXELS = WIDTH * HEIGHT;
+    const vx_uint32 CHROMA_PIXELS = PIXELS / 4;
+
+    vx_uint8 luma[PIXELS];
+    vx_uint8 chroma_u[CHROMA_PIXELS];
+    vx_uint8 chroma_v[CHROMA_PIXELS];
+    vx_uint16 packed[PIXELS];
+    vx_uint16 chroma_uv[CHROMA_PIXELS];
+    vx_uint16 chroma_vu[CHROMA_PIXELS];
+    vx_uint32 dst_rgbx[PIXELS];
+    vx_uint32 dst_rgb[(3 * PIXELS) / 4];
+    vx_uint8 dst_gray[PIXELS];
+
+    // Create Input Data (same chroma for 4:2:2 and 4:2:0 to share the reference)
+    for (vx_uint32 i = 0; i < PIXELS; i++)
+        luma[i] = (vx_uint8)((i * 37 + 11) & 0xFF);
+    for (vx_uint32 i = 0; i < CHROMA_PIXELS; i++) {
+        chroma_u[i] = (vx_uint8)((i * 53 + 7) & 0xFF);
+        chroma_v[i] = (vx_uint8)((i * 91 + 200) & 0xFF);
+        chroma_uv[i] = (vx_uint16)(chroma_u[i] | (chroma_v[i] << 8));
+        chroma_vu[i] = (vx_uint16)(chroma_v[i] | (chroma_u[i] << 8));
+    }
+    for (vx_uint32 y = 0; y < HEIGHT; y++) {
+        for (vx_uint32 x = 0; x < WIDTH; x++) {
+            const vx_uint32 c = (y / 2) * (WIDTH / 2) + (x / 2);
+            const vx_uint8 chroma = ((x % 2) == 0) ? (chroma_u[c]) : (chroma_v[c]);
+            packed[y * WIDTH + x] = (vx_uint16)(luma[y * WIDTH + x] | (chroma << 8));
+        }
+    }
+
+    // Test all input formats
+    for (vx_uint32 k = 0; k < 4; k++) {
+
+        // Compute the color conversion
+        if (k == 0) {
+            printf("Color Conversion YUYV to RGBX/RGB/Grayscale:\n");
+            ImgConvertColorYuv<vx_uint32, VEC_NUM, WIDTH, HEIGHT, VX_DF_IMAGE_YUYV, VX_DF_IMAGE_RGBX>(packed, dst_rgbx);
+            ImgConvertColorYuv<vx_uint32, VEC_NUM, WIDTH, HEIGHT, VX_DF_IMAGE_YUYV, VX_DF_IMAGE_RGB>(packed, dst_rgb);
+            ImgConvertColorYuv<vx_uint8, VEC_NUM, WIDTH, HEIGHT, VX_DF_IMAGE_YUYV, VX_DF_IMAGE_U8>(packed, dst_gray);
+        }
+        if (k == 1) {
+            printf("Color Conversion NV12 to RGBX/RGB/Grayscale:\n");
+            ImgConvertColorYuv<vx_uint32, VEC_NUM, WIDTH, HEIGHT, VX_DF_IMAGE_NV12, VX_DF_IMAGE_RGBX>(luma, chroma_uv,
+                                                                                                      dst_rgbx);
+            ImgConvertColorYuv<vx_uint32, VEC_NUM, WIDTH, HEIGHT, VX_DF_IMAGE_NV12, VX_DF_IMAGE_RGB>(luma, chroma_uv,
+                                                                                                     dst_rgb);
+            ImgConvertColorYuv<vx_uint8, VEC_NUM, WIDTH, HEIGHT, VX_DF_IMAGE_NV12, VX_DF_IMAGE_U8>(luma, chroma_uv,
+                                                                                                   dst_gray);
+        }
+        if (k == 2) {
+            printf("Color Conversion NV21 to RGBX/RGB/Grayscale:\n");
+            ImgConvertColorYuv<vx_uint32, VEC_NUM, WIDTH, HEIGHT, VX_DF_IMAGE_NV21, VX_DF_IMAGE_RGBX>(luma, chroma_vu,
+                                                                                                      dst_rgbx);
+            ImgConvertColorYuv<vx_uint32, VEC_NUM, WIDTH, HEIGHT, VX_DF_IMAGE_NV21, VX_DF_IMAGE_RGB>(luma, chroma_vu,
+                                                                                                     dst_rgb);
+            ImgConvertColorYuv<vx_uint8, VEC_NUM, WIDTH, HEIGHT, VX_DF_IMAGE_NV21, VX_DF_IMAGE_U8>(luma, chroma_vu,
+                                                                                                   dst_gray);
+        }
+        if (k == 3) {
+            printf("Color Conversion IYUV to RGBX/RGB/Grayscale:\n");
+            ImgConvertColorYuv<vx_uint32, VEC_NUM, WIDTH, HEIGHT, VX_DF_IMAGE_IYUV, VX_DF_IMAGE_RGBX>(
+                luma, chroma_u, chroma_v, dst_rgbx);
+            ImgConvertColorYuv<vx_uint32, VEC_NUM, WIDTH, HEIGHT, VX_DF_IMAGE_IYUV, VX_DF_IMAGE_RGB>(
+                luma, chroma_u, chroma_v, dst_rgb);
+            ImgConvertColorYuv<vx_uint8, VEC_NUM, WIDTH, HEIGHT, VX_DF_IMAGE_IYUV, VX_DF_IMAGE_U8>(
+                luma, chroma_u, chroma_v, dst_gray);
+        }
+
+        // Compare against the BT.709 full range reference
+        vx_int32 max_error = 0;
+        vx_uint32 mismatch = 0;
+        const vx_uint8 *rgb_bytes = (const vx_uint8 *)dst_rgb;
+        for (vx_uint32 y = 0; y < HEIGHT; y++) {
+            for (vx_uint32 x = 0; x < WIDTH; x++) {
+                const vx_uint32 i = y * WIDTH + x;
+                const vx_uint32 c = (y / 2) * (WIDTH / 2) + (x / 2);
+                const vx_float32 Y = (vx_float32)luma[i];
+                const vx_float32 U = (vx_float32)chroma_u[c] - 128.0f;
+                const vx_float32 V = (vx_float32)chroma_v[c] - 128.0f;
+                const vx_float32 ref[3] = {Y + 1.5748f * V, Y - 0.1873f * U - 0.4681f * V, Y + 1.8556f * U};
+                for (vx_uint32 n = 0; n < 3; n++) {
+                    const vx_int32 expected = (vx_int32)MIN(MAX(ref[n] + 0.5f, 0.0f), 255.0f);
+                    const vx_int32 rgbx = (vx_int32)((dst_rgbx[i] >> (8 * n)) & 0xFF);
+                    const vx_int32 rgb = (vx_int32)rgb_bytes[3 * i + n];
+                    max_error = MAX(max_error, MAX(ABS((rgbx - expected)), ABS((rgb - expected))));
+                }
+                if (dst_gray[i] != luma[i])
+                    mismatch++;
+            }
+        }
+        printf(" Maximum RGB error: %d\n", max_error);
+        printf(" Grayscale mismatches: %d\n\n", mismatch);
+    }
+}
+
+/*! \brief Floating point reference of the color space conversion from sRGB (8-bit encoding as in ColorSpace) */
+void swTestColorSpaceReference(HIFLIPVX::ColorSpace color_space, const vx_uint8 rgb[3], vx_float32 result[3]) {
+    const vx_float32 r = rgb[0], g = rgb[1], b = rgb[2];
+    if (color_space == HIFLIPVX::COLOR_SPACE_HSV) {
+        const vx_float32 max = MAX(MAX(r, g), b), min = MIN(MIN(r, g), b), delta = max - min;
+        vx_float32 hue = 0.0f;
+        if (delta > 0.0f) {
+            if (max == r)
+                hue = (g - b) / delta;
+            else if (max == g)
+                hue = 2.0f + (b - r) / delta;
+            else
+                hue = 4.0f + (r - g) / delta;
+            if (hue < 0.0f)
+                hue += 6.0f;
+        }
+        result[0] = hue * 256.0f / 6.0f;
+        result[1] = (max > 0.0f) ? (255.0f * delta / max) : (0.0f);
+        result[2] = max;
+    } else if (color_space == HIFLIPVX::COLOR_SPACE_LAB) {
+        vx_float32 lin[3];
+        for (vx_uint32 i = 0; i < 3; i++) {
+            const vx_float32 c = rgb[i] / 255.0f;
+            lin[i] = (c <= 0.04045f) ? (c / 12.92f) : (powf((c + 0.055f) / 1.055f, 2.4f));
+        }
+        const vx_float32 x = (0.412453f * lin[0] + 0.357580f * lin[1] + 0.180423f * lin[2]) / 0.950456f;
+        const vx_float32 y = (0.212671f * lin[0] + 0.715160f * lin[1] + 0.072169f * lin[2]);
+        const vx_float32 z = (0.019334f * lin[0] + 0.119193f * lin[1] + 0.950227f * lin[2]) / 1.088754f;
+        const vx_float32 t[3] = {x, y, z};
+        vx_float32 f[3];
+        for (vx_uint32 i = 0; i < 3; i++)
+            f[i] = (t[i] > 0.008856f) ? (cbrtf(t[i])) : (7.787f * t[i] + 16.0f / 116.0f);
+        result[0] = (116.0f * f[1] - 16.0f) * 255.0f / 100.0f;
+        result[1] = 500.0f * (f[0] - f[1]) + 128.0f;
+        result[2] = 200.0f * (f[1] - f[2]) + 128.0f;
+    } else {
+        const bool bt709 = (color_space == HIFLIPVX::COLOR_SPACE_YCBCR_BT709);
+        const vx_float32 kr = (bt709) ? (0.2126f) : (0.299f), kb = (bt709) ? (0.0722f) : (0.114f);
+        const vx_float32 y = kr * r + (1.0f - kr - kb) * g + kb * b;
+        result[0] = y;
+        result[1] = (b - y) / (2.0f * (1.0f - kb)) + 128.0f;
+        result[2] = (r - y) / (2.0f * (1.0f - kr)) + 128.0f;
+    }
+    for (vx_uint32 i = 0; i < 3; i++)
+        result[i] = MIN(MAX(result[i], 0.0f), 255.0f);
+}
+
+/*! \brief Compares the vectorized color space conversion against a floating point reference and its inverse */
+template <vx_uint8 VEC_NUM, vx_uint32 PIXELS, HIFLIPVX::ColorSpace COLOR_SPACE>
+void swTestColorSpaceCompare(const char *name) {
+    const vx_uint32 RGB_PIXELS = PIXELS * 3 / 4;
+
+    vx_uint32 *src = new vx_uint32[PIXELS];
+    vx_uint32 *src_rgb = new vx_uint32[RGB_PIXELS];
+    vx_uint32 *dst = new vx_uint32[PIXELS];
+    vx_uint32 *dst_rgb = new vx_uint32[PIXELS];
+    vx_uint32 *back = new vx_uint32[PIXELS];
+    for (vx_uint32 i = 0; i < PIXELS; i++)
+        src[i] = (vx_uint32)(((vx_uint32)rand() << 16) ^ (vx_uint32)rand()) & 0x00FFFFFF;
+
+    // Forward conversion from RGBX and from packed RGB
+    ImgRgbToColorSpace<VEC_NUM, PIXELS, PIXELS, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGBX, COLOR_SPACE>(src, dst);
+    ImgConvertColor<vx_uint32, vx_uint32, VEC_NUM, PIXELS, RGB_PIXELS, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGB>(src,
+                                                                                                          src_rgb);
+    ImgRgbToColorSpace<VEC_NUM, RGB_PIXELS, PIXELS, VX_DF_IMAGE_RGB, VX_DF_IMAGE_RGBX, COLOR_SPACE>(src_rgb, dst_rgb);
+
+    // Inverse conversion
+    ImgColorSpaceToRgb<VEC_NUM, PIXELS, PIXELS, VX_DF_IMAGE_RGBX, VX_DF_IMAGE_RGBX, COLOR_SPACE>(dst, back);
+
+    vx_uint32 mismatches = 0;
+    vx_float32 max_error = 0.0f;
+    vx_int32 max_round_trip = 0;
+    for (vx_uint32 i = 0; i < PIXELS; i++) {
+        vx_uint8 rgb[3];
+        vx_float32 ref[3];
+        for (vx_uint32 j = 0; j < 3; j++)
+            rgb[j] = (vx_uint8)(src[i] >> (8 * j));
+        swTestColorSpaceReference(COLOR_SPACE, rgb, ref);
+        mismatches += (dst[i] != dst_rgb[i]) ? 1 : 0;
+        for (vx_uint32 j = 0; j < 3; j++) {
+            vx_float32 error = fabsf((vx_float32)((dst[i] >> (8 * j)) & 0xFF) - ref[j]);
+            if ((COLOR_SPACE == HIFLIPVX::COLOR_SPACE_HSV) && (j == 0))
+                error = MIN(error, 256.0f - error);
+            max_error = MAX(max_error, error);
+            const vx_int32 diff = (vx_int32)((back[i] >> (8 * j)) & 0xFF) - (vx_int32)rgb[j];
+            max_round_trip = MAX(max_round_trip, ABS(diff));
+        }
+    }
+    printf(" %-12s (%d pixel/clock): max error %.2f, round trip max error %d, RGB/RGBX mismatches %d\n", name,
+           VEC_NUM, max_error, max_round_trip, mismatches);
+
+    delete[] src;
+    delete[] src_rgb;
+    delete[] dst;
+    delete[] dst_rgb;
+    delete[] back;
+}
+
+/*! \brief Tests the Color Space Conversions (HSV, YCbCr, Lab) against a floating point reference */
+void swTestColorSpace(void) {
+    const vx_uint32 PIXELS = 64 * 48;
+    printf("Color space conversion:\n");
+    swTestColorSpaceCompare<1, PIXELS, HIFLIPVX::COLOR_SPACE_HSV>("HSV");
+    swTestColorSpaceCompare<4, PIXELS, HIFLIPVX::COLOR_SPACE_YCBCR_BT601>("YCbCr BT.601");
+    swTestColorSpaceCompare<2, PIXELS, HIFLIPVX::COLOR_SPACE_YCBCR_BT709>("YCbCr BT.709");
+    swTestColorSpaceCompare<8, PIXELS, HIFLIPVX::COLOR_SPACE_LAB>("Lab");
+    printf("\n");
+}
+
+/*! \brief Tests the Bayer Demosaicing Function (flat color image and comparison against a floating point reference) */
+void swTestDemosaic(void) {
+
+    const vx_uint16 WIDTH = 32;
+    const vx_uint16 HEIGHT = 16;
+    const vx_uint8 VEC_NUM = 4;
+    const vx_uint32 PIXELS = WIDTH * HEIGHT;
+    const vx_uint8 COLOR[3] = {200, 100, 50};
+
+    // Malvar-He-Cutler kernels (x8): green at red/blue, red/blue at blue/red, same row, same column
+    const vx_float32 KERNEL[4][5][5] = {
+        {{0, 0, -1, 0, 0}, {0, 0, 2, 0, 0}, {-1, 2, 4, 2, -1}, {0, 0, 2, 0, 0}, {0, 0, -1, 0, 0}},
+        {{0, 0, -1.5f, 0, 0}, {0, 2, 0, 2, 0}, {-1.5f, 0, 6, 0, -1.5f}, {0, 2, 0, 2, 0}, {0, 0, -1.5f, 0, 0}},
+        {{0, 0, 0.5f, 0, 0}, {0, -1, 0, -1, 0}, {-1, 4, 5, 4, -1}, {0, -1, 0, -1, 0}, {0, 0, 0.5f, 0, 0}},
+        {{0, 0, -1, 0, 0}, {0, -1, 4, -1, 0}, {0.5f, 0, 5, 0, 0.5f}, {0, -1, 4, -1, 0}, {0, 0, -1, 0, 0}}};
+
+    vx_uint8 raw_flat[PIXELS];
+    vx_uint8 raw_random[PIXELS];
+    vx_uint32 dst_rgbx[PIXELS];
+    vx_uint32 dst_rgb[(3 * PIXELS) / 4];
+    vx_uint8 dst_gray[PIXELS];
+
+    // Create Input Data (RGGB)
+    for (vx_uint32 y = 0; y < HEIGHT; y++) {
+        for (vx_uint32 x = 0; x < WIDTH; x++) {
+            const vx_uint32 site = (y % 2) * 2 + (x % 2);
+            raw_flat[y * WIDTH + x] = (site == 0) ? (COLOR[0]) : ((site == 3) ? (COLOR[2]) : (COLOR[1]));
+            raw_random[y * WIDTH + x] = (vx_uint8)(rand() % 256);
+        }
+    }
+
+    // A flat color must be reconstructed exactly (inside the 2 pixel border)
+    for (vx_uint32 k = 0; k < 2; k++) {
+        if (k == 0) {
+            printf("Bayer Demosaicing (bilinear) of a flat color:\n");
+            ImgDemosaic<vx_uint32, VEC_NUM, WIDTH, HEIGHT, HIFLIPVX::BAYER_RGGB, HIFLIPVX::DEMOSAIC_BILINEAR,
+                        VX_DF_IMAGE_RGBX>(raw_flat, dst_rgbx);
+        } else {
+            printf("Bayer Demosaicing (Malvar-He-Cutler) of a flat color:\n");
+            ImgDemosaic<vx_uint32, VEC_NUM, WIDTH, HEIGHT, HIFLIPVX::BAYER_RGGB, HIFLIPVX::DEMOSAIC_MALVAR_HE_CUTLER,
+                        VX_DF_IMAGE_RGBX>(raw_flat, dst_rgbx);
+        }
+        vx_uint32 mismatch = 0;
+        for (vx_uint32 y = 2; y < HEIGHT - 2; y++) {
+            for (vx_uint32 x = 2; x < WIDTH - 2; x++) {
+                for (vx_uint32 n = 0; n < 3; n++) {
+                    if (((dst_rgbx[y * WIDTH + x] >> (8 * n)) & 0xFF) != COLOR[n])
+                        mismatch++;
+                }
+            }
+        }
+        printf(" Mismatches: %d\n", mismatch);
+    }
+
+    // Compare a random image against the Malvar-He-Cutler reference (replicated border)
+    printf("Bayer Demosaicing (Malvar-He-Cutler) to RGBX/RGB/Grayscale of a random image:\n");
+    ImgDemosaic<vx_uint32, VEC_NUM, WIDTH, HEIGHT, HIFLIPVX::BAYER_RGGB, HIFLIPVX::DEMOSAIC_MALVAR_HE_CUTLER,
+                VX_DF_IMAGE_RGBX>(raw_random, dst_rgbx);
+    ImgDemosaic<vx_uint32, VEC_NUM, WIDTH, HEIGHT, HIFLIPVX::BAYER_RGGB, HIFLIPVX::DEMOSAIC_MALVAR_HE_CUTLER,
+                VX_DF_IMAGE_RGB>(raw_random, dst_rgb);
+    ImgDemosaic<vx_uint8, VEC_NUM, WIDTH, HEIGHT, HIFLIPVX::BAYER_RGGB, HIFLIPVX::DEMOSAIC_MALVAR_HE_CUTLER,
+                VX_DF_IMAGE_U8>(raw_random, dst_gray);
+    vx_int32 max_error = 0;
+    vx_uint32 mismatch = 0;
+    const vx_uint8 *rgb_bytes = (const vx_uint8 *)dst_rgb;
+    for (vx_int32 y = 0; y < HEIGHT; y++) {
+        for (vx_int32 x = 0; x < WIDTH; x++) {
+            const vx_int32 site = (y % 2) * 2 + (x % 2);
+            vx_float32 sum[4] = {0, 0, 0, 0};
+            for (vx_int32 k = 0; k < 4; k++) {
+                for (vx_int32 i = -2; i <= 2; i++) {
+                    for (vx_int32 j = -2; j <= 2; j++) {
+                        const vx_int32 row = MIN(MAX(y + i, 0), HEIGHT - 1);
+                        const vx_int32 col = MIN(MAX(x + j, 0), WIDTH - 1);
+                        sum[k] += KERNEL[k][i + 2][j + 2] * raw_random[row * WIDTH + col] / 8.0f;
+                    }
+                }
+            }
+            const vx_float32 center = raw_random[y * WIDTH + x];
+            vx_float32 rgb[3];
+            if (site == 0) {
+                rgb[0] = center, rgb[1] = sum[0], rgb[2] = sum[1];
+            } else if (site == 1) {
+                rgb[0] = sum[2], rgb[1] = center, rgb[2] = sum[3];
+            } else if (site == 2) {
+                rgb[0] = sum[3], rgb[1] = center, rgb[2] = sum[2];
+            } else {
+                rgb[0] = sum[1], rgb[1] = sum[0], rgb[2] = center;
+            }
+            vx_uint8 expected[3];
+            for (vx_int32 n = 0; n < 3; n++) {
+                expected[n] = (vx_uint8)MIN(MAX(rgb[n] + 0.5f, 0.0f), 255.0f);
+                const vx_int32 rgbx = (vx_int32)((dst_rgbx[y * WIDTH + x] >> (8 * n)) & 0xFF);
+                const vx_int32 packed = (vx_int32)rgb_bytes[3 * (y * WIDTH + x) + n];
+                max_error = MAX(max_error, MAX(ABS((rgbx - expected[n])), ABS((packed - expected[n]))));
+            }
+            if (dst_gray[y * WIDTH + x] != OutputGray<vx_uint8>(expected))
+                mismatch++;
+        }
+    }
+    printf(" Maximum RGB error: %d\n", max_error);
+    printf(" Grayscale mismatches: %d\n\n", mismatch);
+}
+
+/*! \brief Converts a stream between two vector sizes and prints the pixels that differ from the input (padding is 0) */
+template <vx_int64 SRC_PARALLEL, vx_int64 DST_PARALLEL, vx_int64 PIXELS, vx_int64 BATCHES, vx_int64 DST_PIXELS = PIXELS>
+void swTestDataWidthConverterCompare(void) {
+
+    vx_uint8 *input = new vx_uint8[BATCHES * PIXELS];
+    vx_uint8 *output = new vx_uint8[BATCHES * DST_PIXELS];
+    for (vx_int64 i = 0; i < BATCHES * PIXELS; i++)
+        input[i] = (vx_uint8)(rand() % 255 + 1);
+
+    ImgDataWidthConverter<vx_uint8, BATCHES, PIXELS, DST_PIXELS, SRC_PARALLEL, DST_PARALLEL>(
+        (vx_image_data<vx_uint8, SRC_PARALLEL> *)input, (vx_image_data<vx_uint8, DST_PARALLEL> *)output);
+
+    vx_uint32 errors = 0;
+    for (vx_int64 b = 0; b < BATCHES; b++) {
+        for (vx_int64 i = 0; i < DST_PIXELS; i++) {
+            const vx_uint8 expected = (i < PIXELS) ? (input[b * PIXELS + i]) : (0);
+            errors += (output[b * DST_PIXELS + i] != expected) ? 1 : 0;
+        }
+    }
+    printf(" %d -> %d (%d -> %d pixels, %d batches): %d errors\n", (vx_int32)SRC_PARALLEL, (vx_int32)DST_PARALLEL,
+           (vx_int32)PIXELS, (vx_int32)DST_PIXELS, (vx_int32)BATCHES, errors);
+
+    delete[] input;
+    delete[] output;
+}
+
+/*! \brief Tests the Data Width Converter for multiple and non-multiple vector sizes */
+void swTestDataWidthConverter(void) {
+    printf("Data width converter:\n");
+    swTestDataWidthConverterCompare<1, 4, 1920, 1>();
+    swTestDataWidthConverterCompare<8, 2, 1920, 2>();
+    swTestDataWidthConverterCompare<3, 4, 1920, 1>();
+    swTestDataWidthConverterCompare<4, 3, 1920, 2>();
+    swTestDataWidthConverterCompare<6, 8, 1920, 1>();
+    swTestDataWidthConverterCompare<8, 6, 1920, 2>();
+    swTestDataWidthConverterCompare<5, 2, 1920, 1>();
+    swTestDataWidthConverterCompare<2, 5, 1920, 3>();
+    swTestDataWidthConverterCompare<3, 4, 1920, 3, 1936>();
+    swTestDataWidthConverterCompare<4, 3, 1920, 2, 1911>();
+    swTestDataWidthConverterCompare<5, 2, 1920, 3, 1934>();
+    printf("\n");
+}
+
 /*! \brief Tests the Scale Down Function */
 void swTestScaleDown(void) {
 
@@ -236,6 +749,321 @@ void swTestScaleDown(void) {
     }
 }
 
+/*! \brief Compares the vectorized scale function against a floating point reference and prints the maximum error */
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint16 SRC_COLS, vx_uint16 SRC_ROWS, vx_uint16 DST_COLS,
+          vx_uint16 DST_ROWS, vx_interpolation_type_e SCALE_TYPE>
+void swTestScaleImageVectorCompare(void) {
+
+    DataType *in_array = new DataType[SRC_COLS * SRC_ROWS];
+    DataType *out_array = new DataType[DST_COLS * DST_ROWS];
+    const vx_uint32 max_value = (vx_uint32)std::numeric_limits<DataType>::max();
+
+    // Create Input Data
+    for (vx_uint32 i = 0; i < SRC_COLS * SRC_ROWS; i++)
+        in_array[i] = (DataType)(rand() % (max_value + 1));
+
+    // Scale Image
+    ImgScaleImage<DataType, VEC_NUM, SRC_COLS, SRC_ROWS, DST_COLS, DST_ROWS, SCALE_TYPE>(in_array, out_array);
+
+    // Compare against the reference
+    const vx_float64 scale_x = (vx_float64)SRC_COLS / (vx_float64)DST_COLS;
+    const vx_float64 scale_y = (vx_float64)SRC_ROWS / (vx_float64)DST_ROWS;
+    vx_float64 max_error = 0;
+    for (vx_uint32 y = 0; y < DST_ROWS; y++) {
+        for (vx_uint32 x = 0; x < DST_COLS; x++) {
+            vx_float64 expected = 0;
+            if (SCALE_TYPE == VX_INTERPOLATION_NEAREST_NEIGHBOR) {
+                vx_int32 x_src = MIN((vx_int32)floor((x + 0.5) * scale_x), SRC_COLS - 1);
+                vx_int32 y_src = MIN((vx_int32)floor((y + 0.5) * scale_y), SRC_ROWS - 1);
+                expected = in_array[y_src * SRC_COLS + x_src];
+            } else {
+                vx_float64 x_src = MAX((x + 0.5) * scale_x - 0.5, 0.0);
+                vx_float64 y_src = MAX((y + 0.5) * scale_y - 0.5, 0.0);
+                vx_int32 x_lo = MIN((vx_int32)floor(x_src), SRC_COLS - 1);
+                vx_int32 y_lo = MIN((vx_int32)floor(y_src), SRC_ROWS - 1);
+                vx_int32 x_hi = MIN(x_lo + 1, SRC_COLS - 1);
+                vx_int32 y_hi = MIN(y_lo + 1, SRC_ROWS - 1);
+                vx_float64 x_weight = MIN(x_src - x_lo, 1.0);
+                vx_float64 y_weight = MIN(y_src - y_lo, 1.0);
+                vx_float64 top = in_array[y_lo * SRC_COLS + x_lo] * (1 - x_weight) +
+                                 in_array[y_lo * SRC_COLS + x_hi] * x_weight;
+                vx_float64 bottom = in_array[y_hi * SRC_COLS + x_lo] * (1 - x_weight) +
+                                    in_array[y_hi * SRC_COLS + x_hi] * x_weight;
+                expected = top * (1 - y_weight) + bottom * y_weight;
+            }
+            max_error = MAX(max_error, fabs(expected - (vx_float64)out_array[y * DST_COLS + x]));
+        }
+    }
+    printf(" %4d x %4d -> %4d x %4d (%d bit, %d pixel/clock): maximum error %f\n", SRC_COLS, SRC_ROWS, DST_COLS,
+           DST_ROWS, (vx_int32)(8 * sizeof(DataType)), VEC_NUM, max_error);
+
+    delete[] in_array;
+    delete[] out_array;
+}
+
+/*! \brief Tests the vectorized Scale Function (down- and upscaling by arbitrary ratios) */
+void swTestScaleImageVector(void) {
+    printf("Scale vectorized image using Bilinear Interpolation:\n");
+    swTestScaleImageVectorCompare<vx_uint8, 1, 64, 48, 40, 30, VX_INTERPOLATION_BILINEAR>();
+    swTestScaleImageVectorCompare<vx_uint8, 4, 64, 48, 40, 30, VX_INTERPOLATION_BILINEAR>();
+    swTestScaleImageVectorCompare<vx_uint8, 8, 64, 48, 16, 12, VX_INTERPOLATION_BILINEAR>();
+    swTestScaleImageVectorCompare<vx_uint8, 4, 64, 48, 100, 75, VX_INTERPOLATION_BILINEAR>();
+    swTestScaleImageVectorCompare<vx_uint8, 8, 24, 16, 200, 120, VX_INTERPOLATION_BILINEAR>();
+    swTestScaleImageVectorCompare<vx_uint16, 2, 64, 48, 96, 30, VX_INTERPOLATION_BILINEAR>();
+    swTestScaleImageVectorCompare<vx_uint16, 8, 64, 48, 40, 64, VX_INTERPOLATION_BILINEAR>();
+    swTestScaleImageVectorCompare<vx_uint16, 4, 64, 48, 64, 48, VX_INTERPOLATION_BILINEAR>();
+    printf("Scale vectorized image using Nearest Neighbor Interpolation:\n");
+    swTestScaleImageVectorCompare<vx_uint8, 4, 64, 48, 40, 30, VX_INTERPOLATION_NEAREST_NEIGHBOR>();
+    swTestScaleImageVectorCompare<vx_uint16, 8, 64, 48, 96, 72, VX_INTERPOLATION_NEAREST_NEIGHBOR>();
+    printf("\n");
+}
+
+/*! \brief Tests the Gaussian Pyramid Function against a level by level reference */
+void swTestPyramid(void) {
+
+    const vx_uint16 WIDTH = 64;
+    const vx_uint16 HEIGHT = 48;
+    const vx_int32 KERNEL[5] = {1, 4, 6, 4, 1};
+
+    vx_uint8 *in_array = new vx_uint8[WIDTH * HEIGHT];
+    vx_uint8 *level[4];
+    vx_uint8 *reference = new vx_uint8[WIDTH * HEIGHT];
+    for (vx_uint32 l = 0; l < 4; l++)
+        level[l] = new vx_uint8[(WIDTH >> l) * (HEIGHT >> l)];
+
+    // Create Input Data
+    for (vx_uint32 i = 0; i < WIDTH * HEIGHT; i++)
+        in_array[i] = (vx_uint8)(rand() % 256);
+
+    // Compute the pyramid
+    printf("Gaussian Pyramid with 4 levels:\n");
+    ImgPyramid<vx_uint8, WIDTH, HEIGHT>(in_array, level[0], level[1], level[2], level[3]);
+
+    // Compare each level against the Gaussian and downscaled previous level of the reference
+    for (vx_uint32 i = 0; i < WIDTH * HEIGHT; i++)
+        reference[i] = in_array[i];
+    for (vx_int32 l = 0; l < 4; l++) {
+        const vx_int32 cols = WIDTH >> l;
+        const vx_int32 rows = HEIGHT >> l;
+        vx_uint32 mismatch = 0;
+        if (l > 0) {
+            vx_uint8 *previous = new vx_uint8[(cols * 2) * (rows * 2)];
+            for (vx_int32 i = 0; i < (cols * 2) * (rows * 2); i++)
+                previous[i] = reference[i];
+            for (vx_int32 y = 0; y < rows; y++) {
+                for (vx_int32 x = 0; x < cols; x++) {
+                    vx_int32 sum = 0;
+                    for (vx_int32 i = -2; i <= 2; i++) {
+                        for (vx_int32 j = -2; j <= 2; j++) {
+                            vx_int32 row = MIN(MAX(2 * y + i, 0), 2 * rows - 1);
+                            vx_int32 col = MIN(MAX(2 * x + j, 0), 2 * cols - 1);
+                            sum += KERNEL[i + 2] * KERNEL[j + 2] * previous[row * (2 * cols) + col];
+                        }
+                    }
+                    reference[y * cols + x] = (vx_uint8)((sum + 128) >> 8);
+                }
+            }
+            delete[] previous;
+        }
+        for (vx_int32 i = 0; i < cols * rows; i++) {
+            if (reference[i] != level[l][i])
+                mismatch++;
+        }
+        printf(" Level %d (%3d x %3d): %d mismatches\n", l, cols, rows, mismatch);
+    }
+    printf("\n");
+
+    delete[] in_array;
+    delete[] reference;
+    for (vx_uint32 l = 0; l < 4; l++)
+        delete[] level[l];
+}
+
+/*! \brief Tests the Warp Affine and Warp Perspective Functions against a floating point reference */
+void swTestWarp(void) {
+
+    const vx_uint16 WIDTH = 64;
+    const vx_uint16 HEIGHT = 48;
+    const vx_uint16 MAX_DISPLACEMENT = 6;
+    const vx_uint32 PIXELS = WIDTH * HEIGHT;
+    const vx_float32 ANGLE = 0.08f;
+
+    // Rotation around the image center, pure translation and a mild perspective distortion
+    const vx_float32 cx = WIDTH / 2.0f, cy = HEIGHT / 2.0f, c = cosf(ANGLE), s = sinf(ANGLE);
+    const vx_float32 rotation[6] = {c, -s, s, c, cx - c * cx - s * cy, cy + s * cx - c * cy};
+    const vx_float32 translation[6] = {1, 0, 0, 1, -3, 2};
+    const vx_float32 perspective[9] = {1.02f, 0.01f, 0.0002f, -0.02f, 0.98f, 0.0001f, 1.5f, -0.5f, 1.0f};
+
+    vx_uint8 *input = new vx_uint8[PIXELS];
+    vx_uint8 *output = new vx_uint8[PIXELS];
+    vx_uint8 *cpu = new vx_uint8[PIXELS];
+    for (vx_uint32 y = 0; y < HEIGHT; y++) {
+        for (vx_uint32 x = 0; x < WIDTH; x++)
+            input[y * WIDTH + x] = (vx_uint8)(x * 2 + y * 2 + (rand() % 16));
+    }
+
+    for (vx_uint32 test = 0; test < 4; test++) {
+        const vx_float32 *matrix = (test == 0) ? (rotation) : ((test == 1) ? (translation) : (perspective));
+        const bool is_perspective = (test >= 2);
+        const bool is_nearest = (test == 1) || (test == 3);
+        if (test == 0) {
+            printf("Warp Affine (rotation, bilinear):\n");
+            ImgWarpAffine<vx_uint8, WIDTH, HEIGHT, MAX_DISPLACEMENT, VX_INTERPOLATION_BILINEAR>(input, output, matrix);
+            CpuWarpAffine<vx_uint8, WIDTH, HEIGHT, MAX_DISPLACEMENT, VX_INTERPOLATION_BILINEAR>(input, cpu, matrix);
+        } else if (test == 1) {
+            printf("Warp Affine (translation, nearest neighbor):\n");
+            ImgWarpAffine<vx_uint8, WIDTH, HEIGHT, MAX_DISPLACEMENT, VX_INTERPOLATION_NEAREST_NEIGHBOR>(input, output,
+                                                                                                       matrix);
+            CpuWarpAffine<vx_uint8, WIDTH, HEIGHT, MAX_DISPLACEMENT, VX_INTERPOLATION_NEAREST_NEIGHBOR>(input, cpu,
+                                                                                                       matrix);
+        } else if (test == 2) {
+            printf("Warp Perspective (bilinear):\n");
+            ImgWarpPerspective<vx_uint8, WIDTH, HEIGHT, MAX_DISPLACEMENT, VX_INTERPOLATION_BILINEAR>(input, output,
+                                                                                                     matrix);
+            CpuWarpPerspective<vx_uint8, WIDTH, HEIGHT, MAX_DISPLACEMENT, VX_INTERPOLATION_BILINEAR>(input, cpu,
+                                                                                                     matrix);
+        } else {
+            printf("Warp Perspective (nearest neighbor):\n");
+            ImgWarpPerspective<vx_uint8, WIDTH, HEIGHT, MAX_DISPLACEMENT, VX_INTERPOLATION_NEAREST_NEIGHBOR>(
+                input, output, matrix);
+            CpuWarpPerspective<vx_uint8, WIDTH, HEIGHT, MAX_DISPLACEMENT, VX_INTERPOLATION_NEAREST_NEIGHBOR>(
+                input, cpu, matrix);
+        }
+
+        // Compare against the reference (nearest neighbor skips samples close to a rounding decision)
+        vx_int32 max_error = 0;
+        vx_uint32 cpu_mismatches = 0;
+        for (vx_int32 y = 0; y < HEIGHT; y++) {
+            for (vx_int32 x = 0; x < WIDTH; x++) {
+                if (cpu[y * WIDTH + x] != output[y * WIDTH + x])
+                    cpu_mismatches++;
+                vx_float64 sx, sy;
+                if (is_perspective) {
+                    const vx_float64 sz = matrix[2] * x + matrix[5] * y + matrix[8];
+                    sx = (matrix[0] * x + matrix[3] * y + matrix[6]) / sz;
+                    sy = (matrix[1] * x + matrix[4] * y + matrix[7]) / sz;
+                } else {
+                    sx = matrix[0] * x + matrix[2] * y + matrix[4];
+                    sy = matrix[1] * x + matrix[3] * y + matrix[5];
+                }
+                if (is_nearest) {
+                    if ((fabs(sx - floor(sx) - 0.5) < 0.01) || (fabs(sy - floor(sy) - 0.5) < 0.01))
+                        continue;
+                    sx = floor(sx + 0.5);
+                    sy = floor(sy + 0.5);
+                }
+                const vx_int32 x0 = (vx_int32)floor(sx), y0 = (vx_int32)floor(sy);
+                const vx_float64 fx = sx - x0, fy = sy - y0;
+                vx_float64 value = 0.0;
+                for (vx_int32 j = 0; j < 2; j++) {
+                    for (vx_int32 k = 0; k < 2; k++) {
+                        const vx_int32 row = y0 + j, col = x0 + k;
+                        if (row < 0 || row >= HEIGHT || col < 0 || col >= WIDTH)
+                            continue;
+                        const vx_float64 weight = (k ? fx : 1.0 - fx) * (j ? fy : 1.0 - fy);
+                        value += weight * input[row * WIDTH + col];
+                    }
+                }
+                max_error = MAX(max_error, ABS(((vx_int32)(value + 0.5) - (vx_int32)output[y * WIDTH + x])));
+            }
+        }
+        printf(" Maximum error: %d, CPU mismatches: %u\n", max_error, cpu_mismatches);
+    }
+    printf("\n");
+
+    delete[] input;
+    delete[] output;
+    delete[] cpu;
+}
+
+/*! \brief Tests the Remap Function with a lens distortion grid against a floating point reference */
+void swTestRemap(void) {
+
+    const vx_uint16 WIDTH = 64;
+    const vx_uint16 HEIGHT = 48;
+    const vx_uint8 GRID_BITS = 4;
+    const vx_uint16 MAX_DISPLACEMENT = 4;
+    const vx_int32 GRID = 1 << GRID_BITS;
+    const vx_int32 GRID_COLS = WIDTH / GRID + 1;
+    const vx_int32 GRID_ROWS = HEIGHT / GRID + 1;
+    const vx_uint32 PIXELS = WIDTH * HEIGHT;
+    const vx_float64 K1 = 0.08;
+
+    vx_uint8 *input = new vx_uint8[PIXELS];
+    vx_uint8 *output = new vx_uint8[PIXELS];
+    vx_int16 *map = new vx_int16[2 * GRID_COLS * GRID_ROWS];
+    for (vx_uint32 y = 0; y < HEIGHT; y++) {
+        for (vx_uint32 x = 0; x < WIDTH; x++)
+            input[y * WIDTH + x] = (vx_uint8)(x * 2 + y * 2 + (rand() % 16));
+    }
+
+    // Radial (barrel) distortion around the image center in 12.4 fixed point
+    for (vx_int32 i = 0; i < GRID_ROWS; i++) {
+        for (vx_int32 j = 0; j < GRID_COLS; j++) {
+            const vx_float64 nx = (j * GRID - WIDTH / 2.0) / (WIDTH / 2.0);
+            const vx_float64 ny = (i * GRID - HEIGHT / 2.0) / (WIDTH / 2.0);
+            const vx_float64 r2 = nx * nx + ny * ny;
+            map[2 * (i * GRID_COLS + j) + 0] = (vx_int16)floor(K1 * r2 * (j * GRID - WIDTH / 2.0) * 16.0 + 0.5);
+            map[2 * (i * GRID_COLS + j) + 1] = (vx_int16)floor(K1 * r2 * (i * GRID - HEIGHT / 2.0) * 16.0 + 0.5);
+        }
+    }
+
+    for (vx_uint32 test = 0; test < 2; test++) {
+        if (test == 0) {
+            printf("Remap (lens distortion, bilinear):\n");
+            ImgRemap<vx_uint8, WIDTH, HEIGHT, GRID_BITS, MAX_DISPLACEMENT, VX_INTERPOLATION_BILINEAR>(input, map,
+                                                                                                    output);
+        } else {
+            printf("Remap (lens distortion, nearest neighbor):\n");
+            ImgRemap<vx_uint8, WIDTH, HEIGHT, GRID_BITS, MAX_DISPLACEMENT, VX_INTERPOLATION_NEAREST_NEIGHBOR>(
+                input, map, output);
+        }
+
+        // Compare against the reference (nearest neighbor skips samples close to a rounding decision)
+        vx_int32 max_error = 0;
+        for (vx_int32 y = 0; y < HEIGHT; y++) {
+            for (vx_int32 x = 0; x < WIDTH; x++) {
+                const vx_int32 i = y / GRID, j = x / GRID;
+                const vx_float64 u = (x % GRID) / (vx_float64)GRID, v = (y % GRID) / (vx_float64)GRID;
+                vx_float64 d[2];
+                for (vx_int32 n = 0; n < 2; n++) {
+                    const vx_float64 top = (1 - u) * map[2 * (i * GRID_COLS + j) + n] +
+                                           u * map[2 * (i * GRID_COLS + j + 1) + n];
+                    const vx_float64 bottom = (1 - u) * map[2 * ((i + 1) * GRID_COLS + j) + n] +
+                                              u * map[2 * ((i + 1) * GRID_COLS + j + 1) + n];
+                    d[n] = ((1 - v) * top + v * bottom) / 16.0;
+                }
+                vx_float64 sx = x + d[0], sy = y + d[1];
+                if (test == 1) {
+                    if ((fabs(sx - floor(sx) - 0.5) < 0.01) || (fabs(sy - floor(sy) - 0.5) < 0.01))
+                        continue;
+                    sx = floor(sx + 0.5);
+                    sy = floor(sy + 0.5);
+                }
+                const vx_int32 x0 = (vx_int32)floor(sx), y0 = (vx_int32)floor(sy);
+                const vx_float64 fx = sx - x0, fy = sy - y0;
+                vx_float64 value = 0.0;
+                for (vx_int32 k = 0; k < 2; k++) {
+                    for (vx_int32 l = 0; l < 2; l++) {
+                        const vx_int32 row = y0 + k, col = x0 + l;
+                        if (row < 0 || row >= HEIGHT || col < 0 || col >= WIDTH)
+                            continue;
+                        value += (l ? fx : 1.0 - fx) * (k ? fy : 1.0 - fy) * input[row * WIDTH + col];
+                    }
+                }
+                max_error = MAX(max_error, ABS(((vx_int32)(value + 0.5) - (vx_int32)output[y * WIDTH + x])));
+            }
+        }
+        printf(" Maximum error: %d\n", max_error);
+    }
+    printf(" Map size: %d bytes (dense float map: %d bytes, %dx less)\n\n", 4 * GRID_COLS * GRID_ROWS, 8 * PIXELS,
+           (8 * PIXELS) / (4 * GRID_COLS * GRID_ROWS));
+
+    delete[] input;
+    delete[] output;
+    delete[] map;
+}
+
 /*! \brief Tests the Integral Function */
 void swTestIntegral(void) {
 
@@ -279,6 +1107,277 @@ void swTestIntegral(void) {
     printf("\n");
 }
 
+/*! \brief Compares the vectorized (squared) integral image against a 64-bit reference */
+template <typename SrcType, typename DstType, typename SqrType, vx_uint8 VEC_NUM, vx_uint32 COLS, vx_uint32 ROWS>
+void swTestIntegralVectorCompare(const char *name) {
+    const vx_uint32 PIXELS = COLS * ROWS;
+
+    SrcType *input = new SrcType[PIXELS];
+    DstType *output = new DstType[PIXELS];
+    DstType *output_single = new DstType[PIXELS];
+    SqrType *output_sqr = new SqrType[PIXELS];
+    vx_uint64 *ref = new vx_uint64[PIXELS];
+    vx_uint64 *ref_sqr = new vx_uint64[PIXELS];
+    for (vx_uint32 i = 0; i < PIXELS; i++)
+        input[i] = (SrcType)(((vx_uint32)rand() << 16) ^ (vx_uint32)rand());
+
+    // 64-bit reference
+    for (vx_uint32 y = 0; y < ROWS; y++) {
+        vx_uint64 sum = 0, sum_sqr = 0;
+        for (vx_uint32 x = 0; x < COLS; x++) {
+            const vx_uint64 pixel = input[y * COLS + x];
+            sum += pixel;
+            sum_sqr += pixel * pixel;
+            ref[y * COLS + x] = sum + ((y > 0) ? (ref[(y - 1) * COLS + x]) : (0));
+            ref_sqr[y * COLS + x] = sum_sqr + ((y > 0) ? (ref_sqr[(y - 1) * COLS + x]) : (0));
+        }
+    }
+
+    // Integral image with and without the squared output
+    ImgIntegral<SrcType, DstType, SqrType, VEC_NUM, COLS, ROWS>(input, output, output_sqr);
+    ImgIntegral<SrcType, DstType, VEC_NUM, COLS, ROWS>(input, output_single);
+
+    vx_uint32 errors = 0;
+    for (vx_uint32 i = 0; i < PIXELS; i++) {
+        errors += (output[i] != (DstType)ref[i]) ? 1 : 0;
+        errors += (output_single[i] != (DstType)ref[i]) ? 1 : 0;
+        errors += (output_sqr[i] != (SqrType)ref_sqr[i]) ? 1 : 0;
+    }
+    printf(" %-22s (%d pixel/clock): %d errors, sum %llu, squared sum %llu\n", name, VEC_NUM, errors,
+           (unsigned long long)output[PIXELS - 1], (unsigned long long)output_sqr[PIXELS - 1]);
+
+    delete[] input;
+    delete[] output;
+    delete[] output_single;
+    delete[] output_sqr;
+    delete[] ref;
+    delete[] ref_sqr;
+}
+
+/*! \brief Tests the vectorized Integral Function with 32/64-bit and squared outputs */
+void swTestIntegralVector(void) {
+    printf("Vectorized integral image:\n");
+    swTestIntegralVectorCompare<vx_uint8, vx_uint32, vx_uint32, 1, 64, 48>("U8 -> U32, U32");
+    swTestIntegralVectorCompare<vx_uint8, vx_uint32, vx_uint64, 4, 64, 48>("U8 -> U32, U64");
+    swTestIntegralVectorCompare<vx_uint16, vx_uint32, vx_uint64, 8, 64, 48>("U16 -> U32, U64");
+    swTestIntegralVectorCompare<vx_uint16, vx_uint64, vx_uint64, 2, 64, 48>("U16 -> U64, U64");
+    swTestIntegralVectorCompare<vx_uint16, vx_uint32, vx_uint32, 4, 64, 48>("U16 -> U32, U32 (wrap)");
+    printf("\n");
+}
+
+/*! \brief Compares the single-pass mean and standard deviation of an image and its tiles against two passes */
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint32 COLS, vx_uint32 ROWS, vx_uint16 TILES_X, vx_uint16 TILE_ROWS>
+void swTestMeanStdDevCompare(const char *name, vx_int32 offset, vx_int32 range) {
+    const vx_uint32 PIXELS = COLS * ROWS;
+    const vx_uint32 TILE_COLS = COLS / TILES_X;
+    const vx_uint32 TILES = TILES_X * (ROWS / TILE_ROWS);
+
+    DataType *input = new DataType[PIXELS];
+    vx_float32 *tile_mean = new vx_float32[TILES];
+    vx_float32 *tile_stddev = new vx_float32[TILES];
+    for (vx_uint32 i = 0; i < PIXELS; i++)
+        input[i] = (DataType)(offset + (vx_int32)(rand() % range));
+
+    // Single pass
+    vx_float32 mean = 0, stddev = 0, mean_tiled = 0, stddev_tiled = 0;
+    ImgMeanStdDev<DataType, VEC_NUM, COLS, ROWS>(input, &mean, &stddev);
+    ImgMeanStdDev<DataType, VEC_NUM, COLS, ROWS, TILES_X, TILE_ROWS>(input, &mean_tiled, &stddev_tiled, tile_mean,
+                                                                     tile_stddev);
+
+    // Two-pass reference of the image and the tiles (relative error of the mean, absolute error of the stddev)
+    vx_float64 error_mean = 0, error_stddev = 0;
+    for (vx_uint32 tile = 0; tile <= TILES; tile++) {
+        const bool image = (tile == TILES);
+        const vx_uint32 x_start = (image) ? (0) : ((tile % TILES_X) * TILE_COLS);
+        const vx_uint32 y_start = (image) ? (0) : ((tile / TILES_X) * TILE_ROWS);
+        const vx_uint32 x_end = (image) ? (COLS) : (x_start + TILE_COLS);
+        const vx_uint32 y_end = (image) ? (ROWS) : (y_start + TILE_ROWS);
+        vx_float64 sum = 0, sum_sqr = 0;
+        for (vx_uint32 y = y_start; y < y_end; y++)
+            for (vx_uint32 x = x_start; x < x_end; x++)
+                sum += (vx_float64)input[y * COLS + x];
+        const vx_float64 n = (vx_float64)((x_end - x_start) * (y_end - y_start));
+        const vx_float64 ref_mean = sum / n;
+        for (vx_uint32 y = y_start; y < y_end; y++)
+            for (vx_uint32 x = x_start; x < x_end; x++)
+                sum_sqr += ((vx_float64)input[y * COLS + x] - ref_mean) * ((vx_float64)input[y * COLS + x] - ref_mean);
+        const vx_float64 ref_stddev = sqrt(sum_sqr / n);
+        const vx_float64 abs_mean = MAX(fabs(ref_mean), 1.0);
+        if (image) {
+            error_mean = MAX(error_mean, fabs(mean - ref_mean) / abs_mean);
+            error_mean = MAX(error_mean, fabs(mean_tiled - ref_mean) / abs_mean);
+            error_stddev = MAX(error_stddev, fabs(stddev - ref_stddev));
+            error_stddev = MAX(error_stddev, fabs(stddev_tiled - ref_stddev));
+        } else {
+            error_mean = MAX(error_mean, fabs(tile_mean[tile] - ref_mean) / abs_mean);
+            error_stddev = MAX(error_stddev, fabs(tile_stddev[tile] - ref_stddev));
+        }
+    }
+    printf(" %-28s (%d pixel/clock, %3d tiles): mean %10.3f, stddev %8.3f, max error mean %.2e, stddev %.2e\n", name,
+           VEC_NUM, TILES, mean, stddev, error_mean, error_stddev);
+
+    delete[] input;
+    delete[] tile_mean;
+    delete[] tile_stddev;
+}
+
+/*! \brief Tests the single-pass Mean and Standard Deviation Function for images, rows and tiles */
+void swTestMeanStdDev(void) {
+    printf("Single-pass mean and standard deviation:\n");
+    swTestMeanStdDevCompare<vx_uint8, 1, 64, 48, 4, 8>("U8", 0, 256);
+    swTestMeanStdDevCompare<vx_uint8, 8, 64, 48, 1, 1>("U8 (rows)", 0, 256);
+    swTestMeanStdDevCompare<vx_int8, 4, 64, 48, 2, 16>("S8", -128, 256);
+    swTestMeanStdDevCompare<vx_uint16, 2, 64, 48, 8, 6>("U16", 0, 65536);
+    swTestMeanStdDevCompare<vx_int16, 8, 64, 48, 1, 48>("S16", -32768, 65536);
+    swTestMeanStdDevCompare<vx_uint16, 4, 64, 48, 4, 4>("U16 (large mean, small std)", 65500, 4);
+    swTestMeanStdDevCompare<vx_uint16, 8, 1024, 64, 1, 1>("U16 (rows)", 65000, 512);
+    printf("\n");
+}
+
+/*! \brief Min/max values, counters and first locations of an image strip (multi-threaded software version) */
+template <typename DataType, vx_uint16 CAPACITY>
+struct SwMinMaxStrip {
+    DataType min_value, max_value;
+    vx_uint16 min_counter, max_counter;
+    vx_uint16 min_x[CAPACITY], min_y[CAPACITY], max_x[CAPACITY], max_y[CAPACITY];
+};
+
+/*! \brief Computes the min/max values and first locations of the rows [row_start, row_end) of an image */
+template <typename DataType, vx_uint16 COLS, vx_uint16 CAPACITY>
+void SwMinMaxLocationStrip(const DataType *input, vx_uint16 row_start, vx_uint16 row_end,
+                           SwMinMaxStrip<DataType, CAPACITY> *strip) {
+    strip->min_value = ComputeMax<DataType>();
+    strip->max_value = ComputeMin<DataType>();
+    strip->min_counter = 0;
+    strip->max_counter = 0;
+    for (vx_uint16 y = row_start; y < row_end; y++) {
+        for (vx_uint16 x = 0; x < COLS; x++) {
+            MinMaxUpdateLocation<DataType, CAPACITY, vx_true_e>(y, x, input[y * COLS + x], strip->min_x, strip->min_y,
+                                                                strip->max_x, strip->max_y, strip->min_value,
+                                                                strip->max_value, strip->min_counter,
+                                                                strip->max_counter);
+        }
+    }
+}
+
+/*! \brief Multi-threaded software min/max location: every thread processes a horizontal strip of the image and the
+ *         strips are merged in row order, which keeps the first locations in raster order. Without __SW_THREADS__
+ *         the strips are processed one after another */
+template <typename DataType, vx_uint16 COLS, vx_uint16 ROWS, vx_uint16 CAPACITY>
+void SwMinMaxLocationThreads(const DataType *input, vx_uint16 threads, DataType &min_val, DataType &max_val,
+                             vx_uint16 min_loc[CAPACITY][2], vx_uint16 max_loc[CAPACITY][2], vx_uint16 &min_count,
+                             vx_uint16 &max_count) {
+    const vx_uint16 strips = MAX(MIN(threads, ROWS), 1);
+    std::vector<SwMinMaxStrip<DataType, CAPACITY>> result(strips);
+#ifdef __SW_THREADS__
+    std::vector<std::thread> pool;
+#endif
+
+    // Process the strips in parallel
+    for (vx_uint16 i = 0; i < strips; i++) {
+        const vx_uint16 row_start = static_cast<vx_uint16>((static_cast<vx_uint32>(ROWS) * i) / strips);
+        const vx_uint16 row_end = static_cast<vx_uint16>((static_cast<vx_uint32>(ROWS) * (i + 1)) / strips);
+#ifdef __SW_THREADS__
+        pool.push_back(
+            std::thread(SwMinMaxLocationStrip<DataType, COLS, CAPACITY>, input, row_start, row_end, &result[i]));
+#else
+        SwMinMaxLocationStrip<DataType, COLS, CAPACITY>(input, row_start, row_end, &result[i]);
+#endif
+    }
+#ifdef __SW_THREADS__
+    for (vx_uint16 i = 0; i < strips; i++)
+        pool[i].join();
+#endif
+
+    // Merge the strips in row order
+    min_val = ComputeMax<DataType>();
+    max_val = ComputeMin<DataType>();
+    for (vx_uint16 i = 0; i < strips; i++) {
+        min_val = MIN(min_val, result[i].min_value);
+        max_val = MAX(max_val, result[i].max_value);
+    }
+    min_count = 0;
+    max_count = 0;
+    for (vx_uint16 i = 0; i < strips; i++) {
+        const vx_uint16 min_strip = (result[i].min_value == min_val) ? (result[i].min_counter) : (0);
+        const vx_uint16 max_strip = (result[i].max_value == max_val) ? (result[i].max_counter) : (0);
+        for (vx_uint16 j = 0; (j < min_strip) && (min_count < CAPACITY); j++) {
+            min_loc[min_count][0] = result[i].min_x[j];
+            min_loc[min_count][1] = result[i].min_y[j];
+            min_count++;
+        }
+        for (vx_uint16 j = 0; (j < max_strip) && (max_count < CAPACITY); j++) {
+            max_loc[max_count][0] = result[i].max_x[j];
+            max_loc[max_count][1] = result[i].max_y[j];
+            max_count++;
+        }
+    }
+}
+
+/*! \brief Compares the vectorized and the multi-threaded min/max location against the function without vectorization */
+template <typename DataType, vx_uint8 VEC_NUM, vx_uint16 COLS, vx_uint16 ROWS, vx_uint16 CAPACITY>
+void swTestMinMaxLocationCompare(const char *name, vx_int32 offset, vx_int32 range, vx_uint16 threads) {
+    const vx_uint32 PIXELS = COLS * ROWS;
+
+    DataType *input = new DataType[PIXELS];
+    for (vx_uint32 i = 0; i < PIXELS; i++)
+        input[i] = (DataType)(offset + (vx_int32)(rand() % range));
+
+    // Reference (without vectorization)
+    DataType ref_min = 0, ref_max = 0;
+    vx_uint16 ref_min_count = 0, ref_max_count = 0;
+    vx_image_data<vx_uint16, 2> ref_min_loc[CAPACITY], ref_max_loc[CAPACITY];
+    ImgMinMaxLocation<DataType, COLS, ROWS, CAPACITY>(input, &ref_min, &ref_max, ref_min_loc, ref_max_loc,
+                                                      &ref_min_count, &ref_max_count);
+
+    // Vectorized
+    DataType min = 0, max = 0, min_only = 0, max_only = 0;
+    vx_uint16 min_count = 0, max_count = 0;
+    vx_image_data<vx_uint16, 2> min_loc[CAPACITY], max_loc[CAPACITY];
+    ImgMinMaxLocation<DataType, VEC_NUM, COLS, ROWS, CAPACITY>(input, &min, &max, min_loc, max_loc, &min_count,
+                                                               &max_count);
+    ImgMinMaxLocation<DataType, VEC_NUM, COLS, ROWS>(input, &min_only, &max_only);
+
+    // Multi-threaded
+    DataType sw_min = 0, sw_max = 0;
+    vx_uint16 sw_min_count = 0, sw_max_count = 0;
+    vx_uint16 sw_min_loc[CAPACITY][2], sw_max_loc[CAPACITY][2];
+    SwMinMaxLocationThreads<DataType, COLS, ROWS, CAPACITY>(input, threads, sw_min, sw_max, sw_min_loc, sw_max_loc,
+                                                            sw_min_count, sw_max_count);
+
+    vx_uint32 errors = 0;
+    errors += ((min != ref_min) || (max != ref_max) || (min_only != ref_min) || (max_only != ref_max)) ? 1 : 0;
+    errors += ((sw_min != ref_min) || (sw_max != ref_max)) ? 1 : 0;
+    errors += ((min_count != ref_min_count) || (max_count != ref_max_count)) ? 1 : 0;
+    errors += ((sw_min_count != ref_min_count) || (sw_max_count != ref_max_count)) ? 1 : 0;
+    for (vx_uint16 i = 0; i < MIN(ref_min_count, MIN(min_count, sw_min_count)); i++) {
+        const vx_uint16 x = ref_min_loc[i].pixel[0], y = ref_min_loc[i].pixel[1];
+        errors += ((min_loc[i].pixel[0] != x) || (min_loc[i].pixel[1] != y)) ? 1 : 0;
+        errors += ((sw_min_loc[i][0] != x) || (sw_min_loc[i][1] != y)) ? 1 : 0;
+    }
+    for (vx_uint16 i = 0; i < MIN(ref_max_count, MIN(max_count, sw_max_count)); i++) {
+        const vx_uint16 x = ref_max_loc[i].pixel[0], y = ref_max_loc[i].pixel[1];
+        errors += ((max_loc[i].pixel[0] != x) || (max_loc[i].pixel[1] != y)) ? 1 : 0;
+        errors += ((sw_max_loc[i][0] != x) || (sw_max_loc[i][1] != y)) ? 1 : 0;
+    }
+    printf(" %-14s (%d pixel/clock, %2d threads): %d errors, min %6d (%2d locations), max %6d (%2d locations)\n", name,
+           VEC_NUM, threads, errors, (vx_int32)min, min_count, (vx_int32)max, max_count);
+
+    delete[] input;
+}
+
+/*! \brief Tests the vectorized and the multi-threaded Min/Max Location Function */
+void swTestMinMaxLocation(void) {
+    printf("Vectorized and multi-threaded min/max location:\n");
+    swTestMinMaxLocationCompare<vx_uint8, 1, 64, 48, 16>("U8", 0, 256, 1);
+    swTestMinMaxLocationCompare<vx_uint8, 2, 64, 48, 16>("U8", 0, 256, 3);
+    swTestMinMaxLocationCompare<vx_uint8, 4, 64, 48, 16>("U8 (8 values)", 100, 8, 4);
+    swTestMinMaxLocationCompare<vx_int8, 8, 64, 48, 32>("S8", -128, 256, 7);
+    swTestMinMaxLocationCompare<vx_uint16, 4, 64, 48, 16>("U16", 0, 65536, 8);
+    swTestMinMaxLocationCompare<vx_int16, 8, 1024, 64, 64>("S16 (4 values)", -2, 4, 16);
+    printf("\n");
+}
+
 /*! \brief Tests the Histogram Function */
 void swTestHistogram(void) {
 
@@ -352,6 +1451,706 @@ void swTestHistogram(void) {
     }
 }
 
+/*! \brief Tests the single-pass Histogram Equalization of a video stream (previous frame lookup table) */
+void swTestEqualizeHistStream(void) {
+    const vx_uint32 PIXELS = 64 * 48;
+    const vx_uint32 FRAMES = 6;
+
+    vx_uint8 *frame[FRAMES];
+    vx_uint8 *output = new vx_uint8[PIXELS];
+    vx_uint32 *reference = new vx_uint32[PIXELS];
+    for (vx_uint32 f = 0; f < FRAMES; f++) {
+        frame[f] = new vx_uint8[PIXELS];
+        for (vx_uint32 i = 0; i < PIXELS; i++)
+            frame[f][i] = (vx_uint8)(40 + 10 * f + rand() % 100);
+    }
+
+    // Without damping: frame N is equalized with the histogram of frame N-1
+    printf("Histogram equalization (video stream):\n");
+    for (vx_uint32 f = 0; f < FRAMES; f++) {
+        ImgEqualizeHistStream<PIXELS, 0>(frame[f], output);
+        if (f > 0)
+            ImgEqualizeHist<PIXELS>(frame[f - 1], frame[f], reference);
+        vx_uint32 errors = 0;
+        for (vx_uint32 i = 0; i < PIXELS; i++)
+            errors += (output[i] != ((f > 0) ? (reference[i]) : (frame[f][i]))) ? 1 : 0;
+        printf(" Frame %d: %d errors\n", f, errors);
+    }
+
+    // With damping: a static scene converges towards the equalized image
+    ImgEqualizeHist<PIXELS>(frame[0], frame[0], reference);
+    for (vx_uint32 f = 0; f < FRAMES; f++) {
+        ImgEqualizeHistStream<PIXELS, 128>(frame[0], output);
+        vx_int32 max_error = 0;
+        for (vx_uint32 i = 0; i < PIXELS; i++) {
+            const vx_int32 diff = (vx_int32)output[i] - (vx_int32)reference[i];
+            max_error = MAX(max_error, ABS(diff));
+        }
+        printf(" Frame %d (damping 128/256): max difference to the equalized image %d\n", f, max_error);
+    }
+    printf("\n");
+
+    for (vx_uint32 f = 0; f < FRAMES; f++)
+        delete[] frame[f];
+    delete[] output;
+    delete[] reference;
+}
+
+/*! \brief Floating point CLAHE reference (as OpenCV): lookup tables of the tiles of "hist_frame" applied to "frame" */
+void swTestClaheReference(const vx_uint8 *hist_frame, const vx_uint8 *frame, vx_uint8 *output, vx_uint32 cols,
+                          vx_uint32 rows, vx_uint32 tiles_x, vx_uint32 tiles_y, vx_float32 clip_limit) {
+    const vx_int32 tile_cols = cols / tiles_x, tile_rows = rows / tiles_y, tile_pixels = tile_cols * tile_rows;
+    const vx_int32 clip = (clip_limit > 0.0f) ? (MAX((vx_int32)(clip_limit * tile_pixels / 256), 1)) : (tile_pixels);
+    vx_uint8 *lut = new vx_uint8[tiles_x * tiles_y * 256];
+
+    // Lookup tables of all tiles
+    for (vx_uint32 t = 0; t < tiles_x * tiles_y; t++) {
+        vx_int32 hist[256] = {0};
+        const vx_uint32 tx = t % tiles_x, ty = t / tiles_x;
+        for (vx_int32 y = 0; y < tile_rows; y++)
+            for (vx_int32 x = 0; x < tile_cols; x++)
+                hist[hist_frame[(ty * tile_rows + y) * cols + tx * tile_cols + x]]++;
+        vx_int32 clipped = 0;
+        for (vx_uint32 i = 0; i < 256; i++) {
+            if (hist[i] > clip) {
+                clipped += hist[i] - clip;
+                hist[i] = clip;
+            }
+        }
+        const vx_int32 batch = clipped / 256;
+        vx_int32 residual = clipped - batch * 256;
+        for (vx_uint32 i = 0; i < 256; i++)
+            hist[i] += batch;
+        if (residual > 0) {
+            const vx_int32 step = MAX(256 / residual, 1);
+            for (vx_int32 i = 0; (i < 256) && (residual > 0); i += step, residual--)
+                hist[i]++;
+        }
+        for (vx_int32 i = 0, sum = 0; i < 256; i++) {
+            sum += hist[i];
+            lut[t * 256 + i] = (vx_uint8)MIN(floorf(sum * 255.0f / tile_pixels + 0.5f), 255.0f);
+        }
+    }
+
+    // Bilinear interpolation between the tile centers
+    for (vx_uint32 y = 0; y < rows; y++) {
+        const vx_float32 tyf = (y + 0.5f) / tile_rows - 0.5f;
+        const vx_int32 ty1 = (vx_int32)floorf(tyf);
+        const vx_float32 ya = tyf - ty1;
+        const vx_int32 y1 = MAX(ty1, 0), y2 = MIN(ty1 + 1, (vx_int32)tiles_y - 1);
+        for (vx_uint32 x = 0; x < cols; x++) {
+            const vx_float32 txf = (x + 0.5f) / tile_cols - 0.5f;
+            const vx_int32 tx1 = (vx_int32)floorf(txf);
+            const vx_float32 xa = txf - tx1;
+            const vx_int32 x1 = MAX(tx1, 0), x2 = MIN(tx1 + 1, (vx_int32)tiles_x - 1);
+            const vx_uint8 p = frame[y * cols + x];
+            const vx_float32 top = lut[(y1 * tiles_x + x1) * 256 + p] * (1 - xa) + lut[(y1 * tiles_x + x2) * 256 + p] * xa;
+            const vx_float32 bot = lut[(y2 * tiles_x + x1) * 256 + p] * (1 - xa) + lut[(y2 * tiles_x + x2) * 256 + p] * xa;
+            output[y * cols + x] = (vx_uint8)floorf(top * (1 - ya) + bot * ya + 0.5f);
+        }
+    }
+    delete[] lut;
+}
+
+/*! \brief Tests the streaming CLAHE against a floating point reference */
+void swTestClahe(void) {
+    const vx_uint32 COLS = 128, ROWS = 96, TILES_X = 8, TILES_Y = 6, FRAMES = 3;
+    const vx_uint16 CLIP_LIMIT = 32; // 2.0
+    const vx_uint32 PIXELS = COLS * ROWS;
+
+    vx_uint8 *frame[FRAMES];
+    vx_uint8 *output = new vx_uint8[PIXELS];
+    vx_uint8 *reference = new vx_uint8[PIXELS];
+
+    // Dark frames with a slow gradient and noise (low-light camera)
+    for (vx_uint32 f = 0; f < FRAMES; f++) {
+        frame[f] = new vx_uint8[PIXELS];
+        for (vx_uint32 y = 0; y < ROWS; y++)
+            for (vx_uint32 x = 0; x < COLS; x++)
+                frame[f][y * COLS + x] = (vx_uint8)(10 + (x + y) / 8 + f + rand() % 12);
+    }
+
+    printf("CLAHE (%dx%d tiles, clip limit %.1f):\n", TILES_X, TILES_Y, CLIP_LIMIT / 16.0f);
+    for (vx_uint32 f = 0; f < FRAMES; f++) {
+        ImgClahe<COLS, ROWS, TILES_X, TILES_Y, CLIP_LIMIT>(frame[f], output);
+        if (f > 0)
+            swTestClaheReference(frame[f - 1], frame[f], reference, COLS, ROWS, TILES_X, TILES_Y, CLIP_LIMIT / 16.0f);
+        else
+            memcpy(reference, frame[f], PIXELS);
+        vx_int32 max_error = 0, min_value = 255, max_value = 0;
+        for (vx_uint32 i = 0; i < PIXELS; i++) {
+            const vx_int32 diff = (vx_int32)output[i] - (vx_int32)reference[i];
+            max_error = MAX(max_error, ABS(diff));
+            min_value = MIN(min_value, (vx_int32)output[i]);
+            max_value = MAX(max_value, (vx_int32)output[i]);
+        }
+        printf(" Frame %d: max error %d, output range %d - %d\n", f, max_error, min_value, max_value);
+    }
+    printf("\n");
+
+    for (vx_uint32 f = 0; f < FRAMES; f++)
+        delete[] frame[f];
+    delete[] output;
+    delete[] reference;
+}
+
+/*! \brief Flood fill reference of the connected components (records in raster order of the first pixel) */
+vx_uint16 swTestConnectedComponentsReference(const vx_uint8 *input, vx_uint32 cols, vx_uint32 rows, vx_uint8 connectivity,
+                                             vx_uint32 *records) {
+    std::vector<vx_uint8> visited(cols * rows, 0);
+    std::vector<vx_uint32> stack;
+    vx_uint16 count = 0;
+    for (vx_uint32 i = 0; i < cols * rows; i++) {
+        if ((input[i] == 0) || (visited[i] != 0))
+            continue;
+        vx_uint32 *record = &records[count * HIFLIPVX::BLOB_RECORD_SIZE];
+        vx_uint64 area = 0, sum_x = 0, sum_y = 0;
+        vx_uint32 min_x = cols, min_y = rows, max_x = 0, max_y = 0;
+        visited[i] = 1;
+        stack.push_back(i);
+        while (stack.empty() == false) {
+            const vx_uint32 p = stack.back();
+            const vx_int32 x = (vx_int32)(p % cols), y = (vx_int32)(p / cols);
+            stack.pop_back();
+            area++;
+            sum_x += x;
+            sum_y += y;
+            min_x = MIN(min_x, (vx_uint32)x);
+            min_y = MIN(min_y, (vx_uint32)y);
+            max_x = MAX(max_x, (vx_uint32)x);
+            max_y = MAX(max_y, (vx_uint32)y);
+            for (vx_int32 dy = -1; dy <= 1; dy++) {
+                for (vx_int32 dx = -1; dx <= 1; dx++) {
+                    const vx_int32 nx = x + dx, ny = y + dy;
+                    if (((dx == 0) && (dy == 0)) || ((connectivity == 4) && (dx != 0) && (dy != 0)))
+                        continue;
+                    if ((nx < 0) || (ny < 0) || (nx >= (vx_int32)cols) || (ny >= (vx_int32)rows))
+                        continue;
+                    const vx_uint32 n = ny * cols + nx;
+                    if ((input[n] != 0) && (visited[n] == 0)) {
+                        visited[n] = 1;
+                        stack.push_back(n);
+                    }
+                }
+            }
+        }
+        record[HIFLIPVX::BLOB_AREA] = (vx_uint32)area;
+        record[HIFLIPVX::BLOB_MIN_X] = min_x;
+        record[HIFLIPVX::BLOB_MIN_Y] = min_y;
+        record[HIFLIPVX::BLOB_MAX_X] = max_x;
+        record[HIFLIPVX::BLOB_MAX_Y] = max_y;
+        record[HIFLIPVX::BLOB_CENTROID_X] = (vx_uint32)(((sum_x << 16) + area / 2) / area);
+        record[HIFLIPVX::BLOB_CENTROID_Y] = (vx_uint32)(((sum_y << 16) + area / 2) / area);
+        count++;
+    }
+    return count;
+}
+
+/*! \brief Finds the root of a label and keeps the longest chain from a label to its root */
+vx_uint32 swTestConnectedComponentsRoot(const std::vector<vx_uint32> &parent, vx_uint32 label, vx_uint16 &max_depth) {
+    vx_uint16 depth = 0;
+    for (; parent[label] != label; depth++)
+        label = parent[label];
+    max_depth = MAX(max_depth, depth);
+    return label;
+}
+
+/*! \brief Software model of the union-find table of the streaming labeling. Returns the longest chain from a label of the
+ *         previous line to its root at the time of its lookup, which the core reads with two fixed lookups. */
+vx_uint16 swTestConnectedComponentsChainDepth(const vx_uint8 *input, vx_uint32 cols, vx_uint32 rows, vx_uint8 connectivity) {
+    std::vector<vx_uint32> line(cols, 0), parent(1, 0), merged;
+    vx_uint16 max_depth = 0;
+    for (vx_uint32 y = 0; y < rows; y++) {
+        merged.clear();
+
+        vx_uint32 left = 0, up_left = 0;
+        vx_uint32 up = (y > 0) ? swTestConnectedComponentsRoot(parent, line[0], max_depth) : 0;
+        for (vx_uint32 x = 0; x < cols; x++) {
+            vx_uint32 up_right = ((y > 0) && (x + 1 < cols)) ? swTestConnectedComponentsRoot(parent, line[x + 1], max_depth) : 0;
+            vx_uint32 label = 0;
+            if (input[y * cols + x] != 0) {
+                const vx_uint32 neighbor[4] = {left, up, (connectivity == 8) ? up_left : 0, (connectivity == 8) ? up_right : 0};
+                vx_uint32 other = 0;
+                for (vx_uint32 i = 0; i < 4; i++) {
+                    if ((neighbor[i] != 0) && ((label == 0) || (neighbor[i] < label)))
+                        label = neighbor[i];
+                    other = MAX(other, neighbor[i]);
+                }
+                if (label == 0) {
+                    label = (vx_uint32)parent.size();
+                    parent.push_back(label);
+                }
+                if ((other != 0) && (other != label)) {
+                    parent[other] = label;
+                    merged.push_back(other);
+                    up = (up == other) ? label : up;
+                    up_right = (up_right == other) ? label : up_right;
+                }
+            }
+            line[x] = label;
+            left = label;
+            up_left = up;
+            up = up_right;
+        }
+
+        // Resolve the merges of the line (latest first)
+        for (vx_uint32 i = (vx_uint32)merged.size(); i > 0; i--)
+            parent[merged[i - 1]] = parent[parent[merged[i - 1]]];
+    }
+    return max_depth;
+}
+
+/*! \brief Compares the streaming connected component labeling against a flood fill */
+template <vx_uint16 COLS, vx_uint16 ROWS, vx_uint16 MAX_LABELS, vx_uint8 CONNECTIVITY>
+void swTestConnectedComponentsCompare(const char *name, const vx_uint8 *input) {
+    vx_uint32 *records = new vx_uint32[(MAX_LABELS - 1) * HIFLIPVX::BLOB_RECORD_SIZE];
+    vx_uint32 *reference = new vx_uint32[COLS * ROWS * HIFLIPVX::BLOB_RECORD_SIZE];
+    vx_uint16 count = 0;
+
+    ImgConnectedComponents<COLS, ROWS, MAX_LABELS, CONNECTIVITY>((vx_uint8 *)input, records, &count);
+    const vx_uint16 ref_count = swTestConnectedComponentsReference(input, COLS, ROWS, CONNECTIVITY, reference);
+
+    // A label of the previous line must reach its root within the two reads of the lookup
+    const vx_uint16 depth = swTestConnectedComponentsChainDepth(input, COLS, ROWS, CONNECTIVITY);
+    vx_uint32 errors = ((count != ref_count) ? 1 : 0) + ((depth > 2) ? 1 : 0);
+    for (vx_uint32 i = 0; i < (vx_uint32)MIN(count, ref_count) * HIFLIPVX::BLOB_RECORD_SIZE; i++)
+        errors += (records[i] != reference[i]) ? 1 : 0;
+    printf(" %-16s (%d-connectivity): %d errors, %4d components, chain depth %d\n", name, CONNECTIVITY, errors, count, depth);
+
+    delete[] records;
+    delete[] reference;
+}
+
+/*! \brief Tests the streaming Connected Component Labeling Function */
+void swTestConnectedComponents(void) {
+    const vx_uint16 COLS = 160, ROWS = 120, MAX_LABELS = 4096;
+    vx_uint8 *noise = new vx_uint8[COLS * ROWS];
+    vx_uint8 *shapes = new vx_uint8[COLS * ROWS];
+    vx_uint8 *bars = new vx_uint8[COLS * ROWS];
+
+    // Random noise (many merges) and shapes that merge at the bottom or on the right (combs, spirals, rings)
+    for (vx_uint32 i = 0; i < COLS * ROWS; i++)
+        noise[i] = ((rand() % 100) < 55) ? 255 : 0;
+    for (vx_uint32 y = 0; y < ROWS; y++) {
+        for (vx_uint32 x = 0; x < COLS; x++) {
+            const vx_int32 dx = (vx_int32)x - 120, dy = (vx_int32)y - 60, r2 = dx * dx + dy * dy;
+            bool comb = (x < 60) && (y < 50) && (((x % 4) == 0) || (y == 49));
+            bool stairs = (x < 60) && (y >= 60) && ((((x + y) % 6) == 0) || (x == 59 - (y - 60)));
+            bool ring = (r2 >= 400) && (r2 < 600);
+            bool spiral = (x >= 70) && (x < 100) && ((y % 8) == 0 || (x == 70 + (y / 8) % 2 * 29));
+            shapes[y * COLS + x] = (comb || stairs || ring || spiral) ? 255 : 0;
+        }
+    }
+
+    // Bars that start lower from right to left (labels decrease to the right), which are joined by a line and continue below it. Every bar
+    // of the line is merged into the bar on its right, so the merges form a chain through all bars.
+    for (vx_uint32 y = 0; y < ROWS; y++) {
+        for (vx_uint32 x = 0; x < COLS; x++) {
+            const bool bar = ((x % 2) == 0) && (y >= (COLS - x) / 4);
+            bars[y * COLS + x] = ((bar) || (y == ROWS / 2) || (y == ROWS / 2 + 1)) ? 255 : 0;
+        }
+    }
+
+    printf("Connected component labeling:\n");
+    swTestConnectedComponentsCompare<COLS, ROWS, MAX_LABELS, 4>("Noise", noise);
+    swTestConnectedComponentsCompare<COLS, ROWS, MAX_LABELS, 8>("Noise", noise);
+    swTestConnectedComponentsCompare<COLS, ROWS, MAX_LABELS, 4>("Shapes", shapes);
+    swTestConnectedComponentsCompare<COLS, ROWS, MAX_LABELS, 8>("Shapes", shapes);
+    swTestConnectedComponentsCompare<COLS, ROWS, MAX_LABELS, 4>("Bars", bars);
+    swTestConnectedComponentsCompare<COLS, ROWS, MAX_LABELS, 8>("Bars", bars);
+    printf("\n");
+
+    delete[] noise;
+    delete[] shapes;
+    delete[] bars;
+}
+
+/*! \brief Computes the raw moments of an image (LABELS == 0) or of every label of a label image (LABELS > 0) */
+template <typename SrcType, vx_uint16 COLS, vx_uint16 ROWS, vx_uint8 ORDER, vx_uint16 LABELS>
+void swTestMomentsReference(const SrcType *input, vx_uint64 *moments) {
+    const vx_uint8 MOMENT_NUM = ((ORDER + 1) * (ORDER + 2)) / 2;
+    for (vx_uint32 i = 0; i < MAX(LABELS, 1) * MOMENT_NUM; i++)
+        moments[i] = 0;
+    for (vx_uint64 y = 0; y < ROWS; y++) {
+        for (vx_uint64 x = 0; x < COLS; x++) {
+            const SrcType pixel = input[y * COLS + x];
+            if ((LABELS > 0) && (pixel >= LABELS))
+                continue;
+            const vx_uint64 weight = (LABELS > 0) ? 1 : (vx_uint64)pixel;
+            vx_uint64 *moment = (LABELS > 0) ? &moments[pixel * MOMENT_NUM] : moments;
+            for (vx_uint8 n = 0, m = 0; n <= ORDER; n++) {
+                for (vx_uint8 q = 0; q <= n; q++, m++) {
+                    vx_uint64 value = weight;
+                    for (vx_uint8 i = 0; i < n - q; i++)
+                        value *= x;
+                    for (vx_uint8 i = 0; i < q; i++)
+                        value *= y;
+                    moment[m] += value;
+                }
+            }
+        }
+    }
+}
+
+/*! \brief Checks the moments against the reference and prints the centroid and orientation of the first set */
+void swTestMomentsCheck(const char *name, vx_uint8 order, vx_uint8 vec_num, vx_uint16 labels,
+                        const vx_uint64 *reference, const vx_uint64 *result, vx_uint32 size) {
+    vx_uint32 errors = 0;
+    for (vx_uint32 i = 0; i < size; i++)
+        errors += (result[i] != reference[i]) ? 1 : 0;
+
+    // Centroid and orientation from the central moments of the first set
+    const vx_float64 m00 = (vx_float64)result[HIFLIPVX::MOMENT_00];
+    const vx_float64 cx = (vx_float64)result[HIFLIPVX::MOMENT_10] / m00;
+    const vx_float64 cy = (vx_float64)result[HIFLIPVX::MOMENT_01] / m00;
+    const vx_float64 mu20 = (vx_float64)result[HIFLIPVX::MOMENT_20] / m00 - cx * cx;
+    const vx_float64 mu11 = (vx_float64)result[HIFLIPVX::MOMENT_11] / m00 - cx * cy;
+    const vx_float64 mu02 = (vx_float64)result[HIFLIPVX::MOMENT_02] / m00 - cy * cy;
+    const vx_float64 angle = 0.5 * atan2(2.0 * mu11, mu20 - mu02) * 180.0 / M_PI;
+    printf(" %-14s (order %d, %d pixel/clock, %3d labels): %d errors, centroid (%7.2f, %7.2f), orientation %6.2f\n",
+           name, order, vec_num, labels, errors, cx, cy, angle);
+}
+
+/*! \brief Compares the moments of an image against the reference */
+template <vx_uint8 VEC_NUM, vx_uint16 COLS, vx_uint16 ROWS, vx_uint8 ORDER>
+void swTestMomentsCompare(const char *name, vx_uint8 *input) {
+    const vx_uint8 MOMENT_NUM = ((ORDER + 1) * (ORDER + 2)) / 2;
+    vx_uint64 reference[MOMENT_NUM], result[MOMENT_NUM];
+    swTestMomentsReference<vx_uint8, COLS, ROWS, ORDER, 0>(input, reference);
+    ImgMoments<vx_uint8, VEC_NUM, COLS, ROWS, ORDER>(input, result);
+    swTestMomentsCheck(name, ORDER, VEC_NUM, 0, reference, result, MOMENT_NUM);
+}
+
+/*! \brief Compares the moments of every label of a label image against the reference */
+template <typename SrcType, vx_uint8 VEC_NUM, vx_uint16 COLS, vx_uint16 ROWS, vx_uint8 ORDER, vx_uint16 LABELS>
+void swTestMomentsCompare(const char *name, SrcType *input) {
+    const vx_uint32 SIZE = LABELS * (((ORDER + 1) * (ORDER + 2)) / 2);
+    vx_uint64 *reference = new vx_uint64[SIZE];
+    vx_uint64 *result = new vx_uint64[SIZE];
+    swTestMomentsReference<SrcType, COLS, ROWS, ORDER, LABELS>(input, reference);
+    ImgMoments<SrcType, VEC_NUM, COLS, ROWS, ORDER, LABELS>(input, result);
+    swTestMomentsCheck(name, ORDER, VEC_NUM, LABELS, reference, result, SIZE);
+    delete[] reference;
+    delete[] result;
+}
+
+/*! \brief Tests the (per-label) moments on a rotated ellipse and on label images */
+void swTestMoments(void) {
+    const vx_uint16 COLS = 256, ROWS = 128;
+    const vx_float64 ANGLE = 30.0 * M_PI / 180.0;
+    vx_uint8 *ellipse = new vx_uint8[COLS * ROWS];
+    vx_uint8 *labels8 = new vx_uint8[COLS * ROWS];
+    vx_uint16 *labels16 = new vx_uint16[COLS * ROWS];
+
+    // Bright ellipse rotated by 30 degrees around (100, 70), blocks of labels and random labels
+    for (vx_uint32 y = 0; y < ROWS; y++) {
+        for (vx_uint32 x = 0; x < COLS; x++) {
+            const vx_float64 dx = (vx_float64)x - 100.0, dy = (vx_float64)y - 70.0;
+            const vx_float64 u = dx * cos(ANGLE) + dy * sin(ANGLE), v = -dx * sin(ANGLE) + dy * cos(ANGLE);
+            const bool inside = (u * u) / (50.0 * 50.0) + (v * v) / (20.0 * 20.0) <= 1.0;
+            ellipse[y * COLS + x] = inside ? 255 : 0;
+            labels8[y * COLS + x] = (vx_uint8)(((x / 32) + (y / 32) * 8 + (((rand() % 16) == 0) ? 1 : 0)) % 40);
+            labels16[y * COLS + x] = (vx_uint16)(rand() % 300);
+        }
+    }
+
+    printf("Image moments:\n");
+    swTestMomentsCompare<1, COLS, ROWS, 2>("Ellipse", ellipse);
+    swTestMomentsCompare<4, COLS, ROWS, 3>("Ellipse", ellipse);
+    swTestMomentsCompare<8, COLS, ROWS, 3>("Ellipse", ellipse);
+    swTestMomentsCompare<vx_uint8, 1, COLS, ROWS, 3, 32>("Label blocks", labels8);
+    swTestMomentsCompare<vx_uint8, 4, COLS, ROWS, 2, 32>("Label blocks", labels8);
+    swTestMomentsCompare<vx_uint16, 2, COLS, ROWS, 3, 256>("Random labels", labels16);
+    swTestMomentsCompare<vx_uint16, 8, COLS, ROWS, 2, 256>("Random labels", labels16);
+    printf("\n");
+
+    delete[] ellipse;
+    delete[] labels8;
+    delete[] labels16;
+}
+
+/*! \brief Computes the lines of an edge image in software (same fixed-point votes, suppression and order).
+ *         A negative PHASE_WINDOW votes for all theta. */
+template <vx_uint16 COLS, vx_uint16 ROWS, vx_uint16 THETA_NUM, vx_uint8 RHO_SHIFT, vx_uint16 MAX_LINES,
+          vx_uint16 THRESHOLD, vx_uint8 QUANTIZATION, vx_int32 PHASE_WINDOW>
+vx_uint16 swTestHoughLinesReference(const vx_uint8 *edges, const vx_uint8 *phase, vx_int32 *lines) {
+    const vx_int32 SIZE = HIFLIPVX::HOUGH_RECORD_SIZE;
+    const vx_int32 DIAGONAL = MAX(COLS, ROWS) + MIN(COLS, ROWS) / 2 + 1;
+    const vx_int32 RHO_OFFSET = ((COLS - 1) >> RHO_SHIFT) + 1;
+    const vx_int32 RHO_NUM = RHO_OFFSET + (DIAGONAL >> RHO_SHIFT) + 2;
+    const vx_int32 STRIDE = RHO_NUM + 2;
+    const vx_int32 HALF = 1 << (QUANTIZATION - 1);
+    vx_uint32 *acc = new vx_uint32[(THETA_NUM + 2) * STRIDE];
+    for (vx_int32 i = 0; i < (THETA_NUM + 2) * STRIDE; i++)
+        acc[i] = 0;
+
+    // Vote (accumulator with a border of zeros)
+    for (vx_int32 y = 0; y < ROWS; y++) {
+        for (vx_int32 x = 0; x < COLS; x++) {
+            if (edges[y * COLS + x] == 0)
+                continue;
+            const vx_int32 center = ((phase[y * COLS + x] % HALF) * THETA_NUM * 2 + HALF) / (2 * HALF) % THETA_NUM;
+            for (vx_int32 t = 0; t < THETA_NUM; t++) {
+                if ((PHASE_WINDOW >= 0) && (MIN(abs(t - center), THETA_NUM - abs(t - center)) > PHASE_WINDOW))
+                    continue;
+                const vx_float64 angle = (vx_float64)t * M_PI / (vx_float64)THETA_NUM;
+                const vx_int32 cos_val = (vx_int32)floor(cos(angle) * 16384.0 + 0.5);
+                const vx_int32 sin_val = (vx_int32)floor(sin(angle) * 16384.0 + 0.5);
+                const vx_int32 rho = x * cos_val + y * sin_val + (1 << (13 + RHO_SHIFT));
+                acc[(t + 1) * STRIDE + (rho >> (14 + RHO_SHIFT)) + RHO_OFFSET + 1]++;
+            }
+        }
+    }
+
+    // Local maxima (larger than the previous, not smaller than the next neighbors), sorted by votes (stable)
+    vx_uint16 count = 0;
+    for (vx_int32 t = 0; t < THETA_NUM; t++) {
+        for (vx_int32 r = 0; r < RHO_NUM; r++) {
+            const vx_uint32 *center = &acc[(t + 1) * STRIDE + r + 1];
+            bool peak = (*center >= THRESHOLD);
+            for (vx_int32 i = -1; i <= 1; i++) {
+                for (vx_int32 j = -1; j <= 1; j++) {
+                    const vx_uint32 neighbor = center[i * STRIDE + j];
+                    if (((i < 0) || ((i == 0) && (j < 0))) && (neighbor >= *center))
+                        peak = false;
+                    if (((i > 0) || ((i == 0) && (j > 0))) && (neighbor > *center))
+                        peak = false;
+                }
+            }
+            if (!peak)
+                continue;
+            vx_int32 k = count;
+            while ((k > 0) && ((vx_uint32)lines[(k - 1) * SIZE + HIFLIPVX::HOUGH_VOTES] < *center)) {
+                for (vx_int32 f = 0; (k < MAX_LINES) && (f < SIZE); f++)
+                    lines[k * SIZE + f] = lines[(k - 1) * SIZE + f];
+                k--;
+            }
+            if (k < MAX_LINES) {
+                lines[k * SIZE + HIFLIPVX::HOUGH_RHO] = (r - RHO_OFFSET) * (1 << RHO_SHIFT);
+                lines[k * SIZE + HIFLIPVX::HOUGH_THETA] = t;
+                lines[k * SIZE + HIFLIPVX::HOUGH_VOTES] = (vx_int32)*center;
+                count = MIN(count + 1, MAX_LINES);
+            }
+        }
+    }
+    delete[] acc;
+    return count;
+}
+
+/*! \brief Compares the lines against the reference and checks if the drawn lines are the strongest lines */
+void swTestHoughLinesCheck(const char *name, vx_uint8 vec_num, vx_uint8 banks, vx_uint16 theta_num,
+                           const vx_int32 *reference, vx_uint16 reference_count, const vx_int32 *result,
+                           vx_uint16 result_count, const vx_int32 truth[][2], vx_uint16 truth_count) {
+    const vx_int32 SIZE = HIFLIPVX::HOUGH_RECORD_SIZE;
+    vx_uint32 errors = (result_count != reference_count) ? 1 : 0;
+    for (vx_uint32 i = 0; i < MIN(result_count, reference_count) * SIZE; i++)
+        errors += (result[i] != reference[i]) ? 1 : 0;
+
+    // A drawn line (theta in degrees, rho in pixels) is found if it is one of the strongest lines
+    vx_uint16 found = 0;
+    for (vx_uint16 l = 0; l < truth_count; l++) {
+        for (vx_uint16 k = 0; k < MIN(result_count, truth_count); k++) {
+            const vx_int32 rho = result[k * SIZE + HIFLIPVX::HOUGH_RHO];
+            const vx_int32 theta = result[k * SIZE + HIFLIPVX::HOUGH_THETA] * 180 / theta_num;
+            if ((abs(theta - truth[l][0]) <= 1) && (abs(rho - truth[l][1]) <= 2)) {
+                found++;
+                break;
+            }
+        }
+    }
+    printf(" %-12s (%d pixel/clock, %d theta banks): %d errors, %2d lines, %d of %d drawn lines found\n", name,
+           vec_num, banks, errors, result_count, found, truth_count);
+}
+
+/*! \brief Compares the Hough lines (all theta if PHASE_WINDOW < 0) against the reference */
+template <vx_uint8 VEC_NUM, vx_uint8 BANKS, vx_int32 PHASE_WINDOW>
+void swTestHoughLinesCompare(const char *name, vx_uint8 *edges, vx_uint8 *phase, const vx_int32 truth[][2],
+                             vx_uint16 truth_count) {
+    const vx_uint16 COLS = 256, ROWS = 128, THETA_NUM = 180, MAX_LINES = 8, THRESHOLD = 40;
+    const vx_uint8 RHO_SHIFT = 0, QUANTIZATION = 8;
+    const vx_uint16 WINDOW = (PHASE_WINDOW < 0) ? 0 : PHASE_WINDOW;
+    vx_int32 reference[MAX_LINES * HIFLIPVX::HOUGH_RECORD_SIZE], result[MAX_LINES * HIFLIPVX::HOUGH_RECORD_SIZE];
+    vx_uint16 reference_count = 0, result_count = 0;
+    reference_count = swTestHoughLinesReference<COLS, ROWS, THETA_NUM, RHO_SHIFT, MAX_LINES, THRESHOLD, QUANTIZATION,
+                                                PHASE_WINDOW>(edges, phase, reference);
+    if (PHASE_WINDOW < 0) {
+        ImgHoughLines<vx_uint8, VEC_NUM, COLS, ROWS, THETA_NUM, RHO_SHIFT, BANKS, MAX_LINES, THRESHOLD>(
+            edges, result, &result_count);
+    } else {
+        ImgHoughLines<vx_uint8, vx_uint8, VEC_NUM, COLS, ROWS, THETA_NUM, RHO_SHIFT, BANKS, MAX_LINES, THRESHOLD,
+                      QUANTIZATION, WINDOW>(edges, phase, result, &result_count);
+    }
+    swTestHoughLinesCheck(name, VEC_NUM, BANKS, THETA_NUM, reference, reference_count, result, result_count, truth,
+                          truth_count);
+}
+
+/*! \brief Tests the Hough lines on drawn lines and random edges (with and without phase) */
+void swTestHoughLines(void) {
+    const vx_uint16 COLS = 256, ROWS = 128, LINES = 3;
+    const vx_int32 truth[LINES][2] = {{30, 80}, {90, 64}, {135, -40}};
+    vx_uint8 *edges = new vx_uint8[COLS * ROWS];
+    vx_uint8 *phase = new vx_uint8[COLS * ROWS];
+
+    // Random edges with a random phase
+    for (vx_uint32 i = 0; i < COLS * ROWS; i++) {
+        edges[i] = ((rand() % 100) == 0) ? 255 : 0;
+        phase[i] = (vx_uint8)(rand() % 256);
+    }
+
+    // Lines with the gradient direction as phase (angle * 256 / 360)
+    for (vx_uint16 l = 0; l < LINES; l++) {
+        const vx_float64 angle = (vx_float64)truth[l][0] * M_PI / 180.0, rho = (vx_float64)truth[l][1];
+        const vx_uint8 bin = (vx_uint8)((truth[l][0] * 256 + 180) / 360);
+        for (vx_int32 i = 0; i < MAX(COLS, ROWS); i++) {
+            vx_int32 x = i, y = i;
+            if (fabs(sin(angle)) > fabs(cos(angle)))
+                y = (vx_int32)floor((rho - (vx_float64)x * cos(angle)) / sin(angle) + 0.5);
+            else
+                x = (vx_int32)floor((rho - (vx_float64)y * sin(angle)) / cos(angle) + 0.5);
+            if ((x >= 0) && (x < COLS) && (y >= 0) && (y < ROWS)) {
+                edges[y * COLS + x] = 255;
+                phase[y * COLS + x] = bin;
+            }
+        }
+    }
+
+    printf("Hough lines:\n");
+    swTestHoughLinesCompare<1, 1, -1>("All theta", edges, phase, truth, LINES);
+    swTestHoughLinesCompare<4, 4, -1>("All theta", edges, phase, truth, LINES);
+    swTestHoughLinesCompare<8, 6, -1>("All theta", edges, phase, truth, LINES);
+    swTestHoughLinesCompare<1, 4, 8>("Phase window", edges, phase, truth, LINES);
+    swTestHoughLinesCompare<2, 3, 15>("Phase window", edges, phase, truth, LINES);
+    swTestHoughLinesCompare<8, 1, 2>("Phase window", edges, phase, truth, LINES);
+    printf("\n");
+
+    delete[] edges;
+    delete[] phase;
+}
+
+/*! \brief Computes the template matching in software (the template is centered with a radius of (SIZE | 1) / 2) */
+template <typename DstType, vx_uint16 COLS, vx_uint16 ROWS, vx_uint16 SIZE, HIFLIPVX::TemplateMatchMode MODE,
+          vx_border_e BORDER_TYPE>
+void swTestMatchTemplateReference(const vx_uint8 *input, const vx_uint8 *templ, DstType *output) {
+    const vx_int32 RADIUS = (SIZE | 1) >> 1;
+    const vx_int64 PIXELS = (vx_int64)SIZE * SIZE;
+    const vx_int64 DST_MIN = (vx_int64)std::numeric_limits<DstType>::min();
+
+    // Sums of the template
+    vx_int64 pattern_sum = 0, pattern_sqr = 0;
+    for (vx_int32 i = 0; i < SIZE * SIZE; i++) {
+        pattern_sum += templ[i];
+        pattern_sqr += templ[i] * templ[i];
+    }
+    const vx_float32 pattern_dev = sqrtf((vx_float32)(PIXELS * pattern_sqr - pattern_sum * pattern_sum));
+
+    for (vx_int32 y = 0; y < ROWS; y++) {
+        for (vx_int32 x = 0; x < COLS; x++) {
+
+            // Sums of the image patch (constant border is zero, replicated border clamps the coordinates)
+            vx_int64 correlation = 0, sum = 0, sqr = 0;
+            for (vx_int32 i = 0; i < SIZE; i++) {
+                for (vx_int32 j = 0; j < SIZE; j++) {
+                    const vx_int32 row = y - RADIUS + i, col = x - RADIUS + j;
+                    vx_int64 value = 0;
+                    if ((row >= 0) && (row < ROWS) && (col >= 0) && (col < COLS))
+                        value = input[row * COLS + col];
+                    else if (BORDER_TYPE == VX_BORDER_REPLICATE)
+                        value = input[MAX(MIN(row, ROWS - 1), 0) * COLS + MAX(MIN(col, COLS - 1), 0)];
+                    correlation += value * templ[i * SIZE + j];
+                    sum += value;
+                    sqr += value * value;
+                }
+            }
+
+            // Response
+            vx_int64 result = 0;
+            if (MODE == HIFLIPVX::MATCH_SSD) {
+                result = MAX(-((sqr - 2 * correlation + pattern_sqr + PIXELS / 2) / PIXELS), DST_MIN);
+            } else {
+                const vx_float32 deviation = sqrtf((vx_float32)(PIXELS * sqr - sum * sum)) * pattern_dev;
+                if (deviation > 0.0f) {
+                    const vx_float32 ncc = (vx_float32)(PIXELS * correlation - sum * pattern_sum) / deviation;
+                    result = MAX(MIN((vx_int64)floorf(ncc * 16384.0f + 0.5f), 16384), -16384);
+                }
+            }
+            output[y * COLS + x] = (DstType)result;
+        }
+    }
+}
+
+/*! \brief Compares the template matching against the reference and checks if the best match is at the template */
+template <typename DstType, vx_uint8 VEC_NUM, vx_uint16 SIZE, HIFLIPVX::TemplateMatchMode MODE,
+          vx_border_e BORDER_TYPE>
+void swTestMatchTemplateCompare(const char *name, const vx_uint8 *input, vx_uint16 pos_x, vx_uint16 pos_y) {
+    const vx_uint16 COLS = 128, ROWS = 96;
+    const vx_int32 RADIUS = (SIZE | 1) >> 1;
+    vx_uint8 templ[SIZE][SIZE];
+    DstType *reference = new DstType[COLS * ROWS];
+    DstType *result = new DstType[COLS * ROWS];
+
+    // Cut the template out of the image
+    for (vx_uint16 i = 0; i < SIZE; i++) {
+        for (vx_uint16 j = 0; j < SIZE; j++)
+            templ[i][j] = input[(pos_y + i) * COLS + pos_x + j];
+    }
+
+    swTestMatchTemplateReference<DstType, COLS, ROWS, SIZE, MODE, BORDER_TYPE>(input, &templ[0][0], reference);
+    ImgMatchTemplate<DstType, VEC_NUM, COLS, ROWS, SIZE, MODE, BORDER_TYPE>((vx_uint8 *)input, result, templ);
+
+    // Errors and position of the best match
+    vx_uint32 errors = 0, best = 0;
+    for (vx_uint32 i = 0; i < COLS * ROWS; i++) {
+        errors += (result[i] != reference[i]) ? 1 : 0;
+        best = (result[i] > result[best]) ? i : best;
+    }
+    const bool found = ((best % COLS) == (vx_uint32)(pos_x + RADIUS)) && ((best / COLS) == (vx_uint32)(pos_y + RADIUS));
+    printf(" %-4s %2dx%-2d (%d pixel/clock, %-9s border): %d errors, best match %s (%5d)\n", name, SIZE, SIZE,
+           VEC_NUM, (BORDER_TYPE == VX_BORDER_CONSTANT) ? "constant" : "replicate", errors, found ? "found" : "missed",
+           result[best]);
+
+    delete[] reference;
+    delete[] result;
+}
+
+/*! \brief Tests the template matching (SSD and NCC) and extracts the NCC peaks as features */
+void swTestMatchTemplate(void) {
+    const vx_uint16 COLS = 128, ROWS = 96, SIZE = 32, MAX_FEATURES = 16;
+    const vx_uint16 POS_X = 70, POS_Y = 40;
+    const vx_int16 THRESHOLD = 14746;
+    vx_uint8 *input = new vx_uint8[COLS * ROWS];
+    vx_int16 *response = new vx_int16[COLS * ROWS];
+    KeyPoint features[MAX_FEATURES];
+    vx_uint8 templ[SIZE][SIZE];
+
+    // Smooth random image
+    for (vx_uint16 y = 0; y < ROWS; y++) {
+        for (vx_uint16 x = 0; x < COLS; x++)
+            input[y * COLS + x] = (vx_uint8)((x * 3 + y * 2) % 128 + rand() % 128);
+    }
+
+    printf("Template matching:\n");
+    swTestMatchTemplateCompare<vx_int32, 1, 32, HIFLIPVX::MATCH_SSD, VX_BORDER_CONSTANT>("SSD", input, POS_X, POS_Y);
+    swTestMatchTemplateCompare<vx_int16, 4, 32, HIFLIPVX::MATCH_SSD, VX_BORDER_REPLICATE>("SSD", input, POS_X, POS_Y);
+    swTestMatchTemplateCompare<vx_int16, 2, 15, HIFLIPVX::MATCH_SSD, VX_BORDER_REPLICATE>("SSD", input, 3, 80);
+    swTestMatchTemplateCompare<vx_int16, 1, 32, HIFLIPVX::MATCH_NCC, VX_BORDER_CONSTANT>("NCC", input, POS_X, POS_Y);
+    swTestMatchTemplateCompare<vx_int32, 4, 32, HIFLIPVX::MATCH_NCC, VX_BORDER_REPLICATE>("NCC", input, POS_X, POS_Y);
+    swTestMatchTemplateCompare<vx_int16, 8, 15, HIFLIPVX::MATCH_NCC, VX_BORDER_CONSTANT>("NCC", input, 110, 0);
+
+    // The NCC response is directly used by the feature extraction
+    for (vx_uint16 i = 0; i < SIZE; i++) {
+        for (vx_uint16 j = 0; j < SIZE; j++)
+            templ[i][j] = input[(POS_Y + i) * COLS + POS_X + j];
+    }
+    ImgMatchTemplate<vx_int16, 1, COLS, ROWS, SIZE, HIFLIPVX::MATCH_NCC, VX_BORDER_CONSTANT>(input, response, templ);
+    ImgFeatureExtraction<vx_int16, COLS, ROWS, MAX_FEATURES, 0, THRESHOLD, 0>(response, features);
+    printf(" NCC feature extraction (threshold %d): match at (%d, %d), next feature %s\n", THRESHOLD, features[0].x,
+           features[0].y, (features[1].x == 0xffff) && (features[1].y == 0xffff) ? "invalid" : "valid");
+    printf("\n");
+
+    delete[] input;
+    delete[] response;
+}
+
 /*! \brief Tests the Table Lookup Function */
 void swTestTableLookup(void) {
 
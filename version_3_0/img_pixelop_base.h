@@ -332,28 +332,37 @@ void ImgSubtract(DataType input1[IMG_PIXEL / VEC_SIZE],              //
 
 /*********************************************************************************************************************/
 /** @brief Implements the Gradient Magnitude Computation Kernel.
+           The accuracy tier trades precision for latency and resources of the square root:
+           ACCURACY_LUT:          max(max, 7/8 * max + 1/2 * min), no square root, no DSP.
+                                  Relative error between -3.0% and +0.8% (+-1).
+           ACCURACY_CORDIC_SHORT: 3/4 of the square root stages (6, 12 or 24 stages for 8, 16 or 32-bit).
+                                  Max. error < 2^(bits/4): 4, 16 or 256 for 8, 16 or 32-bit.
+           ACCURACY_CORDIC_FULL:  All square root stages. Exact OpenVX results.
 @param DataType      Data type of the image pixels
 @param VEC_SIZE        Amount of pixels computed in parallel
 @param IMG_PIXEL       Amount of pixels in the image
 @param ROUND_POLICY    The round policy <tt>\ref vx_round_policy_e</tt>
+@param ACCURACY        The accuracy tier <tt>\ref HIFLIPVX::ArithmeticAccuracy</tt>
 @param input1          Input image
 @param input2          Input image
 @param output          Output image
 */
-template <typename SrcType, typename DstType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, //
-          vx_round_policy_e ROUND_POLICY>                                           //
-void ImgMagnitude(vx_image_data<SrcType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],      //
-                  vx_image_data<SrcType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],      //
-                  vx_image_data<DstType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE]) {    //
+template <typename SrcType, typename DstType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,  //
+          vx_round_policy_e ROUND_POLICY,                                            //
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_FULL>    //
+void ImgMagnitude(vx_image_data<SrcType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],       //
+                  vx_image_data<SrcType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],       //
+                  vx_image_data<DstType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE]) {     //
 #pragma HLS INLINE
     HIFLIPVX_DATAPACK(input1, input2, output);
     PixelwiseSameWidth<SrcType, DstType, VEC_SIZE, IMG_PIXEL, HIFLIPVX::MAGNITUDE, //
                        VX_CONVERT_POLICY_SATURATE, ROUND_POLICY,                     //
                        VX_THRESHOLD_TYPE_BINARY, 0, 0,                               //
-                       1, 1>(input1, input2, output);                                //
+                       1, 1, ACCURACY>(input1, input2, output);                      //
 }
 template <typename SrcType, typename DstType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, //
-          vx_round_policy_e ROUND_POLICY>                            //
+          vx_round_policy_e ROUND_POLICY,                                           //
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_FULL>   //
 void ImgMagnitude(SrcType input1[IMG_PIXEL / VEC_SIZE],                               //
                   SrcType input2[IMG_PIXEL / VEC_SIZE],                               //
                   DstType output[IMG_PIXEL / VEC_SIZE]) {                             //
@@ -361,9 +370,31 @@ void ImgMagnitude(SrcType input1[IMG_PIXEL / VEC_SIZE],
     PixelwiseSameWidth<SrcType, DstType, VEC_SIZE, IMG_PIXEL, HIFLIPVX::MAGNITUDE, //
                        VX_CONVERT_POLICY_SATURATE, ROUND_POLICY,                     //
                        VX_THRESHOLD_TYPE_BINARY, 0, 0,                               //
-                       1, 1>(input1, input2, output);                                //
+                       1, 1, ACCURACY>(input1, input2, output);                      //
 }
 
+#if !defined(__SYNTHESIS__)
+/*********************************************************************************************************************/
+/** @brief  CPU version of ImgMagnitude with bit-exact results (8 pixels at once for 8 and 16-bit images if compiled
+            with AVX2, e.g. -mavx2)
+@param SrcType         Data type of the input images
+@param DstType         Data type of the output image
+@param IMG_PIXEL       Amount of pixels in the image
+@param ROUND_POLICY    The round policy <tt>\ref vx_round_policy_e</tt>
+@param ACCURACY        The accuracy tier <tt>\ref HIFLIPVX::ArithmeticAccuracy</tt>
+@param input1          Input image
+@param input2          Input image
+@param output          Output image
+*/
+template <typename SrcType, typename DstType, vx_uint32 IMG_PIXEL, vx_round_policy_e ROUND_POLICY, //
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_FULL>                  //
+void CpuMagnitude(const SrcType input1[IMG_PIXEL],                                                 //
+                  const SrcType input2[IMG_PIXEL],                                                 //
+                  DstType output[IMG_PIXEL]) {                                                     //
+    MagnitudeCpu<SrcType, DstType, IMG_PIXEL, ROUND_POLICY, ACCURACY>(input1, input2, output);
+}
+#endif
+
 /*********************************************************************************************************************/
 /** @brief Performs element-wise multiplication between two images and a scalar value.
 @param DataType        Data type of the image pixels
@@ -468,6 +499,254 @@ void ImgWeightedAverage(DataType input1[IMG_PIXEL / VEC_SIZE],       //
                       ALPHA, 1>(input1, input2, output);                         //
 }
 
+/*********************************************************************************************************************/
+/** @brief  Weighted sum of 2 to 8 input images to an output image: output = sum(weights[n] * input[n]).
+            Replaces a chain of weighted averages by a single pass (e.g. temporal smoothing or HDR fusion).
+            Every input image has its own stream, so all inputs are read in the same clock cycle.
+@param DataType       Data type of the image pixels
+@param VEC_SIZE       Amount of pixels computed in parallel
+@param IMG_PIXEL      Amount of pixels in the image
+@param CONV_POLICY    The conversion policy <tt>\ref vx_convert_policy_e</tt>
+@param ROUND_POLICY   The round policy <tt>\ref vx_round_policy_e</tt>
+@param input1         1. input image
+@param input2         2. input image
+@param input3         3. input image (optional)
+@param input4         4. input image (optional)
+@param input5         5. input image (optional)
+@param input6         6. input image (optional)
+@param input7         7. input image (optional)
+@param input8         8. input image (optional)
+@param output         Output image
+@param weights        The weight of each input image in fixed-point between 0 and 256 using 16-bit fraction
+*/
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,                     //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>               //
+void ImgWeightedSum(vx_image_data<DataType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE],      //
+                    const vx_uint32 weights[2]) {                                        //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input1, input2, output);
+    PixelwiseWeightedSum<DataType, VEC_SIZE, IMG_PIXEL, 2, CONV_POLICY, ROUND_POLICY>(
+        input1, input2, input1, input1, input1, input1, input1, input1, output, weights);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,                     //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>               //
+void ImgWeightedSum(DataType input1[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input2[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType output[IMG_PIXEL / VEC_SIZE],                               //
+                    const vx_uint32 weights[2]) {                                        //
+#pragma HLS INLINE
+    PixelwiseWeightedSum<DataType, VEC_SIZE, IMG_PIXEL, 2, CONV_POLICY, ROUND_POLICY>(
+        input1, input2, input1, input1, input1, input1, input1, input1, output, weights);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,                     //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>               //
+void ImgWeightedSum(vx_image_data<DataType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input3[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE],      //
+                    const vx_uint32 weights[3]) {                                        //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input1, input2, input3, output);
+    PixelwiseWeightedSum<DataType, VEC_SIZE, IMG_PIXEL, 3, CONV_POLICY, ROUND_POLICY>(
+        input1, input2, input3, input1, input1, input1, input1, input1, output, weights);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,                     //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>               //
+void ImgWeightedSum(DataType input1[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input2[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input3[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType output[IMG_PIXEL / VEC_SIZE],                               //
+                    const vx_uint32 weights[3]) {                                        //
+#pragma HLS INLINE
+    PixelwiseWeightedSum<DataType, VEC_SIZE, IMG_PIXEL, 3, CONV_POLICY, ROUND_POLICY>(
+        input1, input2, input3, input1, input1, input1, input1, input1, output, weights);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,                     //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>               //
+void ImgWeightedSum(vx_image_data<DataType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input3[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input4[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE],      //
+                    const vx_uint32 weights[4]) {                                        //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input1, input2, input3, input4, output);
+    PixelwiseWeightedSum<DataType, VEC_SIZE, IMG_PIXEL, 4, CONV_POLICY, ROUND_POLICY>(
+        input1, input2, input3, input4, input1, input1, input1, input1, output, weights);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,                     //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>               //
+void ImgWeightedSum(DataType input1[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input2[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input3[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input4[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType output[IMG_PIXEL / VEC_SIZE],                               //
+                    const vx_uint32 weights[4]) {                                        //
+#pragma HLS INLINE
+    PixelwiseWeightedSum<DataType, VEC_SIZE, IMG_PIXEL, 4, CONV_POLICY, ROUND_POLICY>(
+        input1, input2, input3, input4, input1, input1, input1, input1, output, weights);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,                     //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>               //
+void ImgWeightedSum(vx_image_data<DataType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input3[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input4[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input5[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE],      //
+                    const vx_uint32 weights[5]) {                                        //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input1, input2, input3, input4, input5, output);
+    PixelwiseWeightedSum<DataType, VEC_SIZE, IMG_PIXEL, 5, CONV_POLICY, ROUND_POLICY>(
+        input1, input2, input3, input4, input5, input1, input1, input1, output, weights);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,                     //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>               //
+void ImgWeightedSum(DataType input1[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input2[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input3[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input4[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input5[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType output[IMG_PIXEL / VEC_SIZE],                               //
+                    const vx_uint32 weights[5]) {                                        //
+#pragma HLS INLINE
+    PixelwiseWeightedSum<DataType, VEC_SIZE, IMG_PIXEL, 5, CONV_POLICY, ROUND_POLICY>(
+        input1, input2, input3, input4, input5, input1, input1, input1, output, weights);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,                     //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>               //
+void ImgWeightedSum(vx_image_data<DataType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input3[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input4[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input5[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input6[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE],      //
+                    const vx_uint32 weights[6]) {                                        //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input1, input2, input3, input4, input5, input6, output);
+    PixelwiseWeightedSum<DataType, VEC_SIZE, IMG_PIXEL, 6, CONV_POLICY, ROUND_POLICY>(
+        input1, input2, input3, input4, input5, input6, input1, input1, output, weights);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,                     //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>               //
+void ImgWeightedSum(DataType input1[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input2[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input3[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input4[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input5[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input6[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType output[IMG_PIXEL / VEC_SIZE],                               //
+                    const vx_uint32 weights[6]) {                                        //
+#pragma HLS INLINE
+    PixelwiseWeightedSum<DataType, VEC_SIZE, IMG_PIXEL, 6, CONV_POLICY, ROUND_POLICY>(
+        input1, input2, input3, input4, input5, input6, input1, input1, output, weights);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,                     //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>               //
+void ImgWeightedSum(vx_image_data<DataType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input3[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input4[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input5[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input6[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input7[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE],      //
+                    const vx_uint32 weights[7]) {                                        //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input1, input2, input3, input4, input5, input6, input7, output);
+    PixelwiseWeightedSum<DataType, VEC_SIZE, IMG_PIXEL, 7, CONV_POLICY, ROUND_POLICY>(
+        input1, input2, input3, input4, input5, input6, input7, input1, output, weights);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,                     //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>               //
+void ImgWeightedSum(DataType input1[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input2[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input3[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input4[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input5[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input6[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input7[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType output[IMG_PIXEL / VEC_SIZE],                               //
+                    const vx_uint32 weights[7]) {                                        //
+#pragma HLS INLINE
+    PixelwiseWeightedSum<DataType, VEC_SIZE, IMG_PIXEL, 7, CONV_POLICY, ROUND_POLICY>(
+        input1, input2, input3, input4, input5, input6, input7, input1, output, weights);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,                     //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>               //
+void ImgWeightedSum(vx_image_data<DataType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input3[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input4[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input5[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input6[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input7[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> input8[IMG_PIXEL / VEC_SIZE],      //
+                    vx_image_data<DataType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE],      //
+                    const vx_uint32 weights[8]) {                                        //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input1, input2, input3, input4, input5, input6, input7, input8, output);
+    PixelwiseWeightedSum<DataType, VEC_SIZE, IMG_PIXEL, 8, CONV_POLICY, ROUND_POLICY>(
+        input1, input2, input3, input4, input5, input6, input7, input8, output, weights);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,                     //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>               //
+void ImgWeightedSum(DataType input1[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input2[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input3[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input4[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input5[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input6[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input7[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType input8[IMG_PIXEL / VEC_SIZE],                               //
+                    DataType output[IMG_PIXEL / VEC_SIZE],                               //
+                    const vx_uint32 weights[8]) {                                        //
+#pragma HLS INLINE
+    PixelwiseWeightedSum<DataType, VEC_SIZE, IMG_PIXEL, 8, CONV_POLICY, ROUND_POLICY>(
+        input1, input2, input3, input4, input5, input6, input7, input8, output, weights);
+}
+
+/*********************************************************************************************************************/
+/** @brief  Background subtraction with a running Gaussian model per pixel. Reads and updates the model in one pass
+            and outputs a foreground mask. The model needs 32 bits per pixel: mean (Q8.8) and variance (Q12.4).
+@param VEC_SIZE       Amount of pixels computed in parallel
+@param IMG_PIXEL      Amount of pixels in the image
+@param ALPHA          The learning rate in fixed-point (16-bit fraction) between 0.0 and 1.0
+@param THRESHOLD      Foreground if |pixel - mean| > THRESHOLD * stddev, in fixed-point (4-bit fraction)
+@param MIN_VARIANCE   The lower bound of the variance in fixed-point (4-bit fraction)
+@param INIT_VARIANCE  The variance of a new model in fixed-point (4-bit fraction)
+@param SELECTIVE      Is true if foreground pixels do not update the model
+@param input          Input image
+@param model_in       Background model of the previous frame (set to 0 for the first frame)
+@param model_out      Updated background model
+@param mask           Foreground mask (255 foreground, 0 background)
+*/
+template <vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, vx_uint32 ALPHA, vx_uint16 THRESHOLD,        //
+          vx_uint16 MIN_VARIANCE, vx_uint16 INIT_VARIANCE, bool SELECTIVE>                     //
+void ImgBackgroundSubtract(vx_image_data<vx_uint8, VEC_SIZE> input[IMG_PIXEL / VEC_SIZE],      //
+                           vx_image_data<vx_uint32, VEC_SIZE> model_in[IMG_PIXEL / VEC_SIZE],  //
+                           vx_image_data<vx_uint32, VEC_SIZE> model_out[IMG_PIXEL / VEC_SIZE], //
+                           vx_image_data<vx_uint8, VEC_SIZE> mask[IMG_PIXEL / VEC_SIZE]) {     //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input, model_in, model_out, mask);
+    PixelwiseBackgroundSubtract<VEC_SIZE, IMG_PIXEL, ALPHA, THRESHOLD, MIN_VARIANCE, INIT_VARIANCE, SELECTIVE>( //
+        input, model_in, model_out, mask);                                                                      //
+}
+template <vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, vx_uint32 ALPHA, vx_uint16 THRESHOLD, //
+          vx_uint16 MIN_VARIANCE, vx_uint16 INIT_VARIANCE, bool SELECTIVE>              //
+void ImgBackgroundSubtract(vx_uint8 input[IMG_PIXEL / VEC_SIZE],                        //
+                           vx_uint32 model_in[IMG_PIXEL / VEC_SIZE],                    //
+                           vx_uint32 model_out[IMG_PIXEL / VEC_SIZE],                   //
+                           vx_uint8 mask[IMG_PIXEL / VEC_SIZE]) {                       //
+#pragma HLS INLINE
+    PixelwiseBackgroundSubtract<VEC_SIZE, IMG_PIXEL, ALPHA, THRESHOLD, MIN_VARIANCE, INIT_VARIANCE, SELECTIVE>( //
+        (vx_image_data<vx_uint8, VEC_SIZE> *)input, (vx_image_data<vx_uint32, VEC_SIZE> *)model_in,             //
+        (vx_image_data<vx_uint32, VEC_SIZE> *)model_out, (vx_image_data<vx_uint8, VEC_SIZE> *)mask);            //
+}
+
 /*********************************************************************************************************************/
 /** @brief  Thresholds an input image and produces an output Boolean image.
 @param DataType       Data type of the image pixels
@@ -510,30 +789,147 @@ void ImgThreshold(DataType input1[IMG_PIXEL / VEC_SIZE],
 @param IMG_PIXEL      Amount of pixels in the image
 @param QUANTIZATION   The quantisazion of the orientation values.
                       Allowed values Q = [1..8]. 2^(Q) different output values
+@param ACCURACY       The accuracy tier <tt>\ref HIFLIPVX::ArithmeticAccuracy</tt>.
+                      Max. angle error before quantization:
+                      ACCURACY_LUT:          16x32 table, no iterations, no DSP. 2.1 degree.
+                      ACCURACY_CORDIC_SHORT: 8 CORDIC iterations. 1.0 degree (8-bit), 0.5 degree (16/32-bit).
+                      ACCURACY_CORDIC_FULL:  15 CORDIC iterations. 0.02 degree.
+                      One orientation bin is 360 / 2^Q degree (1.4 degree for Q = 8).
 @param input_x        Input vectors in x direction
 @param input_y        Input vectors in y direction
 @param output         Output orientations
 */
-template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, vx_uint8 QUANTIZATION> //
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, vx_uint8 QUANTIZATION, //
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_SHORT>          //
 void ImgPhase(vx_image_data<DataType, VEC_SIZE> input_x[IMG_PIXEL / VEC_SIZE],              //
               vx_image_data<DataType, VEC_SIZE> input_y[IMG_PIXEL / VEC_SIZE],              //
               vx_image_data<DataType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE]) {             //
 #pragma HLS INLINE
     HIFLIPVX_DATAPACK(input_x, input_y, output);
-    PixelwiseSameType<DataType, VEC_SIZE, IMG_PIXEL, HIFLIPVX::PHASE,  //
-                      VX_CONVERT_POLICY_WRAP, VX_ROUND_POLICY_TO_ZERO, //
-                      VX_THRESHOLD_TYPE_BINARY, 0, 0,                  //
-                      1, QUANTIZATION>(input_x, input_y, output);      //
+    PixelwiseSameType<DataType, VEC_SIZE, IMG_PIXEL, HIFLIPVX::PHASE,       //
+                      VX_CONVERT_POLICY_WRAP, VX_ROUND_POLICY_TO_ZERO,      //
+                      VX_THRESHOLD_TYPE_BINARY, 0, 0,                       //
+                      1, QUANTIZATION, ACCURACY>(input_x, input_y, output); //
 }
-template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, vx_uint8 QUANTIZATION> //
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, vx_uint8 QUANTIZATION, //
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_SHORT>          //
 void ImgPhase(DataType input_x[IMG_PIXEL / VEC_SIZE],                                       //
               DataType input_y[IMG_PIXEL / VEC_SIZE],                                       //
               DataType output[IMG_PIXEL / VEC_SIZE]) {                                      //
 #pragma HLS INLINE
-    PixelwiseSameType<DataType, VEC_SIZE, IMG_PIXEL, HIFLIPVX::PHASE,  //
-                      VX_CONVERT_POLICY_WRAP, VX_ROUND_POLICY_TO_ZERO, //
-                      VX_THRESHOLD_TYPE_BINARY, 0, 0,                  //
-                      1, QUANTIZATION>(input_x, input_y, output);      //
+    PixelwiseSameType<DataType, VEC_SIZE, IMG_PIXEL, HIFLIPVX::PHASE,       //
+                      VX_CONVERT_POLICY_WRAP, VX_ROUND_POLICY_TO_ZERO,      //
+                      VX_THRESHOLD_TYPE_BINARY, 0, 0,                       //
+                      1, QUANTIZATION, ACCURACY>(input_x, input_y, output); //
+}
+
+#if !defined(__SYNTHESIS__)
+/*********************************************************************************************************************/
+/** @brief  CPU version of ImgPhase with bit-exact results (8 pixels at once for 8 and 16-bit images if compiled with
+            AVX2, e.g. -mavx2)
+@param DataType       Data type of the image pixels
+@param IMG_PIXEL      Amount of pixels in the image
+@param QUANTIZATION   The quantization for the different amount of orientations
+@param ACCURACY       The accuracy tier <tt>\ref HIFLIPVX::ArithmeticAccuracy</tt>
+@param input_x        Input vectors in x direction
+@param input_y        Input vectors in y direction
+@param output         Output orientations
+*/
+template <typename DataType, vx_uint32 IMG_PIXEL, vx_uint8 QUANTIZATION,                   //
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_SHORT>         //
+void CpuPhase(const DataType input_x[IMG_PIXEL],                                           //
+              const DataType input_y[IMG_PIXEL],                                           //
+              DataType output[IMG_PIXEL]) {                                                //
+    PhaseCpu<DataType, IMG_PIXEL, QUANTIZATION, ACCURACY>(input_x, input_y, output);
+}
+#endif
+
+/*********************************************************************************************************************/
+/** @brief  Computes a chain of pixelwise operations in one streamed pass (kernel fusion).
+            The expression is a compile-time tree of PixelwiseNode, PixelwiseSource and PixelwiseConstant.
+            Every node keeps its own conversion and rounding policy. The intermediate results are not written
+            back to memory. Example: saturate((a - b) * k + c):
+            PixelwiseNode<HIFLIPVX::ARITHMETIC_ADDITION,
+                PixelwiseNode<HIFLIPVX::MULTIPLY_CONSTANT,
+                    PixelwiseNode<HIFLIPVX::ARITHMETIC_SUBTRACTION, PixelwiseSource<0>, PixelwiseSource<1>,
+                                  VX_CONVERT_POLICY_SATURATE>,
+                    PixelwiseSource<0>, VX_CONVERT_POLICY_SATURATE, VX_ROUND_POLICY_TO_ZERO, K>,
+                PixelwiseSource<2>, VX_CONVERT_POLICY_SATURATE>
+            K is a fixed-point number with 16-bit fraction (between 0.0 and 1.0).
+            Every given input image is read, also if the expression does not use it.
+@param DataType       Data type of the image pixels
+@param VEC_SIZE       Amount of pixels computed in parallel
+@param IMG_PIXEL      Amount of pixels in the image
+@param Expression     The expression tree
+@param input1         Input image (PixelwiseSource<0>)
+@param input2         Input image (PixelwiseSource<1>)
+@param input3         Input image (PixelwiseSource<2>)
+@param input4         Input image (PixelwiseSource<3>)
+@param output         Output image
+*/
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, typename Expression> //
+void ImgPixelwiseFused(vx_image_data<DataType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],    //
+                       vx_image_data<DataType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE]) {  //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input1, output);
+    PixelwiseFused<DataType, VEC_SIZE, IMG_PIXEL, Expression, 1>(input1, input1, input1, input1, output);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, typename Expression> //
+void ImgPixelwiseFused(DataType input1[IMG_PIXEL / VEC_SIZE],                             //
+                       DataType output[IMG_PIXEL / VEC_SIZE]) {                           //
+#pragma HLS INLINE
+    PixelwiseFused<DataType, VEC_SIZE, IMG_PIXEL, Expression, 1>(input1, input1, input1, input1, output);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, typename Expression> //
+void ImgPixelwiseFused(vx_image_data<DataType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],    //
+                       vx_image_data<DataType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],    //
+                       vx_image_data<DataType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE]) {  //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input1, input2, output);
+    PixelwiseFused<DataType, VEC_SIZE, IMG_PIXEL, Expression, 2>(input1, input2, input1, input1, output);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, typename Expression> //
+void ImgPixelwiseFused(DataType input1[IMG_PIXEL / VEC_SIZE],                             //
+                       DataType input2[IMG_PIXEL / VEC_SIZE],                             //
+                       DataType output[IMG_PIXEL / VEC_SIZE]) {                           //
+#pragma HLS INLINE
+    PixelwiseFused<DataType, VEC_SIZE, IMG_PIXEL, Expression, 2>(input1, input2, input1, input1, output);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, typename Expression> //
+void ImgPixelwiseFused(vx_image_data<DataType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],    //
+                       vx_image_data<DataType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],    //
+                       vx_image_data<DataType, VEC_SIZE> input3[IMG_PIXEL / VEC_SIZE],    //
+                       vx_image_data<DataType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE]) {  //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input1, input2, input3, output);
+    PixelwiseFused<DataType, VEC_SIZE, IMG_PIXEL, Expression, 3>(input1, input2, input3, input1, output);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, typename Expression> //
+void ImgPixelwiseFused(DataType input1[IMG_PIXEL / VEC_SIZE],                             //
+                       DataType input2[IMG_PIXEL / VEC_SIZE],                             //
+                       DataType input3[IMG_PIXEL / VEC_SIZE],                             //
+                       DataType output[IMG_PIXEL / VEC_SIZE]) {                           //
+#pragma HLS INLINE
+    PixelwiseFused<DataType, VEC_SIZE, IMG_PIXEL, Expression, 3>(input1, input2, input3, input1, output);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, typename Expression> //
+void ImgPixelwiseFused(vx_image_data<DataType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],    //
+                       vx_image_data<DataType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],    //
+                       vx_image_data<DataType, VEC_SIZE> input3[IMG_PIXEL / VEC_SIZE],    //
+                       vx_image_data<DataType, VEC_SIZE> input4[IMG_PIXEL / VEC_SIZE],    //
+                       vx_image_data<DataType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE]) {  //
+#pragma HLS INLINE
+    HIFLIPVX_DATAPACK(input1, input2, input3, input4, output);
+    PixelwiseFused<DataType, VEC_SIZE, IMG_PIXEL, Expression, 4>(input1, input2, input3, input4, output);
+}
+template <typename DataType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, typename Expression> //
+void ImgPixelwiseFused(DataType input1[IMG_PIXEL / VEC_SIZE],                             //
+                       DataType input2[IMG_PIXEL / VEC_SIZE],                             //
+                       DataType input3[IMG_PIXEL / VEC_SIZE],                             //
+                       DataType input4[IMG_PIXEL / VEC_SIZE],                             //
+                       DataType output[IMG_PIXEL / VEC_SIZE]) {                           //
+#pragma HLS INLINE
+    PixelwiseFused<DataType, VEC_SIZE, IMG_PIXEL, Expression, 4>(input1, input2, input3, input4, output);
 }
 
 #endif /* SRC_IMG_PIXELOP_BASE_H_ */
@@ -21,6 +21,44 @@
 /* Compute Magnitude */
 /*********************************************************************************************************************/
 
+/*! \brief Computes the square root of the magnitude depending on the accuracy tier
+    \details ACCURACY_LUT:          shift-add approximation, relative error [-3.0%, +0.8%] (+-1) \n
+             ACCURACY_CORDIC_SHORT: 3/4 of the square root stages, max. error < 2^(output bits / 4) \n
+             ACCURACY_CORDIC_FULL:  all square root stages, exact OpenVX results \n
+@param ResultUint      Data type of the result
+@param CompUint        Data type for the computation
+@param ROUND_POLICY    Rounding policy (to zero & nearest even)
+@param ACCURACY        Accuracy tier
+@param abs1            Absolute value of the 1. input pixel
+@param abs2            Absolute value of the 2. input pixel
+@param square_sum      abs1^2 + abs2^2
+@return                Result
+*/
+template <typename ResultUint, typename CompUint, vx_round_policy_e ROUND_POLICY, //
+          HIFLIPVX::ArithmeticAccuracy ACCURACY>                                  //
+ResultUint MagnitudeRoot(CompUint abs1, CompUint abs2, CompUint square_sum) {     //
+#pragma HLS INLINE
+
+    const vx_uint32 COMPUTE_TYPE = sizeof(CompUint);
+    const vx_uint8 RESULT_BITS = sizeof(ResultUint) * 8;
+    const vx_uint8 SHORT_STAGES = (RESULT_BITS * 3) / 4;
+
+    ResultUint result = 0;
+    if (ACCURACY == HIFLIPVX::ACCURACY_LUT) {
+        result = HypotAlphaMaxBetaMin<ResultUint, CompUint>(abs1, abs2);
+    } else if (ACCURACY == HIFLIPVX::ACCURACY_CORDIC_SHORT) {
+        result = SqrtShort<ResultUint, CompUint, ROUND_POLICY, RESULT_BITS, SHORT_STAGES>(square_sum);
+    } else if (COMPUTE_TYPE == 8) {
+        if (ROUND_POLICY == VX_ROUND_POLICY_TO_NEAREST_EVEN)
+            result = static_cast<ResultUint>(sqrtf(static_cast<vx_float64>(square_sum)) + 0.5);
+        else
+            result = static_cast<ResultUint>(sqrtf(static_cast<vx_float64>(square_sum)));
+    } else {
+        result = SqrtLester<ResultUint, CompUint, true, ROUND_POLICY, RESULT_BITS>(square_sum);
+    }
+    return result;
+}
+
 /*! \brief Compute Magnitude of one pixel (signed)
     \details Tested for 8, 16 and 32 bit | exact OpenVX results
 @param ScalarInt       Data type of the image pixels
@@ -29,18 +67,17 @@
 @param CompUint        Data type for the computation
 @param CONV_POLICY     Conversion policy (wrap & saturate)
 @param ROUND_POLICY    Rounding policy (to zero & nearest even)
+@param ACCURACY        Accuracy tier of the square root
 @param input1          1. input pixel
 @param input2          2. input pixel
 @return                Result
 */
-template <typename ScalarInt, typename ScalarUint, typename CompInt, typename CompUint, //
-          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>              //
-ScalarInt MagnitudeSigned(ScalarInt input1,                                             //
-                          ScalarInt input2) {                                           //
+template <typename ScalarInt, typename ScalarUint, typename CompInt, typename CompUint,                    //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY, HIFLIPVX::ArithmeticAccuracy ACCURACY> //
+ScalarInt MagnitudeSigned(ScalarInt input1,                                                                //
+                          ScalarInt input2) {                                                              //
 #pragma HLS INLINE
 
-    const vx_uint32 COMPUTE_TYPE = sizeof(CompUint);
-
     // Get max value for overflow
     const ScalarUint MAX_VAL = static_cast<ScalarUint>(ComputeMax<ScalarInt>());
 
@@ -52,15 +89,9 @@ ScalarInt MagnitudeSigned(ScalarInt input1,
     CompUint C = AA + BB;
 
     // Square Root
-    ScalarUint D = 0;
-    if (COMPUTE_TYPE == 8) {
-        if (ROUND_POLICY == VX_ROUND_POLICY_TO_NEAREST_EVEN)
-            D = static_cast<ScalarUint>(sqrtf(static_cast<vx_float64>(C)) + 0.5);
-        else
-            D = static_cast<ScalarUint>(sqrtf(static_cast<vx_float64>(C)));
-    } else {
-        D = SqrtLester<ScalarUint, CompUint, true, ROUND_POLICY, sizeof(ScalarUint) * 8>(C);
-    }
+    CompUint absA = static_cast<CompUint>((A < 0) ? (-A) : (A));
+    CompUint absB = static_cast<CompUint>((B < 0) ? (-B) : (B));
+    ScalarUint D = MagnitudeRoot<ScalarUint, CompUint, ROUND_POLICY, ACCURACY>(absA, absB, C);
 
     // Overflow (Saturation) - due to conversion back to signed
     ScalarUint E = 0;
@@ -80,18 +111,17 @@ ScalarInt MagnitudeSigned(ScalarInt input1,
 @param CompUint        Data type for the computation
 @param CONV_POLICY     Conversion policy (wrap & saturate)
 @param ROUND_POLICY    Rounding policy (to zero & nearest even)
+@param ACCURACY        Accuracy tier of the square root
 @param input1          1. input pixel
 @param input2          2. input pixel
 @return                Result
 */
-template <typename ScalarUint, typename CompUint,                          //
-          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY> //
-ScalarUint MagnitudeUnsigned(ScalarUint input1,                            //
-                             ScalarUint input2) {                          //
+template <typename ScalarUint, typename CompUint,                                                          //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY, HIFLIPVX::ArithmeticAccuracy ACCURACY> //
+ScalarUint MagnitudeUnsigned(ScalarUint input1,                                                            //
+                             ScalarUint input2) {                                                          //
 #pragma HLS INLINE
 
-    const vx_uint32 COMPUTE_TYPE = sizeof(CompUint);
-
     // Get max value for overflow
     const ScalarUint MAX_VAL = static_cast<ScalarUint>(ComputeMax<ScalarUint>());
 
@@ -103,15 +133,7 @@ ScalarUint MagnitudeUnsigned(ScalarUint input1,                            //
     CompUint C = AA + BB;
 
     // Square Root
-    ScalarUint D = 0;
-    if (COMPUTE_TYPE == 8) {
-        if (ROUND_POLICY == VX_ROUND_POLICY_TO_NEAREST_EVEN)
-            D = static_cast<ScalarUint>(sqrtf(static_cast<vx_float64>(C)) + 0.5);
-        else
-            D = static_cast<ScalarUint>(sqrtf(static_cast<vx_float64>(C)));
-    } else {
-        D = SqrtLester<ScalarUint, CompUint, true, ROUND_POLICY, sizeof(ScalarUint) * 8>(C);
-    }
+    ScalarUint D = MagnitudeRoot<ScalarUint, CompUint, ROUND_POLICY, ACCURACY>(A, B, C);
 
     // Overflow (Saturation) - if C alrady has overflow
     ScalarUint E = 0;
@@ -316,27 +338,40 @@ ScalarType Multiply(ScalarType input1,
 @param DataType            Data type of the image pixels
 @param CompType            Data type for the computation
 @param PHASE_QUANTIZATION  2^PHASE_QUANTIZATION different possibilities for the output
+@param ACCURACY            Accuracy tier: lookup table, CORDIC with 8 or with 15 iterations (see ImgPhase)
 @param input1              1. input pixel
 @param input2              2. input pixel
 @return                    Result
 */
-template <typename DataType, typename CompType, vx_uint8 PHASE_QUANTIZATION> //
+template <typename DataType, typename CompType, vx_uint8 PHASE_QUANTIZATION, //
+          HIFLIPVX::ArithmeticAccuracy ACCURACY>                              //
 CompType Phase(CompType input1, CompType input2) {                           //
 #pragma HLS INLINE
 
     // Constants
-    const vx_int32 ACCURACY = 7 + PHASE_QUANTIZATION;
-    const vx_int32 SHIFT = (vx_int32)1 << ACCURACY;
+    const vx_int32 ANGLE_BITS = 7 + PHASE_QUANTIZATION;
+    const vx_int32 SHIFT = (vx_int32)1 << ANGLE_BITS;
     const vx_int32 TURN_POS = SHIFT / (vx_int32)(2 << (vx_int32)PHASE_QUANTIZATION);
     const vx_int32 TURN_NEG = SHIFT - TURN_POS;
-    const vx_int32 QUANTIZATION = ACCURACY - (vx_int32)PHASE_QUANTIZATION;
+    const vx_int32 QUANTIZATION = ANGLE_BITS - (vx_int32)PHASE_QUANTIZATION;
     const vx_int32 ROUNDING = (vx_int32)1 << (QUANTIZATION - (vx_int32)1);
+    const CompType PRESCALE = (CompType)1 << (sizeof(CompType) * 4 - 4);
+
+    // Scale the vector to use the whole computation width for the CORDIC iterations
+    const CompType x = input1 * PRESCALE;
+    const CompType y = input2 * PRESCALE;
 
     // Compute angle
-    CompType a1 = atan2Cordic<CompType, 8>((CompType)input1, (CompType)input2);
+    CompType a1 = 0;
+    if (ACCURACY == HIFLIPVX::ACCURACY_LUT)
+        a1 = atan2Lut<CompType>(input1, input2);
+    else if (ACCURACY == HIFLIPVX::ACCURACY_CORDIC_SHORT)
+        a1 = atan2Cordic<CompType, 8>(x, y);
+    else
+        a1 = atan2Cordic<CompType, 15>(x, y);
 
     // Reduce Precision and round
-    CompType a2 = a1 >> (16 - ACCURACY) - ROUNDING;
+    CompType a2 = (a1 >> (16 - ANGLE_BITS)) - ROUNDING;
 
     // Convert negative degree to positiv
     CompType a3 = (a2 < 0) ? (a2 + SHIFT) : (a2);
@@ -371,15 +406,16 @@ CompType Phase(CompType input1, CompType input2) {                           //
 @param input2          2. input pixel
 @return                result
 */
-template <typename ScalarType,                          //
-          HIFLIPVX::PixelwiseOperationA OPERATION_TYPE, //
-          vx_convert_policy_e CONV_POLICY,              //
-          vx_round_policy_e ROUND_POLICY,               //
-          vx_threshold_type_e THRESH_TYPE,              //
-          ScalarType THRESH_UPPER,                      //
-          ScalarType THRESH_LOWER,                      //
-          vx_uint32 FACTOR,                             //
-          vx_uint8 QUANTIZATION>                        //
+template <typename ScalarType,                                                    //
+          HIFLIPVX::PixelwiseOperationA OPERATION_TYPE,                           //
+          vx_convert_policy_e CONV_POLICY,                                        //
+          vx_round_policy_e ROUND_POLICY,                                         //
+          vx_threshold_type_e THRESH_TYPE,                                        //
+          vx_int64 THRESH_UPPER,                                                  //
+          vx_int64 THRESH_LOWER,                                                  //
+          vx_uint32 FACTOR,                                                       //
+          vx_uint8 QUANTIZATION,                                                  //
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_FULL> //
 ScalarType Arithmetic(ScalarType input1, ScalarType input2) {
 #pragma HLS INLINE
 
@@ -456,23 +492,23 @@ ScalarType Arithmetic(ScalarType input1, ScalarType input2) {
     // MAGNITUDE
     else if (OPERATION_TYPE == HIFLIPVX::MAGNITUDE) {
         if (SCALAR_TYPE == VX_TYPE_INT8)
-            result = MagnitudeSigned<ScalarType, vx_uint8, vx_int16, vx_uint16,  //
-                                     CONV_POLICY, ROUND_POLICY>(input1, input2); //
+            result = MagnitudeSigned<ScalarType, vx_uint8, vx_int16, vx_uint16,            //
+                                     CONV_POLICY, ROUND_POLICY, ACCURACY>(input1, input2); //
         else if (SCALAR_TYPE == VX_TYPE_INT16)
-            result = MagnitudeSigned<ScalarType, vx_uint16, vx_int32, vx_uint32, //
-                                     CONV_POLICY, ROUND_POLICY>(input1, input2); //
+            result = MagnitudeSigned<ScalarType, vx_uint16, vx_int32, vx_uint32,           //
+                                     CONV_POLICY, ROUND_POLICY, ACCURACY>(input1, input2); //
         else if (SCALAR_TYPE == VX_TYPE_INT32)
-            result = MagnitudeSigned<ScalarType, vx_uint32, vx_int64, vx_uint64, //
-                                     CONV_POLICY, ROUND_POLICY>(input1, input2); //
+            result = MagnitudeSigned<ScalarType, vx_uint32, vx_int64, vx_uint64,           //
+                                     CONV_POLICY, ROUND_POLICY, ACCURACY>(input1, input2); //
         else if (SCALAR_TYPE == VX_TYPE_UINT8)
-            result = MagnitudeUnsigned<ScalarType, vx_uint16,                      //
-                                       CONV_POLICY, ROUND_POLICY>(input1, input2); //
+            result = MagnitudeUnsigned<ScalarType, vx_uint16,                                //
+                                       CONV_POLICY, ROUND_POLICY, ACCURACY>(input1, input2); //
         else if (SCALAR_TYPE == VX_TYPE_UINT16)
-            result = MagnitudeUnsigned<ScalarType, vx_uint32,                      //
-                                       CONV_POLICY, ROUND_POLICY>(input1, input2); //
+            result = MagnitudeUnsigned<ScalarType, vx_uint32,                                //
+                                       CONV_POLICY, ROUND_POLICY, ACCURACY>(input1, input2); //
         else if (SCALAR_TYPE == VX_TYPE_UINT32)
-            result = MagnitudeUnsigned<ScalarType, vx_uint64,                      //
-                                       CONV_POLICY, ROUND_POLICY>(input1, input2); //
+            result = MagnitudeUnsigned<ScalarType, vx_uint64,                                //
+                                       CONV_POLICY, ROUND_POLICY, ACCURACY>(input1, input2); //
     }
 
     // MULTIPLY
@@ -530,18 +566,123 @@ ScalarType Arithmetic(ScalarType input1, ScalarType input2) {
 
     // PHASE
     else if (OPERATION_TYPE == HIFLIPVX::PHASE) {
-        if ((SCALAR_TYPE == VX_TYPE_UINT8) || (SCALAR_TYPE == VX_TYPE_INT8)) {
-            result = Phase<ScalarType, vx_int16, QUANTIZATION>((vx_int16)input1, (vx_int16)input2);
+        if (((SCALAR_TYPE == VX_TYPE_UINT8) || (SCALAR_TYPE == VX_TYPE_INT8)) &&
+            (ACCURACY != HIFLIPVX::ACCURACY_CORDIC_FULL)) {
+            result = Phase<ScalarType, vx_int16, QUANTIZATION, ACCURACY>((vx_int16)input1, (vx_int16)input2);
+        } else if ((SCALAR_TYPE == VX_TYPE_UINT8) || (SCALAR_TYPE == VX_TYPE_INT8)) {
+            result = Phase<ScalarType, vx_int32, QUANTIZATION, ACCURACY>((vx_int32)input1, (vx_int32)input2);
         } else if ((SCALAR_TYPE == VX_TYPE_UINT16) || (SCALAR_TYPE == VX_TYPE_INT16)) {
-            result = Phase<ScalarType, vx_int32, QUANTIZATION>((vx_int32)input1, (vx_int32)input2);
+            result = Phase<ScalarType, vx_int32, QUANTIZATION, ACCURACY>((vx_int32)input1, (vx_int32)input2);
         } else if ((SCALAR_TYPE == VX_TYPE_UINT32) || (SCALAR_TYPE == VX_TYPE_INT32)) {
-            result = Phase<ScalarType, vx_int64, QUANTIZATION>((vx_int64)input1, (vx_int64)input2);
+            result = Phase<ScalarType, vx_int64, QUANTIZATION, ACCURACY>((vx_int64)input1, (vx_int64)input2);
         }
     }
 
     return static_cast<ScalarType>(result);
 }
 
+/** @brief Computes an arithmetic operation on 16-bit floating point pixels. The computation is done in vx_float32.
+@details Multiplications, the weighted average and the thresholds use the same fixed-point constants as the integer
+         version. The threshold returns 1.0 for true. The phase uses the same orientation bins as the integer version.
+@param ScalarType      Data type of the image pixels (vx_float16, vx_bfloat16)
+@param OPERATION_TYPE  Operation type (e.g. bitwise (or, and, xor) | arithmetic (add, sub, mul))
+@param CONV_POLICY     Conversion policy (wrap to infinity & saturate to the largest finite value)
+@param ROUND_POLICY    Rounding policy of the 16-bit result (to zero & nearest even)
+@param THRESH_TYPE     Type of thresholding (VX_THRESHOLD_TYPE_BINARY, VX_THRESHOLD_TYPE_RANGE)
+@param THRESH_UPPER    Upper threshold value (VX_THRESHOLD_TYPE_RANGE)
+@param THRESH_LOWER    Lower threshold value (VX_THRESHOLD_TYPE_RANGE, VX_THRESHOLD_TYPE_BINARY)
+@param FACTOR          ALPHA: Weighted value in fixed-point (16-bit fraction) between 0 and 1.
+                       SCALE: A positive fixed-point (16-bit fraction) number multiplied to each product.
+@param QUANTIZATION    The quantization for the different amount of orientations
+@param input1          1. input pixel
+@param input2          2. input pixel
+@return                Result
+*/
+template <typename ScalarType,                         //
+          HIFLIPVX::PixelwiseOperationA OPERATION_TYPE, //
+          vx_convert_policy_e CONV_POLICY,              //
+          vx_round_policy_e ROUND_POLICY,               //
+          vx_threshold_type_e THRESH_TYPE,              //
+          vx_int64 THRESH_UPPER,                        //
+          vx_int64 THRESH_LOWER,                        //
+          vx_uint32 FACTOR,                             //
+          vx_uint8 QUANTIZATION>                        //
+ScalarType ArithmeticFloat(ScalarType input1, ScalarType input2) {
+#pragma HLS INLINE
+
+    // Compile-time-checks
+    STATIC_ASSERT((QUANTIZATION <= 8) && (QUANTIZATION > 0),                           //
+                  THE_QUANTIZATION_OF_THE_PHASE_FUNCTION_NEEDS_TO_BE_BETWEEN_1_AND_8); //
+
+    // Constants
+    const vx_uint8 EXPONENT_BITS = 16 - std::numeric_limits<ScalarType>::digits;
+    const vx_float32 ONE = static_cast<vx_float32>(1 << 16);
+    const vx_float32 TURN = static_cast<vx_float32>(1 << QUANTIZATION);
+    const vx_float32 PI_2 = 6.28318530718f;
+
+    // Convert for computation
+    const vx_float32 a = static_cast<vx_float32>(input1);
+    const vx_float32 b = static_cast<vx_float32>(input2);
+
+    // Result
+    vx_float32 result = 0.0f;
+
+    // ABSOLUTE_DIFFERENCE
+    if (OPERATION_TYPE == HIFLIPVX::ABSOLUTE_DIFFERENCE)
+        result = (a > b) ? (a - b) : (b - a);
+
+    // ARITHMETIC_ADDITION
+    else if (OPERATION_TYPE == HIFLIPVX::ARITHMETIC_ADDITION)
+        result = a + b;
+
+    // ARITHMETIC_SUBTRACTION
+    else if (OPERATION_TYPE == HIFLIPVX::ARITHMETIC_SUBTRACTION)
+        result = a - b;
+
+    // MAGNITUDE
+    else if (OPERATION_TYPE == HIFLIPVX::MAGNITUDE)
+        result = sqrtf(a * a + b * b);
+
+    // MULTIPLY
+    else if (OPERATION_TYPE == HIFLIPVX::MULTIPLY)
+        result = a * b * (static_cast<vx_float32>(FACTOR) / ONE);
+
+    // MULTIPLY by constant
+    else if (OPERATION_TYPE == HIFLIPVX::MULTIPLY_CONSTANT)
+        result = a * (static_cast<vx_float32>(FACTOR) / ONE);
+
+    // THRESHOLD
+    else if (OPERATION_TYPE == HIFLIPVX::THRESHOLD) {
+        const vx_float32 lower = static_cast<vx_float32>(THRESH_LOWER);
+        const vx_float32 upper = static_cast<vx_float32>(THRESH_UPPER);
+        if (THRESH_TYPE == VX_THRESHOLD_TYPE_BINARY)
+            result = (a > lower) ? (1.0f) : (0.0f);
+        else if (THRESH_TYPE == VX_THRESHOLD_TYPE_RANGE)
+            result = ((a > upper) || (a < lower)) ? (0.0f) : (1.0f);
+    }
+
+    // WEIGHTED AVERAGE
+    else if (OPERATION_TYPE == HIFLIPVX::WEIGHTED_AVERAGE) {
+        const vx_float32 alpha = static_cast<vx_float32>(FACTOR) / ONE;
+        result = (1.0f - alpha) * b + alpha * a;
+    }
+
+    // PHASE (0 is east, rounded to the nearest of the 2^QUANTIZATION orientations)
+    else if (OPERATION_TYPE == HIFLIPVX::PHASE) {
+        const vx_float32 angle = atan2f(b, a) / PI_2;
+        const vx_float32 bin = floorf(((angle < 0.0f) ? (angle + 1.0f) : (angle)) * TURN + 0.5f);
+        result = (bin >= TURN) ? (0.0f) : (bin);
+    }
+
+    // Only the scaling operations have a rounding policy, all other results are rounded to nearest even
+    const bool SCALED = (OPERATION_TYPE == HIFLIPVX::MAGNITUDE) || (OPERATION_TYPE == HIFLIPVX::MULTIPLY) ||
+                        (OPERATION_TYPE == HIFLIPVX::MULTIPLY_CONSTANT) ||
+                        (OPERATION_TYPE == HIFLIPVX::WEIGHTED_AVERAGE);
+    const vx_round_policy_e ROUNDING = (SCALED == true) ? (ROUND_POLICY) : (VX_ROUND_POLICY_TO_NEAREST_EVEN);
+
+    return ScalarType::FromBits(Float32ToHalf<EXPONENT_BITS, ROUNDING, CONV_POLICY>(result));
+}
+
 /*********************************************************************************************************************/
 /* Pixelwise Operations */
 /*********************************************************************************************************************/
@@ -562,18 +703,19 @@ ScalarType Arithmetic(ScalarType input1, ScalarType input2) {
 @param src2            2. input pixel
 @param dst             result
 */
-template <typename ScalarType,                          //
-          HIFLIPVX::PixelwiseOperationA OPERATION_TYPE, //
-          vx_convert_policy_e CONV_POLICY,              //
-          vx_round_policy_e ROUND_POLICY,               //
-          vx_threshold_type_e THRESH_TYPE,              //
-          ScalarType THRESH_UPPER,                      //
-          ScalarType THRESH_LOWER,                      //
-          vx_uint32 FACTOR,                             //
-          vx_uint8 QUANTIZATION>                        //
-void PixelwiseComputeSameType(ScalarType src1,          //
-                              ScalarType src2,          //
-                              ScalarType &dst) {        //
+template <typename ScalarType,                                                    //
+          HIFLIPVX::PixelwiseOperationA OPERATION_TYPE,                           //
+          vx_convert_policy_e CONV_POLICY,                                        //
+          vx_round_policy_e ROUND_POLICY,                                         //
+          vx_threshold_type_e THRESH_TYPE,                                        //
+          vx_int64 THRESH_UPPER,                                                  //
+          vx_int64 THRESH_LOWER,                                                  //
+          vx_uint32 FACTOR,                                                       //
+          vx_uint8 QUANTIZATION,                                                  //
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_FULL> //
+void PixelwiseComputeSameType(ScalarType src1,                                    //
+                              ScalarType src2,                                    //
+                              ScalarType &dst) {                                  //
 #pragma HLS INLINE
 
     // Constants
@@ -620,13 +762,51 @@ void PixelwiseComputeSameType(ScalarType src1,          //
     else if (is_arithmetic_operation == true)
         dst = Arithmetic<ScalarType, OPERATION_TYPE, CONV_POLICY, ROUND_POLICY, //
                          THRESH_TYPE, THRESH_UPPER, THRESH_LOWER,               //
-                         FACTOR, QUANTIZATION>(src1, src2);                     //
+                         FACTOR, QUANTIZATION, ACCURACY>(src1, src2);           //
 
     // Operation not found
     else
         dst = 0;
 }
 
+/** @brief Performs a pixelwise operation on 16-bit floating point pixels (vx_float16, vx_bfloat16). The bitwise
+           operations are not supported. The template parameters are the same as for the integer version.
+*/
+template <typename ScalarType,                                                    //
+          HIFLIPVX::PixelwiseOperationA OPERATION_TYPE,                           //
+          vx_convert_policy_e CONV_POLICY,                                        //
+          vx_round_policy_e ROUND_POLICY,                                         //
+          vx_threshold_type_e THRESH_TYPE,                                        //
+          vx_int64 THRESH_UPPER,                                                  //
+          vx_int64 THRESH_LOWER,                                                  //
+          vx_uint32 FACTOR,                                                       //
+          vx_uint8 QUANTIZATION,                                                  //
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_FULL, //
+          vx_uint8 EXPONENT_BITS>                                                 //
+void PixelwiseComputeSameType(vx_half_float<EXPONENT_BITS> src1,                  //
+                              vx_half_float<EXPONENT_BITS> src2,                  //
+                              vx_half_float<EXPONENT_BITS> &dst) {                //
+#pragma HLS INLINE
+
+    // Check function parameters/types
+    STATIC_ASSERT((OPERATION_TYPE != HIFLIPVX::BITWISE_NOT) && (OPERATION_TYPE != HIFLIPVX::BITWISE_AND) && //
+                      (OPERATION_TYPE != HIFLIPVX::BITWISE_OR) && (OPERATION_TYPE != HIFLIPVX::BITWISE_XOR), //
+                  bitwise_operations_are_not_supported_for_floating_point_pixels);                          //
+
+    // Copy, maximum and minimum are done on the 16-bit values
+    if (OPERATION_TYPE == HIFLIPVX::COPY_DATA)
+        dst = src1;
+    else if (OPERATION_TYPE == HIFLIPVX::MAX)
+        dst = (static_cast<vx_float32>(src1) > static_cast<vx_float32>(src2)) ? (src1) : (src2);
+    else if (OPERATION_TYPE == HIFLIPVX::MIN)
+        dst = (static_cast<vx_float32>(src1) < static_cast<vx_float32>(src2)) ? (src1) : (src2);
+
+    // Computes arithmetic operations in 32-bit float
+    else
+        dst = ArithmeticFloat<vx_half_float<EXPONENT_BITS>, OPERATION_TYPE, CONV_POLICY, ROUND_POLICY, //
+                              THRESH_TYPE, THRESH_UPPER, THRESH_LOWER, FACTOR, QUANTIZATION>(src1, src2); //
+}
+
 /** @brief  Checks if the input parameters are valid
 @param ScalarType      Data type of the image pixels
 @param VEC_SIZE        Amount of pixels computed in parallel
@@ -644,10 +824,12 @@ vx_uint32 PixelwiseCheckSameType() {                                   //
                                      (SCALAR_TYPE == VX_TYPE_UINT32) || //
                                      (SCALAR_TYPE == VX_TYPE_INT8) ||   //
                                      (SCALAR_TYPE == VX_TYPE_INT16) ||  //
-                                     (SCALAR_TYPE == VX_TYPE_INT32);    //
+                                     (SCALAR_TYPE == VX_TYPE_INT32) ||  //
+                                     ((std::numeric_limits<ScalarType>::is_integer == false) && //
+                                      (sizeof(ScalarType) == 2));                               //
 
     // Check function parameters/types
-    STATIC_ASSERT(SCALAR_TYPE_CORRECT, data_type_error__uint_and_int_8_to_32_bit_allowed);    //
+    STATIC_ASSERT(SCALAR_TYPE_CORRECT, data_type_error__uint_and_int_8_to_32_bit_and_16_bit_float_allowed); //
     STATIC_ASSERT((IMG_PIXEL % VEC_SIZE) == 0, image_pixels_are_not_multiple_of_vector_size); //
     STATIC_ASSERT((VEC_SIZE == 1) || (VEC_SIZE == 2) || (VEC_SIZE == 4) || (VEC_SIZE == 8),   //
                   _vec_size_musst_be_1_2_4_8__use_vx_image_for_2_4_8);                        //
@@ -678,21 +860,22 @@ vx_uint32 PixelwiseCheckSameType() {                                   //
 @param input2          2. input image
 @param output          Output image
 */
-template <typename ScalarType,                                          //
-          vx_uint8 VEC_SIZE,                                            //
-          vx_uint32 IMG_PIXEL,                                          //
-          HIFLIPVX::PixelwiseOperationA OPERATION_TYPE,                 //
-          vx_convert_policy_e CONV_POLICY,                              //
-          vx_round_policy_e ROUND_POLICY,                               //
-          vx_threshold_type_e THRESH_TYPE,                              //
-          ScalarType THRESH_UPPER,                                      //
-          ScalarType THRESH_LOWER,                                      //
-          vx_uint32 FACTOR,                                             //
-          vx_uint8 QUANTIZATION>                                        //
-void PixelwiseSameType(                                                 //
-    vx_image_data<ScalarType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],   //
-    vx_image_data<ScalarType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],   //
-    vx_image_data<ScalarType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE]) { //
+template <typename ScalarType,                                                    //
+          vx_uint8 VEC_SIZE,                                                      //
+          vx_uint32 IMG_PIXEL,                                                    //
+          HIFLIPVX::PixelwiseOperationA OPERATION_TYPE,                           //
+          vx_convert_policy_e CONV_POLICY,                                        //
+          vx_round_policy_e ROUND_POLICY,                                         //
+          vx_threshold_type_e THRESH_TYPE,                                        //
+          vx_int64 THRESH_UPPER,                                                  //
+          vx_int64 THRESH_LOWER,                                                  //
+          vx_uint32 FACTOR,                                                       //
+          vx_uint8 QUANTIZATION,                                                  //
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_FULL> //
+void PixelwiseSameType(                                                           //
+    vx_image_data<ScalarType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],             //
+    vx_image_data<ScalarType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],             //
+    vx_image_data<ScalarType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE]) {           //
 #pragma HLS INLINE
 
     // Check if input correct
@@ -718,9 +901,9 @@ void PixelwiseSameType(                                                 //
 #pragma HLS unroll
             const ScalarType in1 = src1.pixel[j];
             const ScalarType in2 = src2.pixel[j];
-            PixelwiseComputeSameType<ScalarType, OPERATION_TYPE, CONV_POLICY, ROUND_POLICY, //
-                                     THRESH_TYPE, THRESH_UPPER, THRESH_LOWER,               //
-                                     FACTOR, QUANTIZATION>(in1, in2, dst.pixel[j]);         //
+            PixelwiseComputeSameType<ScalarType, OPERATION_TYPE, CONV_POLICY, ROUND_POLICY,  //
+                                     THRESH_TYPE, THRESH_UPPER, THRESH_LOWER,                //
+                                     FACTOR, QUANTIZATION, ACCURACY>(in1, in2, dst.pixel[j]); //
         }
 
         // Set user(SOF) & last(EOF)
@@ -730,21 +913,22 @@ void PixelwiseSameType(                                                 //
         output[i] = dst;
     }
 }
-template <typename ScalarType,                          //
-          vx_uint8 VEC_SIZE,                            //
-          vx_uint32 IMG_PIXEL,                          //
-          HIFLIPVX::PixelwiseOperationA OPERATION_TYPE, //
-          vx_convert_policy_e CONV_POLICY,              //
-          vx_round_policy_e ROUND_POLICY,               //
-          vx_threshold_type_e THRESH_TYPE,              //
-          ScalarType THRESH_UPPER,                      //
-          ScalarType THRESH_LOWER,                      //
-          vx_uint32 FACTOR,                             //
-          vx_uint8 QUANTIZATION>                        //
-void PixelwiseSameType(                                 //
-    ScalarType input1[IMG_PIXEL / VEC_SIZE],            //
-    ScalarType input2[IMG_PIXEL / VEC_SIZE],            //
-    ScalarType output[IMG_PIXEL / VEC_SIZE]) {          //
+template <typename ScalarType,                                                    //
+          vx_uint8 VEC_SIZE,                                                      //
+          vx_uint32 IMG_PIXEL,                                                    //
+          HIFLIPVX::PixelwiseOperationA OPERATION_TYPE,                           //
+          vx_convert_policy_e CONV_POLICY,                                        //
+          vx_round_policy_e ROUND_POLICY,                                         //
+          vx_threshold_type_e THRESH_TYPE,                                        //
+          vx_int64 THRESH_UPPER,                                                  //
+          vx_int64 THRESH_LOWER,                                                  //
+          vx_uint32 FACTOR,                                                       //
+          vx_uint8 QUANTIZATION,                                                  //
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_FULL> //
+void PixelwiseSameType(                                                           //
+    ScalarType input1[IMG_PIXEL / VEC_SIZE],                                      //
+    ScalarType input2[IMG_PIXEL / VEC_SIZE],                                      //
+    ScalarType output[IMG_PIXEL / VEC_SIZE]) {                                    //
 #pragma HLS INLINE
 
     // Check if input correct
@@ -768,12 +952,501 @@ void PixelwiseSameType(                                 //
         // Computes a vector of pixelwise operations in parallel
         PixelwiseComputeSameType<ScalarType, OPERATION_TYPE, CONV_POLICY, ROUND_POLICY, //
                                  THRESH_TYPE, THRESH_UPPER, THRESH_LOWER,               //
-                                 FACTOR, QUANTIZATION>(src1, src2, dst);                //
+                                 FACTOR, QUANTIZATION, ACCURACY>(src1, src2, dst);      //
+
+        // Write output
+        output[i] = dst;
+    }
+}
+
+/*********************************************************************************************************************/
+/* Pixelwise Fused Operations (expression templates) */
+/*********************************************************************************************************************/
+
+/** @brief Leaf of a fused pixelwise expression. Forwards the pixel of an input image.
+@param INPUT_ID        Index of the input image (0 = input1, 1 = input2, 2 = input3, 3 = input4)
+*/
+template <vx_uint8 INPUT_ID> //
+struct PixelwiseSource {     //
+    static const vx_uint8 INPUTS = INPUT_ID + 1;
+
+    template <typename ScalarType>                      //
+    static ScalarType Compute(const ScalarType src[4]) { //
+#pragma HLS INLINE
+        STATIC_ASSERT(INPUT_ID < 4, fused_expression_supports_up_to_4_input_images);
+        return src[INPUT_ID];
+    }
+};
+
+/** @brief Leaf of a fused pixelwise expression. Returns a constant value.
+@param VALUE           The constant (converted to the data type of the image pixels)
+*/
+template <vx_int64 VALUE> //
+struct PixelwiseConstant {
+    static const vx_uint8 INPUTS = 0;
+
+    template <typename ScalarType>                      //
+    static ScalarType Compute(const ScalarType src[4]) { //
+#pragma HLS INLINE
+        return static_cast<ScalarType>(VALUE);
+    }
+};
+
+/** @brief Node of a fused pixelwise expression. Computes one pixelwise operation on the results of its sub-expressions.
+           Each node keeps its own policies, so the fused result is bit-exact to the chained functions.
+@param OPERATION_TYPE  Operation type (e.g. bitwise (or, and, xor) | arithmetic (add, sub, mul))
+@param Src1            1. sub-expression (PixelwiseSource, PixelwiseConstant or PixelwiseNode)
+@param Src2            2. sub-expression (ignored by unary operations)
+@param CONV_POLICY     Conversion policy (wrap & saturate)
+@param ROUND_POLICY    Rounding policy (to zero & nearest even)
+@param FACTOR          ALPHA: Weighted value in fixed-point (16-bit fraction) between 0 and 1.
+                       SCALE: A positive fixed-point (16-bit fraction) number multiplied to
+                              each product before overflow handling.
+@param QUANTIZATION    The quantization for the different amount of orientations
+@param THRESH_TYPE     Type of thresholding (VX_THRESHOLD_TYPE_BINARY, VX_THRESHOLD_TYPE_RANGE)
+@param THRESH_UPPER    Upper threshold value (VX_THRESHOLD_TYPE_RANGE)
+@param THRESH_LOWER    Lower threshold value (VX_THRESHOLD_TYPE_RANGE, VX_THRESHOLD_TYPE_BINARY)
+@param ACCURACY        Accuracy tier of magnitude and phase (defaults match ImgMagnitude and ImgPhase)
+*/
+template <HIFLIPVX::PixelwiseOperationA OPERATION_TYPE,                    //
+          typename Src1,                                                   //
+          typename Src2 = Src1,                                            //
+          vx_convert_policy_e CONV_POLICY = VX_CONVERT_POLICY_WRAP,        //
+          vx_round_policy_e ROUND_POLICY = VX_ROUND_POLICY_TO_ZERO,        //
+          vx_uint32 FACTOR = 1,                                            //
+          vx_uint8 QUANTIZATION = 1,                                       //
+          vx_threshold_type_e THRESH_TYPE = VX_THRESHOLD_TYPE_BINARY,      //
+          vx_int64 THRESH_UPPER = 0,                                       //
+          vx_int64 THRESH_LOWER = 0,                                       //
+          HIFLIPVX::ArithmeticAccuracy ACCURACY =                          //
+              (OPERATION_TYPE == HIFLIPVX::PHASE)                          //
+                  ? HIFLIPVX::ACCURACY_CORDIC_SHORT                        //
+                  : HIFLIPVX::ACCURACY_CORDIC_FULL>                        //
+struct PixelwiseNode {                                                     //
+    static const vx_uint8 INPUTS = (Src1::INPUTS > Src2::INPUTS) ? (Src1::INPUTS) : (Src2::INPUTS);
+
+    template <typename ScalarType>                      //
+    static ScalarType Compute(const ScalarType src[4]) { //
+#pragma HLS INLINE
+        const ScalarType in1 = Src1::template Compute<ScalarType>(src);
+        const ScalarType in2 = Src2::template Compute<ScalarType>(src);
+        ScalarType dst = 0;
+        PixelwiseComputeSameType<ScalarType, OPERATION_TYPE, CONV_POLICY, ROUND_POLICY, //
+                                 THRESH_TYPE, THRESH_UPPER, THRESH_LOWER,               //
+                                 FACTOR, QUANTIZATION, ACCURACY>(in1, in2, dst);        //
+        return dst;
+    }
+};
+
+/** @brief Computes a fused pixelwise expression on up to 4 images in one pass (Top function)
+@param ScalarType      Data type of the image pixels
+@param VEC_SIZE        Amount of pixels computed in parallel
+@param IMG_PIXEL       Amount of pixels in the image
+@param Expression      The expression tree (PixelwiseNode)
+@param INPUT_NUM       Amount of input images that are given to the function (all are read)
+@param input1          1. input image
+@param input2          2. input image
+@param input3          3. input image
+@param input4          4. input image
+@param output          Output image
+*/
+template <typename ScalarType,                                          //
+          vx_uint8 VEC_SIZE,                                            //
+          vx_uint32 IMG_PIXEL,                                          //
+          typename Expression,                                          //
+          vx_uint8 INPUT_NUM>                                           //
+void PixelwiseFused(                                                    //
+    vx_image_data<ScalarType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],   //
+    vx_image_data<ScalarType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],   //
+    vx_image_data<ScalarType, VEC_SIZE> input3[IMG_PIXEL / VEC_SIZE],   //
+    vx_image_data<ScalarType, VEC_SIZE> input4[IMG_PIXEL / VEC_SIZE],   //
+    vx_image_data<ScalarType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE]) { //
+#pragma HLS INLINE
+
+    // Check if input correct
+    const vx_uint32 vector_pixels = PixelwiseCheckSameType<ScalarType, VEC_SIZE, IMG_PIXEL>();
+    STATIC_ASSERT(Expression::INPUTS <= INPUT_NUM, fused_expression_reads_more_images_than_given);
+
+    // Computes the fused pixelwise operations (pipelined)
+    for (vx_uint32 i = 0; i < vector_pixels; i++) {
+#pragma HLS PIPELINE II = 1
+
+        // Variables
+        vx_image_data<ScalarType, VEC_SIZE> src1, src2, src3, src4, dst;
+
+        // Read every given input, also the ones the expression does not use (a stream that is not drained stalls its producer)
+        if (INPUT_NUM > 0)
+            src1 = input1[i];
+        if (INPUT_NUM > 1)
+            src2 = input2[i];
+        if (INPUT_NUM > 2)
+            src3 = input3[i];
+        if (INPUT_NUM > 3)
+            src4 = input4[i];
+
+        // Computes a vector of fused pixelwise operations in parallel
+        for (vx_uint16 j = 0; j < VEC_SIZE; j++) {
+#pragma HLS unroll
+            ScalarType src[4] = {src1.pixel[j], src2.pixel[j], src3.pixel[j], src4.pixel[j]};
+#pragma HLS array_partition variable = src complete dim = 0
+            dst.pixel[j] = Expression::template Compute<ScalarType>(src);
+        }
+
+        // Set user(SOF) & last(EOF)
+        GenerateDmaSignal<ScalarType, VEC_SIZE>((i == 0), (i == vector_pixels - 1), dst);
+
+        // Write output
+        output[i] = dst;
+    }
+}
+template <typename ScalarType,                  //
+          vx_uint8 VEC_SIZE,                    //
+          vx_uint32 IMG_PIXEL,                  //
+          typename Expression,                  //
+          vx_uint8 INPUT_NUM>                   //
+void PixelwiseFused(                            //
+    ScalarType input1[IMG_PIXEL / VEC_SIZE],    //
+    ScalarType input2[IMG_PIXEL / VEC_SIZE],    //
+    ScalarType input3[IMG_PIXEL / VEC_SIZE],    //
+    ScalarType input4[IMG_PIXEL / VEC_SIZE],    //
+    ScalarType output[IMG_PIXEL / VEC_SIZE]) {  //
+#pragma HLS INLINE
+
+    // Check if input correct
+    const vx_uint32 vector_pixels = PixelwiseCheckSameType<ScalarType, VEC_SIZE, IMG_PIXEL>();
+    STATIC_ASSERT(Expression::INPUTS <= INPUT_NUM, fused_expression_reads_more_images_than_given);
+
+    // Computes the fused pixelwise operations (pipelined)
+    for (vx_uint32 i = 0; i < vector_pixels; i++) {
+#pragma HLS PIPELINE II = 1
+
+        // Variables
+        ScalarType src[4] = {0, 0, 0, 0};
+#pragma HLS array_partition variable = src complete dim = 0
+
+        // Read every given input, also the ones the expression does not use (a stream that is not drained stalls its producer)
+        if (INPUT_NUM > 0)
+            src[0] = input1[i];
+        if (INPUT_NUM > 1)
+            src[1] = input2[i];
+        if (INPUT_NUM > 2)
+            src[2] = input3[i];
+        if (INPUT_NUM > 3)
+            src[3] = input4[i];
+
+        // Write output
+        output[i] = Expression::template Compute<ScalarType>(src);
+    }
+}
+
+/*********************************************************************************************************************/
+/* Weighted sum of multiple images */
+/*********************************************************************************************************************/
+
+/** @brief Computes the weighted sum of multiple pixels: sum(weight[n] * src[n])
+@param ScalarType      Data type of the image pixels
+@param INPUT_NUM       Amount of input pixels
+@param CONV_POLICY     Conversion policy (wrap & saturate)
+@param ROUND_POLICY    Rounding policy (to zero & nearest even)
+@param src             The input pixels
+@param weights         The weights in fixed-point (16-bit fraction) between 0.0 and 256.0
+@return                Result
+*/
+template <typename ScalarType, vx_uint8 INPUT_NUM, vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY> //
+ScalarType WeightedSum(const ScalarType src[INPUT_NUM], const vx_uint32 weights[INPUT_NUM]) {                      //
+#pragma HLS INLINE
+
+    // Constants
+    const bool IS_SIGNED = std::numeric_limits<ScalarType>::is_signed;
+    const vx_int64 MIN_VAL = static_cast<vx_int64>(ComputeMin<ScalarType>());
+    const vx_int64 MAX_VAL = static_cast<vx_int64>(ComputeMax<ScalarType>());
+    const vx_int64 ROUND = (ROUND_POLICY == VX_ROUND_POLICY_TO_NEAREST_EVEN) ? (1 << 15) : (0);
+
+    // Multiply and accumulate all inputs
+    vx_int64 sum = ROUND;
+    for (vx_uint8 n = 0; n < INPUT_NUM; n++) {
+#pragma HLS unroll
+        sum += static_cast<vx_int64>(weights[n]) * static_cast<vx_int64>(src[n]);
+    }
+    vx_int64 result = ShiftArithmeticRight<vx_int64, IS_SIGNED>(sum, 16);
+
+    // Check for overflow
+    if (CONV_POLICY == VX_CONVERT_POLICY_SATURATE)
+        result = MIN(MAX(result, MIN_VAL), MAX_VAL);
+
+    return static_cast<ScalarType>(result);
+}
+
+/** @brief Computes the weighted sum of multiple 16-bit floating point pixels. The sum is computed in vx_float32.
+*/
+template <typename ScalarType, vx_uint8 INPUT_NUM, vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY, //
+          vx_uint8 EXPONENT_BITS>                                                                                  //
+vx_half_float<EXPONENT_BITS> WeightedSum(const vx_half_float<EXPONENT_BITS> src[INPUT_NUM],                        //
+                                         const vx_uint32 weights[INPUT_NUM]) {                                     //
+#pragma HLS INLINE
+
+    // Constants
+    const vx_float32 ONE = static_cast<vx_float32>(1 << 16);
+
+    // Multiply and accumulate all inputs
+    vx_float32 sum = 0.0f;
+    for (vx_uint8 n = 0; n < INPUT_NUM; n++) {
+#pragma HLS unroll
+        sum += (static_cast<vx_float32>(weights[n]) / ONE) * static_cast<vx_float32>(src[n]);
+    }
+
+    return vx_half_float<EXPONENT_BITS>::FromBits(Float32ToHalf<EXPONENT_BITS, ROUND_POLICY, CONV_POLICY>(sum));
+}
+
+/** @brief Computes the weighted sum of multiple images in one pass. Every image has its own input stream.
+@param ScalarType      Data type of the image pixels
+@param VEC_SIZE        Amount of pixels computed in parallel
+@param IMG_PIXEL       Amount of pixels in the image
+@param INPUT_NUM       Amount of input images that are given to the function (2 .. 8)
+@param CONV_POLICY     Conversion policy (wrap & saturate)
+@param ROUND_POLICY    Rounding policy (to zero & nearest even)
+@param input1          1. input image
+@param input2          2. input image
+@param input3          3. input image
+@param input4          4. input image
+@param input5          5. input image
+@param input6          6. input image
+@param input7          7. input image
+@param input8          8. input image
+@param output          Output image
+@param weights         The weight of each input image in fixed-point (16-bit fraction) between 0.0 and 256.0
+*/
+template <typename ScalarType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, vx_uint8 INPUT_NUM, //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>                 //
+void PixelwiseWeightedSum(                                                                 //
+    vx_image_data<ScalarType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],                      //
+    vx_image_data<ScalarType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],                      //
+    vx_image_data<ScalarType, VEC_SIZE> input3[IMG_PIXEL / VEC_SIZE],                      //
+    vx_image_data<ScalarType, VEC_SIZE> input4[IMG_PIXEL / VEC_SIZE],                      //
+    vx_image_data<ScalarType, VEC_SIZE> input5[IMG_PIXEL / VEC_SIZE],                      //
+    vx_image_data<ScalarType, VEC_SIZE> input6[IMG_PIXEL / VEC_SIZE],                      //
+    vx_image_data<ScalarType, VEC_SIZE> input7[IMG_PIXEL / VEC_SIZE],                      //
+    vx_image_data<ScalarType, VEC_SIZE> input8[IMG_PIXEL / VEC_SIZE],                      //
+    vx_image_data<ScalarType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE],                      //
+    const vx_uint32 weights[INPUT_NUM]) {                                                  //
+#pragma HLS INLINE
+
+    // Check if input correct
+    const vx_uint32 vector_pixels = PixelwiseCheckSameType<ScalarType, VEC_SIZE, IMG_PIXEL>();
+    STATIC_ASSERT((INPUT_NUM >= 2) && (INPUT_NUM <= 8), weighted_sum_supports_2_to_8_input_images);
+
+    // Buffer the weights
+    vx_uint32 weight[INPUT_NUM];
+#pragma HLS array_partition variable = weight complete dim = 0
+    for (vx_uint8 n = 0; n < INPUT_NUM; n++) {
+#pragma HLS unroll
+        weight[n] = weights[n];
+    }
+
+    // Computes the weighted sum (pipelined)
+    for (vx_uint32 i = 0; i < vector_pixels; i++) {
+#pragma HLS PIPELINE II = 1
+
+        // Read one vector of every input stream
+        vx_image_data<ScalarType, VEC_SIZE> src[8], dst;
+#pragma HLS array_partition variable = src complete dim = 0
+        src[0] = input1[i];
+        src[1] = input2[i];
+        if (INPUT_NUM > 2)
+            src[2] = input3[i];
+        if (INPUT_NUM > 3)
+            src[3] = input4[i];
+        if (INPUT_NUM > 4)
+            src[4] = input5[i];
+        if (INPUT_NUM > 5)
+            src[5] = input6[i];
+        if (INPUT_NUM > 6)
+            src[6] = input7[i];
+        if (INPUT_NUM > 7)
+            src[7] = input8[i];
+
+        // Computes a vector of weighted sums in parallel
+        for (vx_uint16 j = 0; j < VEC_SIZE; j++) {
+#pragma HLS unroll
+            ScalarType pixel[INPUT_NUM];
+#pragma HLS array_partition variable = pixel complete dim = 0
+            for (vx_uint8 n = 0; n < INPUT_NUM; n++) {
+#pragma HLS unroll
+                pixel[n] = src[n].pixel[j];
+            }
+            dst.pixel[j] = WeightedSum<ScalarType, INPUT_NUM, CONV_POLICY, ROUND_POLICY>(pixel, weight);
+        }
+
+        // Set user(SOF) & last(EOF)
+        GenerateDmaSignal<ScalarType, VEC_SIZE>((i == 0), (i == vector_pixels - 1), dst);
 
         // Write output
         output[i] = dst;
     }
 }
+template <typename ScalarType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, vx_uint8 INPUT_NUM, //
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>                 //
+void PixelwiseWeightedSum(                                                                 //
+    ScalarType input1[IMG_PIXEL / VEC_SIZE],                                               //
+    ScalarType input2[IMG_PIXEL / VEC_SIZE],                                               //
+    ScalarType input3[IMG_PIXEL / VEC_SIZE],                                               //
+    ScalarType input4[IMG_PIXEL / VEC_SIZE],                                               //
+    ScalarType input5[IMG_PIXEL / VEC_SIZE],                                               //
+    ScalarType input6[IMG_PIXEL / VEC_SIZE],                                               //
+    ScalarType input7[IMG_PIXEL / VEC_SIZE],                                               //
+    ScalarType input8[IMG_PIXEL / VEC_SIZE],                                               //
+    ScalarType output[IMG_PIXEL / VEC_SIZE],                                               //
+    const vx_uint32 weights[INPUT_NUM]) {                                                  //
+#pragma HLS INLINE
+
+    // Check if input correct
+    const vx_uint32 vector_pixels = PixelwiseCheckSameType<ScalarType, VEC_SIZE, IMG_PIXEL>();
+    STATIC_ASSERT((INPUT_NUM >= 2) && (INPUT_NUM <= 8), weighted_sum_supports_2_to_8_input_images);
+
+    // Buffer the weights
+    vx_uint32 weight[INPUT_NUM];
+#pragma HLS array_partition variable = weight complete dim = 0
+    for (vx_uint8 n = 0; n < INPUT_NUM; n++) {
+#pragma HLS unroll
+        weight[n] = weights[n];
+    }
+
+    // Computes the weighted sum (pipelined)
+    for (vx_uint32 i = 0; i < vector_pixels; i++) {
+#pragma HLS PIPELINE II = 1
+
+        // Read one pixel of every input stream
+        ScalarType src[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+#pragma HLS array_partition variable = src complete dim = 0
+        src[0] = input1[i];
+        src[1] = input2[i];
+        if (INPUT_NUM > 2)
+            src[2] = input3[i];
+        if (INPUT_NUM > 3)
+            src[3] = input4[i];
+        if (INPUT_NUM > 4)
+            src[4] = input5[i];
+        if (INPUT_NUM > 5)
+            src[5] = input6[i];
+        if (INPUT_NUM > 6)
+            src[6] = input7[i];
+        if (INPUT_NUM > 7)
+            src[7] = input8[i];
+
+        // Write output
+        output[i] = WeightedSum<ScalarType, INPUT_NUM, CONV_POLICY, ROUND_POLICY>(src, weight);
+    }
+}
+
+/*********************************************************************************************************************/
+/* Background subtraction (running Gaussian per pixel) */
+/*********************************************************************************************************************/
+
+/** @brief Updates the background model of one pixel and classifies the pixel. The model word contains the mean in
+           the lower 16 bits (Q8.8) and the variance in the upper 16 bits (Q12.4). A variance of 0 marks an
+           uninitialized model, which is set to the pixel value and INIT_VARIANCE.
+@param ALPHA           The learning rate in fixed-point (16-bit fraction) between 0.0 and 1.0
+@param THRESHOLD       Foreground if |pixel - mean| > THRESHOLD * stddev, in fixed-point (4-bit fraction)
+@param MIN_VARIANCE    The lower bound of the variance in fixed-point (4-bit fraction)
+@param INIT_VARIANCE   The variance of a new model in fixed-point (4-bit fraction)
+@param SELECTIVE       Is true if foreground pixels do not update the model
+@param pixel           The input pixel
+@param model           The model of the pixel (updated)
+@return                The mask value (255 foreground, 0 background)
+*/
+template <vx_uint32 ALPHA, vx_uint16 THRESHOLD, vx_uint16 MIN_VARIANCE, vx_uint16 INIT_VARIANCE, bool SELECTIVE> //
+vx_uint8 BackgroundSubtract(vx_uint8 pixel, vx_uint32 &model) {                                                  //
+#pragma HLS INLINE
+
+    // Constants
+    const vx_uint64 THRESHOLD_SQR = static_cast<vx_uint64>(THRESHOLD) * static_cast<vx_uint64>(THRESHOLD);
+
+    // Read the model
+    const vx_int32 mean = static_cast<vx_int32>(model & 0xFFFF);
+    const vx_int32 variance = static_cast<vx_int32>(model >> 16);
+
+    // Initialize the model
+    if (variance == 0) {
+        model = (static_cast<vx_uint32>(INIT_VARIANCE) << 16) | (static_cast<vx_uint32>(pixel) << 8);
+        return 0;
+    }
+
+    // Squared difference to the mean (Q.4)
+    const vx_int32 diff = (static_cast<vx_int32>(pixel) << 8) - mean;
+    const vx_int64 diff_sqr = (static_cast<vx_int64>(diff) * static_cast<vx_int64>(diff)) >> 12;
+
+    // Classify: diff^2 > THRESHOLD^2 * variance
+    const vx_uint64 distance = static_cast<vx_uint64>(diff_sqr) << 8;
+    const bool foreground = distance > (THRESHOLD_SQR * static_cast<vx_uint64>(variance));
+
+    // Update mean and variance with the learning rate (rounded)
+    if ((SELECTIVE == false) || (foreground == false)) {
+        const vx_int64 mean_step = static_cast<vx_int64>(ALPHA) * diff + (1 << 15);
+        const vx_int64 variance_step = static_cast<vx_int64>(ALPHA) * (diff_sqr - variance) + (1 << 15);
+        const vx_int64 mean_delta = ShiftArithmeticRight<vx_int64, true>(mean_step, 16);
+        const vx_int64 variance_delta = ShiftArithmeticRight<vx_int64, true>(variance_step, 16);
+        const vx_int64 mean_new = MIN(MAX(mean + mean_delta, 0), 0xFFFF);
+        const vx_int64 variance_new = MIN(MAX(variance + variance_delta, static_cast<vx_int64>(MIN_VARIANCE)), 0xFFFF);
+        model = (static_cast<vx_uint32>(variance_new) << 16) | static_cast<vx_uint32>(mean_new);
+    }
+
+    return (foreground == true) ? (255) : (0);
+}
+
+/** @brief Background subtraction with a running Gaussian per pixel. Reads and updates the model in one streamed pass
+           and outputs a foreground mask. The model needs 32 bits per pixel (see BackgroundSubtract).
+@param VEC_SIZE        Amount of pixels computed in parallel
+@param IMG_PIXEL       Amount of pixels in the image
+@param ALPHA           The learning rate in fixed-point (16-bit fraction) between 0.0 and 1.0
+@param THRESHOLD       Foreground if |pixel - mean| > THRESHOLD * stddev, in fixed-point (4-bit fraction)
+@param MIN_VARIANCE    The lower bound of the variance in fixed-point (4-bit fraction)
+@param INIT_VARIANCE   The variance of a new model in fixed-point (4-bit fraction)
+@param SELECTIVE       Is true if foreground pixels do not update the model
+@param input           The input image
+@param model_in        The background model of the previous frame (0 for an uninitialized model)
+@param model_out       The updated background model
+@param mask            The foreground mask (255 foreground, 0 background)
+*/
+template <vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL, vx_uint32 ALPHA, vx_uint16 THRESHOLD, vx_uint16 MIN_VARIANCE, //
+          vx_uint16 INIT_VARIANCE, bool SELECTIVE>                                                              //
+void PixelwiseBackgroundSubtract(                                                                               //
+    vx_image_data<vx_uint8, VEC_SIZE> input[IMG_PIXEL / VEC_SIZE],                                              //
+    vx_image_data<vx_uint32, VEC_SIZE> model_in[IMG_PIXEL / VEC_SIZE],                                          //
+    vx_image_data<vx_uint32, VEC_SIZE> model_out[IMG_PIXEL / VEC_SIZE],                                         //
+    vx_image_data<vx_uint8, VEC_SIZE> mask[IMG_PIXEL / VEC_SIZE]) {                                             //
+#pragma HLS INLINE
+
+    // Check if input correct
+    const vx_uint32 vector_pixels = PixelwiseCheckSameType<vx_uint8, VEC_SIZE, IMG_PIXEL>();
+    STATIC_ASSERT((ALPHA > 0) && (ALPHA <= 65536), background_learning_rate_must_be_between_0_and_1);
+    STATIC_ASSERT((MIN_VARIANCE > 0) && (INIT_VARIANCE >= MIN_VARIANCE), background_variance_must_be_positive);
+
+    // Computes the foreground mask and updates the model (pipelined)
+    for (vx_uint32 i = 0; i < vector_pixels; i++) {
+#pragma HLS PIPELINE II = 1
+
+        // Read the inputs
+        vx_image_data<vx_uint8, VEC_SIZE> src = input[i], dst_mask;
+        vx_image_data<vx_uint32, VEC_SIZE> src_model = model_in[i], dst_model;
+
+        // Computes a vector of pixels in parallel
+        for (vx_uint16 j = 0; j < VEC_SIZE; j++) {
+#pragma HLS unroll
+            vx_uint32 model = src_model.pixel[j];
+            dst_mask.pixel[j] = BackgroundSubtract<ALPHA, THRESHOLD, MIN_VARIANCE, INIT_VARIANCE, SELECTIVE>( //
+                src.pixel[j], model);                                                                         //
+            dst_model.pixel[j] = model;
+        }
+
+        // Set user(SOF) & last(EOF)
+        GenerateDmaSignal<vx_uint8, VEC_SIZE>((i == 0), (i == vector_pixels - 1), dst_mask);
+        GenerateDmaSignal<vx_uint32, VEC_SIZE>((i == 0), (i == vector_pixels - 1), dst_model);
+
+        // Write the outputs
+        mask[i] = dst_mask;
+        model_out[i] = dst_model;
+    }
+}
 
 /*********************************************************************************************************************/
 /* Pixelwise different type */
@@ -781,11 +1454,10 @@ void PixelwiseSameType(                                 //
 
 /*********************************************************************************************************************/
 template <typename SrcType, typename DstType, typename ComputeSrc, typename ComputeUint, typename ResultUint,
-          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY>
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY, HIFLIPVX::ArithmeticAccuracy ACCURACY>
 DstType MagnitudeSameWidth(SrcType input1, SrcType input2) {
 #pragma HLS INLINE
 
-    const vx_uint32 COMPUTE_TYPE_SIZE = sizeof(ComputeUint);
     const bool SRC_IS_SIGNED = std::numeric_limits<SrcType>::is_signed;
     const bool DST_IS_SIGNED = std::numeric_limits<DstType>::is_signed;
 
@@ -800,15 +1472,9 @@ DstType MagnitudeSameWidth(SrcType input1, SrcType input2) {
     ComputeUint C = AA + BB;
 
     // Square Root
-    ResultUint D = 0;
-    if (COMPUTE_TYPE_SIZE == 8) {
-        if (ROUND_POLICY == VX_ROUND_POLICY_TO_NEAREST_EVEN)
-            D = static_cast<ResultUint>(sqrtf(static_cast<vx_float64>(C)) + 0.5);
-        else
-            D = static_cast<ResultUint>(sqrtf(static_cast<vx_float64>(C)));
-    } else {
-        D = SqrtLester<ResultUint, ComputeUint, true, ROUND_POLICY, sizeof(ResultUint) * 8>(C);
-    }
+    ComputeUint absA = static_cast<ComputeUint>((A < 0) ? (-A) : (A));
+    ComputeUint absB = static_cast<ComputeUint>((B < 0) ? (-B) : (B));
+    ResultUint D = MagnitudeRoot<ResultUint, ComputeUint, ROUND_POLICY, ACCURACY>(absA, absB, C);
 
     // Overflow (Saturation) - if C alrady has overflow
     ResultUint E = 0, F = 0;
@@ -836,7 +1502,8 @@ DstType MagnitudeSameWidth(SrcType input1, SrcType input2) {
 /*********************************************************************************************************************/
 template <typename SrcType, typename DstType, HIFLIPVX::PixelwiseOperationA OPERATION_TYPE,
           vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY, vx_threshold_type_e THRESH_TYPE,
-          SrcType THRESH_UPPER, SrcType THRESH_LOWER, vx_uint32 FACTOR, vx_uint8 QUANTIZATION>
+          vx_int64 THRESH_UPPER, vx_int64 THRESH_LOWER, vx_uint32 FACTOR, vx_uint8 QUANTIZATION,
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_FULL>
 DstType ArithmeticSameWidth(SrcType src1, SrcType src2) {
 #pragma HLS INLINE
 
@@ -849,23 +1516,23 @@ DstType ArithmeticSameWidth(SrcType src1, SrcType src2) {
     // MAGNITUDE
     if (OPERATION_TYPE == HIFLIPVX::MAGNITUDE) {
         if (SRC_TYPE == VX_TYPE_UINT8)
-            result = MagnitudeSameWidth<SrcType, DstType, vx_uint16, vx_uint16, vx_uint8, CONV_POLICY, ROUND_POLICY>(
-                src1, src2);
+            result = MagnitudeSameWidth<SrcType, DstType, vx_uint16, vx_uint16, vx_uint8, CONV_POLICY, ROUND_POLICY,
+                                        ACCURACY>(src1, src2);
         else if (SRC_TYPE == VX_TYPE_INT8)
-            result = MagnitudeSameWidth<SrcType, DstType, vx_int16, vx_uint16, vx_uint8, CONV_POLICY, ROUND_POLICY>(
-                src1, src2);
+            result = MagnitudeSameWidth<SrcType, DstType, vx_int16, vx_uint16, vx_uint8, CONV_POLICY, ROUND_POLICY,
+                                        ACCURACY>(src1, src2);
         else if (SRC_TYPE == VX_TYPE_UINT16)
-            result = MagnitudeSameWidth<SrcType, DstType, vx_uint32, vx_uint32, vx_uint16, CONV_POLICY, ROUND_POLICY>(
-                src1, src2);
+            result = MagnitudeSameWidth<SrcType, DstType, vx_uint32, vx_uint32, vx_uint16, CONV_POLICY, ROUND_POLICY,
+                                        ACCURACY>(src1, src2);
         else if (SRC_TYPE == VX_TYPE_INT16)
-            result = MagnitudeSameWidth<SrcType, DstType, vx_int32, vx_uint32, vx_uint16, CONV_POLICY, ROUND_POLICY>(
-                src1, src2);
+            result = MagnitudeSameWidth<SrcType, DstType, vx_int32, vx_uint32, vx_uint16, CONV_POLICY, ROUND_POLICY,
+                                        ACCURACY>(src1, src2);
         else if (SRC_TYPE == VX_TYPE_UINT32)
-            result = MagnitudeSameWidth<SrcType, DstType, vx_uint64, vx_uint64, vx_uint32, CONV_POLICY, ROUND_POLICY>(
-                src1, src2);
+            result = MagnitudeSameWidth<SrcType, DstType, vx_uint64, vx_uint64, vx_uint32, CONV_POLICY, ROUND_POLICY,
+                                        ACCURACY>(src1, src2);
         else if (SRC_TYPE == VX_TYPE_INT32)
-            result = MagnitudeSameWidth<SrcType, DstType, vx_int64, vx_uint64, vx_uint32, CONV_POLICY, ROUND_POLICY>(
-                src1, src2);
+            result = MagnitudeSameWidth<SrcType, DstType, vx_int64, vx_uint64, vx_uint32, CONV_POLICY, ROUND_POLICY,
+                                        ACCURACY>(src1, src2);
     }
 
     return static_cast<DstType>(result);
@@ -874,7 +1541,8 @@ DstType ArithmeticSameWidth(SrcType src1, SrcType src2) {
 /*********************************************************************************************************************/
 template <typename SrcType, typename DstType, HIFLIPVX::PixelwiseOperationA OPERATION_TYPE,
           vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY, vx_threshold_type_e THRESH_TYPE,
-          SrcType THRESH_UPPER, SrcType THRESH_LOWER, vx_uint32 FACTOR, vx_uint8 QUANTIZATION>
+          vx_int64 THRESH_UPPER, vx_int64 THRESH_LOWER, vx_uint32 FACTOR, vx_uint8 QUANTIZATION,
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_FULL>
 void PixelwiseComputeSameWidth(SrcType src1, SrcType src2, DstType &dst) {
 #pragma HLS INLINE
 
@@ -884,7 +1552,23 @@ void PixelwiseComputeSameWidth(SrcType src1, SrcType src2, DstType &dst) {
     // Computes arithmetic operations
     if (is_arithmetic_operation == true)
         dst = ArithmeticSameWidth<SrcType, DstType, OPERATION_TYPE, CONV_POLICY, ROUND_POLICY, THRESH_TYPE,
-                                  THRESH_UPPER, THRESH_LOWER, FACTOR, QUANTIZATION>(src1, src2);
+                                  THRESH_UPPER, THRESH_LOWER, FACTOR, QUANTIZATION, ACCURACY>(src1, src2);
+
+    // Operation not found
+    else
+        dst = 0;
+}
+template <typename SrcType, typename DstType, HIFLIPVX::PixelwiseOperationA OPERATION_TYPE,
+          vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY, vx_threshold_type_e THRESH_TYPE,
+          vx_int64 THRESH_UPPER, vx_int64 THRESH_LOWER, vx_uint32 FACTOR, vx_uint8 QUANTIZATION,
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_FULL, vx_uint8 EXPONENT_BITS>
+void PixelwiseComputeSameWidth(vx_half_float<EXPONENT_BITS> src1, vx_half_float<EXPONENT_BITS> src2, DstType &dst) {
+#pragma HLS INLINE
+
+    // Computes arithmetic operations in 32-bit float
+    if (OPERATION_TYPE == HIFLIPVX::MAGNITUDE)
+        dst = ArithmeticFloat<vx_half_float<EXPONENT_BITS>, OPERATION_TYPE, CONV_POLICY, ROUND_POLICY, THRESH_TYPE,
+                              THRESH_UPPER, THRESH_LOWER, FACTOR, QUANTIZATION>(src1, src2);
 
     // Operation not found
     else
@@ -899,6 +1583,8 @@ vx_uint32 CheckTypeSameWidth() {
     // Constants
     const vx_type_e SRC_TYPE = GET_TYPE(SrcType);
     const vx_type_e DST_TYPE = GET_TYPE(DstType);
+    const bool SRC_IS_HALF = (std::numeric_limits<SrcType>::is_integer == false) && (sizeof(SrcType) == 2);
+    const bool DST_IS_HALF = (std::numeric_limits<DstType>::is_integer == false) && (sizeof(DstType) == 2);
     const bool SRC_TYPE_CORRECT = (SRC_TYPE == VX_TYPE_UINT8) || (SRC_TYPE == VX_TYPE_UINT16) ||
                                   (SRC_TYPE == VX_TYPE_UINT32) || (SRC_TYPE == VX_TYPE_INT8) ||
                                   (SRC_TYPE == VX_TYPE_INT16) || (SRC_TYPE == VX_TYPE_INT32);
@@ -907,7 +1593,8 @@ vx_uint32 CheckTypeSameWidth() {
                                   (DST_TYPE == VX_TYPE_INT16) || (DST_TYPE == VX_TYPE_INT32);
 
     // Check function parameters/types
-    STATIC_ASSERT(SRC_TYPE_CORRECT && DST_TYPE_CORRECT, data_type_error__uint_and_int_8_to_32_bit_allowed);
+    STATIC_ASSERT((SRC_TYPE_CORRECT && DST_TYPE_CORRECT) || (SRC_IS_HALF && DST_IS_HALF),
+                  data_type_error__uint_and_int_8_to_32_bit_and_16_bit_float_allowed);
     STATIC_ASSERT((IMG_PIXEL % VEC_SIZE) == 0, image_pixels_are_not_multiple_of_vector_size);
     STATIC_ASSERT((VEC_SIZE == 1) || (VEC_SIZE == 2) || (VEC_SIZE == 4) || (VEC_SIZE == 8),
                   _vec_size_musst_be_1_2_4_8__use_vx_image_for_2_4_8);
@@ -919,8 +1606,9 @@ vx_uint32 CheckTypeSameWidth() {
 /*********************************************************************************************************************/
 template <typename SrcType, typename DstType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,
           HIFLIPVX::PixelwiseOperationA OPERATION_TYPE, vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY,
-          vx_threshold_type_e THRESH_TYPE, SrcType THRESH_UPPER, SrcType THRESH_LOWER, vx_uint32 FACTOR,
-          vx_uint8 QUANTIZATION>
+          vx_threshold_type_e THRESH_TYPE, vx_int64 THRESH_UPPER, vx_int64 THRESH_LOWER, vx_uint32 FACTOR,
+          vx_uint8 QUANTIZATION,
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_FULL>
 void PixelwiseSameWidth(vx_image_data<SrcType, VEC_SIZE> input1[IMG_PIXEL / VEC_SIZE],
                         vx_image_data<SrcType, VEC_SIZE> input2[IMG_PIXEL / VEC_SIZE],
                         vx_image_data<DstType, VEC_SIZE> output[IMG_PIXEL / VEC_SIZE]) {
@@ -949,7 +1637,8 @@ void PixelwiseSameWidth(vx_image_data<SrcType, VEC_SIZE> input1[IMG_PIXEL / VEC_
             const SrcType in1 = src1.pixel[j];
             const SrcType in2 = src2.pixel[j];
             PixelwiseComputeSameWidth<SrcType, DstType, OPERATION_TYPE, CONV_POLICY, ROUND_POLICY, THRESH_TYPE,
-                                      THRESH_UPPER, THRESH_LOWER, FACTOR, QUANTIZATION>(in1, in2, dst.pixel[j]);
+                                      THRESH_UPPER, THRESH_LOWER, FACTOR, QUANTIZATION, ACCURACY>(in1, in2,
+                                                                                                  dst.pixel[j]);
         }
 
         // Set user(SOF) & last(EOF)
@@ -963,8 +1652,9 @@ void PixelwiseSameWidth(vx_image_data<SrcType, VEC_SIZE> input1[IMG_PIXEL / VEC_
 /*********************************************************************************************************************/
 template <typename SrcType, typename DstType, vx_uint8 VEC_SIZE, vx_uint32 IMG_PIXEL,
           HIFLIPVX::PixelwiseOperationA OPERATION_TYPE, vx_convert_policy_e CONV_POLICY, vx_round_policy_e ROUND_POLICY,
-          vx_threshold_type_e THRESH_TYPE, SrcType THRESH_UPPER, SrcType THRESH_LOWER, vx_uint32 FACTOR,
-          vx_uint8 QUANTIZATION>
+          vx_threshold_type_e THRESH_TYPE, vx_int64 THRESH_UPPER, vx_int64 THRESH_LOWER, vx_uint32 FACTOR,
+          vx_uint8 QUANTIZATION,
+          HIFLIPVX::ArithmeticAccuracy ACCURACY = HIFLIPVX::ACCURACY_CORDIC_FULL>
 void PixelwiseSameWidth(SrcType input1[IMG_PIXEL / VEC_SIZE], SrcType input2[IMG_PIXEL / VEC_SIZE],
                         DstType output[IMG_PIXEL / VEC_SIZE]) {
 #pragma HLS INLINE
@@ -988,14 +1678,374 @@ void PixelwiseSameWidth(SrcType input1[IMG_PIXEL / VEC_SIZE], SrcType input2[IMG
 
         // Computes a vector of pixelwise operations in parallel
         PixelwiseComputeSameWidth<SrcType, DstType, OPERATION_TYPE, CONV_POLICY, ROUND_POLICY, THRESH_TYPE,
-                                  THRESH_UPPER, THRESH_LOWER, FACTOR, QUANTIZATION>(src1, src2, dst);
-
-        // Set user(SOF) & last(EOF)
-        GenerateDmaSignal<DstType, VEC_SIZE>((i == 0), (i == vector_pixels - 1), dst);
+                                  THRESH_UPPER, THRESH_LOWER, FACTOR, QUANTIZATION, ACCURACY>(src1, src2, dst);
 
         // Write output
         output[i] = dst;
     }
 }
 
+/*********************************************************************************************************************/
+/* CPU Magnitude and Phase (host only) */
+/*********************************************************************************************************************/
+
+#if !defined(__SYNTHESIS__)
+#ifdef __AVX2_PIXELOP__
+/** @brief Loads 8 pixels of an 8 or 16-bit image into 32-bit lanes (sign or zero extended)
+@param DataType  Data type of the image pixels
+@param input     The first of the 8 pixels
+@return          The 8 pixels
+*/
+template <typename DataType> __m256i PixelLoadAvx2(const DataType input[]) {
+    const bool IS_SIGNED = std::numeric_limits<DataType>::is_signed;
+    __m256i result;
+    if (sizeof(DataType) == 1) {
+        const __m128i data = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(input));
+        result = (IS_SIGNED) ? (_mm256_cvtepi8_epi32(data)) : (_mm256_cvtepu8_epi32(data));
+    } else {
+        const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input));
+        result = (IS_SIGNED) ? (_mm256_cvtepi16_epi32(data)) : (_mm256_cvtepu16_epi32(data));
+    }
+    return result;
+}
+
+/** @brief Stores 8 32-bit lanes as pixels of an image (converted to its data type)
+@param DataType  Data type of the image pixels
+@param data      The 8 pixels
+@param output    The first of the 8 pixels
+*/
+template <typename DataType> void PixelStoreAvx2(__m256i data, DataType output[]) {
+    alignas(32) vx_int32 pixel[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(pixel), data);
+    for (vx_uint8 i = 0; i < 8; i++)
+        output[i] = static_cast<DataType>(pixel[i]);
+}
+
+/** @brief Wraps 32-bit lanes to the signed range of CompType (as a store to a 16-bit variable does)
+@param CompType  Data type of the scalar computation
+@param data      The 8 values
+@return          The wrapped values
+*/
+template <typename CompType> __m256i PixelWrapAvx2(__m256i data) {
+    return (sizeof(CompType) == 2) ? (_mm256_srai_epi32(_mm256_slli_epi32(data, 16), 16)) : (data);
+}
+
+/** @brief Unsigned comparison a <= b of 32-bit lanes
+@return  All bits set in the lanes where a <= b
+*/
+inline __m256i PixelLessEqualAvx2(__m256i a, __m256i b) {
+    return _mm256_cmpeq_epi32(_mm256_max_epu32(a, b), b);
+}
+
+/** @brief SqrtLester with CHECK_MAX for 8 unsigned 32-bit lanes
+@param STAGES        Number of computed result bits
+@param ROUND_POLICY  Rounding policy (to zero & nearest even)
+@param value         The input values
+@param max_val       Maximum value of the output data type
+@return              The square roots of the input values
+*/
+template <vx_uint8 STAGES, vx_round_policy_e ROUND_POLICY> __m256i SqrtLesterAvx2(__m256i value, __m256i max_val) {
+    __m256i a1 = _mm256_setzero_si256();
+    __m256i a2 = _mm256_setzero_si256();
+
+    // Each stage computes 1 bit of the result vector
+    for (vx_int32 n = STAGES - 1; n >= 0; n--) {
+        const __m256i shift = _mm256_set1_epi32(n);
+        const __m256i b1 = _mm256_set1_epi32(1 << n);
+        const __m256i b2 = _mm256_sllv_epi32(b1, shift);
+        const __m256i ab = _mm256_sllv_epi32(a1, shift);
+        const __m256i a2_next = _mm256_add_epi32(_mm256_add_epi32(a2, b2), _mm256_slli_epi32(ab, 1));
+        const __m256i take = PixelLessEqualAvx2(a2_next, value);
+        a1 = _mm256_or_si256(a1, _mm256_and_si256(b1, take));
+        a2 = _mm256_blendv_epi8(a2, a2_next, take);
+    }
+
+    // Round to the nearest integer and check for overflow
+    if (ROUND_POLICY == VX_ROUND_POLICY_TO_NEAREST_EVEN) {
+        const __m256i below = PixelLessEqualAvx2(_mm256_sub_epi32(value, a2), a1);
+        const __m256i at_max = _mm256_cmpeq_epi32(a1, max_val);
+        a1 = _mm256_sub_epi32(a1, _mm256_andnot_si256(_mm256_or_si256(below, at_max), _mm256_set1_epi32(-1)));
+    }
+    return a1;
+}
+
+/** @brief Computes the magnitude of 8-bit and 16-bit images with AVX2, 8 pixels at once (same arithmetic as
+           MagnitudeSameWidth). The square sums are wrapped to the 16 bits of the scalar computation of 8-bit images.
+@param SrcType       Data type of the input images (8 or 16-bit)
+@param DstType       Data type of the output image
+@param ROUND_POLICY  Rounding policy (to zero & nearest even)
+@param ACCURACY      Accuracy tier of the square root
+@param input1        1. input image
+@param input2        2. input image
+@param output        Output image
+@param pixels        Amount of pixels in the image
+@return              The amount of computed pixels (multiple of 8)
+*/
+template <typename SrcType, typename DstType, vx_round_policy_e ROUND_POLICY, HIFLIPVX::ArithmeticAccuracy ACCURACY>
+vx_uint32 MagnitudeAvx2(const SrcType input1[], const SrcType input2[], DstType output[], vx_uint32 pixels) {
+
+    // Constants
+    const bool SRC_IS_SIGNED = std::numeric_limits<SrcType>::is_signed;
+    const bool DST_IS_SIGNED = std::numeric_limits<DstType>::is_signed;
+    const vx_uint8 RESULT_BITS = sizeof(SrcType) * 8;
+    const vx_uint8 SHORT_STAGES = (RESULT_BITS * 3) / 4;
+    const __m256i COMP_MASK = _mm256_set1_epi32((sizeof(SrcType) == 1) ? (0xffff) : (-1));
+    const __m256i ROOT_MAX = _mm256_set1_epi32((sizeof(SrcType) == 1) ? (0xff) : (0xffff));
+    const __m256i MAX_VAL = _mm256_set1_epi32(static_cast<vx_int32>(ComputeMax<DstType>()));
+
+    vx_uint32 i = 0;
+    for (; i + 8 <= pixels; i += 8) {
+
+        // Square sum and absolute values
+        const __m256i a = PixelLoadAvx2<SrcType>(&input1[i]);
+        const __m256i b = PixelLoadAvx2<SrcType>(&input2[i]);
+        const __m256i aa = _mm256_and_si256(_mm256_mullo_epi32(a, a), COMP_MASK);
+        const __m256i bb = _mm256_and_si256(_mm256_mullo_epi32(b, b), COMP_MASK);
+        const __m256i c = _mm256_and_si256(_mm256_add_epi32(aa, bb), COMP_MASK);
+        const __m256i abs_a = _mm256_abs_epi32(a);
+        const __m256i abs_b = _mm256_abs_epi32(b);
+
+        // Square root
+        __m256i d;
+        if (ACCURACY == HIFLIPVX::ACCURACY_LUT) {
+            const __m256i max_val = _mm256_max_epu32(abs_a, abs_b);
+            const __m256i min_val = _mm256_min_epu32(abs_a, abs_b);
+            const __m256i seg = _mm256_add_epi32(_mm256_sub_epi32(max_val, _mm256_srli_epi32(max_val, 3)),
+                                                 _mm256_srli_epi32(min_val, 1));
+            d = _mm256_min_epu32(_mm256_max_epu32(max_val, seg), ROOT_MAX);
+        } else if (ACCURACY == HIFLIPVX::ACCURACY_CORDIC_SHORT) {
+            __m256i shift = _mm256_setzero_si256();
+            for (vx_uint8 j = 0; j < RESULT_BITS - SHORT_STAGES; j++) {
+                const __m256i high = _mm256_srlv_epi32(c, _mm256_set1_epi32(2 * (SHORT_STAGES + j)));
+                shift = _mm256_sub_epi32(shift, _mm256_xor_si256(_mm256_cmpeq_epi32(high, _mm256_setzero_si256()),
+                                                                 _mm256_set1_epi32(-1)));
+            }
+            const __m256i normalized = _mm256_srlv_epi32(c, _mm256_add_epi32(shift, shift));
+            const __m256i root = SqrtLesterAvx2<SHORT_STAGES, ROUND_POLICY>(normalized, ROOT_MAX);
+            d = _mm256_min_epu32(_mm256_sllv_epi32(root, shift), ROOT_MAX);
+        } else {
+            d = SqrtLesterAvx2<RESULT_BITS, ROUND_POLICY>(c, ROOT_MAX);
+        }
+
+        // Saturation (the square sum of unsigned inputs can overflow)
+        __m256i e = d;
+        if (SRC_IS_SIGNED == false) {
+            const __m256i valid = _mm256_and_si256(PixelLessEqualAvx2(aa, c), PixelLessEqualAvx2(bb, c));
+            e = _mm256_blendv_epi8(MAX_VAL, d, valid);
+        }
+        if (DST_IS_SIGNED == true)
+            e = _mm256_min_epu32(e, MAX_VAL);
+
+        PixelStoreAvx2<DstType>(e, &output[i]);
+    }
+    return i;
+}
+
+/** @brief atan2Cordic for 8 lanes. A lane stops iterating once its y-vector is 0.
+@param CompType  Data type of the scalar computation (the lanes are wrapped to its range)
+@param STEPS     Number of CORDIC iterations [1..15]
+@param x         x-vectors
+@param y         y-vectors
+@return          atan2(x,y) (65536 equals 360 degree)
+*/
+template <typename CompType, vx_uint16 STEPS> __m256i Atan2CordicAvx2(__m256i x, __m256i y) {
+    const vx_int32 i_atantab[] = {16384, 8192, 4836, 2555, 1297, 651, 326, 163, 81, 41, 20, 10, 5, 3, 1, 1};
+    const __m256i ZERO = _mm256_setzero_si256();
+    const __m256i ONES = _mm256_set1_epi32(-1);
+
+    // Initialization (sgn = -1 for positive y)
+    __m256i positive = _mm256_cmpgt_epi32(y, ONES);
+    const __m256i xh = PixelWrapAvx2<CompType>(_mm256_blendv_epi8(_mm256_sub_epi32(ZERO, y), y, positive));
+    const __m256i yh = PixelWrapAvx2<CompType>(_mm256_blendv_epi8(x, _mm256_sub_epi32(ZERO, x), positive));
+    __m256i winkel = _mm256_blendv_epi8(_mm256_set1_epi32(i_atantab[0]), _mm256_set1_epi32(-i_atantab[0]), positive);
+    x = xh;
+    y = yh;
+
+    // Iterations of the lanes that have not reached y = 0
+    __m256i active = ONES;
+    for (vx_int32 i = 1, k = 0; i <= STEPS; i++, k++) {
+        positive = _mm256_cmpgt_epi32(y, ONES);
+        const __m256i angle = _mm256_set1_epi32(i_atantab[i]);
+        const __m256i step_x = _mm256_srav_epi32(x, _mm256_set1_epi32(k));
+        const __m256i step_y = _mm256_srav_epi32(y, _mm256_set1_epi32(k));
+        const __m256i winkel_next = _mm256_blendv_epi8(_mm256_add_epi32(winkel, angle),
+                                                       _mm256_sub_epi32(winkel, angle), positive);
+        const __m256i x_next = _mm256_blendv_epi8(_mm256_sub_epi32(x, step_y), _mm256_add_epi32(x, step_y), positive);
+        const __m256i y_next = _mm256_blendv_epi8(_mm256_add_epi32(y, step_x), _mm256_sub_epi32(y, step_x), positive);
+        winkel = _mm256_blendv_epi8(winkel, PixelWrapAvx2<CompType>(winkel_next), active);
+        x = _mm256_blendv_epi8(x, PixelWrapAvx2<CompType>(x_next), active);
+        y = _mm256_blendv_epi8(y, PixelWrapAvx2<CompType>(y_next), active);
+        active = _mm256_andnot_si256(_mm256_cmpeq_epi32(y, ZERO), active);
+        if (_mm256_testz_si256(active, active))
+            break;
+    }
+
+    return PixelWrapAvx2<CompType>(_mm256_sub_epi32(ZERO, winkel));
+}
+
+/** @brief atan2Lut for 8 lanes. The table entries are read with a gather.
+@param CompType  Data type of the scalar computation (the lanes are wrapped to its range)
+@param x         x-vectors (less than 24 bits)
+@param y         y-vectors (less than 24 bits)
+@param table     The 16x32 table of atan2Lut
+@return          atan2(x,y) (65536 equals 360 degree)
+*/
+template <typename CompType> __m256i Atan2LutAvx2(__m256i x, __m256i y, const vx_int32 table[16 * 32]) {
+    const __m256i ZERO = _mm256_setzero_si256();
+    const __m256i NORM = _mm256_set1_epi32(4);
+
+    // Fold the vector into the first octant
+    const __m256i abs_x = PixelWrapAvx2<CompType>(_mm256_abs_epi32(x));
+    const __m256i abs_y = PixelWrapAvx2<CompType>(_mm256_abs_epi32(y));
+    const __m256i swap = _mm256_cmpgt_epi32(abs_y, abs_x);
+    const __m256i max_val = _mm256_blendv_epi8(abs_x, abs_y, swap);
+    const __m256i min_val = _mm256_blendv_epi8(abs_y, abs_x, swap);
+
+    // Position of the leading one from the exponent of the float conversion (exact below 24 bits)
+    const __m256i exponent = _mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(max_val)), 23);
+    const __m256i msb = _mm256_sub_epi32(exponent, _mm256_set1_epi32(127));
+
+    // Normalize the vector to 5 bits
+    const __m256i right = _mm256_max_epi32(_mm256_sub_epi32(msb, NORM), ZERO);
+    const __m256i left = _mm256_max_epi32(_mm256_sub_epi32(NORM, msb), ZERO);
+    const __m256i m = _mm256_sllv_epi32(_mm256_srlv_epi32(max_val, right), left);
+    const __m256i n = _mm256_sllv_epi32(_mm256_srlv_epi32(min_val, right), left);
+
+    // Read angle of the first octant and unfold it
+    const __m256i valid = _mm256_cmpgt_epi32(max_val, ZERO);
+    const __m256i index = _mm256_add_epi32(_mm256_slli_epi32(_mm256_sub_epi32(m, _mm256_set1_epi32(16)), 5), n);
+    const __m256i a1 = _mm256_mask_i32gather_epi32(ZERO, reinterpret_cast<const int *>(table), index, valid, 4);
+    const __m256i a2 = _mm256_blendv_epi8(a1, _mm256_sub_epi32(_mm256_set1_epi32(16384), a1), swap);
+    const __m256i a3 = PixelWrapAvx2<CompType>(
+        _mm256_blendv_epi8(a2, _mm256_sub_epi32(_mm256_set1_epi32(32768), a2), _mm256_cmpgt_epi32(ZERO, x)));
+    return PixelWrapAvx2<CompType>(_mm256_blendv_epi8(a3, _mm256_sub_epi32(ZERO, a3), _mm256_cmpgt_epi32(ZERO, y)));
+}
+
+/** @brief Computes the phase of 8-bit and 16-bit images with AVX2, 8 pixels at once (same arithmetic as Phase)
+@param DataType            Data type of the image pixels (8 or 16-bit)
+@param CompType            Data type of the scalar computation (vx_int16, vx_int32)
+@param PHASE_QUANTIZATION  2^PHASE_QUANTIZATION different possibilities for the output
+@param ACCURACY            Accuracy tier: lookup table, CORDIC with 8 or with 15 iterations
+@param input1              1. input image
+@param input2              2. input image
+@param output              Output image
+@param pixels              Amount of pixels in the image
+@return                    The amount of computed pixels (multiple of 8)
+*/
+template <typename DataType, typename CompType, vx_uint8 PHASE_QUANTIZATION, HIFLIPVX::ArithmeticAccuracy ACCURACY>
+vx_uint32 PhaseAvx2(const DataType input1[], const DataType input2[], DataType output[], vx_uint32 pixels) {
+
+    // Constants
+    const vx_int32 ANGLE_BITS = 7 + PHASE_QUANTIZATION;
+    const vx_int32 SHIFT = (vx_int32)1 << ANGLE_BITS;
+    const vx_int32 TURN_POS = SHIFT / (vx_int32)(2 << (vx_int32)PHASE_QUANTIZATION);
+    const vx_int32 TURN_NEG = SHIFT - TURN_POS;
+    const vx_int32 QUANTIZATION = ANGLE_BITS - (vx_int32)PHASE_QUANTIZATION;
+    const vx_int32 ROUNDING = (vx_int32)1 << (QUANTIZATION - (vx_int32)1);
+    const __m256i PRESCALE = _mm256_set1_epi32((vx_int32)1 << (sizeof(CompType) * 4 - 4));
+    const __m256i ZERO = _mm256_setzero_si256();
+
+    // The table of atan2Lut (the entry of a normalized vector in the first octant is returned unchanged)
+    alignas(32) vx_int32 table[16 * 32] = {0};
+    if (ACCURACY == HIFLIPVX::ACCURACY_LUT) {
+        for (vx_int32 m = 16; m < 32; m++) {
+            for (vx_int32 n = 0; n <= m; n++)
+                table[(m - 16) * 32 + n] = atan2Lut<vx_int32>(m, n);
+        }
+    }
+
+    vx_uint32 i = 0;
+    for (; i + 8 <= pixels; i += 8) {
+        const __m256i input_x = PixelLoadAvx2<DataType>(&input1[i]);
+        const __m256i input_y = PixelLoadAvx2<DataType>(&input2[i]);
+
+        // Compute angle
+        __m256i a1;
+        if (ACCURACY == HIFLIPVX::ACCURACY_LUT) {
+            a1 = Atan2LutAvx2<CompType>(input_x, input_y, table);
+        } else {
+            const __m256i x = PixelWrapAvx2<CompType>(_mm256_mullo_epi32(input_x, PRESCALE));
+            const __m256i y = PixelWrapAvx2<CompType>(_mm256_mullo_epi32(input_y, PRESCALE));
+            if (ACCURACY == HIFLIPVX::ACCURACY_CORDIC_SHORT)
+                a1 = Atan2CordicAvx2<CompType, 8>(x, y);
+            else
+                a1 = Atan2CordicAvx2<CompType, 15>(x, y);
+        }
+
+        // Reduce precision, round, turn 0 degree to east and quantize
+        const __m256i a2 = PixelWrapAvx2<CompType>(
+            _mm256_sub_epi32(_mm256_srai_epi32(a1, 16 - ANGLE_BITS), _mm256_set1_epi32(ROUNDING)));
+        const __m256i a3 = PixelWrapAvx2<CompType>(
+            _mm256_blendv_epi8(a2, _mm256_add_epi32(a2, _mm256_set1_epi32(SHIFT)), _mm256_cmpgt_epi32(ZERO, a2)));
+        const __m256i turn = _mm256_cmpgt_epi32(a3, _mm256_set1_epi32(TURN_NEG));
+        const __m256i a4_pos = _mm256_add_epi32(a3, _mm256_set1_epi32(TURN_POS));
+        const __m256i a4_neg = _mm256_sub_epi32(a3, _mm256_set1_epi32(TURN_NEG));
+        const __m256i a4 = PixelWrapAvx2<CompType>(_mm256_blendv_epi8(a4_pos, a4_neg, turn));
+        const __m256i a5 = _mm256_andnot_si256(_mm256_cmpgt_epi32(a4, _mm256_set1_epi32(SHIFT - 1)), a4);
+
+        PixelStoreAvx2<DataType>(_mm256_srai_epi32(a5, QUANTIZATION), &output[i]);
+    }
+    return i;
+}
+#endif
+
+/*********************************************************************************************************************/
+/** @brief CPU version of the magnitude with the results of ImgMagnitude. 8-bit and 16-bit images are vectorized with
+           AVX2 if it is enabled.
+@param SrcType       Data type of the input images
+@param DstType       Data type of the output image
+@param IMG_PIXEL     Amount of pixels in the image
+@param ROUND_POLICY  Rounding policy (to zero & nearest even)
+@param ACCURACY      Accuracy tier of the square root
+@param input1        1. input image
+@param input2        2. input image
+@param output        Output image
+*/
+template <typename SrcType, typename DstType, vx_uint32 IMG_PIXEL, vx_round_policy_e ROUND_POLICY,
+          HIFLIPVX::ArithmeticAccuracy ACCURACY>
+void MagnitudeCpu(const SrcType input1[IMG_PIXEL], const SrcType input2[IMG_PIXEL], DstType output[IMG_PIXEL]) {
+    vx_uint32 i = 0;
+
+#ifdef __AVX2_PIXELOP__
+    if (sizeof(SrcType) <= 2)
+        i = MagnitudeAvx2<SrcType, DstType, ROUND_POLICY, ACCURACY>(input1, input2, output, IMG_PIXEL);
+#endif
+
+    // Remaining pixels
+    for (; i < IMG_PIXEL; i++) {
+        output[i] = ArithmeticSameWidth<SrcType, DstType, HIFLIPVX::MAGNITUDE, VX_CONVERT_POLICY_SATURATE, ROUND_POLICY,
+                                        VX_THRESHOLD_TYPE_BINARY, 0, 0, 1, 1, ACCURACY>(input1[i], input2[i]);
+    }
+}
+
+/*********************************************************************************************************************/
+/** @brief CPU version of the phase with the results of ImgPhase. 8-bit and 16-bit images are vectorized with AVX2 if
+           it is enabled.
+@param DataType            Data type of the image pixels
+@param IMG_PIXEL           Amount of pixels in the image
+@param PHASE_QUANTIZATION  2^PHASE_QUANTIZATION different possibilities for the output
+@param ACCURACY            Accuracy tier: lookup table, CORDIC with 8 or with 15 iterations
+@param input1              1. input image
+@param input2              2. input image
+@param output              Output image
+*/
+template <typename DataType, vx_uint32 IMG_PIXEL, vx_uint8 PHASE_QUANTIZATION, HIFLIPVX::ArithmeticAccuracy ACCURACY>
+void PhaseCpu(const DataType input1[IMG_PIXEL], const DataType input2[IMG_PIXEL], DataType output[IMG_PIXEL]) {
+    vx_uint32 i = 0;
+
+#ifdef __AVX2_PIXELOP__
+    if ((sizeof(DataType) == 1) && (ACCURACY != HIFLIPVX::ACCURACY_CORDIC_FULL))
+        i = PhaseAvx2<DataType, vx_int16, PHASE_QUANTIZATION, ACCURACY>(input1, input2, output, IMG_PIXEL);
+    else if (sizeof(DataType) <= 2)
+        i = PhaseAvx2<DataType, vx_int32, PHASE_QUANTIZATION, ACCURACY>(input1, input2, output, IMG_PIXEL);
+#endif
+
+    // Remaining pixels
+    for (; i < IMG_PIXEL; i++) {
+        output[i] = Arithmetic<DataType, HIFLIPVX::PHASE, VX_CONVERT_POLICY_WRAP, VX_ROUND_POLICY_TO_ZERO,
+                               VX_THRESHOLD_TYPE_BINARY, 0, 0, 1, PHASE_QUANTIZATION, ACCURACY>(input1[i], input2[i]);
+    }
+}
+#endif
+
 #endif /* SRC_IMG_PIXELOP_CORE_H_ */
@@ -364,6 +364,424 @@ void TestDataTypeA(std::string &name) {
     std::cout << std::endl;
 }
 
+/*! \brief Test the fused pixelwise function against the chained pixelwise functions: sat((a - b) * k + c) */
+template <typename ScalarType, vx_uint32 PIXELS, vx_uint8 VEC_SIZE, vx_uint32 SCALE>
+void TestPixelwiseFused(std::string &name) {
+
+    // Expression tree
+    typedef PixelwiseNode<HIFLIPVX::ARITHMETIC_SUBTRACTION, PixelwiseSource<0>, PixelwiseSource<1>,
+                          VX_CONVERT_POLICY_SATURATE>
+        ExprSub;
+    typedef PixelwiseNode<HIFLIPVX::MULTIPLY_CONSTANT, ExprSub, ExprSub, VX_CONVERT_POLICY_SATURATE,
+                          VX_ROUND_POLICY_TO_NEAREST_EVEN, SCALE>
+        ExprMul;
+    typedef PixelwiseNode<HIFLIPVX::ARITHMETIC_ADDITION, ExprMul, PixelwiseSource<2>, VX_CONVERT_POLICY_SATURATE>
+        ExprAdd;
+
+    // Test images
+    ScalarType *inputA = new ScalarType[PIXELS];
+    ScalarType *inputB = new ScalarType[PIXELS];
+    ScalarType *inputC = new ScalarType[PIXELS];
+    ScalarType *tmpA = new ScalarType[PIXELS];
+    ScalarType *tmpB = new ScalarType[PIXELS];
+    ScalarType *outputA = new ScalarType[PIXELS];
+    ScalarType *outputB = new ScalarType[PIXELS];
+    for (vx_uint32 i = 0; i < PIXELS; i++) {
+        inputA[i] = static_cast<ScalarType>(rand());
+        inputB[i] = static_cast<ScalarType>(rand());
+        inputC[i] = static_cast<ScalarType>(rand());
+    }
+
+    // Chained functions (3 passes)
+    ImgSubtract<ScalarType, VEC_SIZE, PIXELS, VX_CONVERT_POLICY_SATURATE>(
+        (vx_image_data<ScalarType, VEC_SIZE> *)inputA, (vx_image_data<ScalarType, VEC_SIZE> *)inputB,
+        (vx_image_data<ScalarType, VEC_SIZE> *)tmpA);
+    ImgMultiplyConstant<ScalarType, VEC_SIZE, PIXELS, VX_CONVERT_POLICY_SATURATE, VX_ROUND_POLICY_TO_NEAREST_EVEN,
+                        SCALE>((vx_image_data<ScalarType, VEC_SIZE> *)tmpA,
+                               (vx_image_data<ScalarType, VEC_SIZE> *)tmpB);
+    ImgAdd<ScalarType, VEC_SIZE, PIXELS, VX_CONVERT_POLICY_SATURATE>((vx_image_data<ScalarType, VEC_SIZE> *)tmpB,
+                                                                     (vx_image_data<ScalarType, VEC_SIZE> *)inputC,
+                                                                     (vx_image_data<ScalarType, VEC_SIZE> *)outputA);
+
+    // Fused function (1 pass)
+    ImgPixelwiseFused<ScalarType, VEC_SIZE, PIXELS, ExprAdd>(
+        (vx_image_data<ScalarType, VEC_SIZE> *)inputA, (vx_image_data<ScalarType, VEC_SIZE> *)inputB,
+        (vx_image_data<ScalarType, VEC_SIZE> *)inputC, (vx_image_data<ScalarType, VEC_SIZE> *)outputB);
+
+    // Test result
+    TestPixel<ScalarType, ScalarType, PIXELS>(inputA, inputB, outputA, outputB, name);
+
+    // Delete memory
+    delete[] inputA;
+    delete[] inputB;
+    delete[] inputC;
+    delete[] tmpA;
+    delete[] tmpB;
+    delete[] outputA;
+    delete[] outputB;
+}
+
+/*! \brief Test the accuracy tier of the magnitude and phase functions against a floating point reference */
+template <typename ScalarType, vx_uint32 PIXELS, vx_uint8 VEC_SIZE, HIFLIPVX::ArithmeticAccuracy ACCURACY,
+          vx_uint8 ORIENT_QUANTIZATION>
+void TestAccuracyTier(std::string &name) {
+
+    // Fused expressions of the same accuracy tier (and of the default tier of ImgPhase)
+    typedef PixelwiseNode<HIFLIPVX::MAGNITUDE, PixelwiseSource<0>, PixelwiseSource<1>, VX_CONVERT_POLICY_SATURATE,
+                          VX_ROUND_POLICY_TO_NEAREST_EVEN, 1, 1, VX_THRESHOLD_TYPE_BINARY, 0, 0, ACCURACY>
+        ExprMag;
+    typedef PixelwiseNode<HIFLIPVX::PHASE, PixelwiseSource<0>, PixelwiseSource<1>, VX_CONVERT_POLICY_WRAP,
+                          VX_ROUND_POLICY_TO_ZERO, 1, ORIENT_QUANTIZATION, VX_THRESHOLD_TYPE_BINARY, 0, 0, ACCURACY>
+        ExprPhase;
+    typedef PixelwiseNode<HIFLIPVX::PHASE, PixelwiseSource<0>, PixelwiseSource<1>, VX_CONVERT_POLICY_WRAP,
+                          VX_ROUND_POLICY_TO_ZERO, 1, ORIENT_QUANTIZATION>
+        ExprPhaseDefault;
+
+    // Constants
+    const vx_float64 MAX_VAL = static_cast<vx_float64>(ComputeMax<ScalarType>());
+    const vx_float64 TURN = static_cast<vx_float64>(1 << ORIENT_QUANTIZATION);
+    const vx_float64 PI = 3.14159265358979323846;
+
+    // Test images
+    ScalarType *inputA = new ScalarType[PIXELS];
+    ScalarType *inputB = new ScalarType[PIXELS];
+    ScalarType *outputA = new ScalarType[PIXELS];
+    ScalarType *outputB = new ScalarType[PIXELS];
+    ScalarType *outputC = new ScalarType[PIXELS];
+    ScalarType *outputD = new ScalarType[PIXELS];
+    ScalarType *outputE = new ScalarType[PIXELS];
+    ScalarType *outputF = new ScalarType[PIXELS];
+    ScalarType *outputG = new ScalarType[PIXELS];
+    ScalarType *outputH = new ScalarType[PIXELS];
+    for (vx_uint32 i = 0; i < PIXELS; i++) {
+        inputA[i] = static_cast<ScalarType>(rand());
+        inputB[i] = static_cast<ScalarType>(rand());
+        if ((inputA[i] == 0) && (inputB[i] == 0)) // the phase is undefined
+            inputA[i] = 1;
+    }
+
+    // Compute floating point reference (phase is rounded to the center of the orientation bins)
+    for (vx_uint32 i = 0; i < PIXELS; i++) {
+        const vx_float64 A = static_cast<vx_float64>(inputA[i]);
+        const vx_float64 B = static_cast<vx_float64>(inputB[i]);
+        outputA[i] = static_cast<ScalarType>(MIN(sqrt(A * A + B * B) + 0.5, MAX_VAL));
+        const vx_float64 angle = atan2(B, A) / (2.0 * PI);
+        const vx_float64 bin = floor((angle < 0.0 ? angle + 1.0 : angle) * TURN + 0.5);
+        outputC[i] = static_cast<ScalarType>(bin >= TURN ? 0.0 : bin);
+    }
+
+    // Compute Hardware
+    ImgMagnitude<ScalarType, ScalarType, VEC_SIZE, PIXELS, VX_ROUND_POLICY_TO_NEAREST_EVEN, ACCURACY>(
+        (vx_image_data<ScalarType, VEC_SIZE> *)inputA, (vx_image_data<ScalarType, VEC_SIZE> *)inputB,
+        (vx_image_data<ScalarType, VEC_SIZE> *)outputB);
+    ImgPhase<ScalarType, VEC_SIZE, PIXELS, ORIENT_QUANTIZATION, ACCURACY>(
+        (vx_image_data<ScalarType, VEC_SIZE> *)inputA, (vx_image_data<ScalarType, VEC_SIZE> *)inputB,
+        (vx_image_data<ScalarType, VEC_SIZE> *)outputD);
+    ImgPixelwiseFused<ScalarType, VEC_SIZE, PIXELS, ExprMag>((vx_image_data<ScalarType, VEC_SIZE> *)inputA,
+                                                             (vx_image_data<ScalarType, VEC_SIZE> *)inputB,
+                                                             (vx_image_data<ScalarType, VEC_SIZE> *)outputE);
+    ImgPixelwiseFused<ScalarType, VEC_SIZE, PIXELS, ExprPhase>((vx_image_data<ScalarType, VEC_SIZE> *)inputA,
+                                                               (vx_image_data<ScalarType, VEC_SIZE> *)inputB,
+                                                               (vx_image_data<ScalarType, VEC_SIZE> *)outputF);
+
+    // Compute CPU version (AVX2 if enabled)
+    CpuMagnitude<ScalarType, ScalarType, PIXELS, VX_ROUND_POLICY_TO_NEAREST_EVEN, ACCURACY>(inputA, inputB, outputG);
+    CpuPhase<ScalarType, PIXELS, ORIENT_QUANTIZATION, ACCURACY>(inputA, inputB, outputH);
+
+    // Test result
+    std::cout << "  " << name.c_str() << std::endl;
+    std::string name0 = "Mag:  ";
+    std::string name1 = "Orie: ";
+    std::string name2 = "Fused Mag (bit-exact):  ";
+    std::string name3 = "Fused Orie (bit-exact): ";
+    std::string name5 = "CPU Mag (bit-exact):    ";
+    std::string name6 = "CPU Orie (bit-exact):   ";
+    const vx_uint32 BINS = 1 << ORIENT_QUANTIZATION;
+    vx_int64 absDifMax = 0;
+    vx_float64 relDifMax = 0.0;
+    for (vx_uint32 i = 0; i < PIXELS; i++) {
+        const vx_int64 dif = static_cast<vx_int64>(outputB[i]) - static_cast<vx_int64>(outputA[i]);
+        absDifMax = MAX(absDifMax, abs(dif));
+        if (outputA[i] != 0) {
+            const vx_float64 relDif = 100.0 * static_cast<vx_float64>(dif) / static_cast<vx_float64>(outputA[i]);
+            relDifMax = MAX(relDifMax, fabs(relDif));
+        }
+    }
+    std::cout << "    " << name0.c_str() << "Max. absolut error: " << absDifMax
+              << " | Max. relative error: " << relDifMax << "%" << std::endl;
+    TestPixelMax<ScalarType, ScalarType, PIXELS, BINS>(inputA, inputB, outputC, outputD, name1);
+    TestPixel<ScalarType, ScalarType, PIXELS>(inputA, inputB, outputB, outputE, name2);
+    TestPixel<ScalarType, ScalarType, PIXELS>(inputA, inputB, outputD, outputF, name3);
+    TestPixel<ScalarType, ScalarType, PIXELS>(inputA, inputB, outputB, outputG, name5);
+    TestPixel<ScalarType, ScalarType, PIXELS>(inputA, inputB, outputD, outputH, name6);
+
+    // The default tier of a fused phase is the default tier of ImgPhase
+    if (ACCURACY == HIFLIPVX::ACCURACY_CORDIC_SHORT) {
+        std::string name4 = "Fused Orie default tier (bit-exact): ";
+        ImgPhase<ScalarType, VEC_SIZE, PIXELS, ORIENT_QUANTIZATION>((vx_image_data<ScalarType, VEC_SIZE> *)inputA,
+                                                                   (vx_image_data<ScalarType, VEC_SIZE> *)inputB,
+                                                                   (vx_image_data<ScalarType, VEC_SIZE> *)outputD);
+        ImgPixelwiseFused<ScalarType, VEC_SIZE, PIXELS, ExprPhaseDefault>(
+            (vx_image_data<ScalarType, VEC_SIZE> *)inputA, (vx_image_data<ScalarType, VEC_SIZE> *)inputB,
+            (vx_image_data<ScalarType, VEC_SIZE> *)outputF);
+        TestPixel<ScalarType, ScalarType, PIXELS>(inputA, inputB, outputD, outputF, name4);
+    }
+
+    // Delete memory
+    delete[] inputA;
+    delete[] inputB;
+    delete[] outputA;
+    delete[] outputB;
+    delete[] outputC;
+    delete[] outputD;
+    delete[] outputE;
+    delete[] outputF;
+    delete[] outputG;
+    delete[] outputH;
+}
+
+/*! \brief Test the weighted sum of multiple images against the weighted average and a floating point reference */
+template <typename ScalarType, vx_uint32 PIXELS, vx_uint8 VEC_SIZE, vx_uint32 ALPHA>
+void TestWeightedSum(std::string &name) {
+
+    // Constants
+    const vx_uint8 INPUT_NUM = 4;
+    const vx_uint32 WEIGHTS_AVERAGE[2] = {ALPHA, 65536 - ALPHA};
+    const vx_uint32 WEIGHTS[INPUT_NUM] = {8192, 16384, 24576, 16384};
+
+    // Test images
+    ScalarType(*input)[PIXELS] = new ScalarType[INPUT_NUM][PIXELS];
+    ScalarType *outputA = new ScalarType[PIXELS];
+    ScalarType *outputB = new ScalarType[PIXELS];
+    ScalarType *outputC = new ScalarType[PIXELS];
+    ScalarType *outputD = new ScalarType[PIXELS];
+    for (vx_uint8 n = 0; n < INPUT_NUM; n++) {
+        for (vx_uint32 i = 0; i < PIXELS; i++)
+            input[n][i] = static_cast<ScalarType>(rand());
+    }
+
+    // Compute floating point reference (rounded to nearest)
+    for (vx_uint32 i = 0; i < PIXELS; i++) {
+        vx_float64 sum = 0.0;
+        for (vx_uint8 n = 0; n < INPUT_NUM; n++)
+            sum += static_cast<vx_float64>(WEIGHTS[n]) / 65536.0 * static_cast<vx_float64>(input[n][i]);
+        outputC[i] = static_cast<ScalarType>(floor(sum + 0.5));
+    }
+
+    // Compute Hardware
+    ImgWeightedAverage<ScalarType, VEC_SIZE, PIXELS, ALPHA, VX_ROUND_POLICY_TO_NEAREST_EVEN>(
+        (vx_image_data<ScalarType, VEC_SIZE> *)input[0], (vx_image_data<ScalarType, VEC_SIZE> *)input[1],
+        (vx_image_data<ScalarType, VEC_SIZE> *)outputA);
+    ImgWeightedSum<ScalarType, VEC_SIZE, PIXELS, VX_CONVERT_POLICY_WRAP, VX_ROUND_POLICY_TO_NEAREST_EVEN>(
+        (vx_image_data<ScalarType, VEC_SIZE> *)input[0], (vx_image_data<ScalarType, VEC_SIZE> *)input[1],
+        (vx_image_data<ScalarType, VEC_SIZE> *)outputB, WEIGHTS_AVERAGE);
+    ImgWeightedSum<ScalarType, VEC_SIZE, PIXELS, VX_CONVERT_POLICY_SATURATE, VX_ROUND_POLICY_TO_NEAREST_EVEN>(
+        (vx_image_data<ScalarType, VEC_SIZE> *)input[0], (vx_image_data<ScalarType, VEC_SIZE> *)input[1],
+        (vx_image_data<ScalarType, VEC_SIZE> *)input[2], (vx_image_data<ScalarType, VEC_SIZE> *)input[3],
+        (vx_image_data<ScalarType, VEC_SIZE> *)outputD, WEIGHTS);
+
+    // Test result
+    std::cout << "  " << name.c_str() << std::endl;
+    std::string name0 = "2 Inputs: ";
+    std::string name1 = "4 Inputs: ";
+    TestPixel<ScalarType, ScalarType, PIXELS>(input[0], input[1], outputA, outputB, name0);
+    TestPixel<ScalarType, ScalarType, PIXELS>(input[0], input[1], outputC, outputD, name1);
+
+    // Delete memory
+    delete[] input;
+    delete[] outputA;
+    delete[] outputB;
+    delete[] outputC;
+    delete[] outputD;
+}
+
+/*! \brief Test the background subtraction on a noisy video with a moving square against a scalar reference */
+template <vx_uint32 COLS, vx_uint32 ROWS, vx_uint8 VEC_SIZE>
+void TestBackgroundSubtract(std::string &name) {
+
+    // Constants
+    const vx_uint32 PIXELS = COLS * ROWS;
+    const vx_uint32 FRAMES = 32;
+    const vx_uint32 WARM_UP = 8;
+    const vx_uint32 SQUARE = 32;
+    const vx_uint32 ALPHA = 3277;        // 0.05
+    const vx_uint16 THRESHOLD = 40;      // 2.5 * stddev
+    const vx_uint16 MIN_VARIANCE = 64;   // 4.0
+    const vx_uint16 INIT_VARIANCE = 256; // 16.0
+
+    // Test images
+    vx_uint8 *input = new vx_uint8[PIXELS];
+    vx_uint8 *maskA = new vx_uint8[PIXELS];
+    vx_uint8 *maskB = new vx_uint8[PIXELS];
+    vx_uint32 *modelA = new vx_uint32[PIXELS];
+    vx_uint32 *modelB = new vx_uint32[PIXELS];
+    vx_uint32 *modelC = new vx_uint32[PIXELS];
+    for (vx_uint32 i = 0; i < PIXELS; i++) {
+        modelA[i] = 0;
+        modelC[i] = 0;
+    }
+
+    // Process the video
+    vx_uint64 errors = 0, foreground = 0, detected = 0, background = 0, false_positives = 0;
+    for (vx_uint32 frame = 0; frame < FRAMES; frame++) {
+
+        // Noisy gradient background and a bright square moving from left to right
+        const vx_uint32 square_x = (frame * 6) % (COLS - SQUARE);
+        const vx_uint32 square_y = (ROWS - SQUARE) / 2;
+        for (vx_uint32 y = 0; y < ROWS; y++) {
+            for (vx_uint32 x = 0; x < COLS; x++) {
+                const bool inside = (x >= square_x) && (x < square_x + SQUARE) && (y >= square_y) &&
+                                    (y < square_y + SQUARE) && (frame >= WARM_UP);
+                const vx_int32 value = static_cast<vx_int32>((x + y) % 128) + 32 + (rand() % 9) - 4;
+                input[y * COLS + x] = static_cast<vx_uint8>((inside == true) ? (value + 80) : (value));
+            }
+        }
+
+        // Compute Hardware
+        ImgBackgroundSubtract<VEC_SIZE, PIXELS, ALPHA, THRESHOLD, MIN_VARIANCE, INIT_VARIANCE, true>(
+            (vx_image_data<vx_uint8, VEC_SIZE> *)input, (vx_image_data<vx_uint32, VEC_SIZE> *)modelA,
+            (vx_image_data<vx_uint32, VEC_SIZE> *)modelB, (vx_image_data<vx_uint8, VEC_SIZE> *)maskA);
+
+        // Compute scalar reference
+        for (vx_uint32 i = 0; i < PIXELS; i++)
+            maskB[i] = BackgroundSubtract<ALPHA, THRESHOLD, MIN_VARIANCE, INIT_VARIANCE, true>(input[i], modelC[i]);
+
+        // Compare and count detections after the warm-up
+        for (vx_uint32 y = 0; y < ROWS; y++) {
+            for (vx_uint32 x = 0; x < COLS; x++) {
+                const vx_uint32 i = y * COLS + x;
+                const bool inside = (x >= square_x) && (x < square_x + SQUARE) && (y >= square_y) &&
+                                    (y < square_y + SQUARE) && (frame >= WARM_UP);
+                if ((maskA[i] != maskB[i]) || (modelB[i] != modelC[i]))
+                    errors++;
+                if (frame >= WARM_UP) {
+                    if (inside == true) {
+                        foreground++;
+                        detected += (maskA[i] != 0) ? (1) : (0);
+                    } else {
+                        background++;
+                        false_positives += (maskA[i] != 0) ? (1) : (0);
+                    }
+                }
+            }
+        }
+        std::swap(modelA, modelB);
+    }
+
+    // Test result
+    std::cout << "    " << name.c_str() << "Errors: " << errors << " Detection rate: "
+              << static_cast<vx_float64>(detected) / static_cast<vx_float64>(foreground)
+              << " False positive rate: "
+              << static_cast<vx_float64>(false_positives) / static_cast<vx_float64>(background) << std::endl;
+
+    // Delete memory
+    delete[] input;
+    delete[] maskA;
+    delete[] maskB;
+    delete[] modelA;
+    delete[] modelB;
+    delete[] modelC;
+}
+
+/*! \brief Test the 16-bit floating point pixel types against a 32-bit floating point reference (error in ULPs) */
+template <typename ScalarType, vx_uint32 PIXELS, vx_uint8 VEC_SIZE>
+void TestHalfFloat(std::string &name) {
+
+    // Test images
+    ScalarType *inputA = new ScalarType[PIXELS];
+    ScalarType *inputB = new ScalarType[PIXELS];
+    ScalarType *outputA = new ScalarType[PIXELS];
+    ScalarType *outputB = new ScalarType[PIXELS];
+    ScalarType *outputC = new ScalarType[PIXELS];
+    for (vx_uint32 i = 0; i < PIXELS; i++) {
+        inputA[i] = static_cast<vx_float32>(rand() % 8192 - 4096) / 64.0f;
+        inputB[i] = static_cast<vx_float32>(rand() % 8192 - 4096) / 64.0f;
+    }
+
+    // Compute Hardware
+    ImgAdd<ScalarType, VEC_SIZE, PIXELS, VX_CONVERT_POLICY_SATURATE>((vx_image_data<ScalarType, VEC_SIZE> *)inputA,
+                                                                     (vx_image_data<ScalarType, VEC_SIZE> *)inputB,
+                                                                     (vx_image_data<ScalarType, VEC_SIZE> *)outputA);
+    ImgSubtract<ScalarType, VEC_SIZE, PIXELS, VX_CONVERT_POLICY_SATURATE>(
+        (vx_image_data<ScalarType, VEC_SIZE> *)inputA, (vx_image_data<ScalarType, VEC_SIZE> *)inputB,
+        (vx_image_data<ScalarType, VEC_SIZE> *)outputB);
+    ImgMagnitude<ScalarType, ScalarType, VEC_SIZE, PIXELS, VX_ROUND_POLICY_TO_NEAREST_EVEN>(
+        (vx_image_data<ScalarType, VEC_SIZE> *)inputA, (vx_image_data<ScalarType, VEC_SIZE> *)inputB,
+        (vx_image_data<ScalarType, VEC_SIZE> *)outputC);
+
+    // Compare against the rounded 32-bit floating point result
+    vx_int32 ulpMax = 0;
+    for (vx_uint32 i = 0; i < PIXELS; i++) {
+        const vx_float32 A = static_cast<vx_float32>(inputA[i]);
+        const vx_float32 B = static_cast<vx_float32>(inputB[i]);
+        const ScalarType reference[3] = {A + B, A - B, sqrtf(A * A + B * B)};
+        const ScalarType result[3] = {outputA[i], outputB[i], outputC[i]};
+        for (vx_uint32 j = 0; j < 3; j++) {
+            vx_int32 ulp = abs(static_cast<vx_int32>(reference[j].bits) - static_cast<vx_int32>(result[j].bits));
+            ulpMax = MAX(ulpMax, ulp);
+        }
+    }
+    std::cout << "    " << name.c_str() << "Max. ULP error: " << ulpMax << std::endl;
+
+    // Delete memory
+    delete[] inputA;
+    delete[] inputB;
+    delete[] outputA;
+    delete[] outputB;
+    delete[] outputC;
+}
+
+#ifdef __F16C_CONVERSION__
+/*! \brief Bit-compares the portable half precision conversions against the F16C instructions */
+template <vx_round_policy_e ROUND_POLICY, vx_convert_policy_e CONV_POLICY>
+vx_uint32 TestHalfConversionPolicy(void) {
+    vx_uint32 errors = 0;
+
+    // Every 251st float (all exponents, signs, NaN payloads and rounding cases)
+    for (vx_uint64 u = 0; u < (1ULL << 32); u += 251) {
+        vx_float32_bits convert;
+        convert.u = static_cast<vx_uint32>(u);
+        const vx_uint16 f16c = Float32ToHalf<5, ROUND_POLICY, CONV_POLICY>(convert.f);
+        const vx_uint16 portable = Float32ToHalfPortable<5, ROUND_POLICY, CONV_POLICY>(convert.f);
+        errors += (f16c != portable) ? 1 : 0;
+    }
+
+    // Zeros, infinities, NaNs, the largest half, the halfway case to infinity and the smallest subnormal halfway case
+    const vx_uint32 specials[8] = {0x00000000, 0x80000000, 0x7F800000, 0xFF800000,
+                                   0x7FC00000, 0x7F800001, 0x477FF000, 0x33000000};
+    for (vx_uint32 i = 0; i < 8; i++) {
+        vx_float32_bits convert;
+        convert.u = specials[i];
+        const vx_uint16 f16c = Float32ToHalf<5, ROUND_POLICY, CONV_POLICY>(convert.f);
+        const vx_uint16 portable = Float32ToHalfPortable<5, ROUND_POLICY, CONV_POLICY>(convert.f);
+        errors += (f16c != portable) ? 1 : 0;
+    }
+    return errors;
+}
+
+/*! \brief Bit-compares Float32ToHalf and HalfToFloat32 with and without the F16C instructions */
+void TestHalfConversion(std::string &name) {
+
+    // All half precision numbers
+    vx_uint32 errors_half = 0;
+    for (vx_uint32 bits = 0; bits < 0x10000; bits++) {
+        vx_float32_bits f16c, portable;
+        f16c.f = HalfToFloat32<5>(static_cast<vx_uint16>(bits));
+        portable.f = HalfToFloat32Portable<5>(static_cast<vx_uint16>(bits));
+        errors_half += (f16c.u != portable.u) ? 1 : 0;
+    }
+
+    // All rounding and overflow policies
+    vx_uint32 errors_float = 0;
+    errors_float += TestHalfConversionPolicy<VX_ROUND_POLICY_TO_NEAREST_EVEN, VX_CONVERT_POLICY_WRAP>();
+    errors_float += TestHalfConversionPolicy<VX_ROUND_POLICY_TO_NEAREST_EVEN, VX_CONVERT_POLICY_SATURATE>();
+    errors_float += TestHalfConversionPolicy<VX_ROUND_POLICY_TO_ZERO, VX_CONVERT_POLICY_WRAP>();
+    errors_float += TestHalfConversionPolicy<VX_ROUND_POLICY_TO_ZERO, VX_CONVERT_POLICY_SATURATE>();
+    std::cout << "    " << name.c_str() << "HalfToFloat32 errors: " << errors_half
+              << " | Float32ToHalf errors: " << errors_float << std::endl;
+}
+#endif
+
 /*! \brief Calls all Software Test Functions */
 void SwTestPixelopMain(void) {
 
@@ -406,6 +824,41 @@ void SwTestPixelopMain(void) {
     TestDataTypeA<vx_int32, PIXELS, VEC_SIZE, SCALE, THRESH_TYPE, THRESH_UPPER, THRESH_LOWER, ALPHA,
                   ORIENT_QUANTIZATION>(name06);
 #endif
+
+    std::string name07 = "Fused sat((a-b)*k+c) UNSIGNED INTEGER 8-Bit: ";
+    std::string name08 = "Fused sat((a-b)*k+c) SIGNED INTEGER 16-Bit:  ";
+    TestPixelwiseFused<vx_uint8, PIXELS, 4, 0xC000>(name07);
+    TestPixelwiseFused<vx_int16, PIXELS, 2, 0xC000>(name08);
+
+    std::string name09 = "Accuracy LUT SIGNED INTEGER 8-Bit:           ";
+    std::string name10 = "Accuracy CORDIC_SHORT SIGNED INTEGER 8-Bit:  ";
+    std::string name11 = "Accuracy CORDIC_FULL SIGNED INTEGER 8-Bit:   ";
+    TestAccuracyTier<vx_int8, PIXELS, 4, HIFLIPVX::ACCURACY_LUT, 6>(name09);
+    TestAccuracyTier<vx_int8, PIXELS, 4, HIFLIPVX::ACCURACY_CORDIC_SHORT, 6>(name10);
+    TestAccuracyTier<vx_int8, PIXELS, 4, HIFLIPVX::ACCURACY_CORDIC_FULL, 6>(name11);
+    std::string name09b = "Accuracy LUT SIGNED INTEGER 16-Bit:          ";
+    std::string name10b = "Accuracy CORDIC_SHORT SIGNED INTEGER 16-Bit: ";
+    std::string name11b = "Accuracy CORDIC_FULL SIGNED INTEGER 16-Bit:  ";
+    TestAccuracyTier<vx_int16, PIXELS, 2, HIFLIPVX::ACCURACY_LUT, 8>(name09b);
+    TestAccuracyTier<vx_int16, PIXELS, 2, HIFLIPVX::ACCURACY_CORDIC_SHORT, 8>(name10b);
+    TestAccuracyTier<vx_int16, PIXELS, 2, HIFLIPVX::ACCURACY_CORDIC_FULL, 8>(name11b);
+
+    std::string name12 = "FLOAT 16-Bit:  ";
+    std::string name13 = "BFLOAT 16-Bit: ";
+    TestHalfFloat<vx_float16, PIXELS, 4>(name12);
+    TestHalfFloat<vx_bfloat16, PIXELS, 4>(name13);
+#ifdef __F16C_CONVERSION__
+    std::string name13b = "F16C against portable conversion: ";
+    TestHalfConversion(name13b);
+#endif
+
+    std::string name14 = "Weighted sum UNSIGNED INTEGER 8-Bit: ";
+    std::string name15 = "Weighted sum SIGNED INTEGER 16-Bit:  ";
+    TestWeightedSum<vx_uint8, PIXELS, 4, ALPHA>(name14);
+    TestWeightedSum<vx_int16, PIXELS, 2, ALPHA>(name15);
+
+    std::string name16 = "Background subtraction UNSIGNED INTEGER 8-Bit: ";
+    TestBackgroundSubtract<COLS, ROWS, 4>(name16);
 }
 
 #endif /* SRC_PIXELOP_TEST_H_ */
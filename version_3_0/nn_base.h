@@ -20,7 +20,7 @@
 
 /***************************************************************************************************************************************************/
 /** @brief Do Point-Wise Image Convolution
-@param TypeData             : uint8, int8, uin16, int16, float. Be carefull with uin32, int32
+@param TypeData             : uint8, int8, uin16, int16, float, vx_float16, vx_bfloat16. Be carefull with uin32, int32
 @param FIXED_POINT_POSITION : Positive number. It is maximum the number of digits of TypeData. Ignorred for float.
 @param INPUT_HEIGHT         : (i > 0) || (i < 2048) || ((i % OUTPUT_HEIGHT) == 0) || (i >= OUTPUT_HEIGHT)
 @param INPUT_WIDTH          : (i > 0) || (i < 2048) || ((i % OUTPUT_WIDTH) == 0) || (i >= OUTPUT_WIDTH)
@@ -658,10 +658,12 @@ void CompileTimeChecks() {
 
 	const vx_int64 digits = std::numeric_limits<TypeData>::digits;
 	const bool is_integer = std::numeric_limits<TypeData>::is_integer;
+	// Float data is computed in float32 and not scaled by the fixed point position
+	const vx_int64 digits_fp = (is_integer == true) ? (digits) : (std::numeric_limits<float>::digits);
 
 	// Compile time checks
-	STATIC_ASSERT(((is_integer == true) && ((digits == 7) || (digits == 8) || (digits == 15) || (digits == 16))) || ((is_integer == false) && (digits == 24)), DATA_TYPE_IS_NOT_SUPPORTED);
-	STATIC_ASSERT((FIXED_POINT_POSITION >= 0 && FIXED_POINT_POSITION <= digits), FIXED_POINT_POSITION_NOT_VALID);
+	STATIC_ASSERT(((is_integer == true) && ((digits == 7) || (digits == 8) || (digits == 15) || (digits == 16))) || ((is_integer == false) && ((digits == 24) || (digits == 11) || (digits == 8))), DATA_TYPE_IS_NOT_SUPPORTED);
+	STATIC_ASSERT((FIXED_POINT_POSITION >= 0) && (FIXED_POINT_POSITION <= digits_fp), FIXED_POINT_POSITION_NOT_VALID);
 	STATIC_ASSERT((INPUT_HEIGHT > 0) && (INPUT_WIDTH > 0) && (IFM > 0) && (OUTPUT_HEIGHT > 0) && (OUTPUT_WIDTH > 0) && (OFM > 0) &&
 		(KERNEL_X > 0) && (KERNEL_Y > 0) && (BATCHES > 0) && (IFM_PARALLEL > 0) && (OFM_PARALLEL > 0), NO_ZERO_OR_NEGATIVE_DIMENSIONS_IN_INPUTS_OR_OUTPUTS);
 	STATIC_ASSERT((INPUT_HEIGHT <= 2048) && (INPUT_WIDTH <= 2048) && (IFM <= 2048) && (OUTPUT_HEIGHT <= 2048) && (OUTPUT_WIDTH <= 2048) && (OFM <= 2048) &&
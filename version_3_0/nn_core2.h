@@ -147,121 +147,80 @@ void ConverterPassThrough(
 }
 
 /***************************************************************************************************************************************************/
+// Converts between arbitrary vector sizes (e.g. 3 -> 4, 6 -> 8, 5 -> 2) using a shift register of
+// LCM(SRC_PARALLEL, DST_PARALLEL) elements. Within one LCM period, LCM / SRC_PARALLEL input vectors and
+// LCM / DST_PARALLEL output vectors are transferred, so the wider side transfers one vector per clock cycle.
 template<typename TypeData, vx_int64 BATCHES, vx_int64 SRC_PIXELS, vx_int64 DST_PIXELS, vx_int64 SRC_PARALLEL, vx_int64 DST_PARALLEL>
-void ConvertSrcBigger(
+void ConverterGearbox(
 	vx_image_data<TypeData, SRC_PARALLEL> src[(BATCHES * SRC_PIXELS) / SRC_PARALLEL],
 	vx_image_data<TypeData, DST_PARALLEL> dst[(BATCHES * DST_PIXELS) / DST_PARALLEL]) {
 #pragma HLS INLINE
 
 	// Constants
-	const vx_int64 DST_VECTOR = DST_PIXELS / DST_PARALLEL;
+	const vx_int64 LCM_PARALLEL = LCM(SRC_PARALLEL, DST_PARALLEL);
+	const vx_int64 SRC_STEPS = LCM_PARALLEL / SRC_PARALLEL;
+	const vx_int64 DST_STEPS = LCM_PARALLEL / DST_PARALLEL;
+	const vx_int64 STEPS = MAX(SRC_STEPS, DST_STEPS);
 	const vx_int64 SRC_VECTOR = SRC_PIXELS / SRC_PARALLEL;
-	const vx_int64 BUFFER_SIZE = MIN(SRC_PARALLEL * DST_PARALLEL, MAX(DST_PIXELS, SRC_PIXELS));
-	const vx_int64 VECTOR = MAX((BATCHES * DST_PIXELS) / (SRC_PARALLEL * DST_PARALLEL), (BATCHES * SRC_PIXELS) / (SRC_PARALLEL * DST_PARALLEL));
+	const vx_int64 DST_VECTOR = DST_PIXELS / DST_PARALLEL;
+	const vx_int64 PERIODS = (MAX(SRC_PIXELS, DST_PIXELS) + LCM_PARALLEL - 1) / LCM_PARALLEL;
 
-	// Long buffer to overcome the SRC/DST PARALLEL missmatch
-	TypeData buffer[BUFFER_SIZE]; // TODO: Initialize
+	// Shift register that holds one LCM period
+	TypeData buffer[LCM_PARALLEL];
 #pragma HLS array_partition variable=buffer complete dim=0
+	for (vx_int64 k = 0; k < LCM_PARALLEL; ++k) {
+#pragma HLS unroll
+		buffer[k] = 0;
+	}
 
 	// Iteration
-	for (vx_int64 i = 0, src_ptr = 0, dst_ptr = 0; i < VECTOR; ++i) {
-		for (vx_int64 j = 0; j < SRC_PARALLEL; ++j) {
-#pragma HLS pipeline II=1	
+	for (vx_int64 batch = 0; batch < BATCHES; ++batch) {
+		for (vx_int64 i = 0, src_ptr = 0, dst_ptr = 0, dst_cnt = 0; i < (PERIODS * STEPS); ++i) {
+#pragma HLS pipeline II=1
 
 			// Input buffer
 			vx_image_data<TypeData, SRC_PARALLEL> inputbuffer;
-//#pragma HLS array_partition variable=inputbuffer complete dim=0
 
 			// Output buffer
 			vx_image_data<TypeData, DST_PARALLEL> outputbuffer;
-//#pragma HLS array_partition variable=outputbuffer complete dim=0
 
-			// Read data from input and write to buffer
-			if ((j < DST_PARALLEL) && (src_ptr < (BATCHES * SRC_VECTOR))) {
+			// Step inside of the LCM period
+			const vx_int64 step = i % STEPS;
+			if (step == 0)
+				dst_cnt = 0;
 
-				inputbuffer = src[src_ptr];
-				++src_ptr;
+			// Read data from input and write to the shift register (zeros once the input is read completely)
+			if (step < SRC_STEPS) {
+				if (src_ptr < SRC_VECTOR) {
+					inputbuffer = src[batch * SRC_VECTOR + src_ptr];
+					++src_ptr;
+				} else {
+					for (vx_int64 k = 0; k < SRC_PARALLEL; ++k)
+						inputbuffer.pixel[k] = 0;
+				}
 
 				for (vx_int64 k = 0; k < SRC_PARALLEL; ++k)
-					buffer[j * SRC_PARALLEL + k] = inputbuffer.pixel[k];
+					buffer[step * SRC_PARALLEL + k] = inputbuffer.pixel[k];
 			}
 
-			// Read data from buffer and write to output
-			if ((j < SRC_PARALLEL) && (dst_ptr < (BATCHES * DST_VECTOR))) {
+			// Write to output, as soon as the shift register contains the next output vector
+			const vx_int64 available = MIN(step + 1, SRC_STEPS) * SRC_PARALLEL;
+			if ((((dst_cnt + 1) * DST_PARALLEL) <= available) && (dst_ptr < DST_VECTOR)) {
 
 				for (vx_int64 k = 0; k < DST_PARALLEL; ++k)
-					outputbuffer.pixel[k] = buffer[j * DST_PARALLEL + k];
-
-				GenerateDmaSignal<TypeData, DST_PARALLEL>(((dst_ptr % DST_VECTOR) == 0), ((dst_ptr % DST_VECTOR) == (DST_VECTOR - 1)), outputbuffer);
-				dst[dst_ptr] = outputbuffer;
-				++dst_ptr;
-			}
-		}
-	}
-}
-
-/***************************************************************************************************************************************************/
-template<typename TypeData, vx_int64 BATCHES, vx_int64 SRC_PIXELS, vx_int64 DST_PIXELS, vx_int64 SRC_PARALLEL, vx_int64 DST_PARALLEL>
-void ConvertDstBigger(
-	vx_image_data<TypeData, SRC_PARALLEL> src[(BATCHES * SRC_PIXELS) / SRC_PARALLEL],
-	vx_image_data<TypeData, DST_PARALLEL> dst[(BATCHES * DST_PIXELS) / DST_PARALLEL]) {
-#pragma HLS INLINE
-
-	// Constants
-	const vx_int64 GCD_PARALLEL = GCD(DST_PARALLEL, SRC_PARALLEL);
-	const vx_int64 LCM_PARALLEL = LCM(DST_PARALLEL, SRC_PARALLEL);
-	const vx_int64 BUFFER_SIZE = MIN(LCM_PARALLEL, MAX(DST_PIXELS, SRC_PIXELS));
-	const vx_int64 DST_VECTOR = DST_PIXELS / DST_PARALLEL;
-	const vx_int64 SRC_VECTOR = SRC_PIXELS / SRC_PARALLEL;
-	const vx_int64 VECTOR = MAX(SRC_VECTOR, DST_VECTOR);
-
-	// Long buffer to overcome the SRC/DST PARALLEL missmatch
-	TypeData buffer[BUFFER_SIZE];
-#pragma HLS array_partition variable=buffer complete dim=0
-
-	// Itaeration
-	for (vx_int64 batch = 0; batch < BATCHES; ++batch) {
-		for (vx_int64 src_ptr = 0, dst_ptr = 0; (src_ptr < VECTOR); ++src_ptr) {
-#pragma HLS pipeline II=1	
+					outputbuffer.pixel[k] = buffer[dst_cnt * DST_PARALLEL + k];
 
-			// Input buffer
-			vx_image_data<TypeData, SRC_PARALLEL> inputbuffer;
-//#pragma HLS array_partition variable=inputbuffer complete dim=0
+				// Set user(SOF) & last(EOF)
+				GenerateDmaSignal<TypeData, DST_PARALLEL>((dst_ptr == 0), (dst_ptr == DST_VECTOR - 1), outputbuffer);
 
-			// Output buffer
-			vx_image_data<TypeData, DST_PARALLEL> outputbuffer;
-//#pragma HLS array_partition variable=outputbuffer complete dim=0
-
-			// Buffer pointer
-			const vx_int64 src_cnt = (src_ptr % (DST_PARALLEL / GCD_PARALLEL)) * SRC_PARALLEL;
-			const vx_int64 dst_cnt = (dst_ptr % (SRC_PARALLEL / GCD_PARALLEL)) * DST_PARALLEL;
-
-			// Read data from input and write to buffer
-			if (src_ptr < SRC_VECTOR) {
-
-				inputbuffer = src[batch * SRC_VECTOR + src_ptr];
-
-				for (vx_int64 k = 0; k < SRC_PARALLEL; ++k)
-					buffer[src_cnt + k] = inputbuffer.pixel[k];
-			}
-
-			// Read data from buffer and write to output
-			if (dst_ptr < DST_VECTOR) {
-				if ((src_cnt + SRC_PARALLEL) >= (dst_cnt + DST_PARALLEL)) {
-
-					for (vx_int64 k = 0; k < DST_PARALLEL; ++k)
-						outputbuffer.pixel[k] = buffer[dst_cnt + k];
-
-					GenerateDmaSignal<TypeData, DST_PARALLEL>((dst_ptr == 0), (dst_ptr == DST_VECTOR - 1), outputbuffer);
-					dst[batch * DST_VECTOR + dst_ptr] = outputbuffer;
-					++dst_ptr;
-				}
+				dst[batch * DST_VECTOR + dst_ptr] = outputbuffer;
+				++dst_ptr;
+				++dst_cnt;
 			}
 		}
 	}
 }
 
-
 /***************************************************************************************************************************************************/
 // Convert between vector sizes of a stream
 template<typename TypeData, vx_int64 BATCHES, vx_int64 SRC_PIXELS, vx_int64 DST_PIXELS, vx_int64 SRC_PARALLEL, vx_int64 DST_PARALLEL>
@@ -283,7 +242,7 @@ void VectorSizeConverter(
 		if (MULTIPLE == true) {
 			ConverterSrcMulitple<TypeData, BATCHES, SRC_PIXELS, DST_PIXELS, SRC_PARALLEL, DST_PARALLEL>(src, dst);
 		} else {
-			ConvertSrcBigger<TypeData, BATCHES, SRC_PIXELS, DST_PIXELS, SRC_PARALLEL, DST_PARALLEL>(src, dst);
+			ConverterGearbox<TypeData, BATCHES, SRC_PIXELS, DST_PIXELS, SRC_PARALLEL, DST_PARALLEL>(src, dst);
 		}
 
 	// Up Conversion
@@ -291,7 +250,7 @@ void VectorSizeConverter(
 		if (MULTIPLE == true) {
 			ConverterDstMulitple<TypeData, BATCHES, SRC_PIXELS, DST_PIXELS, SRC_PARALLEL, DST_PARALLEL>(src, dst);
 		} else {
-			ConvertDstBigger<TypeData, BATCHES, SRC_PIXELS, DST_PIXELS, SRC_PARALLEL, DST_PARALLEL>(src, dst);
+			ConverterGearbox<TypeData, BATCHES, SRC_PIXELS, DST_PIXELS, SRC_PARALLEL, DST_PARALLEL>(src, dst);
 		}
 
 	// Pass through
@@ -412,13 +371,16 @@ void BatchNormalizationChecks() {
 	const vx_int32 digits = std::numeric_limits<TypeData>::digits;
 	const bool is_integer = std::numeric_limits<TypeData>::is_integer;
 	const bool interger_size = ((digits == 7) || (digits == 8) || (digits == 15) || (digits == 16));
+	// Float data is computed in float32 and not scaled by the fixed point position
+	const vx_int32 digits_fp = (is_integer == true) ? (digits) : (std::numeric_limits<float>::digits);
 
 	// Compile time checks
 	STATIC_ASSERT((BATCHES > 0) && (PIXELS > 0) && (IFM > 0) && (PARALLEL > 0), ONE_OF_THE_TEMPLATE_PARAMETERS_IS_ZERO);
-	STATIC_ASSERT(((is_integer == true) && (interger_size == true)) || ((is_integer == false) && (digits == 24)), DATA_TYPE_IS_NOT_SUPPORTED);
+	STATIC_ASSERT(((is_integer == true) && (interger_size == true)) || ((is_integer == false) && ((digits == 24) || (digits == 11) || (digits == 8))), DATA_TYPE_IS_NOT_SUPPORTED);
 	STATIC_ASSERT(ROUNDING_POLICY == VX_ROUND_POLICY_TO_ZERO || ROUNDING_POLICY == VX_ROUND_POLICY_TO_NEAREST_EVEN, ROUNDING_POLICY_IS_NOT_SUPPORTED);
 	STATIC_ASSERT(OVERFLOW_POLICY == VX_CONVERT_POLICY_SATURATE || OVERFLOW_POLICY == VX_CONVERT_POLICY_WRAP, OVERFLOW_POLICY_IS_NOT_SUPPORTED);
-	STATIC_ASSERT(FIXED_POINT_POSITION >= 0 && FIXED_POINT_POSITION <= digits, FIXED_POINT_POSITION_OUT_OF_SCOPE);
+	STATIC_ASSERT((FIXED_POINT_POSITION >= 0) && (FIXED_POINT_POSITION <= digits_fp),
+		FIXED_POINT_POSITION_OUT_OF_SCOPE);
 	STATIC_ASSERT(((IFM % PARALLEL) == 0) && (IFM >= PARALLEL), FEATURE_MAP_NOT_MULTIPLE_OF_PARALLELIZATION);
 }
 
@@ -875,11 +837,13 @@ void ActivationLayerCheck() {
 	const vx_int32 digits = std::numeric_limits<TypeData>::digits;
 	const bool is_integer = std::numeric_limits<TypeData>::is_integer;
 	const bool interger_size = ((digits == 7) || (digits == 8) || (digits == 15) || (digits == 16));
-	const vx_int32 digits_fp_max = (ACTIVATION_FUNCTION == VX_NN_ACTIVATION_SOFTRELU) ? (digits - 1) : (digits);
+	// Float data is computed in float32 and not scaled by the fixed point position
+	const vx_int32 digits_fp = (is_integer == true) ? (digits) : (std::numeric_limits<float>::digits);
+	const vx_int32 digits_fp_max = (ACTIVATION_FUNCTION == VX_NN_ACTIVATION_SOFTRELU) ? (digits_fp - 1) : (digits_fp);
 
 	// Compile time checks
 	STATIC_ASSERT((BATCHES > 0) && (PIXELS > 0) && (PARALLEL > 0), ONE_OF_THE_TEMPLATE_PARAMETERS_IS_ZERO);
-	STATIC_ASSERT(((is_integer == true) && (interger_size == true)) || ((is_integer == false) && (digits == 24)), DATA_TYPE_IS_NOT_SUPPORTED);
+	STATIC_ASSERT(((is_integer == true) && (interger_size == true)) || ((is_integer == false) && ((digits == 24) || (digits == 11) || (digits == 8))), DATA_TYPE_IS_NOT_SUPPORTED);
 	STATIC_ASSERT(ROUNDING_POLICY == VX_ROUND_POLICY_TO_ZERO || ROUNDING_POLICY == VX_ROUND_POLICY_TO_NEAREST_EVEN, ROUNDING_POLICY_IS_NOT_SUPPORTED);
 	STATIC_ASSERT(OVERFLOW_POLICY == VX_CONVERT_POLICY_SATURATE || OVERFLOW_POLICY == VX_CONVERT_POLICY_WRAP, OVERFLOW_POLICY_IS_NOT_SUPPORTED);
 	STATIC_ASSERT((FIXED_POINT_POSITION >= 0) && (FIXED_POINT_POSITION <= digits_fp_max), FIXED_POINT_POSITION_OUT_OF_SCOPE);
@@ -1154,6 +1118,8 @@ void SoftmaxLayer(
 	const vx_int32 digits = std::numeric_limits<TypeData>::digits;
 	const bool is_integer = std::numeric_limits<TypeData>::is_integer;
 	const bool interger_size = ((digits == 7) || (digits == 8) || (digits == 15) || (digits == 16));
+	// Floats use the fixed point position only for the fraction of the exponential sum
+	const vx_int32 digits_fp = (is_integer == true) ? (digits) : (std::numeric_limits<float>::digits);
 	const float SHIFT = static_cast<float>(1 << FIXED_POINT_POSITION);
 	const float INV_SHIFT = (1.0f / SHIFT);
 	const float MAX_INT31 = 1073741824.0f;
@@ -1161,9 +1127,10 @@ void SoftmaxLayer(
 
 	// Compile time checks
 	STATIC_ASSERT((BATCHES > 0) && (IFM > 0) && (PARALLEL > 0), ONE_OF_THE_TEMPLATE_PARAMETERS_IS_ZERO);
-	STATIC_ASSERT(((is_integer == true) && (interger_size == true)) || ((is_integer == false) && (digits == 24)), DATA_TYPE_IS_NOT_SUPPORTED);
+	STATIC_ASSERT(((is_integer == true) && (interger_size == true)) || ((is_integer == false) && ((digits == 24) || (digits == 11) || (digits == 8))), DATA_TYPE_IS_NOT_SUPPORTED);
 	STATIC_ASSERT(ROUNDING_POLICY == VX_ROUND_POLICY_TO_ZERO || ROUNDING_POLICY == VX_ROUND_POLICY_TO_NEAREST_EVEN, ROUNDING_POLICY_IS_NOT_SUPPORTED);
-	STATIC_ASSERT(FIXED_POINT_POSITION >= 0 && FIXED_POINT_POSITION <= digits, FIXED_POINT_POSITION_OUT_OF_SCOPE);
+	STATIC_ASSERT((FIXED_POINT_POSITION >= 0) && (FIXED_POINT_POSITION <= digits_fp),
+		FIXED_POINT_POSITION_OUT_OF_SCOPE);
 	STATIC_ASSERT((IFM % PARALLEL) == 0 && (IFM >= PARALLEL), TOTAL_ELEMENTS_NOT_MULTIPLE_OF_PARALLELIZATION);
 
 	// Buffers the exponential of all incoming values
@@ -1201,7 +1168,7 @@ void SoftmaxLayer(
 						TypeData variable1 = input.pixel[fmp];
 
 						// Convert to floating point if needed
-						const float variable2 = (is_integer == true) ? ((float)variable1 * INV_SHIFT) : (variable1);
+						const float variable2 = (is_integer == true) ? ((float)variable1 * INV_SHIFT) : ((float)variable1);
 
 						// Compute exponential of input value
 						const float exponential = expf(variable2);
@@ -1385,13 +1352,15 @@ void FullyConnected (
 	const vx_int32 digits = std::numeric_limits<TypeData>::digits;
 	const bool is_integer = std::numeric_limits<TypeData>::is_integer;	
 	const bool interger_size = (digits == 7) || (digits == 8) || (digits == 15) || (digits == 16);
+	// Floats use the fixed point position only for the fraction of the accumulator
+	const vx_int32 digits_fp = (is_integer == true) ? (digits) : (std::numeric_limits<float>::digits);
 
 	// Compile time checks
 	STATIC_ASSERT((BATCHES > 0) && (IFM > 0) && (OFM > 0) && (PARALLEL > 0), ONE_OF_THE_TEMPLATE_PARAMETERS_IS_ZERO);
-	STATIC_ASSERT(((is_integer == true) && (interger_size == true)) || ((is_integer == false) && (digits == 24)), DATA_TYPE_IS_NOT_SUPPORTED);
+	STATIC_ASSERT(((is_integer == true) && (interger_size == true)) || ((is_integer == false) && ((digits == 24) || (digits == 11) || (digits == 8))), DATA_TYPE_IS_NOT_SUPPORTED);
 	STATIC_ASSERT(ROUNDING_POLICY == VX_ROUND_POLICY_TO_ZERO || ROUNDING_POLICY == VX_ROUND_POLICY_TO_NEAREST_EVEN, ROUNDING_POLICY_IS_NOT_SUPPORTED);
 	STATIC_ASSERT(OVERFLOW_POLICY == VX_CONVERT_POLICY_SATURATE || OVERFLOW_POLICY == VX_CONVERT_POLICY_WRAP, OVERFLOW_POLICY_IS_NOT_SUPPORTED);
-	STATIC_ASSERT((FIXED_POINT_POSITION >= 0) && (FIXED_POINT_POSITION <= digits), FIXED_POINT_POSITION_NOT_VALID);
+	STATIC_ASSERT((FIXED_POINT_POSITION >= 0) && (FIXED_POINT_POSITION <= digits_fp), FIXED_POINT_POSITION_NOT_VALID);
 	STATIC_ASSERT((IFM % PARALLEL) == 0 && (IFM >= PARALLEL), IFM_NOT_MULTIPLE_OF_PARALLELIZATION);
 	STATIC_ASSERT((BIASES_SIZE == 0) || (BIASES_SIZE == OFM) || (BIASES_SIZE == BATCHES * OFM), BIASES_SIZE_NOT_VALID);
 	STATIC_ASSERT((WEIGHTS_SIZE == (OFM * IFM)) || (WEIGHTS_SIZE == (BATCHES * OFM * IFM)), WEIGHTS_SIZE_NOT_VALID);
@@ -38,10 +38,10 @@ ISSUES: SDSoC does not allow:
 /***************************************************************************************************************************************************/
 
 // Shared parameters
-typedef vx_uint16 NnType;                                // uint8, uint16, int8, int16, float32
-typedef vx_uint32 NnTypeBias;                            // uint8, uint16, int8, int16, float32, int32, uint32
+typedef vx_uint16 NnType;                                // uint8, uint16, int8, int16, float16, bfloat16, float32
+typedef vx_uint32 NnTypeBias;                            // uint8, uint16, int8, int16, float16, bfloat16, float32, int32, uint32
 #define NN_BATCHES                                   4  // Amount of images. Can give error if 1 due to weird unrolling of HLS
-#define NN_FP_POSITION                              16 // Position of the fixed point. Signed values need at least 1 integer.
+#define NN_FP_POSITION                              16 // Fixed point position (floats: accumulator). Signed needs 1 integer bit.
 #define NN_ROUND_TYPE          VX_ROUND_POLICY_TO_ZERO  // Underflow: vx_round_policy_e
 #define NN_OVERFLOW_TYPE    VX_CONVERT_POLICY_SATURATE  // Overflow: vx_convert_policy_e
 #define BUFFER_COEFFICIENTS                       true  // Buffers weights, biases internally on first use
@@ -1448,6 +1448,15 @@ int main(void) {
 	TestFullyConnected();
 	TestSoftmaxLayer();
 
+	// Test NN Layers with 16-bit floating point
+	TestHalfFloatLayers<vx_float16>("Float16  ");
+	TestHalfFloatLayers<vx_bfloat16>("BFloat16 ");
+
+	// Test the vector size converter with and without padding
+	TestVectorSizeConverter<vx_int16, 2, 1200, 1200, 3, 4>();
+	TestVectorSizeConverter<vx_int16, 3, 1200, 1212, 3, 4>();
+	TestVectorSizeConverter<vx_int8, 2, 1210, 1200, 5, 2>();
+
 	// Test Mobile Net
 	TestMnLayer1();
 	TestMnLayer2();	
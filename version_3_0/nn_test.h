@@ -773,4 +773,104 @@ void Evaluate(float* sw_output, vx_image_data<TypeData, FM_PARALLEL>* hw_output,
 	delete[] hw_output_test;
 }
 
+/***************************************************************************************************************************************************/
+// Test the activation, softmax and fully connected layers with a 16-bit float type against the float reference
+template<typename TypeData>
+void TestHalfFloatLayers(const char* name) {
+
+	// Layer parameters
+	const vx_int64 BATCHES = 2;
+	const vx_int64 PIXELS = 1024;
+	const vx_int64 IFM = 64;
+	const vx_int64 OFM = 32;
+	const vx_int64 PARALLEL = 2;
+	const vx_int64 FIXED_POINT_POSITION = 16;
+	const vx_round_policy_e ROUNDING_POLICY = VX_ROUND_POLICY_TO_NEAREST_EVEN;
+	const vx_convert_policy_e OVERFLOW_POLICY = VX_CONVERT_POLICY_SATURATE;
+	const vx_nn_activation_function_e ACTIVATION_FUNCTION = VX_NN_ACTIVATION_LOGISTIC;
+
+	// Matrixes
+	float* sw_src = new float[BATCHES * PIXELS];
+	float* sw_dst = new float[BATCHES * PIXELS];
+	float* sw_weights = new float[IFM * OFM];
+	float* sw_biases = new float[OFM];
+	float* hw_test = new float[BATCHES * PIXELS];
+	vx_image_data<TypeData, PARALLEL>* hw_src = new vx_image_data<TypeData, PARALLEL>[(BATCHES * PIXELS) / PARALLEL];
+	vx_image_data<TypeData, PARALLEL>* hw_dst = new vx_image_data<TypeData, PARALLEL>[(BATCHES * PIXELS) / PARALLEL];
+	vx_image_data<TypeData, PARALLEL>* hw_weights = new vx_image_data<TypeData, PARALLEL>[(IFM * OFM) / PARALLEL];
+	vx_image_data<TypeData, 1>* hw_biases = new vx_image_data<TypeData, 1>[OFM];
+	vx_image_data<TypeData, 1>* hw_fully = new vx_image_data<TypeData, 1>[BATCHES * OFM];
+
+	// Activation Layer
+	RandomInputs<TypeData, FIXED_POINT_POSITION, 1, PIXELS, 1, BATCHES, PARALLEL>(sw_src, hw_src);
+	SwActivation<BATCHES * PIXELS, ACTIVATION_FUNCTION>(1.0f, 1.0f, sw_src, sw_dst);
+	ImgActivationLayer<TypeData, BATCHES, PIXELS, PARALLEL, FIXED_POINT_POSITION, ROUNDING_POLICY, OVERFLOW_POLICY,
+		ACTIVATION_FUNCTION, false>((TypeData)1.0f, (TypeData)1.0f, hw_src, hw_dst);
+	FixedToFloat<TypeData, FIXED_POINT_POSITION, (BATCHES * PIXELS) / PARALLEL, PARALLEL>(hw_dst, hw_test);
+	printf("%s", name);
+	Print3dDiff<TypeData, FIXED_POINT_POSITION, BATCHES, 1, PIXELS, 1>(sw_dst, hw_test, "Activation:");
+
+	// Softmax Layer
+	SwSoftmaxLayer<BATCHES, PIXELS>(sw_src, sw_dst);
+	ImgSoftmaxLayer<TypeData, BATCHES, PIXELS, PARALLEL, FIXED_POINT_POSITION, ROUNDING_POLICY>(hw_src, hw_dst);
+	FixedToFloat<TypeData, FIXED_POINT_POSITION, (BATCHES * PIXELS) / PARALLEL, PARALLEL>(hw_dst, hw_test);
+	printf("%s", name);
+	Print3dDiff<TypeData, FIXED_POINT_POSITION, BATCHES, 1, PIXELS, 1>(sw_dst, hw_test, "Softmax:   ");
+
+	// Fully Connected Layer
+	RandomInputs<TypeData, FIXED_POINT_POSITION, 1, 1, IFM, BATCHES, PARALLEL>(sw_src, hw_src);
+	RandomBiases<TypeData, FIXED_POINT_POSITION, 1, OFM, 1, 1>(sw_biases, hw_biases);
+	RandomWeights<TypeData, FIXED_POINT_POSITION, 1, PARALLEL, 1, IFM, OFM, PARALLEL, 1>(sw_weights, hw_weights);
+	SwFullyConnected<BATCHES, IFM, OFM, OFM, IFM * OFM>(sw_src, sw_weights, sw_biases, sw_dst);
+	ImgFullyConnected<TypeData, BATCHES, IFM, OFM, PARALLEL, OFM, IFM * OFM, FIXED_POINT_POSITION, ROUNDING_POLICY,
+		OVERFLOW_POLICY, true>(hw_src, hw_weights, hw_biases, hw_fully);
+	FixedToFloat<TypeData, FIXED_POINT_POSITION, BATCHES * OFM, 1>(hw_fully, hw_test);
+	printf("%s", name);
+	Print3dDiff<TypeData, FIXED_POINT_POSITION, BATCHES, 1, 1, OFM>(sw_dst, hw_test, "Fully:     ");
+
+	// Free memory
+	delete[] sw_src;
+	delete[] sw_dst;
+	delete[] sw_weights;
+	delete[] sw_biases;
+	delete[] hw_test;
+	delete[] hw_src;
+	delete[] hw_dst;
+	delete[] hw_weights;
+	delete[] hw_biases;
+	delete[] hw_fully;
+}
+
+/***************************************************************************************************************************************************/
+// Test the vector size converter against the input stream (pixels after the end of the input are zero)
+template<typename TypeData, vx_int64 BATCHES, vx_int64 SRC_PIXELS, vx_int64 DST_PIXELS, vx_int64 SRC_PARALLEL, vx_int64 DST_PARALLEL>
+void TestVectorSizeConverter() {
+
+	// Matrixes
+	TypeData* src = new TypeData[BATCHES * SRC_PIXELS];
+	TypeData* dst = new TypeData[BATCHES * DST_PIXELS];
+	for (vx_int64 i = 0; i < BATCHES * SRC_PIXELS; ++i)
+		src[i] = static_cast<TypeData>(rand() % 100 + 1);
+
+	// Convert
+	ImgVectorSizeConverter<TypeData, BATCHES, SRC_PIXELS, DST_PIXELS, SRC_PARALLEL, DST_PARALLEL>(
+		(vx_image_data<TypeData, SRC_PARALLEL>*)src, (vx_image_data<TypeData, DST_PARALLEL>*)dst);
+
+	// Compare
+	vx_int64 errors = 0;
+	for (vx_int64 batch = 0; batch < BATCHES; ++batch) {
+		for (vx_int64 i = 0; i < DST_PIXELS; ++i) {
+			const TypeData expected = (i < SRC_PIXELS) ? (src[batch * SRC_PIXELS + i]) : (static_cast<TypeData>(0));
+			if (dst[batch * DST_PIXELS + i] != expected)
+				++errors;
+		}
+	}
+	printf("Vector size converter %d -> %d (%d -> %d elements, %d batches): %d errors\n", (int)SRC_PARALLEL,
+		(int)DST_PARALLEL, (int)SRC_PIXELS, (int)DST_PIXELS, (int)BATCHES, (int)errors);
+
+	// Free memory
+	delete[] src;
+	delete[] dst;
+}
+
 #endif // NN_TEST_H_
@@ -75,6 +75,17 @@ class type_info;
 #include <hls_stream.h>
 #endif
 
+#if defined(__F16C__) && !defined(__SYNTHESIS__) && !defined(__XILINX__)
+#include <immintrin.h>
+#define __F16C_CONVERSION__ // Half precision conversions use the x86 F16C instructions
+#endif
+
+#if defined(__AVX2__) && !defined(__SYNTHESIS__) && !defined(__XILINX__)
+#include <immintrin.h>
+#define __AVX2_WARP__ // The CPU warp functions compute 8 pixels at once with the x86 AVX2 instructions
+#define __AVX2_PIXELOP__ // The CPU magnitude and phase functions compute 8 pixels at once with AVX2
+#endif
+
 /*********************************************************************************************************************/
 /* Own Macros */
 /*********************************************************************************************************************/
@@ -206,6 +217,257 @@ struct vx_data_pack {                    //
     TYPE pixel[SIZE];
 };
 
+/*********************************************************************************************************************/
+/* Half Precision Data Types */
+/*********************************************************************************************************************/
+
+/*! \brief Reinterprets the bits of a 32-bit float (and vice versa)
+*/
+union vx_float32_bits {
+    vx_float32 f;
+    vx_uint32 u;
+};
+
+/*! \brief Converts a 32-bit float into a 16-bit float in portable code (see Float32ToHalf)
+@param EXPONENT_BITS Amount of exponent bits (5 = IEEE 754 half precision, 8 = bfloat16)
+@param ROUND_POLICY  Rounding of the mantissa (to zero & nearest even)
+@param CONV_POLICY   Overflow handling (wrap to infinity & saturate)
+@param value         The 32-bit float
+@return              The bits of the 16-bit float
+*/
+template <vx_uint8 EXPONENT_BITS, vx_round_policy_e ROUND_POLICY, vx_convert_policy_e CONV_POLICY> //
+vx_uint16 Float32ToHalfPortable(vx_float32 value) {                                                 //
+#pragma HLS INLINE
+
+    // Constants
+    const vx_int32 MANTISSA_BITS = 15 - EXPONENT_BITS;
+    const vx_int32 SHIFT = 23 - MANTISSA_BITS;
+    const vx_int32 BIAS = (1 << (EXPONENT_BITS - 1)) - 1;
+    const vx_uint32 EXPONENT_MAX = (1 << EXPONENT_BITS) - 1;
+    const vx_uint16 INFINITY_BITS = static_cast<vx_uint16>(EXPONENT_MAX << MANTISSA_BITS);
+    const vx_uint16 LARGEST_BITS = INFINITY_BITS - 1;
+
+    // Split the float
+    vx_float32_bits convert;
+    convert.f = value;
+    const vx_uint32 sign = (convert.u >> 16) & 0x8000;
+    const vx_uint32 exponent = (convert.u >> 23) & 0xFF;
+    const vx_uint32 mantissa = convert.u & 0x7FFFFF;
+
+    // Infinity and NaN (a quiet NaN that keeps the upper payload bits, like the F16C instructions)
+    if (exponent == 0xFF) {
+        if (mantissa != 0)
+            return static_cast<vx_uint16>(sign | INFINITY_BITS | (1 << (MANTISSA_BITS - 1)) | (mantissa >> SHIFT));
+        return static_cast<vx_uint16>(sign | ((CONV_POLICY == VX_CONVERT_POLICY_SATURATE) ? LARGEST_BITS
+                                                                                            : INFINITY_BITS));
+    }
+
+    // Normal numbers keep the exponent, smaller numbers are shifted into the subnormal range
+    const vx_int32 half_exponent = static_cast<vx_int32>(exponent) - 127 + BIAS;
+    vx_uint32 full = (exponent == 0) ? (mantissa) : (mantissa | 0x800000);
+    vx_int32 shift = SHIFT;
+    vx_uint32 result = 0;
+    if ((half_exponent > 0) && (exponent != 0)) {
+        result = (static_cast<vx_uint32>(half_exponent) << MANTISSA_BITS) | (mantissa >> SHIFT);
+    } else {
+        shift = (exponent == 0) ? (SHIFT + 127 - BIAS) : (SHIFT + 1 - half_exponent);
+        if (shift > 24)
+            return static_cast<vx_uint16>(sign);
+        result = full >> shift;
+    }
+
+    // Round the mantissa (a carry correctly increments the exponent)
+    if (ROUND_POLICY == VX_ROUND_POLICY_TO_NEAREST_EVEN) {
+        const vx_uint32 remainder = full & ((1u << shift) - 1);
+        const vx_uint32 halfway = 1u << (shift - 1);
+        if ((remainder > halfway) || ((remainder == halfway) && ((result & 1) != 0)))
+            result += 1;
+    }
+
+    // Overflow
+    if (result >= INFINITY_BITS)
+        result = (CONV_POLICY == VX_CONVERT_POLICY_SATURATE || ROUND_POLICY == VX_ROUND_POLICY_TO_ZERO)
+                     ? (LARGEST_BITS)
+                     : (INFINITY_BITS);
+
+    return static_cast<vx_uint16>(sign | result);
+}
+
+/*! \brief Converts a 32-bit float into a 16-bit float with 1 sign, EXPONENT_BITS exponent and (15 - EXPONENT_BITS)
+ * mantissa bits. Infinity and NaN are kept, results that do not fit into the exponent range become zero or infinity.
+ * The saturate policy clamps infinity (also overflowed results) to the largest finite value.
+@param EXPONENT_BITS Amount of exponent bits (5 = IEEE 754 half precision, 8 = bfloat16)
+@param ROUND_POLICY  Rounding of the mantissa (to zero & nearest even)
+@param CONV_POLICY   Overflow handling (wrap to infinity & saturate)
+@param value         The 32-bit float
+@return              The bits of the 16-bit float
+*/
+template <vx_uint8 EXPONENT_BITS, vx_round_policy_e ROUND_POLICY, vx_convert_policy_e CONV_POLICY> //
+vx_uint16 Float32ToHalf(vx_float32 value) {                                                         //
+#pragma HLS INLINE
+
+#ifdef __F16C_CONVERSION__
+    if (EXPONENT_BITS == 5) {
+        vx_float32 clamped = value;
+        if (CONV_POLICY == VX_CONVERT_POLICY_SATURATE)
+            clamped = (value > 65504.0f) ? (65504.0f) : ((value < -65504.0f) ? (-65504.0f) : (value));
+        if (ROUND_POLICY == VX_ROUND_POLICY_TO_ZERO)
+            return static_cast<vx_uint16>(_cvtss_sh(clamped, _MM_FROUND_TO_ZERO));
+        else
+            return static_cast<vx_uint16>(_cvtss_sh(clamped, _MM_FROUND_TO_NEAREST_INT));
+    }
+#endif
+
+    return Float32ToHalfPortable<EXPONENT_BITS, ROUND_POLICY, CONV_POLICY>(value);
+}
+
+/*! \brief Converts a 16-bit float into a 32-bit float in portable code (see HalfToFloat32)
+@param EXPONENT_BITS Amount of exponent bits (5 = IEEE 754 half precision, 8 = bfloat16)
+@param bits          The bits of the 16-bit float
+@return              The 32-bit float
+*/
+template <vx_uint8 EXPONENT_BITS>              //
+vx_float32 HalfToFloat32Portable(vx_uint16 bits) { //
+#pragma HLS INLINE
+
+    // Constants
+    const vx_int32 MANTISSA_BITS = 15 - EXPONENT_BITS;
+    const vx_int32 SHIFT = 23 - MANTISSA_BITS;
+    const vx_int32 BIAS = (1 << (EXPONENT_BITS - 1)) - 1;
+    const vx_uint32 EXPONENT_MAX = (1 << EXPONENT_BITS) - 1;
+
+    vx_float32_bits convert;
+
+    // bfloat16 is the upper half of a 32-bit float
+    if (EXPONENT_BITS == 8) {
+        convert.u = static_cast<vx_uint32>(bits) << 16;
+        return convert.f;
+    }
+
+    // Split the half
+    const vx_uint32 sign = static_cast<vx_uint32>(bits & 0x8000) << 16;
+    vx_int32 exponent = (bits >> MANTISSA_BITS) & EXPONENT_MAX;
+    vx_uint32 mantissa = bits & ((1 << MANTISSA_BITS) - 1);
+
+    // Infinity, NaN (quiet, like the F16C instructions), zero and normal numbers
+    if (exponent == static_cast<vx_int32>(EXPONENT_MAX)) {
+        convert.u = sign | 0x7F800000 | ((mantissa != 0) ? (0x400000) : (0)) | (mantissa << SHIFT);
+    } else if ((exponent == 0) && (mantissa == 0)) {
+        convert.u = sign;
+    } else {
+
+        // Normalize subnormal numbers
+        if (exponent == 0) {
+            exponent = 1;
+            for (vx_int32 i = 0; i < MANTISSA_BITS; i++) {
+#pragma HLS unroll
+                if ((mantissa & (1 << MANTISSA_BITS)) == 0) {
+                    mantissa <<= 1;
+                    exponent -= 1;
+                }
+            }
+            mantissa &= (1 << MANTISSA_BITS) - 1;
+        }
+        convert.u = sign | (static_cast<vx_uint32>(exponent - BIAS + 127) << 23) | (mantissa << SHIFT);
+    }
+
+    return convert.f;
+}
+
+/*! \brief Converts a 16-bit float with 1 sign, EXPONENT_BITS exponent and (15 - EXPONENT_BITS) mantissa bits into a
+ * 32-bit float. The conversion is exact.
+@param EXPONENT_BITS Amount of exponent bits (5 = IEEE 754 half precision, 8 = bfloat16)
+@param bits          The bits of the 16-bit float
+@return              The 32-bit float
+*/
+template <vx_uint8 EXPONENT_BITS>      //
+vx_float32 HalfToFloat32(vx_uint16 bits) { //
+#pragma HLS INLINE
+
+#ifdef __F16C_CONVERSION__
+    if (EXPONENT_BITS == 5)
+        return _cvtsh_ss(bits);
+#endif
+
+    return HalfToFloat32Portable<EXPONENT_BITS>(bits);
+}
+
+/*! \brief 16-bit floating point pixel type. Only the storage is 16-bit, computations are done in vx_float32.
+ * Conversions from vx_float32 round to nearest even and overflow to infinity.
+@param EXPONENT_BITS Amount of exponent bits (5 = IEEE 754 half precision, 8 = bfloat16)
+*/
+template <vx_uint8 EXPONENT_BITS> //
+struct vx_half_float {            //
+    vx_uint16 bits;
+
+    vx_half_float() : bits(0) {}
+
+    // Conversion from any arithmetic type (and the other 16-bit float format)
+    template <typename Type>
+    vx_half_float(Type value)
+        : bits(Float32ToHalf<EXPONENT_BITS, VX_ROUND_POLICY_TO_NEAREST_EVEN, VX_CONVERT_POLICY_WRAP>(
+              static_cast<vx_float32>(value))) {}
+
+    // Creates the value from its bits
+    static vx_half_float FromBits(vx_uint16 value) {
+#pragma HLS INLINE
+        vx_half_float result;
+        result.bits = value;
+        return result;
+    }
+
+    // Conversion to 32-bit float
+    inline operator vx_float32() const {
+#pragma HLS INLINE
+        return HalfToFloat32<EXPONENT_BITS>(bits);
+    }
+
+    // Negation only flips the sign bit
+    inline vx_half_float operator-() const {
+#pragma HLS INLINE
+        return FromBits(static_cast<vx_uint16>(bits ^ 0x8000));
+    }
+};
+
+typedef vx_half_float<5> vx_float16;  // IEEE 754 half precision (1 sign, 5 exponent, 10 mantissa bits)
+typedef vx_half_float<8> vx_bfloat16; // bfloat16 (1 sign, 8 exponent, 7 mantissa bits)
+
+/*! \brief Limits of the 16-bit floating point pixel types (is_integer is false, digits is 11 or 8)
+*/
+namespace std {
+template <vx_uint8 EXPONENT_BITS>          //
+class numeric_limits<vx_half_float<EXPONENT_BITS> > { //
+  private:
+    static const vx_uint16 MANTISSA_BITS = 15 - EXPONENT_BITS;
+    static const vx_uint16 BIAS = (1 << (EXPONENT_BITS - 1)) - 1;
+    static const vx_uint16 INFINITY_BITS = ((1 << EXPONENT_BITS) - 1) << MANTISSA_BITS;
+
+  public:
+    static const bool is_specialized = true;
+    static const bool is_signed = true;
+    static const bool is_integer = false;
+    static const bool is_exact = false;
+    static const bool has_infinity = true;
+    static const bool has_quiet_NaN = true;
+    static const int radix = 2;
+    static const int digits = MANTISSA_BITS + 1;
+    static const int min_exponent = 2 - BIAS;
+    static const int max_exponent = BIAS + 1;
+    static vx_half_float<EXPONENT_BITS> min() { return vx_half_float<EXPONENT_BITS>::FromBits(1 << MANTISSA_BITS); }
+    static vx_half_float<EXPONENT_BITS> max() { return vx_half_float<EXPONENT_BITS>::FromBits(INFINITY_BITS - 1); }
+    static vx_half_float<EXPONENT_BITS> lowest() {
+        return vx_half_float<EXPONENT_BITS>::FromBits(0x8000 | (INFINITY_BITS - 1));
+    }
+    static vx_half_float<EXPONENT_BITS> epsilon() {
+        return vx_half_float<EXPONENT_BITS>::FromBits((BIAS - MANTISSA_BITS) << MANTISSA_BITS);
+    }
+    static vx_half_float<EXPONENT_BITS> infinity() { return vx_half_float<EXPONENT_BITS>::FromBits(INFINITY_BITS); }
+    static vx_half_float<EXPONENT_BITS> quiet_NaN() {
+        return vx_half_float<EXPONENT_BITS>::FromBits(INFINITY_BITS | (1 << (MANTISSA_BITS - 1)));
+    }
+};
+} // namespace std
+
 struct KeyPoint {
     vx_uint16 x;
     vx_uint16 y;
@@ -435,6 +697,85 @@ enum PixelwiseOperationA {
     MULTIPLY_CONSTANT,
 };
 
+/*! \brief Accuracy tier of the magnitude and phase computation (see ImgMagnitude and ImgPhase for error bounds)
+ */
+enum ArithmeticAccuracy {
+    ACCURACY_LUT,          /*!< \brief Lookup table or shift-add approximation only (no iterations) */
+    ACCURACY_CORDIC_SHORT, /*!< \brief Reduced number of CORDIC/square root iterations */
+    ACCURACY_CORDIC_FULL,  /*!< \brief Full number of CORDIC/square root iterations */
+};
+
+/*! \brief Color filter array layout of a raw Bayer image (colors of the upper left 2x2 pixels)
+ */
+enum BayerPattern {
+    BAYER_RGGB, /*!< \brief R G / G B */
+    BAYER_BGGR, /*!< \brief B G / G R */
+    BAYER_GRBG, /*!< \brief G R / B G */
+    BAYER_GBRG, /*!< \brief G B / R G */
+};
+
+/*! \brief Interpolation method of the Bayer demosaicing
+ */
+enum DemosaicMethod {
+    DEMOSAIC_BILINEAR,         /*!< \brief Averages the nearest pixels of the same color */
+    DEMOSAIC_MALVAR_HE_CUTLER, /*!< \brief Bilinear with gradient correction (edge-aware 5x5 kernels) */
+};
+
+/*! \brief Color spaces of the color space conversion (3 channels with 8-bit each)
+ */
+enum ColorSpace {
+    COLOR_SPACE_HSV,         /*!< \brief Hue (0 - 255 for 0 - 360 degree), saturation, value */
+    COLOR_SPACE_YCBCR_BT601, /*!< \brief Full range YCbCr with BT.601 coefficients (JPEG) */
+    COLOR_SPACE_YCBCR_BT709, /*!< \brief Full range YCbCr with BT.709 coefficients */
+    COLOR_SPACE_LAB,         /*!< \brief Approximate CIE Lab (D65): L * 255 / 100, a + 128, b + 128 */
+};
+
+/*! \brief Fields of a connected component (blob) record (vx_uint32 each)
+ */
+enum BlobRecord {
+    BLOB_AREA,        /*!< \brief Amount of pixels of the component */
+    BLOB_MIN_X,       /*!< \brief Left column of the bounding box */
+    BLOB_MIN_Y,       /*!< \brief Top row of the bounding box */
+    BLOB_MAX_X,       /*!< \brief Right column of the bounding box */
+    BLOB_MAX_Y,       /*!< \brief Bottom row of the bounding box */
+    BLOB_CENTROID_X,  /*!< \brief Centroid column (Q16.16 fixed-point) */
+    BLOB_CENTROID_Y,  /*!< \brief Centroid row (Q16.16 fixed-point) */
+    BLOB_RECORD_SIZE, /*!< \brief Amount of fields of a record */
+};
+
+/*! \brief Raw image moments m_pq = sum(x^p * y^q * weight) in the order they are written (vx_uint64 each).
+ *         Moments up to order 2 use the first 6 entries, moments up to order 3 all entries.
+ */
+enum ImageMoment {
+    MOMENT_00,          /*!< \brief Sum of the weights (area of a mask or label) */
+    MOMENT_10,          /*!< \brief Sum of x * weight */
+    MOMENT_01,          /*!< \brief Sum of y * weight */
+    MOMENT_20,          /*!< \brief Sum of x^2 * weight */
+    MOMENT_11,          /*!< \brief Sum of x * y * weight */
+    MOMENT_02,          /*!< \brief Sum of y^2 * weight */
+    MOMENT_30,          /*!< \brief Sum of x^3 * weight */
+    MOMENT_21,          /*!< \brief Sum of x^2 * y * weight */
+    MOMENT_12,          /*!< \brief Sum of x * y^2 * weight */
+    MOMENT_03,          /*!< \brief Sum of y^3 * weight */
+    MOMENT_RECORD_SIZE, /*!< \brief Amount of moments up to order 3 */
+};
+
+/*! \brief Fields of a line (rho = x * cos(theta) + y * sin(theta)) in the order they are written (vx_int32 each)
+ */
+enum HoughLineRecord {
+    HOUGH_RHO,         /*!< \brief Signed distance of the line to the origin in pixels */
+    HOUGH_THETA,       /*!< \brief Angle of the line normal in steps of 180 / THETA_NUM degrees */
+    HOUGH_VOTES,       /*!< \brief Amount of edge pixels that voted for the line */
+    HOUGH_RECORD_SIZE, /*!< \brief Amount of fields of a record */
+};
+
+/*! \brief Response of the template matching (a larger response is a better match)
+ */
+enum TemplateMatchMode {
+    MATCH_SSD, /*!< \brief Negative mean of the squared differences (0 is a perfect match) */
+    MATCH_NCC, /*!< \brief Zero-mean normalized cross-correlation in Q1.14 (16384 is a perfect match) */
+};
+
 enum NonMaxSuppressionMask {
     SQUARE,
     CIRCLE,
@@ -974,15 +1315,17 @@ template <typename Type, bool SIGNED_DATA_TYPE> Type ShiftArithmeticRight(Type d
 }
 
 /** @brief Computes the ATAN2(x,y) using the cordic algorithm
-@param x  x-vector
-@param y  y_vector
-@return	  atan2(x,y)
+@param CompType  Data type for the computation
+@param STEPS     Number of CORDIC iterations [1..15]
+@param x         x-vector
+@param y         y_vector
+@return	         atan2(x,y) (65536 equals 360 degree)
 */
 template <typename CompType, vx_uint16 STEPS> CompType atan2Cordic(CompType x, CompType y) {
 #pragma HLS INLINE
 
     CompType sgn, xh, yh, winkel;
-    CompType i_atantab[] = {16384, 9672, 5110, 2594, 1302, 652, 326, 163, 81, 41, 20, 10, 5, 3, 1, 1};
+    CompType i_atantab[] = {16384, 8192, 4836, 2555, 1297, 651, 326, 163, 81, 41, 20, 10, 5, 3, 1, 1};
 
     // Initalization
     sgn = (y >= 0) ? -1 : 1;
@@ -1008,6 +1351,90 @@ template <typename CompType, vx_uint16 STEPS> CompType atan2Cordic(CompType x, C
     return -winkel;
 }
 
+/** @brief Computes the ATAN2(x,y) using a lookup table only (no iterations).
+           The vector is folded into the first octant and normalized to 5 bits. The angle of the octant is then
+           read from a 16x32 table. Maximum error: 378 (2.08 degree).
+@param CompType  Data type for the computation
+@param x         x-vector
+@param y         y_vector
+@return	         atan2(x,y) (65536 equals 360 degree)
+*/
+template <typename CompType> CompType atan2Lut(CompType x, CompType y) {
+#pragma HLS INLINE
+
+    // Bits of the normalized vector
+    const vx_uint8 NORM_BITS = 5;
+    const vx_uint8 COMP_BITS = sizeof(CompType) * 8;
+
+    // atan(n/m) for m = [16..31] and n = [0..31] (midpoint of each cell)
+    const vx_int16 i_atanlut[16][32] = {
+        {326, 955, 1577, 2189, 2785, 3363, 3920, 4455, 4966, 5452, 5914, 6351, 6764, 7154, 7521, 7866,
+         8192, 8350, 8499, 8639, 8772, 8897, 9015, 9126, 9232, 9332, 9426, 9515, 9600, 9681, 9757, 9830},
+        {306, 900, 1488, 2066, 2632, 3183, 3715, 4228, 4720, 5191, 5640, 6066, 6471, 6855, 7218, 7561,
+         7886, 8192, 8341, 8482, 8615, 8741, 8861, 8974, 9081, 9183, 9279, 9370, 9457, 9540, 9619, 9693},
+        {289, 851, 1408, 1957, 2495, 3020, 3529, 4022, 4496, 4952, 5387, 5803, 6200, 6577, 6935, 7275,
+         7597, 7903, 8192, 8333, 8467, 8593, 8714, 8828, 8937, 9040, 9138, 9231, 9320, 9404, 9485, 9561},
+        {274, 807, 1336, 1859, 2371, 2873, 3361, 3834, 4291, 4732, 5155, 5560, 5948, 6318, 6670, 7006,
+         7325, 7629, 7918, 8192, 8326, 8453, 8574, 8689, 8799, 8903, 9002, 9097, 9187, 9273, 9355, 9434},
+        {261, 768, 1272, 1769, 2259, 2739, 3207, 3662, 4103, 4530, 4940, 5335, 5713, 6076, 6423, 6754,
+         7070, 7371, 7658, 7931, 8192, 8319, 8440, 8556, 8666, 8772, 8872, 8968, 9059, 9147, 9230, 9310},
+        {248, 732, 1213, 1688, 2157, 2617, 3067, 3505, 3930, 4343, 4741, 5125, 5495, 5850, 6190, 6516,
+         6828, 7127, 7412, 7684, 7944, 8192, 8313, 8429, 8540, 8646, 8747, 8844, 8936, 9025, 9109, 9190},
+        {237, 699, 1159, 1614, 2063, 2505, 2937, 3360, 3771, 4170, 4557, 4931, 5291, 5639, 5972, 6293,
+         6601, 6896, 7178, 7449, 7707, 7955, 8192, 8308, 8419, 8525, 8627, 8724, 8818, 8907, 8993, 9075},
+        {227, 670, 1110, 1547, 1978, 2402, 2818, 3226, 3623, 4010, 4385, 4749, 5101, 5441, 5768, 6083,
+         6386, 6677, 6957, 7225, 7482, 7729, 7965, 8192, 8303, 8409, 8511, 8609, 8703, 8793, 8880, 8963},
+        {217, 642, 1065, 1484, 1899, 2307, 2708, 3102, 3486, 3861, 4226, 4580, 4923, 5255, 5575, 5885,
+         6183, 6470, 6747, 7012, 7268, 7513, 7749, 7975, 8192, 8298, 8401, 8499, 8593, 8684, 8771, 8855},
+        {208, 617, 1023, 1427, 1826, 2219, 2607, 2987, 3359, 3722, 4077, 4421, 4756, 5080, 5394, 5698,
+         5991, 6274, 6547, 6810, 7063, 7307, 7541, 7767, 7984, 8192, 8294, 8393, 8487, 8578, 8666, 8751},
+        {200, 593, 985, 1373, 1758, 2138, 2512, 2880, 3240, 3593, 3937, 4273, 4599, 4916, 5224, 5522,
+         5810, 6089, 6358, 6618, 6868, 7110, 7343, 7567, 7783, 7992, 8192, 8290, 8385, 8477, 8565, 8649},
+        {193, 572, 949, 1324, 1695, 2062, 2424, 2780, 3129, 3472, 3807, 4133, 4452, 4762, 5063, 5355,
+         5638, 5912, 6178, 6434, 6682, 6922, 7153, 7376, 7591, 7799, 7999, 8192, 8287, 8378, 8467, 8552},
+        {186, 552, 916, 1278, 1636, 1991, 2342, 2687, 3026, 3358, 3684, 4002, 4313, 4616, 4910, 5197,
+         5475, 5745, 6006, 6260, 6505, 6742, 6971, 7193, 7407, 7613, 7813, 8006, 8192, 8283, 8372, 8457},
+        {180, 533, 885, 1235, 1582, 1925, 2265, 2599, 2928, 3252, 3569, 3879, 4182, 4478, 4767, 5047,
+         5320, 5586, 5843, 6093, 6335, 6570, 6797, 7017, 7229, 7435, 7634, 7826, 8012, 8192, 8280, 8366},
+        {174, 515, 856, 1194, 1531, 1863, 2193, 2517, 2837, 3152, 3460, 3763, 4059, 4348, 4630, 4906,
+         5174, 5434, 5688, 5934, 6173, 6405, 6630, 6848, 7059, 7263, 7461, 7653, 7839, 8018, 8192, 8277},
+        {168, 499, 829, 1157, 1483, 1805, 2125, 2440, 2751, 3057, 3358, 3653, 3942, 4225, 4501, 4771,
+         5034, 5290, 5540, 5782, 6018, 6248, 6470, 6686, 6895, 7098, 7295, 7486, 7671, 7850, 8024, 8192}};
+
+    // Fold the vector into the first octant
+    const CompType abs_x = (x < 0) ? (static_cast<CompType>(-x)) : (x);
+    const CompType abs_y = (y < 0) ? (static_cast<CompType>(-y)) : (y);
+    const bool swap = (abs_y > abs_x);
+    const CompType max_val = (swap) ? (abs_y) : (abs_x);
+    const CompType min_val = (swap) ? (abs_x) : (abs_y);
+
+    // Position of the leading one
+    vx_uint8 msb = 0;
+    for (vx_uint8 i = 0; i < COMP_BITS - 1; i++) {
+#pragma HLS unroll
+        if ((max_val >> i) != 0)
+            msb = i;
+    }
+
+    // Normalize the vector to NORM_BITS
+    CompType m = 0, n = 0;
+    if (msb >= NORM_BITS - 1) {
+        m = max_val >> (msb - (NORM_BITS - 1));
+        n = min_val >> (msb - (NORM_BITS - 1));
+    } else {
+        m = max_val << ((NORM_BITS - 1) - msb);
+        n = min_val << ((NORM_BITS - 1) - msb);
+    }
+
+    // Read angle of the first octant and unfold it
+    const CompType a1 = (max_val == 0) ? (0) : (static_cast<CompType>(i_atanlut[m - (1 << (NORM_BITS - 1))][n]));
+    const CompType a2 = (swap) ? (static_cast<CompType>(16384 - a1)) : (a1);
+    const CompType a3 = (x < 0) ? (static_cast<CompType>(32768 - a2)) : (a2);
+    const CompType a4 = (y < 0) ? (static_cast<CompType>(-a3)) : (a3);
+
+    return a4;
+}
+
 /** @brief Computes the ATAN2(x,y) using the cordic algorithm
 @param x  x-vector
 @param y  y_vector
@@ -1046,6 +1473,51 @@ vx_int64 atan2CordicAccurate(vx_int64 x, vx_int64 y) {
     return -winkel;
 }
 
+/** @brief Computes the cosine and sine of an angle in [0, 180) degree using the cordic algorithm (rotation mode).
+           The vector is computed with 40 fraction bits in 39 iterations and rounded to the nearest value.
+@param FRACTION_BITS The fraction bits of the result [1..30]
+@param angle         The angle (2^40 equals 360 degree)
+@param cos_val       cos(angle) with FRACTION_BITS fraction bits
+@param sin_val       sin(angle) with FRACTION_BITS fraction bits
+*/
+template <vx_uint8 FRACTION_BITS> void sinCosCordic(vx_int64 angle, vx_int32 &cos_val, vx_int32 &sin_val) {
+#pragma HLS INLINE
+
+    // atan(2^-i) (2^40 equals 360 degree) and 1/K (40 fraction bits)
+    const vx_int64 i_atantab[] = {137438953472LL, 81134951838LL, 42869480287LL, 21761217566LL, 10922836750LL,
+                                  5466743129LL,   2734038620LL,  1367102738LL,  683561799LL,   341782203LL,
+                                  170891265LL,    85445653LL,    42722829LL,    21361415LL,    10680707LL,
+                                  5340354LL,      2670177LL,     1335088LL,     667544LL,      333772LL,
+                                  166886LL,       83443LL,       41722LL,       20861LL,       10430LL,
+                                  5215LL,         2608LL,        1304LL,        652LL,         326LL,
+                                  163LL,          81LL,          41LL,          20LL,          10LL,
+                                  5LL,            3LL,           1LL,           1LL};
+    const vx_int64 GAIN = 667681663043LL;
+    const vx_int64 QUARTER = static_cast<vx_int64>(1) << 38;
+    const vx_uint8 BITS = 40;
+    const vx_uint8 STEPS = 39;
+
+    // Rotate by 90 degree first, if the angle is larger (the iterations converge up to 99.9 degree)
+    vx_int64 x = (angle >= QUARTER) ? (0) : (GAIN);
+    vx_int64 y = (angle >= QUARTER) ? (GAIN) : (0);
+    vx_int64 z = (angle >= QUARTER) ? (angle - QUARTER) : (angle);
+
+    // Rotate towards the residual angle
+    for (vx_uint8 i = 0; i < STEPS; i++) {
+#pragma HLS PIPELINE II = 1
+        const vx_int64 xh = (z >= 0) ? (x - (y >> i)) : (x + (y >> i));
+        const vx_int64 yh = (z >= 0) ? (y + (x >> i)) : (y - (x >> i));
+        z = (z >= 0) ? (z - i_atantab[i]) : (z + i_atantab[i]);
+        x = xh;
+        y = yh;
+    }
+
+    // Round to the fraction bits
+    const vx_int64 ROUND = static_cast<vx_int64>(1) << (BITS - FRACTION_BITS - 1);
+    cos_val = static_cast<vx_int32>((x + ROUND) >> (BITS - FRACTION_BITS));
+    sin_val = static_cast<vx_int32>((y + ROUND) >> (BITS - FRACTION_BITS));
+}
+
 /** @brief Computes square root: Rounding to floor or to nearest integer
 @param OutType		The data type of the output
 @param InType		The data type of the input
@@ -1100,6 +1572,63 @@ OutType SqrtLester(InType value) {   //
     return A1;
 }
 
+/** @brief Computes square root with a reduced number of stages. The input is normalized by an even shift, so that
+           only the STAGES most significant bits of the result are computed. Relative error < 2^-(STAGES-1).
+@param OutType           The data type of the output
+@param InType            The data type of the input
+@param ROUND_POLICY      Rounding policy (to zero & nearest even)
+@param OUTPUT_BIT_WIDTH  The bit width of the result
+@param STAGES            Number of computed result bits (latency)
+@param value             The input value
+@return                  The square root of the input value
+*/
+template <typename OutType, typename InType, vx_round_policy_e ROUND_POLICY, vx_uint8 OUTPUT_BIT_WIDTH,
+          vx_uint8 STAGES>      //
+OutType SqrtShort(InType value) { //
+#pragma HLS INLINE
+
+    STATIC_ASSERT(STAGES > 0 && STAGES <= OUTPUT_BIT_WIDTH, stages_must_be_between_1_and_output_bit_width);
+
+    const InType MAX_VAL = static_cast<InType>(ComputeMax<OutType>());
+
+    // Even shift to normalize the input to 2 * STAGES bits
+    vx_uint8 shift = 0;
+    for (vx_uint8 i = 0; i < OUTPUT_BIT_WIDTH - STAGES; i++) {
+#pragma HLS unroll
+        if ((value >> (2 * (STAGES + i))) != 0)
+            shift = i + 1;
+    }
+
+    // Square root of the normalized input
+    const InType normalized = value >> (2 * shift);
+    const InType root = static_cast<InType>(SqrtLester<OutType, InType, true, ROUND_POLICY, STAGES>(normalized));
+
+    // Denormalize and check for overflow due to rounding
+    const InType result = root << shift;
+    return static_cast<OutType>(MIN(result, MAX_VAL));
+}
+
+/** @brief Approximates sqrt(a^2 + b^2) with two alpha-max-plus-beta-min segments (shift and add only).
+           max(max, 7/8 * max + 1/2 * min). Relative error between -3.0% and +0.8% (+-1 for truncation).
+@param OutType  The data type of the output
+@param InType   The data type of the input
+@param abs1     Absolute value of the 1. input
+@param abs2     Absolute value of the 2. input
+@return         The approximated magnitude
+*/
+template <typename OutType, typename InType> OutType HypotAlphaMaxBetaMin(InType abs1, InType abs2) {
+#pragma HLS INLINE
+
+    const InType MAX_VAL = static_cast<InType>(ComputeMax<OutType>());
+
+    const InType max_val = MAX(abs1, abs2);
+    const InType min_val = MIN(abs1, abs2);
+    const InType seg = max_val - (max_val >> 3) + (min_val >> 1);
+    const InType result = MAX(max_val, seg);
+
+    return static_cast<OutType>(MIN(result, MAX_VAL));
+}
+
 /*********************************************************************************************************************/
 /* HW: Helper Functions to Create Kernels (COMPILE TIME) */
 /*********************************************************************************************************************/
@@ -243,6 +243,26 @@ enum vx_df_image_e {
      * generated.
      */
     VX_DF_IMAGE_S32 = VX_DF_IMAGE('S', '0', '3', '2'),
+    /*! \brief A 2-plane YUV format of Luma (Y) and interleaved UV data at
+     * 4:2:0 sampling. This uses the BT709 full range by default.
+     */
+    VX_DF_IMAGE_NV12 = VX_DF_IMAGE('N', 'V', '1', '2'),
+    /*! \brief A 2-plane YUV format of Luma (Y) and interleaved VU data at
+     * 4:2:0 sampling. This uses the BT709 full range by default.
+     */
+    VX_DF_IMAGE_NV21 = VX_DF_IMAGE('N', 'V', '2', '1'),
+    /*! \brief A single plane of 32-bit macro pixel of U0, Y0, V0, Y1 bytes.
+     * This uses the BT709 full range by default.
+     */
+    VX_DF_IMAGE_UYVY = VX_DF_IMAGE('U', 'Y', 'V', 'Y'),
+    /*! \brief A single plane of 32-bit macro pixel of Y0, U0, Y1, V0 bytes.
+     * This uses the BT709 full range by default.
+     */
+    VX_DF_IMAGE_YUYV = VX_DF_IMAGE('Y', 'U', 'Y', 'V'),
+    /*! \brief A 3 plane of 8-bit 4:2:0 sampled Y, U, V planes.
+     * This uses the BT709 full range by default.
+     */
+    VX_DF_IMAGE_IYUV = VX_DF_IMAGE('I', 'Y', 'U', 'V'),
 };
 
 /*! \brief The Threshold types.